@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,9 +21,11 @@
 #include "xdp/profile/database/dynamic_event_database.h"
 #include "xdp/profile/database/events/device_events.h"
 
+#include "core/common/message.h"
 #include "core/common/time.h"
 
 #include <iostream>
+#include <sstream>
 
 namespace xdp {
 
@@ -33,6 +35,34 @@ namespace xdp {
     host = std::make_unique<HostDB>();
   }
 
+  VPDynamicDatabase::~VPDynamicDatabase()
+  {
+    auto stats = getEventArenaStatistics();
+    if (stats.chunksAllocated != 0) {
+      std::stringstream msg;
+      msg << "Event arena: " << stats.eventsAllocated << " events ("
+          << stats.bytesAllocated << " bytes) allocated in "
+          << stats.chunksAllocated << " chunks, " << stats.chunksReleased
+          << " chunks released, peak of " << stats.peakLiveChunks
+          << " chunks live, " << stats.largeAllocations
+          << " large allocations";
+      xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
+                              msg.str());
+    }
+
+    auto poolStats = getAIETraceBufferPoolStatistics();
+    if (poolStats.hits + poolStats.misses != 0) {
+      std::stringstream msg;
+      msg << "AIE trace buffer pool: " << poolStats.hits << " hits, "
+          << poolStats.misses << " misses, " << poolStats.recycled
+          << " buffers recycled, " << poolStats.discarded
+          << " buffers discarded, " << poolStats.cachedBytes
+          << " bytes cached";
+      xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
+                              msg.str());
+    }
+  }
+
   // For designs that load multiple xclbins, we add an event into the database
   // to mark when one xclbin is cleaned out and a new one is loaded.
   void VPDynamicDatabase::markXclbinEnd(uint64_t deviceId)
@@ -80,6 +110,14 @@ namespace xdp {
     device_db->addPLTraceEvent(event);
   }
 
+  // The events must already have been issued ids
+  void VPDynamicDatabase::addDeviceEvents(uint64_t deviceId,
+                                          const std::vector<VTFEvent*>& events)
+  {
+    auto device_db = getDeviceDB(deviceId);
+    device_db->addPLTraceEvents(events);
+  }
+
   void VPDynamicDatabase::addEvent(VTFEvent* event)
   {
     if (event == nullptr)
@@ -170,11 +208,23 @@ namespace xdp {
     return host->filterSortedEvents(filter);
   }
 
+  std::vector<VTFEvent*>
+  VPDynamicDatabase::copySortedHostEvents(const CategoryFilter& filter)
+  {
+    return host->filterSortedEvents(filter);
+  }
+
   std::vector<std::unique_ptr<VTFEvent>> VPDynamicDatabase::moveSortedHostEvents(std::function<bool(VTFEvent*)> filter)
   {
     return host->moveSortedEvents(filter);
   }
 
+  std::vector<std::unique_ptr<VTFEvent>>
+  VPDynamicDatabase::moveSortedHostEvents(const CategoryFilter& filter)
+  {
+    return host->moveSortedEvents(filter);
+  }
+
   std::vector<VTFEvent*>
   VPDynamicDatabase::
   moveUnsortedHostEvents(std::function<bool(VTFEvent*)> filter)
@@ -182,11 +232,22 @@ namespace xdp {
     return host->moveUnsortedEvents(filter);
   }
 
+  std::vector<VTFEvent*>
+  VPDynamicDatabase::moveUnsortedHostEvents(const CategoryFilter& filter)
+  {
+    return host->moveUnsortedEvents(filter);
+  }
+
   bool VPDynamicDatabase::hostEventsExist(std::function<bool(VTFEvent*)> filter)
   {
     return host->sortedEventsExist(filter);
   }
 
+  bool VPDynamicDatabase::hostEventsExist(const CategoryFilter& filter)
+  {
+    return host->sortedEventsExist(filter);
+  }
+
   bool VPDynamicDatabase::deviceEventsExist(uint64_t deviceId)
   {
     auto device_db = getDeviceDB(deviceId);
@@ -272,46 +333,39 @@ namespace xdp {
     return device_db->getPowerSamples();
   }
 
-  void VPDynamicDatabase::addAIESample(uint64_t deviceId, double timestamp,
-          const std::vector<uint64_t>& values)
-  {
-    auto device_db = getDeviceDB(deviceId);
-    device_db->addAIESample(timestamp, values);
-  }
-
-  std::vector<counters::Sample>
-  VPDynamicDatabase::getAIESamples(uint64_t deviceId)
+  void VPDynamicDatabase::addAIESample(uint64_t deviceId,
+          const counters::AIESample& sample)
   {
     auto device_db = getDeviceDB(deviceId);
-    return device_db->getAIESamples();
+    device_db->addAIESample(sample);
   }
 
-  std::vector<counters::Sample>
-  VPDynamicDatabase::moveAIESamples(uint64_t deviceId)
+  void VPDynamicDatabase::consumeAIESamples(uint64_t deviceId,
+    const std::function<void (const counters::AIESample*, std::size_t)>& consumer)
   {
     auto device_db = getDeviceDB(deviceId);
-    return device_db->moveAIESamples();
+    device_db->consumeAIESamples(consumer);
   }
 
-  void VPDynamicDatabase::addAIEDebugSample(uint64_t deviceId, uint8_t col,
-          uint8_t row, uint32_t value, uint64_t offset, std::string name) 
+  void VPDynamicDatabase::addAIEDebugBlock(uint64_t deviceId,
+                                           aie::AIEDebugBlock&& block)
   {
     auto device_db = getDeviceDB(deviceId);
-    device_db->addAIEDebugSample(col, row, value, offset, name);
+    device_db->addAIEDebugBlock(std::move(block));
   }
 
-  std::vector<xdp::aie::AIEDebugDataType>
-  VPDynamicDatabase::getAIEDebugSamples(uint64_t deviceId)
+  std::vector<xdp::aie::AIEDebugBlock>
+  VPDynamicDatabase::getAIEDebugBlocks(uint64_t deviceId)
   {
     auto device_db = getDeviceDB(deviceId);
-    return device_db->getAIEDebugSamples();
+    return device_db->getAIEDebugBlocks();
   }
 
-  std::vector<xdp::aie::AIEDebugDataType>
-  VPDynamicDatabase::moveAIEDebugSamples(uint64_t deviceId)
+  std::vector<xdp::aie::AIEDebugBlock>
+  VPDynamicDatabase::moveAIEDebugBlocks(uint64_t deviceId)
   {
     auto device_db = getDeviceDB(deviceId);
-    return device_db->moveAIEDebugSamples();
+    return device_db->moveAIEDebugBlocks();
   }
 
   void VPDynamicDatabase::addAIETimerSample(uint64_t deviceId, unsigned long timestamp1,
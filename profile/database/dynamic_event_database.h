@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -24,16 +24,19 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string_view>
 #include <vector>
 
 #include "core/common/uuid.h"
 #include "core/include/xdp/counters.h"
 
 #include "xdp/config.h"
+#include "xdp/profile/database/dynamic_info/aie_trace_buffer_pool.h"
 #include "xdp/profile/database/dynamic_info/device_db.h"
 #include "xdp/profile/database/dynamic_info/host_db.h"
 #include "xdp/profile/database/dynamic_info/string_table.h"
 #include "xdp/profile/database/dynamic_info/types.h"
+#include "xdp/profile/database/events/event_arena.h"
 #include "xdp/profile/database/events/vtf_event.h"
 #include "xdp/profile/database/static_info/aie_constructs.h"
 
@@ -70,7 +73,6 @@ namespace xdp {
     // and device events.  It starts with 1 so we can use 0 as an
     // indicator of NULL.
     std::atomic<uint64_t> eventId;
-    void issueId(VTFEvent* event);
 
     // For all strings associated with events, we keep only one unique
     // copy and will use uint64_t numbers as references instead.
@@ -83,7 +85,7 @@ namespace xdp {
 
   public:
     XDP_CORE_EXPORT VPDynamicDatabase(VPDatabase* d);
-    XDP_CORE_EXPORT ~VPDynamicDatabase() = default;
+    XDP_CORE_EXPORT ~VPDynamicDatabase();
 
     // For multiple xclbin designs, add a device event that marks the
     // transition from one xclbin to another
@@ -95,6 +97,13 @@ namespace xdp {
     // Add an event to the database to be sorted later when we write
     XDP_CORE_EXPORT void addUnsortedEvent(VTFEvent* event);
 
+    // Device trace decoders create events on several threads and need
+    // their ids right away to match starts with ends.  They issue the
+    // ids as events are created and add the events later in one batch.
+    XDP_CORE_EXPORT void issueId(VTFEvent* event);
+    XDP_CORE_EXPORT void addDeviceEvents(uint64_t deviceId,
+                                         const std::vector<VTFEvent*>& events);
+
     // For API events, find the event id of the start event for an end event
     XDP_CORE_EXPORT void markStart(uint64_t functionID, uint64_t eventID) ;
     XDP_CORE_EXPORT uint64_t matchingStart(uint64_t functionID) ;
@@ -129,22 +138,31 @@ namespace xdp {
 
     // A lookup into the string table.  If the string isn't already in
     // the string table it will be added
-    inline uint64_t addString(const std::string& value)
+    inline uint64_t addString(std::string_view value)
     { return stringTable.addString(value); }
 
+    // The same lookup for string literals, which is cached per thread
+    inline uint64_t addStaticString(const char* literal)
+    { return stringTable.addStaticString(literal); }
+
     // A function that iterates on the dynamic events and returns
     // copies of the events based upon the filter passed in
     XDP_CORE_EXPORT
     std::vector<VTFEvent*>
     copySortedHostEvents(std::function<bool(VTFEvent*)> filter);
+    XDP_CORE_EXPORT
+    std::vector<VTFEvent*> copySortedHostEvents(const CategoryFilter& filter);
 
     // Erase events from db and transfer ownership to caller
     XDP_CORE_EXPORT std::vector<std::unique_ptr<VTFEvent>> moveSortedHostEvents(std::function<bool(VTFEvent*)> filter);
+    XDP_CORE_EXPORT std::vector<std::unique_ptr<VTFEvent>> moveSortedHostEvents(const CategoryFilter& filter);
     XDP_CORE_EXPORT std::vector<VTFEvent*> moveUnsortedHostEvents(std::function<bool(VTFEvent*)> filter);
+    XDP_CORE_EXPORT std::vector<VTFEvent*> moveUnsortedHostEvents(const CategoryFilter& filter);
     XDP_CORE_EXPORT std::vector<std::unique_ptr<VTFEvent>> moveDeviceEvents(uint64_t deviceId);
 
     XDP_CORE_EXPORT bool deviceEventsExist(uint64_t deviceId);
     XDP_CORE_EXPORT bool hostEventsExist(std::function<bool(VTFEvent*)> filter);
+    XDP_CORE_EXPORT bool hostEventsExist(const CategoryFilter& filter);
 
     XDP_CORE_EXPORT void setCounterResults(uint64_t deviceId,
 				      xrt_core::uuid uuid,
@@ -152,6 +170,15 @@ namespace xdp {
     XDP_CORE_EXPORT xdp::CounterResults getCounterResults(uint64_t deviceId,
                                                      xrt_core::uuid uuid) ;
 
+    // How much work the event arena has done on behalf of the host and
+    // device event storage
+    inline EventArenaStatistics getEventArenaStatistics()
+    { return EventArena::getStatistics(); }
+
+    // How often copies of AIE trace reused a pooled buffer
+    inline AIETraceBufferPoolStatistics getAIETraceBufferPoolStatistics()
+    { return AIETraceBufferPool::getStatistics(); }
+
     // A function that each writer calls to dump the string table
     inline void dumpStringTable(std::ofstream& fout)
     { stringTable.dumpTable(fout); }
@@ -173,14 +200,17 @@ namespace xdp {
 				   const std::vector<uint64_t>& values) ;
     XDP_CORE_EXPORT std::vector<counters::Sample> getPowerSamples(uint64_t deviceId) ;
 
-    XDP_CORE_EXPORT void addAIESample(uint64_t deviceId, double timestamp,
-				   const std::vector<uint64_t>& values);
-    XDP_CORE_EXPORT void addAIEDebugSample(uint64_t deviceId, uint8_t col,
-           uint8_t row,  uint32_t value, uint64_t offset, std::string name);
-    XDP_CORE_EXPORT std::vector<xdp::aie::AIEDebugDataType> moveAIEDebugSamples(uint64_t deviceId);
-    XDP_CORE_EXPORT std::vector<xdp::aie::AIEDebugDataType> getAIEDebugSamples(uint64_t deviceId);
-    XDP_CORE_EXPORT std::vector<counters::Sample> getAIESamples(uint64_t deviceId) ;
-    XDP_CORE_EXPORT std::vector<counters::Sample> moveAIESamples(uint64_t deviceId);
+    XDP_CORE_EXPORT void addAIESample(uint64_t deviceId,
+                                      const counters::AIESample& sample);
+    // AIE debug reads are added one tile at a time
+    XDP_CORE_EXPORT void addAIEDebugBlock(uint64_t deviceId,
+                                          aie::AIEDebugBlock&& block);
+    XDP_CORE_EXPORT std::vector<xdp::aie::AIEDebugBlock> moveAIEDebugBlocks(uint64_t deviceId);
+    XDP_CORE_EXPORT std::vector<xdp::aie::AIEDebugBlock> getAIEDebugBlocks(uint64_t deviceId);
+    // Hand the AIE samples recorded so far to the consumer without
+    // copying them.  The pointers are only valid during the call.
+    XDP_CORE_EXPORT void consumeAIESamples(uint64_t deviceId,
+      const std::function<void (const counters::AIESample*, std::size_t)>& consumer);
     XDP_CORE_EXPORT void addAIETimerSample(uint64_t deviceId, unsigned long timestamp1,
 				   unsigned long timestamp2, const std::vector<uint64_t>& values) ;
     XDP_CORE_EXPORT std::vector<counters::DoubleSample> getAIETimerSamples(uint64_t deviceId) ;
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,15 +21,25 @@
 #include "core/common/message.h"
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/database/dynamic_info/aie_db.h"
+#include "xdp/profile/database/dynamic_info/aie_trace_buffer_pool.h"
 
 namespace xdp {
 
   AIEDB::~AIEDB()
   {
     std::lock_guard<std::mutex> lock(traceLock);
-    for (auto& [offloadType, traceData] : traceDataMap)
-      for (auto info : traceData)
+    for (auto& [offloadType, traceData] : traceDataMap) {
+      for (auto info : traceData) {
+        if (info == nullptr)
+          continue;
+        // Data that no writer picked up
+        if (info->owner) {
+          for (size_t i = 0; i < info->buffer.size(); ++i)
+            AIETraceBufferPool::release(info->buffer[i], info->bufferSz[i]);
+        }
         delete info;
+      }
+    }
     traceDataMap.clear();
   }
 
@@ -52,8 +62,9 @@ namespace xdp {
 
     unsigned char* trace_buffer = static_cast<unsigned char*>(buffer);
     if (copy) {
-      // We need to copy data as it may be overwritten by datamover
-      trace_buffer = new unsigned char[bufferSz];
+      // We need to copy data as it may be overwritten by datamover.
+      // The writer hands the copy back to the pool once it is dumped.
+      trace_buffer = AIETraceBufferPool::acquire(bufferSz);
       std::memcpy(trace_buffer, buffer, bufferSz);
     }
     traceData[strmIndex]->buffer.push_back(trace_buffer);
@@ -77,10 +88,9 @@ namespace xdp {
     return data;
   }
 
-  void AIEDB::addAIESample(double timestamp, const std::vector<uint64_t>& values)
+  void AIEDB::addAIESample(const counters::AIESample& sample)
   {
-      samples.addSample({timestamp, values});
-      if (samples.getSamplesSize() > sampleThreshold) {
+      if (samples.add(sample) > sampleThreshold) {
         std::string msg = "AIE profiling sample limit reached, writing data to disk.";
         xrt_core::message::send(xrt_core::message::severity_level::info, "XRT", msg);
         VPDatabase::Instance()->broadcast(VPDatabase::DUMP_AIE_PROFILE);
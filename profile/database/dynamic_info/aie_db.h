@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,12 +17,15 @@
 #ifndef AIE_DB_DOT_H
 #define AIE_DB_DOT_H
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <vector>
 
 #include "xdp/config.h"
+#include "xdp/profile/database/dynamic_info/aie_sample_ring.h"
 #include "xdp/profile/database/dynamic_info/samples.h"
 #include "xdp/profile/database/dynamic_info/types.h"
 #include "xdp/profile/database/static_info/aie_constructs.h"
@@ -37,7 +40,7 @@ namespace xdp {
     // aie::TraceDataVector traceData;
     std::map<io_type, aie::TraceDataVector> traceDataMap;
 
-    SampleContainer samples;
+    AIESampleRing samples;
     DoubleSampleContainer timerSamples;
     AIEDebugContainer aieDebugSamples;
 
@@ -54,7 +57,7 @@ namespace xdp {
                          bool copy, uint64_t numTraceStreams, io_type offloadType);
     aie::TraceDataType* getAIETraceData(uint64_t strmIndex, io_type offloadType);
 
-    void addAIESample(double timestamp, const std::vector<uint64_t>& values);
+    void addAIESample(const counters::AIESample& sample);
 
     inline
     void addAIETimerSample(unsigned long timestamp1, unsigned long timestamp2,
@@ -62,16 +65,13 @@ namespace xdp {
     { timerSamples.addSample({timestamp1, timestamp2, values}); }
 
     inline
-    void addAIEDebugSample(uint8_t col, uint8_t row, uint32_t value, uint64_t offset, std::string name)
-    { aieDebugSamples.addAIEDebugData({col, row, value, offset, name}); }
+    void addAIEDebugBlock(aie::AIEDebugBlock&& block)
+    { aieDebugSamples.addAIEDebugBlock(std::move(block)); }
 
     inline
-    std::vector<counters::Sample> getAIESamples()
-    { return samples.getSamples();  }
-
-    inline
-    std::vector<counters::Sample> moveAIESamples()
-    { return samples.moveSamples(); }
+    void consumeAIESamples(const std::function<void (const counters::AIESample*,
+                                                     std::size_t)>& consumer)
+    { samples.consume(consumer); }
 
     inline
     std::vector<counters::DoubleSample> getAIETimerSamples()
@@ -82,12 +82,12 @@ namespace xdp {
     { return timerSamples.moveSamples();  }
 
     inline
-    std::vector<xdp::aie::AIEDebugDataType> getAIEDebugSamples()
-    { return aieDebugSamples.getAIEDebugData();  }
+    std::vector<xdp::aie::AIEDebugBlock> getAIEDebugBlocks()
+    { return aieDebugSamples.getAIEDebugBlocks();  }
 
     inline
-    std::vector<xdp::aie::AIEDebugDataType> moveAIEDebugSamples()
-    { return aieDebugSamples.moveAIEDebugData(); }
+    std::vector<xdp::aie::AIEDebugBlock> moveAIEDebugBlocks()
+    { return aieDebugSamples.moveAIEDebugBlocks(); }
   };
 
 } // end namespace xdp
@@ -0,0 +1,100 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include "xdp/profile/database/dynamic_info/aie_sample_ring.h"
+
+namespace xdp {
+
+  AIESampleRing::AIESampleRing() : head(new Block), tail(head)
+  {
+  }
+
+  AIESampleRing::~AIESampleRing()
+  {
+    while (head != nullptr) {
+      auto next = head->next.load(std::memory_order_relaxed);
+      delete head;
+      head = next;
+    }
+    for (auto block : freeBlocks)
+      delete block;
+  }
+
+  AIESampleRing::Block* AIESampleRing::getFreeBlock()
+  {
+    {
+      std::lock_guard<std::mutex> lock(freeLock);
+      if (!freeBlocks.empty()) {
+        auto block = freeBlocks.back();
+        freeBlocks.pop_back();
+        return block;
+      }
+    }
+    return new Block;
+  }
+
+  uint64_t AIESampleRing::add(const counters::AIESample& sample)
+  {
+    std::lock_guard<std::mutex> lock(producerLock);
+
+    auto index = tail->count.load(std::memory_order_relaxed);
+    if (index == blockSize) {
+      auto block = getFreeBlock();
+      tail->next.store(block, std::memory_order_release);
+      tail = block;
+      index = 0;
+    }
+    tail->slots[index] = sample;
+    tail->count.store(index + 1, std::memory_order_release);
+    return ++pending;
+  }
+
+  void AIESampleRing::consume(const std::function<void (const counters::AIESample*,
+                                                        std::size_t)>& consumer)
+  {
+    std::lock_guard<std::mutex> lock(consumerLock);
+
+    while (true) {
+      auto available = head->count.load(std::memory_order_acquire);
+      if (readIndex < available) {
+        consumer(&(head->slots[readIndex]), available - readIndex);
+        pending -= (available - readIndex);
+        readIndex = available;
+      }
+
+      if (readIndex < blockSize)
+        return;
+
+      // The producer only links a new block once it has filled this one
+      // and never touches a full block again, so it can be reused.
+      auto next = head->next.load(std::memory_order_acquire);
+      if (next == nullptr)
+        return;
+
+      head->count.store(0, std::memory_order_relaxed);
+      head->next.store(nullptr, std::memory_order_relaxed);
+      {
+        std::lock_guard<std::mutex> freeGuard(freeLock);
+        freeBlocks.push_back(head);
+      }
+      head = next;
+      readIndex = 0;
+    }
+  }
+
+} // end namespace xdp
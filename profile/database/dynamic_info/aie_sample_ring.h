@@ -0,0 +1,91 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef AIE_SAMPLE_RING_DOT_H
+#define AIE_SAMPLE_RING_DOT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "xdp/profile/database/dynamic_info/types.h"
+
+namespace xdp {
+
+  // AIE profile counters are read by a polling thread at short intervals
+  // and written out by whichever thread dumps the profile.  Samples are
+  // stored in place in a ring of preallocated blocks.  The polling
+  // thread fills blocks while the writer reads the filled part of the
+  // ring directly, and blocks the writer is done with are recycled, so
+  // once the ring has grown to its working size recording a sample
+  // never allocates.
+  class AIESampleRing
+  {
+  private:
+    static constexpr std::size_t blockSize = 1024;
+
+    // The producer publishes each slot by bumping "count", and links a
+    // new block through "next" only after the current one is full.
+    struct Block
+    {
+      counters::AIESample slots[blockSize];
+      std::atomic<std::size_t> count{0};
+      std::atomic<Block*> next{nullptr};
+    };
+
+    Block* head;               // Only touched by the consumer
+    std::size_t readIndex = 0; // Only touched by the consumer
+    Block* tail;               // Only touched by the producer
+
+    // Samples added but not yet consumed
+    std::atomic<uint64_t> pending{0};
+
+    // Blocks the consumer has finished with, ready to be reused
+    std::vector<Block*> freeBlocks;
+    std::mutex freeLock; // Protects the "freeBlocks" vector
+
+    // There is normally one polling thread per device, so these are
+    // not contended.  They keep the ring single producer/single consumer.
+    std::mutex producerLock;
+    std::mutex consumerLock;
+
+    Block* getFreeBlock();
+
+  public:
+    AIESampleRing();
+    ~AIESampleRing();
+
+    AIESampleRing(const AIESampleRing&) = delete;
+    AIESampleRing& operator=(const AIESampleRing&) = delete;
+
+    // Returns the number of samples waiting to be consumed
+    uint64_t add(const counters::AIESample& sample);
+
+    inline uint64_t size() const { return pending.load(); }
+
+    // Hand every sample added so far to the consumer, in order, as
+    // contiguous runs that point into the ring itself.  The runs are
+    // only valid during the call.
+    void consume(const std::function<void (const counters::AIESample*,
+                                           std::size_t)>& consumer);
+  };
+
+} // end namespace xdp
+
+#endif
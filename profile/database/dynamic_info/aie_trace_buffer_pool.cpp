@@ -0,0 +1,164 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "xdp/profile/database/dynamic_info/aie_trace_buffer_pool.h"
+
+namespace xdp {
+
+  namespace {
+
+    constexpr int classesPerDoubling = 4;
+
+    struct SizeClass
+    {
+      uint64_t size;
+      std::mutex lock;
+      std::vector<unsigned char*> freeList;
+    };
+
+    struct PoolState
+    {
+      std::vector<SizeClass> classes;
+      std::atomic<uint64_t> cachedBytes{0};
+
+      std::atomic<uint64_t> hits{0};
+      std::atomic<uint64_t> misses{0};
+      std::atomic<uint64_t> recycled{0};
+      std::atomic<uint64_t> discarded{0};
+
+      PoolState()
+      {
+        std::vector<uint64_t> sizes;
+        for (uint64_t base = AIETraceBufferPool::minClassSize;
+             base < AIETraceBufferPool::maxClassSize; base *= 2) {
+          for (int step = 0; step < classesPerDoubling; ++step)
+            sizes.push_back(base + (base / classesPerDoubling) * step);
+        }
+        sizes.push_back(AIETraceBufferPool::maxClassSize);
+
+        classes = std::vector<SizeClass>(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+          classes[i].size = sizes[i];
+      }
+    };
+
+    // Trace buffers can still be released by writers that run while
+    // the library is being unloaded, so the pool is never destroyed.
+    PoolState& state()
+    {
+      static PoolState* pool = new PoolState;
+      return *pool;
+    }
+
+    SizeClass* classFor(PoolState& pool, uint64_t size)
+    {
+      if (size == 0 || size > AIETraceBufferPool::maxClassSize)
+        return nullptr;
+
+      auto sizeClass =
+        std::lower_bound(pool.classes.begin(), pool.classes.end(), size,
+                         [](const SizeClass& c, uint64_t s) { return c.size < s; });
+      return &(*sizeClass);
+    }
+
+  } // end anonymous namespace
+
+  unsigned char* AIETraceBufferPool::acquire(uint64_t size)
+  {
+    auto& pool = state();
+    auto sizeClass = classFor(pool, size);
+    if (sizeClass == nullptr) {
+      ++pool.misses;
+      return new unsigned char[size];
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(sizeClass->lock);
+      if (!sizeClass->freeList.empty()) {
+        auto buffer = sizeClass->freeList.back();
+        sizeClass->freeList.pop_back();
+        pool.cachedBytes -= sizeClass->size;
+        ++pool.hits;
+        return buffer;
+      }
+    }
+
+    ++pool.misses;
+    return new unsigned char[sizeClass->size];
+  }
+
+  void AIETraceBufferPool::release(unsigned char* buffer, uint64_t size)
+  {
+    if (buffer == nullptr)
+      return;
+
+    auto& pool = state();
+    auto sizeClass = classFor(pool, size);
+    if (sizeClass == nullptr) {
+      delete [] buffer;
+      return;
+    }
+
+    // Reserve room in the cache before putting the buffer on the list so
+    // concurrent releases cannot push the pool over its limit
+    auto cached = pool.cachedBytes.fetch_add(sizeClass->size);
+    if (cached + sizeClass->size > maxCachedBytes) {
+      pool.cachedBytes -= sizeClass->size;
+      ++pool.discarded;
+      delete [] buffer;
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(sizeClass->lock);
+    sizeClass->freeList.push_back(buffer);
+    ++pool.recycled;
+  }
+
+  void AIETraceBufferPool::trim()
+  {
+    auto& pool = state();
+    for (auto& sizeClass : pool.classes) {
+      std::vector<unsigned char*> buffers;
+      {
+        std::lock_guard<std::mutex> lock(sizeClass.lock);
+        buffers.swap(sizeClass.freeList);
+      }
+      pool.cachedBytes -= sizeClass.size * buffers.size();
+      for (auto buffer : buffers)
+        delete [] buffer;
+    }
+  }
+
+  AIETraceBufferPoolStatistics AIETraceBufferPool::getStatistics()
+  {
+    auto& pool = state();
+    AIETraceBufferPoolStatistics stats;
+    stats.hits        = pool.hits.load();
+    stats.misses      = pool.misses.load();
+    stats.recycled    = pool.recycled.load();
+    stats.discarded   = pool.discarded.load();
+    stats.cachedBytes = pool.cachedBytes.load();
+    return stats;
+  }
+
+} // end namespace xdp
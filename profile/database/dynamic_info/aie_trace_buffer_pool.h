@@ -0,0 +1,65 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef AIE_TRACE_BUFFER_POOL_DOT_H
+#define AIE_TRACE_BUFFER_POOL_DOT_H
+
+#include <cstdint>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  struct AIETraceBufferPoolStatistics
+  {
+    uint64_t hits;        // Buffers handed out from a free list
+    uint64_t misses;      // Buffers that had to come from the system
+    uint64_t recycled;    // Buffers put back on a free list
+    uint64_t discarded;   // Buffers freed because the pool was full
+    uint64_t cachedBytes; // Bytes currently sitting on free lists
+  };
+
+  // Copies of AIE trace made at offload time live until the writer has
+  // dumped them, and then are released back here instead of being
+  // deleted.  Buffers are rounded up to one of four size classes per
+  // power of two so chunks of slightly different sizes from the same
+  // stream share a free list.  The next copy of the same size then
+  // reuses memory whose pages are already mapped rather than paying for
+  // a fresh mmap and its page faults.  Sizes outside the classes go
+  // straight to the system allocator.
+  class AIETraceBufferPool
+  {
+  public:
+    static constexpr uint64_t minClassSize = 4 * 1024;
+    static constexpr uint64_t maxClassSize = 64 * 1024 * 1024;
+    // Free buffers beyond this are given back to the system
+    static constexpr uint64_t maxCachedBytes = 256 * 1024 * 1024;
+
+    // The buffer has room for at least size bytes.  It must be released
+    // with the same size it was acquired with.
+    XDP_CORE_EXPORT static unsigned char* acquire(uint64_t size);
+    XDP_CORE_EXPORT static void release(unsigned char* buffer, uint64_t size);
+
+    // Give every cached buffer back to the system.  Called once trace
+    // has been written out, so an idle pool holds no memory.
+    XDP_CORE_EXPORT static void trim();
+
+    XDP_CORE_EXPORT static AIETraceBufferPoolStatistics getStatistics();
+  };
+
+} // end namespace xdp
+
+#endif
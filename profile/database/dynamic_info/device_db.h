@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,6 +17,7 @@
 #ifndef DEVICE_DB_DOT_H
 #define DEVICE_DB_DOT_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -59,6 +60,8 @@ namespace xdp {
     // inlined accesses to the PL database object.
     // ****************************************************************
     inline void addPLTraceEvent(VTFEvent* event) { pl_db.addEvent(event); }
+    inline void addPLTraceEvents(const std::vector<VTFEvent*>& events)
+    { pl_db.addEvents(events); }
     inline bool eventsExist() { return pl_db.eventsExist(); }
 
     inline std::vector<std::unique_ptr<VTFEvent>> moveEvents()
@@ -105,22 +108,21 @@ namespace xdp {
     { return aie_db.getAIETraceData(strmIndex, offloadType);  }
 
     inline
-    void addAIESample(double timestamp, const std::vector<uint64_t>& values)
-    { aie_db.addAIESample(timestamp, values);  }
+    void addAIESample(const counters::AIESample& sample)
+    { aie_db.addAIESample(sample);  }
 
     void addAIETimerSample(unsigned long timestamp1, unsigned long timestamp2,
                            const std::vector<uint64_t>& values)
     { aie_db.addAIETimerSample(timestamp1, timestamp2, values);  }
 
     inline
-    void addAIEDebugSample(uint8_t col, uint8_t row, uint32_t value, uint64_t offset, std::string name)
-    { aie_db.addAIEDebugSample(col, row, value, offset, name);  }
+    void addAIEDebugBlock(aie::AIEDebugBlock&& block)
+    { aie_db.addAIEDebugBlock(std::move(block));  }
 
-    inline std::vector<counters::Sample> getAIESamples()
-    { return aie_db.getAIESamples();  }
-
-    inline std::vector<counters::Sample> moveAIESamples()
-    { return aie_db.moveAIESamples(); }
+    inline
+    void consumeAIESamples(const std::function<void (const counters::AIESample*,
+                                                     std::size_t)>& consumer)
+    { aie_db.consumeAIESamples(consumer); }
 
     inline std::vector<counters::DoubleSample> getAIETimerSamples()
     { return aie_db.getAIETimerSamples();  }
@@ -135,11 +137,11 @@ namespace xdp {
     { return pl_db.getDeadlockInfo(); }
 
     inline
-    std::vector<xdp::aie::AIEDebugDataType> getAIEDebugSamples()
-    { return aie_db.getAIEDebugSamples();  }
+    std::vector<xdp::aie::AIEDebugBlock> getAIEDebugBlocks()
+    { return aie_db.getAIEDebugBlocks();  }
 
-    inline std::vector<xdp::aie::AIEDebugDataType> moveAIEDebugSamples()
-    { return aie_db.moveAIEDebugSamples(); }
+    inline std::vector<xdp::aie::AIEDebugBlock> moveAIEDebugBlocks()
+    { return aie_db.moveAIEDebugBlocks(); }
 
 
   };
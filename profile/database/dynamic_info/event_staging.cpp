@@ -0,0 +1,133 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <utility>
+
+#include "xdp/profile/database/dynamic_info/event_staging.h"
+
+namespace xdp {
+
+  namespace {
+
+    std::atomic<uint64_t> nextInstanceId{1};
+
+  } // end anonymous namespace
+
+  EventStaging::Ring::Ring() : head(new Block), tail(head)
+  {
+  }
+
+  EventStaging::Ring::~Ring()
+  {
+    while (head != nullptr) {
+      auto next = head->next.load(std::memory_order_relaxed);
+      delete head;
+      head = next;
+    }
+  }
+
+  void EventStaging::Ring::append(VTFEvent* event)
+  {
+    auto index = tail->count.load(std::memory_order_relaxed);
+    if (index == blockSize) {
+      auto block = new Block;
+      tail->next.store(block, std::memory_order_release);
+      tail = block;
+      index = 0;
+    }
+    tail->slots[index] = event;
+    tail->count.store(index + 1, std::memory_order_release);
+  }
+
+  void EventStaging::Ring::drain(const std::function<void (VTFEvent*)>& consumer)
+  {
+    while (true) {
+      auto available = head->count.load(std::memory_order_acquire);
+      for (; readIndex < available; ++readIndex)
+        consumer(head->slots[readIndex]);
+
+      if (readIndex < blockSize)
+        return;
+
+      // The producer only links a new block once it has filled this one
+      // and never touches a full block again, so it is safe to free.
+      auto next = head->next.load(std::memory_order_acquire);
+      if (next == nullptr)
+        return;
+      delete head;
+      head = next;
+      readIndex = 0;
+    }
+  }
+
+  struct EventStaging::ThreadRings
+  {
+    std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> entries;
+
+    ~ThreadRings()
+    {
+      for (auto& entry : entries)
+        entry.second->retired.store(true, std::memory_order_release);
+    }
+  };
+
+  EventStaging::EventStaging() : instanceId(nextInstanceId++)
+  {
+  }
+
+  EventStaging::Ring* EventStaging::getThreadRing()
+  {
+    // Each thread remembers the ring it was given by every instance it
+    // has appended to.  In practice this is only a couple of entries.
+    thread_local ThreadRings cache;
+
+    for (auto& entry : cache.entries) {
+      if (entry.first == instanceId)
+        return entry.second.get();
+    }
+
+    auto ring = std::make_shared<Ring>();
+    {
+      std::lock_guard<std::mutex> lock(ringLock);
+      rings.push_back(ring);
+    }
+    cache.entries.emplace_back(instanceId, ring);
+    return ring.get();
+  }
+
+  void EventStaging::append(VTFEvent* event)
+  {
+    getThreadRing()->append(event);
+  }
+
+  void EventStaging::drain(const std::function<void (VTFEvent*)>& consumer)
+  {
+    std::lock_guard<std::mutex> lock(ringLock);
+    for (auto iter = rings.begin(); iter != rings.end(); ) {
+      // Check before draining so every event the thread appended
+      // before it exited is seen by this drain
+      bool retired = (*iter)->retired.load(std::memory_order_acquire);
+      (*iter)->drain(consumer);
+      if (retired)
+        iter = rings.erase(iter);
+      else
+        ++iter;
+    }
+  }
+
+} // end namespace xdp
@@ -0,0 +1,106 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef EVENT_STAGING_DOT_H
+#define EVENT_STAGING_DOT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace xdp {
+
+  // Forward declarations
+  class VTFEvent;
+
+  // Host events are generated by callbacks on every application thread
+  // that calls into XRT.  Instead of having all of those threads fight
+  // over a single lock, each thread appends its events to its own
+  // staging ring.  Each ring has exactly one producer (the thread that
+  // owns it) and one consumer (whichever thread is dumping the database),
+  // so appending an event never waits on another thread.  The events are
+  // merged into the final containers when the database is drained.
+  class EventStaging
+  {
+  private:
+    static constexpr std::size_t blockSize = 1024;
+
+    // Rings are built out of fixed-size blocks chained together.  The
+    // producer publishes each slot by bumping "count", and links a new
+    // block through "next" only after the current one is full.
+    struct Block
+    {
+      VTFEvent* slots[blockSize];
+      std::atomic<std::size_t> count{0};
+      std::atomic<Block*> next{nullptr};
+    };
+
+    struct Ring
+    {
+      Block* head;               // Only touched by the consumer
+      std::size_t readIndex = 0; // Only touched by the consumer
+      Block* tail;               // Only touched by the producer
+
+      // Set when the owning thread exits.  Nothing is appended after
+      // that, so once drained the ring can be freed.
+      std::atomic<bool> retired{false};
+
+      Ring();
+      ~Ring();
+
+      void append(VTFEvent* event);
+      void drain(const std::function<void (VTFEvent*)>& consumer);
+    };
+
+    // Each instance gets a unique id so that a ring a thread has cached
+    // is never confused with one belonging to a destroyed instance
+    // that happened to live at the same address.
+    const uint64_t instanceId;
+
+    // Rings are shared with the thread_local list of the thread that
+    // appends to them, so either side can go away first
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    // Every ring a thread has been given, one per instance.  Its
+    // destructor runs when the thread exits and retires them all.
+    struct ThreadRings;
+
+    // Taken once per thread when its ring is first created, and by
+    // drain.  Holding it for the whole drain also guarantees there is
+    // only ever one consumer for each ring.
+    std::mutex ringLock;
+
+    Ring* getThreadRing();
+
+  public:
+    EventStaging();
+    ~EventStaging() = default;
+
+    void append(VTFEvent* event);
+
+    // Hand every staged event, from every thread, to the consumer.
+    // Events staged by a single thread are handed over in the order
+    // they were appended.
+    void drain(const std::function<void (VTFEvent*)>& consumer);
+  };
+
+} // end namespace xdp
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef EVENT_STORE_DOT_H
+#define EVENT_STORE_DOT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "xdp/profile/database/events/vtf_event.h"
+
+namespace xdp {
+
+  // The fixed-size record the database keeps for every stored event.
+  // Everything needed to order and filter events lives in the record,
+  // so scanning the store never has to touch the event objects
+  // themselves.  The event object is only the payload used when dumping.
+  struct EventRecord
+  {
+    double timestamp;
+    VTFEvent* event;
+    uint32_t categories;
+    VTFEventType type;
+  };
+
+  // A flat array of event records.  When the store is sorted, records
+  // are kept in timestamp order (events with the same timestamp stay in
+  // the order they were added), but sorting is deferred until the
+  // records are read so adding an event is just an append.
+  class EventStore
+  {
+  private:
+    std::vector<EventRecord> records;
+
+    // For sorted stores, records[0, sortedCount) are already in order.
+    std::size_t sortedCount = 0;
+    bool keepSorted;
+
+    inline void sort()
+    {
+      if (!keepSorted || sortedCount == records.size())
+        return;
+
+      auto byTimestamp = [](const EventRecord& l, const EventRecord& r)
+                         { return l.timestamp < r.timestamp; };
+      auto middle = records.begin() + sortedCount;
+      std::stable_sort(middle, records.end(), byTimestamp);
+      std::inplace_merge(records.begin(), middle, records.end(), byTimestamp);
+      sortedCount = records.size();
+    }
+
+  public:
+    explicit EventStore(bool sorted) : keepSorted(sorted) {}
+    ~EventStore() = default;
+
+    inline void add(VTFEvent* event)
+    {
+      records.push_back({event->getTimestamp(), event,
+                         event->categorize(), event->getEventType()});
+    }
+
+    inline std::size_t size() const { return records.size(); }
+    inline bool empty() const { return records.empty(); }
+
+    template <typename Predicate>
+    bool anyOf(Predicate matches)
+    {
+      return std::any_of(records.begin(), records.end(), matches);
+    }
+
+    // Return the events that match, in order, leaving them in the store.
+    template <typename Predicate>
+    std::vector<VTFEvent*> collect(Predicate matches)
+    {
+      sort();
+      std::vector<VTFEvent*> collected;
+      for (auto& record : records) {
+        if (matches(record))
+          collected.push_back(record.event);
+      }
+      return collected;
+    }
+
+    // Return the events that match, in order, and remove them from the
+    // store.  Ownership of the returned events passes to the caller.
+    template <typename Predicate>
+    std::vector<VTFEvent*> extract(Predicate matches)
+    {
+      sort();
+      std::vector<VTFEvent*> collected;
+      std::size_t kept = 0;
+      for (auto& record : records) {
+        if (matches(record))
+          collected.push_back(record.event);
+        else
+          records[kept++] = record;
+      }
+      records.resize(kept);
+      sortedCount = records.size();
+      return collected;
+    }
+
+    // Delete every event still held by the store
+    inline void clear()
+    {
+      for (auto& record : records)
+        delete record.event;
+      records.clear();
+      sortedCount = 0;
+    }
+  };
+
+} // end namespace xdp
+
+#endif
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,35 +18,72 @@
 
 #include "xdp/profile/database/dynamic_info/host_db.h"
 #include "xdp/profile/database/events/vtf_event.h"
-#include <algorithm>
 
 namespace xdp {
 
+  namespace {
+
+    // Wrap the different kinds of filters into predicates on the
+    // records stored in the database.
+    inline auto byEvent(std::function<bool (VTFEvent*)>& filter)
+    {
+      return [&filter](const EventRecord& r) { return filter(r.event); };
+    }
+
+    inline auto byCategory(const CategoryFilter& filter)
+    {
+      return [filter](const EventRecord& r)
+             { return filter.matches(r.categories); };
+    }
+
+    inline std::vector<std::unique_ptr<VTFEvent>>
+    takeOwnership(const std::vector<VTFEvent*>& events)
+    {
+      std::vector<std::unique_ptr<VTFEvent>> owned;
+      owned.reserve(events.size());
+      for (auto event : events)
+        owned.emplace_back(event);
+      return owned;
+    }
+
+  } // end anonymous namespace
+
   HostDB::~HostDB()
   {
     // Delete sorted events still in the database and not moved
     {
       std::lock_guard<std::mutex> lock(sortedLock);
-      for (auto& iter : sortedEvents) {
-        auto event = iter.second;
-        delete event;
-      }
+      mergeSortedStaging();
+      sortedEvents.clear();
     }
     // Delete unsorted events still in the database and not moved
     {
       std::lock_guard<std::mutex> lock(unsortedLock);
-      for (auto event : unsortedEvents)
-        delete event;
+      mergeUnsortedStaging();
+      unsortedEvents.clear();
     }
   }
 
+  void HostDB::mergeSortedStaging()
+  {
+    sortedStaging.drain([this](VTFEvent* event) {
+      sortedEvents.add(event);
+    });
+  }
+
+  void HostDB::mergeUnsortedStaging()
+  {
+    unsortedStaging.drain([this](VTFEvent* event) {
+      unsortedEvents.add(event);
+    });
+  }
+
   void HostDB::addSortedEvent(VTFEvent* event)
   {
     if (event == nullptr)
       return;
 
-    std::lock_guard<std::mutex> lock(sortedLock);
-    sortedEvents.emplace(event->getTimestamp(), event);
+    sortedStaging.append(event);
   }
 
   void HostDB::addUnsortedEvent(VTFEvent* event)
@@ -54,86 +91,85 @@ namespace xdp {
     if (event == nullptr)
       return;
 
-    std::lock_guard<std::mutex> lock(unsortedLock);
-    unsortedEvents.push_back(event);
+    unsortedStaging.append(event);
   }
 
   bool HostDB::sortedEventsExist(std::function<bool (VTFEvent*)>& filter)
   {
     std::lock_guard<std::mutex> lock(sortedLock);
-    for (auto& iter : sortedEvents) {
-      auto event = iter.second;
-      if (filter(event))
-        return true;
-    }
-    return false;
+    mergeSortedStaging();
+    return sortedEvents.anyOf(byEvent(filter));
+  }
+
+  bool HostDB::sortedEventsExist(const CategoryFilter& filter)
+  {
+    std::lock_guard<std::mutex> lock(sortedLock);
+    mergeSortedStaging();
+    return sortedEvents.anyOf(byCategory(filter));
   }
 
   std::vector<VTFEvent*>
   HostDB::filterSortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
     std::lock_guard<std::mutex> lock(sortedLock);
+    mergeSortedStaging();
+    return sortedEvents.collect(byEvent(filter));
+  }
 
-    std::vector<VTFEvent*> collected;
-    for (auto& iter : sortedEvents) {
-      auto event = iter.second;
-      if (filter(event))
-        collected.push_back(event);
-    }
-    return collected;
+  std::vector<VTFEvent*>
+  HostDB::filterSortedEvents(const CategoryFilter& filter)
+  {
+    std::lock_guard<std::mutex> lock(sortedLock);
+    mergeSortedStaging();
+    return sortedEvents.collect(byCategory(filter));
   }
 
   std::vector<VTFEvent*>
   HostDB::filterUnsortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
     std::lock_guard<std::mutex> lock(unsortedLock);
+    mergeUnsortedStaging();
+    return unsortedEvents.collect(byEvent(filter));
+  }
 
-    std::vector<VTFEvent*> collected;
-    for (auto event : unsortedEvents) {
-      if (filter(event))
-        collected.push_back(event);
-    }
-    return collected;
+  std::vector<VTFEvent*>
+  HostDB::filterUnsortedEvents(const CategoryFilter& filter)
+  {
+    std::lock_guard<std::mutex> lock(unsortedLock);
+    mergeUnsortedStaging();
+    return unsortedEvents.collect(byCategory(filter));
   }
 
   std::vector<std::unique_ptr<VTFEvent>>
   HostDB::moveSortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
     std::lock_guard<std::mutex> lock(sortedLock);
+    mergeSortedStaging();
+    return takeOwnership(sortedEvents.extract(byEvent(filter)));
+  }
 
-    std::vector<std::unique_ptr<VTFEvent>> collected;
-
-    for (auto iter = sortedEvents.begin(); iter != sortedEvents.end(); ) {
-      auto event = (*iter).second;
-      if (filter(event)) {
-        collected.emplace_back(event);
-        iter = sortedEvents.erase(iter);
-      }
-      else
-        ++iter;
-    }
-    return collected;
+  std::vector<std::unique_ptr<VTFEvent>>
+  HostDB::moveSortedEvents(const CategoryFilter& filter)
+  {
+    std::lock_guard<std::mutex> lock(sortedLock);
+    mergeSortedStaging();
+    return takeOwnership(sortedEvents.extract(byCategory(filter)));
   }
 
   std::vector<VTFEvent*>
   HostDB::moveUnsortedEvents(std::function<bool (VTFEvent*)>& filter)
   {
     std::lock_guard<std::mutex> lock(unsortedLock);
+    mergeUnsortedStaging();
+    return unsortedEvents.extract(byEvent(filter));
+  }
 
-    std::vector<VTFEvent*> collected;
-
-    auto newEnd = std::remove_if(unsortedEvents.begin(), unsortedEvents.end(), [&filter, &collected](VTFEvent* event) {
-        if (filter(event)) {
-            collected.push_back(event);
-            return true;  // Mark the event for removal from unsortedEvents vector
-        }
-        return false; // Keep event in the unsortedEvents vector
-    });
-
-    // Resize the UnsortedEvents vector to keep only the remaining unfiltered events
-    unsortedEvents.erase(newEnd, unsortedEvents.end());
-
-    return collected;
+  std::vector<VTFEvent*>
+  HostDB::moveUnsortedEvents(const CategoryFilter& filter)
+  {
+    std::lock_guard<std::mutex> lock(unsortedLock);
+    mergeUnsortedStaging();
+    return unsortedEvents.extract(byCategory(filter));
   }
 
 } // end namespace xdp
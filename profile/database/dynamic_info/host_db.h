@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -26,6 +26,8 @@
 
 #include "xdp/config.h"
 #include "xdp/profile/database/dynamic_info/dependency_manager.h"
+#include "xdp/profile/database/dynamic_info/event_staging.h"
+#include "xdp/profile/database/dynamic_info/event_store.h"
 #include "xdp/profile/database/dynamic_info/mark.h"
 #include "xdp/profile/database/dynamic_info/types.h"
 
@@ -42,12 +44,19 @@ namespace xdp {
     static constexpr uint64_t eventThreshold = 10000000;
 
     // Before all events are printed in a CSV, they have to be sorted.
-    // The multimap sorts them as we create and insert them.
-    std::multimap<double, VTFEvent*> sortedEvents;
+    // The store keeps them in timestamp order.
+    EventStore sortedEvents{true};
 
     // For host events that will be sorted later (when printed), we
-    // can store them away in a simple vector
-    std::vector<VTFEvent*> unsortedEvents;
+    // can store them away in a simple array of records
+    EventStore unsortedEvents{false};
+
+    // Application threads never touch the containers above directly.
+    // Callbacks append to per-thread staging rings instead, and the
+    // staged events are merged (and sorted) by whichever thread
+    // accesses the containers next, typically a writer at dump time.
+    EventStaging sortedStaging;
+    EventStaging unsortedStaging;
 
     // This object keeps track of matching start events with end events
     APIMatch<uint64_t, uint64_t> eventStarts;
@@ -69,8 +78,13 @@ namespace xdp {
     // Different host layers can have dependencies between events
     DependencyManager openclDependencies;
 
-    std::mutex sortedLock; // Protects the "sortedEvents" multimap
-    std::mutex unsortedLock; // Protects the "unsortedEvents" vector
+    std::mutex sortedLock; // Protects the "sortedEvents" store
+    std::mutex unsortedLock; // Protects the "unsortedEvents" store
+
+    // Move all staged events into their final containers.  These must
+    // be called with the corresponding lock held.
+    void mergeSortedStaging();
+    void mergeUnsortedStaging();
 
   public:
     HostDB() = default;
@@ -83,22 +97,27 @@ namespace xdp {
     // A function to check the sorted events to see if any events that
     // fit the filter exist are currently stored in the database.
     bool sortedEventsExist(std::function<bool (VTFEvent*)>& filter);
+    bool sortedEventsExist(const CategoryFilter& filter);
 
     // A function that goes through all the sorted events and create
     // a vector of copies of the events that fit the filter
     std::vector<VTFEvent*>
     filterSortedEvents(std::function<bool (VTFEvent*)>& filter);
+    std::vector<VTFEvent*> filterSortedEvents(const CategoryFilter& filter);
 
     // A function that goes through all the unsorted events and create
     // a vector of copies of the events that fit the filter
     std::vector<VTFEvent*>
     filterUnsortedEvents(std::function<bool (VTFEvent*)>& filter);
+    std::vector<VTFEvent*> filterUnsortedEvents(const CategoryFilter& filter);
 
     // A function that goes through all the sorted events and creates
     // a vector of the events that fit the filter.  This transfers
     // ownership of the events to the caller.
     std::vector<std::unique_ptr<VTFEvent>>
     moveSortedEvents(std::function<bool (VTFEvent*)>& filter);
+    std::vector<std::unique_ptr<VTFEvent>>
+    moveSortedEvents(const CategoryFilter& filter);
 
     // A function that goes through all the unsorted events and
     // creates a vector of the events that fit the filter.  This
@@ -106,6 +125,7 @@ namespace xdp {
     // Not a unique pointer because it needs to be sorted later.
     std::vector<VTFEvent*>
     moveUnsortedEvents(std::function<bool (VTFEvent*)>& filter);
+    std::vector<VTFEvent*> moveUnsortedEvents(const CategoryFilter& filter);
 
     // Functions for matching start events with end events
     inline void registerStart(uint64_t functionId, uint64_t eventId)
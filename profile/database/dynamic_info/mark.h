@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,43 +17,281 @@
 #ifndef MARK_DOT_H
 #define MARK_DOT_H
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace xdp {
 
-  // For API tracking, we will encounter the start of an API event and the 
+  // For API tracking, we will encounter the start of an API event and the
   // end of the API event through different callbacks which may not be
   // sequential.  When we are processing the end of the API, we must lookup
   // the corresponding start of the API event that was previously stored
   // so we can collect the information we need when we dump events.
+  //
+  // The start and end of a call almost always happen on the same thread,
+  // so every thread records its starts in its own small hash table.  An
+  // end first looks in the table of its own thread, which is never
+  // contended.  Every start also leaves a hint of which table holds it,
+  // so if the call ended on a different thread the start is usually
+  // found without searching the tables of every other thread.
 
   template <typename id_type, typename start_type>
   class APIMatch
   {
   private:
-    // Each start event is identified by a unique uint64_t, given by the
-    // database when stored away.
-    std::map<id_type, start_type> map;
+    // An open addressing (linear probing) table used by a single thread.
+    // The owning thread is the only one that inserts.  Other threads only
+    // ever remove entries when matching a start from another thread, so
+    // the flag guarding the table is essentially never contended.
+    class LocalTable
+    {
+    private:
+      struct Slot
+      {
+        id_type id;
+        start_type value;
+        bool used;
+      };
+
+      std::vector<Slot> slots;
+      std::size_t count = 0;
+      std::atomic_flag busy = ATOMIC_FLAG_INIT;
+
+    public:
+      // Set when the owning thread exits.  Nothing is inserted after that.
+      std::atomic<bool> retired{false};
+
+    private:
+
+      inline std::size_t home(id_type id) const
+      {
+        auto hash = static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(hash >> 32) & (slots.size() - 1);
+      }
+
+      std::size_t probe(id_type id) const
+      {
+        auto mask = slots.size() - 1;
+        auto i = home(id);
+        while (slots[i].used && !(slots[i].id == id))
+          i = (i + 1) & mask;
+        return i;
+      }
+
+      void grow()
+      {
+        std::vector<Slot> old(slots.size() * 2);
+        old.swap(slots);
+        count = 0;
+        for (auto& slot : old) {
+          if (slot.used)
+            insert(slot.id, slot.value);
+        }
+      }
+
+    public:
+      LocalTable() : slots(64) {}
+
+      inline void lock()
+      {
+        while (busy.test_and_set(std::memory_order_acquire))
+          std::this_thread::yield();
+      }
+      inline void unlock() { busy.clear(std::memory_order_release); }
+
+      void insert(id_type id, const start_type& value)
+      {
+        if ((count + 1) * 2 > slots.size())
+          grow();
+
+        auto i = probe(id);
+        if (!slots[i].used)
+          ++count;
+        slots[i] = { id, value, true };
+      }
+
+      bool remove(id_type id, start_type& value)
+      {
+        auto i = probe(id);
+        if (!slots[i].used)
+          return false;
+
+        value = slots[i].value;
+        slots[i].used = false;
+        --count;
+
+        // Shift back any entries that probed past the freed slot so
+        // lookups never need tombstones.
+        auto mask = slots.size() - 1;
+        for (auto j = (i + 1) & mask; slots[j].used; j = (j + 1) & mask) {
+          auto k = home(slots[j].id);
+          bool movable = (i <= j) ? (k <= i || k > j) : (k <= i && k > j);
+          if (movable) {
+            slots[i] = slots[j];
+            slots[j].used = false;
+            i = j;
+          }
+        }
+        return true;
+      }
+
+      // Move every entry into another table, leaving this one empty
+      void moveTo(LocalTable& other)
+      {
+        for (auto& slot : slots) {
+          if (slot.used) {
+            other.insert(slot.id, slot.value);
+            slot.used = false;
+          }
+        }
+        count = 0;
+      }
+    };
+
+    // The table of every live thread that has registered a start.  Tables
+    // are shared with the thread_local list of their thread so either
+    // side can go away first.
+    std::vector<std::shared_ptr<LocalTable>> tables;
+    // Starts left behind by threads that have exited
+    LocalTable orphans;
+    std::mutex tablesLock; // Protects "tables" and "orphans"
+
+    // Every table a thread has been given, one per object.  Its
+    // destructor runs when the thread exits and retires them all.
+    struct ThreadTables
+    {
+      std::vector<std::pair<uint64_t, std::shared_ptr<LocalTable>>> entries;
+
+      ~ThreadTables()
+      {
+        for (auto& entry : entries)
+          entry.second->retired.store(true, std::memory_order_release);
+      }
+    };
+
+    // The table that most recently registered a start with an id that
+    // hashes here.  Only a hint for ends on other threads: it is written
+    // without a lock on every start and checked against "tables" before
+    // it is used.
+    static constexpr std::size_t numHints = 1024;
+    std::array<std::atomic<LocalTable*>, numHints> hints;
+
+    inline std::atomic<LocalTable*>& hint(id_type id)
+    {
+      auto hash = static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL;
+      return hints[static_cast<std::size_t>(hash >> 54)];
+    }
+
+    // Distinguishes this object in the per-thread table cache
+    const uint64_t instanceId;
+
+    static uint64_t nextInstanceId()
+    {
+      static std::atomic<uint64_t> next{1};
+      return next++;
+    }
+
+    // Fold the starts of exited threads into "orphans" and free their
+    // tables.  Must hold tablesLock.
+    void retireTables()
+    {
+      for (auto iter = tables.begin(); iter != tables.end(); ) {
+        if (!(*iter)->retired.load(std::memory_order_acquire)) {
+          ++iter;
+          continue;
+        }
+        (*iter)->lock();
+        (*iter)->moveTo(orphans);
+        (*iter)->unlock();
+        iter = tables.erase(iter);
+      }
+    }
+
+    LocalTable* threadTable(bool create)
+    {
+      thread_local ThreadTables cache;
+      for (auto& entry : cache.entries) {
+        if (entry.first == instanceId)
+          return entry.second.get();
+      }
+      if (!create)
+        return nullptr;
+
+      auto table = std::make_shared<LocalTable>();
+      {
+        std::lock_guard<std::mutex> lock(tablesLock);
+        retireTables();
+        tables.push_back(table);
+      }
+      cache.entries.emplace_back(instanceId, table);
+      return table.get();
+    }
+
+    static bool take(LocalTable* table, id_type id, start_type& value)
+    {
+      table->lock();
+      bool found = table->remove(id, value);
+      table->unlock();
+      return found;
+    }
 
-    std::mutex mapLock;
   public:
+    APIMatch() : instanceId(nextInstanceId())
+    {
+      for (auto& h : hints)
+        h.store(nullptr, std::memory_order_relaxed);
+    }
+
     void registerStart(id_type ID, start_type eventNum)
     {
-      std::lock_guard<std::mutex> lock(mapLock);
-      map[ID] = eventNum;
+      auto table = threadTable(true);
+      table->lock();
+      table->insert(ID, eventNum);
+      table->unlock();
+      hint(ID).store(table, std::memory_order_relaxed);
     }
 
     start_type lookupStart(id_type endID)
     {
-      std::lock_guard<std::mutex> lock(mapLock);
-      auto iter = map.find(endID);
-      if (iter == map.end())
-        return {0};
+      start_type value;
+
+      auto local = threadTable(false);
+      if (local != nullptr && take(local, endID, value))
+        return value;
+
+      // The start was registered on a different thread, or by a thread
+      // that has since exited
+      std::lock_guard<std::mutex> lock(tablesLock);
+      retireTables();
+
+      auto hinted = hint(endID).load(std::memory_order_relaxed);
+      if (hinted != nullptr && hinted != local) {
+        for (auto& table : tables) {
+          if (table.get() == hinted) {
+            if (take(hinted, endID, value))
+              return value;
+            break;
+          }
+        }
+      }
+
+      if (orphans.remove(endID, value))
+        return value;
 
-      start_type value = (*iter).second;
-      map.erase(endID);
-      return value;
+      for (auto& table : tables) {
+        if (table.get() == local || table.get() == hinted)
+          continue;
+        if (take(table.get(), endID, value))
+          return value;
+      }
+      return start_type{};
     }
   };
 
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -22,6 +22,12 @@
 
 namespace xdp {
 
+  PLDB::~PLDB()
+  {
+    std::lock_guard<std::mutex> lock(eventLock);
+    events.clear();
+  }
+
   void PLDB::addEvent(VTFEvent* event)
   {
     if (event == nullptr)
@@ -30,7 +36,24 @@ namespace xdp {
     bool overLimit = false;
     {
       std::lock_guard<std::mutex> lock(eventLock);
-      events.emplace(event->getTimestamp(), event);
+      events.add(event);
+      if (events.size() > eventThreshold)
+        overLimit = true;
+    }
+    if (overLimit)
+      VPDatabase::Instance()->broadcast(VPDatabase::DUMP_TRACE);
+  }
+
+  void PLDB::addEvents(const std::vector<VTFEvent*>& batch)
+  {
+    if (batch.empty())
+      return;
+
+    bool overLimit = false;
+    {
+      std::lock_guard<std::mutex> lock(eventLock);
+      for (auto event : batch)
+        events.add(event);
       if (events.size() > eventThreshold)
         overLimit = true;
     }
@@ -48,12 +71,12 @@ namespace xdp {
   {
     std::lock_guard<std::mutex> lock(eventLock);
 
+    auto moved = events.extract([](const EventRecord&) { return true; });
+
     std::vector<std::unique_ptr<VTFEvent>> collected;
-    for (auto iter = events.begin(); iter != events.end(); /* */) {
-      auto event = iter->second;
+    collected.reserve(moved.size());
+    for (auto event : moved)
       collected.emplace_back(event);
-      iter = events.erase(iter);
-    }
     return collected;
   }
 
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,10 +21,12 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "core/common/uuid.h"
 #include "core/include/xdp/counters.h"
 
+#include "xdp/profile/database/dynamic_info/event_store.h"
 #include "xdp/profile/database/dynamic_info/samples.h"
 #include "xdp/profile/database/dynamic_info/types.h"
 
@@ -44,8 +46,8 @@ namespace xdp {
 
     // Trace events.  Since the actual hardware might shuffle the order
     // of events we have to make sure that this set of events is ordered
-    // based on the timestamp
-    std::multimap<double, VTFEvent*> events;
+    // based on the timestamp.  The store sorts when the events are moved.
+    EventStore events{true};
 
     // Each monitor in the device will have a set of device event starts.
     // This map goes from monitor ID to the list of all the currently
@@ -63,7 +65,7 @@ namespace xdp {
 
     SampleContainer powerSamples;
 
-    std::mutex eventLock;   // For protecting the events multimap
+    std::mutex eventLock;   // For protecting the events store
     std::mutex startLock;   // For protecting the startEvents map
     std::mutex counterLock; // For protecting the plCounters map
     std::mutex fullLock;    // For protecting the trace buffer full bool
@@ -73,9 +75,10 @@ namespace xdp {
 
   public:
     PLDB()  = default;
-    ~PLDB() = default;
+    ~PLDB();
 
     void addEvent(VTFEvent* event);
+    void addEvents(const std::vector<VTFEvent*>& batch);
     bool eventsExist();
 
     std::vector<std::unique_ptr<VTFEvent>> moveEvents();
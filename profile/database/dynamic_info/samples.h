@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -96,27 +96,27 @@ namespace xdp {
   class AIEDebugContainer
   {
     private:
-    std::vector<xdp::aie::AIEDebugDataType> samples;
-    std::mutex containerLock; // Protects the "samples" vector
+    std::vector<xdp::aie::AIEDebugBlock> blocks;
+    std::mutex containerLock; // Protects the "blocks" vector
 
     public:
     AIEDebugContainer() = default;
     ~AIEDebugContainer() = default;
 
-    inline void addAIEDebugData(const xdp::aie::AIEDebugDataType& s)
+    inline void addAIEDebugBlock(xdp::aie::AIEDebugBlock&& b)
     {
       std::lock_guard<std::mutex> lock(containerLock);
-      samples.push_back(s);
+      blocks.push_back(std::move(b));
     }
-    inline std::vector<xdp::aie::AIEDebugDataType> getAIEDebugData()
+    inline std::vector<xdp::aie::AIEDebugBlock> getAIEDebugBlocks()
     {
       std::lock_guard<std::mutex> lock(containerLock);
-      return samples;
+      return blocks;
     }
-    inline std::vector<xdp::aie::AIEDebugDataType> moveAIEDebugData()
+    inline std::vector<xdp::aie::AIEDebugBlock> moveAIEDebugBlocks()
     {
       std::lock_guard<std::mutex> lock(containerLock);
-      return std::move(samples);
+      return std::move(blocks);
     }
   };
 } // end namespace xdp
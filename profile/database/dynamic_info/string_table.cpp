@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -16,26 +16,140 @@
 
 #define XDP_CORE_SOURCE
 
+#include <functional>
+
 #include "xdp/profile/database/dynamic_info/string_table.h"
 
 namespace xdp {
 
-  uint64_t StringTable::addString(const std::string& value)
+  namespace {
+
+    std::atomic<uint64_t> nextInstanceId{1};
+
+  } // end anonymous namespace
+
+  StringTable::StringTable() :
+    shards(std::make_unique<Shard[]>(numShards)),
+    instanceId(nextInstanceId++)
   {
-    std::lock_guard<std::mutex> lock(dataLock);
+    for (std::size_t s = 0; s < numShards; ++s) {
+      for (auto& bucket : shards[s].buckets)
+        bucket.store(nullptr, std::memory_order_relaxed);
+    }
+    for (auto& segment : segments)
+      segment.store(nullptr, std::memory_order_relaxed);
+  }
 
-    if (table.find(value) == table.end())
-      table[value] = currentId++;
+  StringTable::~StringTable()
+  {
+    for (std::size_t s = 0; s < numShards; ++s) {
+      for (auto& bucket : shards[s].buckets) {
+        auto entry = bucket.load(std::memory_order_relaxed);
+        while (entry != nullptr) {
+          auto next = entry->next;
+          delete entry;
+          entry = next;
+        }
+      }
+    }
+    for (auto& segment : segments)
+      delete [] segment.load(std::memory_order_relaxed);
+  }
 
-    return table[value];
+  StringTable::Entry*
+  StringTable::find(std::string_view value, std::size_t hash, Entry* head)
+  {
+    for (auto entry = head; entry != nullptr; entry = entry->next) {
+      if (entry->hash == hash && entry->value == value)
+        return entry;
+    }
+    return nullptr;
   }
 
-  void StringTable::dumpTable(std::ofstream& fout)
+  std::atomic<StringTable::Entry*>*
+  StringTable::slot(uint64_t id, bool create)
+  {
+    // Segment k starts at id firstSegmentSize * (2^k - 1)
+    uint64_t n = (id >> firstSegmentBits) + 1;
+    std::size_t k = 0;
+    while (n >>= 1)
+      ++k;
+    uint64_t segmentStart = static_cast<uint64_t>(firstSegmentSize) * ((1ULL << k) - 1);
+
+    auto segment = segments[k].load(std::memory_order_acquire);
+    if (segment == nullptr) {
+      if (!create)
+        return nullptr;
+      // Inserts into different shards can race to create the same segment
+      std::size_t size = firstSegmentSize << k;
+      auto fresh = new std::atomic<Entry*>[size];
+      for (std::size_t i = 0; i < size; ++i)
+        fresh[i].store(nullptr, std::memory_order_relaxed);
+      if (segments[k].compare_exchange_strong(segment, fresh,
+                                              std::memory_order_acq_rel))
+        segment = fresh;
+      else
+        delete [] fresh;
+    }
+    return &segment[id - segmentStart];
+  }
+
+  uint64_t StringTable::addString(std::string_view value)
   {
-    std::lock_guard<std::mutex> lock(dataLock);
+    auto hash = std::hash<std::string_view>{}(value);
+    auto& shard = shards[hash % numShards];
+    auto& bucket = shard.buckets[(hash / numShards) % bucketsPerShard];
 
-    for (auto& s : table)
-      fout << s.second << "," << s.first.c_str() << "\n";
+    // Fast path: the string is already in the table
+    if (auto entry = find(value, hash, bucket.load(std::memory_order_acquire)))
+      return entry->id;
+
+    std::lock_guard<std::mutex> lock(shard.insertLock);
+
+    // Another thread may have inserted the string while we were waiting
+    auto head = bucket.load(std::memory_order_acquire);
+    if (auto entry = find(value, hash, head))
+      return entry->id;
+
+    auto entry = new Entry{hash, currentId++, std::string(value), head};
+    slot(entry->id, true)->store(entry, std::memory_order_release);
+    bucket.store(entry, std::memory_order_release);
+    return entry->id;
+  }
+
+  uint64_t StringTable::addStaticString(const char* literal)
+  {
+    struct CachedLiteral
+    {
+      const char* literal;
+      uint64_t table;
+      uint64_t id;
+    };
+    static constexpr std::size_t cacheSize = 64;
+    thread_local CachedLiteral cache[cacheSize] = {};
+
+    auto& slot =
+      cache[reinterpret_cast<uintptr_t>(literal) % cacheSize];
+    if (slot.literal == literal && slot.table == instanceId)
+      return slot.id;
+
+    slot = { literal, instanceId, addString(literal) };
+    return slot.id;
+  }
+
+  void StringTable::dumpTable(std::ofstream& fout)
+  {
+    auto end = currentId.load(std::memory_order_acquire);
+    for (uint64_t id = 1; id < end; ++id) {
+      auto s = slot(id, false);
+      if (s == nullptr)
+        continue;
+      // An id can be issued before its entry is published.  No event
+      // can refer to it yet, so it is fine to leave it out.
+      auto entry = s->load(std::memory_order_acquire);
+      if (entry != nullptr)
+        fout << id << "," << entry->value.c_str() << "\n";
+    }
   }
 
 } // end namespace xdp
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,28 +17,77 @@
 #ifndef STRING_TABLE_DOT_H
 #define STRING_TABLE_DOT_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
-#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 
 #include "xdp/config.h"
 
 namespace xdp {
 
+  // Every string associated with an event is interned here and referred
+  // to by id.  This is called on every API event from many threads, so
+  // looking up a string that is already in the table never takes a lock.
+  // The table is a set of insert-only hash chains: entries are fully
+  // built before they are published and never change afterwards, so
+  // readers can walk the chains while other threads insert.  Only
+  // inserting a new string takes the lock of the shard it hashes to.
   class StringTable
   {
   private:
-    std::map<std::string, uint64_t> table;
-    uint64_t currentId = 1; // Start at 1 so we can use 0 as a special value
+    struct Entry
+    {
+      std::size_t hash;
+      uint64_t id;
+      std::string value;
+      Entry* next;
+    };
+
+    static constexpr std::size_t numShards       = 16;
+    static constexpr std::size_t bucketsPerShard = 1024;
+
+    struct Shard
+    {
+      std::atomic<Entry*> buckets[bucketsPerShard];
+      std::mutex insertLock; // Serializes inserts into this shard
+    };
+    std::unique_ptr<Shard[]> shards;
+
+    // Entries are also indexed by id so the table can be dumped in id
+    // order without copying it.  Segment k holds firstSegmentSize << k
+    // ids, so the index grows with the table without ever moving an
+    // entry, and the fixed segment list covers every id that can be
+    // issued.  Segments are allocated the first time an id lands in them.
+    static constexpr std::size_t firstSegmentBits = 10;
+    static constexpr std::size_t firstSegmentSize = 1 << firstSegmentBits;
+    static constexpr std::size_t numSegments = 64 - firstSegmentBits;
+    std::atomic<std::atomic<Entry*>*> segments[numSegments];
+
+    std::atomic<uint64_t> currentId{1}; // Start at 1 so we can use 0 as a special value
+
+    // Distinguishes this table in the per-thread literal cache
+    const uint64_t instanceId;
+
+    Entry* find(std::string_view value, std::size_t hash, Entry* head);
+    std::atomic<Entry*>* slot(uint64_t id, bool create);
 
-    std::mutex dataLock; // Protects "table" map and currentId
   public:
-    StringTable() = default;
-    ~StringTable() = default;
+    XDP_CORE_EXPORT StringTable();
+    XDP_CORE_EXPORT ~StringTable();
+
+    XDP_CORE_EXPORT uint64_t addString(std::string_view value);
+
+    // For strings with static storage duration (string literals or
+    // __func__).  The id is cached per thread based on the address, so
+    // the contents at that address must never change.
+    XDP_CORE_EXPORT uint64_t addStaticString(const char* literal);
 
-    XDP_CORE_EXPORT uint64_t addString(const std::string& value);
+    // Writes "id,string" for every string, in id order
     XDP_CORE_EXPORT void dumpTable(std::ofstream& fout);
   };
 
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -62,6 +62,21 @@ namespace xdp::counters {
     std::vector<uint64_t> values;
   };
 
+  // A single reading of an AIE profile counter.  Every field has a fixed
+  // width so readings can be stored back to back without any allocation.
+  struct AIESample
+  {
+    double timestamp;
+    uint64_t value;
+    uint64_t timer;
+    uint64_t payload;
+    uint16_t startEvent;
+    uint16_t endEvent;
+    uint16_t resetEvent;
+    uint8_t column;
+    uint8_t row;
+  };
+
   // Different container to handle two timestamps
   struct DoubleSample
   {
@@ -82,13 +97,16 @@ namespace xdp::aie {
 
   typedef std::vector<TraceDataType*> TraceDataVector;
 
-  struct AIEDebugDataType
+  // The registers read from one tile in one pass of AIE debug.  Register
+  //  i was read as values[i], and registerIds[i] is its position in the
+  //  static register table of the AIE generation (see
+  //  plugin/aie_debug/aie_debug_registers.h), so no names are stored.
+  struct AIEDebugBlock
   {
     uint8_t col;
     uint8_t row;
-    uint32_t value;
-    uint64_t offset;
-    std::string name;
+    std::vector<uint16_t> registerIds;
+    std::vector<uint32_t> values;
   };
 
 } // end namespace xdp::aie
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -35,6 +35,10 @@ AIETraceDataLogger::~AIETraceDataLogger()
 
 void AIETraceDataLogger::addAIETraceData(uint64_t strmIndex, void* buffer, uint64_t bufferSz, bool copy)
 {
+  if (sink) {
+    sink->append(strmIndex, buffer, bufferSz);
+    return;
+  }
   if(!VPDatabase::alive()) {
     return;
   }
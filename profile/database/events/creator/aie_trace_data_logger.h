@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -24,11 +24,21 @@
 
 namespace xdp {
 
+// Takes AIE trace as it is offloaded, in place of the database.  The
+//  buffer is only valid for the duration of the call.
+class AIETraceSink
+{
+public:
+  virtual ~AIETraceSink() {}
+  virtual void append(uint64_t strmIndex, const void* buffer, uint64_t bufferSz) = 0;
+};
+
 class AIETraceDataLogger : public AIETraceLogger
 {
   uint64_t deviceId = 0;
   io_type offloadType = io_type::PLIO;
   VPDatabase* db = nullptr;
+  AIETraceSink* sink = nullptr;
 
 public:
 
@@ -39,6 +49,10 @@ public:
 
   XDP_CORE_EXPORT
   virtual void addAIETraceData(uint64_t strmIndex, void* buffer, uint64_t bufferSz, bool copy);
+
+  // Send trace to the sink instead of keeping it in the database until it
+  //  is written.  Must be set before offload starts.
+  inline void setSink(AIETraceSink* s) { sink = s; }
 };
 
 }
@@ -0,0 +1,173 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <atomic>
+#include <new>
+
+#include "xdp/profile/database/events/event_arena.h"
+
+namespace xdp {
+
+  namespace {
+
+    constexpr std::size_t alignment = alignof(std::max_align_t);
+
+    // Each chunk starts with a header that counts the events still alive
+    // in the chunk, plus one reference held by the thread that is
+    // currently allocating out of it.  The header gets its own cache line
+    // so the allocating thread and the thread deleting events do not
+    // false share with the events themselves.
+    struct ChunkHeader
+    {
+      std::atomic<uint64_t> live;
+    };
+    constexpr std::size_t headerSize = 64;
+    static_assert(sizeof(ChunkHeader) <= headerSize, "Chunk header too big");
+
+    std::atomic<uint64_t> chunksAllocated{0};
+    std::atomic<uint64_t> chunksReleased{0};
+    std::atomic<uint64_t> peakLiveChunks{0};
+    std::atomic<uint64_t> eventsAllocated{0};
+    std::atomic<uint64_t> bytesAllocated{0};
+    std::atomic<uint64_t> largeAllocations{0};
+
+    inline std::size_t roundUp(std::size_t size)
+    {
+      return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    ChunkHeader* newChunk()
+    {
+      void* memory = ::operator new(EventArena::chunkSize,
+                                    std::align_val_t(EventArena::chunkSize));
+      auto chunk = new (memory) ChunkHeader;
+      chunk->live.store(1, std::memory_order_relaxed);
+
+      auto inUse = ++chunksAllocated - chunksReleased.load();
+      auto peak = peakLiveChunks.load();
+      while (inUse > peak && !peakLiveChunks.compare_exchange_weak(peak, inUse))
+        ;
+      return chunk;
+    }
+
+    void releaseReference(ChunkHeader* chunk)
+    {
+      if (chunk->live.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+      chunk->~ChunkHeader();
+      ::operator delete(chunk, std::align_val_t(EventArena::chunkSize));
+      ++chunksReleased;
+    }
+
+    // The bump allocation state for each thread.  This is kept trivially
+    // destructible so it is still usable if a thread creates events
+    // while it is being torn down.
+    struct ThreadState
+    {
+      ChunkHeader* chunk;
+      std::size_t offset;
+      uint64_t events;
+    };
+    thread_local ThreadState state = { nullptr, 0, 0 };
+    thread_local bool threadExited = false;
+
+    void retire(ThreadState& s)
+    {
+      if (s.chunk == nullptr)
+        return;
+
+      eventsAllocated += s.events;
+      bytesAllocated += s.offset - headerSize;
+
+      auto chunk = s.chunk;
+      s = { nullptr, 0, 0 };
+      releaseReference(chunk);
+    }
+
+    // Drops the reference a thread holds on its current chunk when the
+    // thread exits so the chunk can be freed once its events are deleted.
+    struct ThreadRetirer
+    {
+      ~ThreadRetirer()
+      {
+        retire(state);
+        threadExited = true;
+      }
+    };
+    thread_local ThreadRetirer retirer;
+
+  } // end anonymous namespace
+
+  void* EventArena::allocate(std::size_t size)
+  {
+    size = roundUp(size);
+    if (size > maxEventSize) {
+      ++largeAllocations;
+      return ::operator new(size);
+    }
+
+    if (threadExited) {
+      // Only happens for events created during thread teardown.  Give
+      // the event a chunk of its own that is freed along with it.
+      auto chunk = newChunk();
+      eventsAllocated += 1;
+      bytesAllocated += size;
+      return reinterpret_cast<char*>(chunk) + headerSize;
+    }
+
+    if (state.chunk == nullptr || state.offset + size > chunkSize) {
+      retire(state);
+      (void)&retirer; // Make sure the thread exit hook is registered
+      state = { newChunk(), headerSize, 0 };
+    }
+
+    void* ptr = reinterpret_cast<char*>(state.chunk) + state.offset;
+    state.offset += size;
+    ++state.events;
+    state.chunk->live.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+  }
+
+  void EventArena::deallocate(void* ptr, std::size_t size)
+  {
+    if (ptr == nullptr)
+      return;
+
+    if (roundUp(size) > maxEventSize) {
+      ::operator delete(ptr);
+      return;
+    }
+
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    releaseReference(reinterpret_cast<ChunkHeader*>(address & ~(uintptr_t)(chunkSize - 1)));
+  }
+
+  EventArenaStatistics EventArena::getStatistics()
+  {
+    EventArenaStatistics stats;
+    stats.chunksAllocated  = chunksAllocated.load();
+    stats.chunksReleased   = chunksReleased.load();
+    stats.peakLiveChunks   = peakLiveChunks.load();
+    stats.eventsAllocated  = eventsAllocated.load();
+    stats.bytesAllocated   = bytesAllocated.load();
+    stats.largeAllocations = largeAllocations.load();
+    return stats;
+  }
+
+} // end namespace xdp
@@ -0,0 +1,59 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef EVENT_ARENA_DOT_H
+#define EVENT_ARENA_DOT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  struct EventArenaStatistics
+  {
+    uint64_t chunksAllocated;  // Calls into the system allocator for chunks
+    uint64_t chunksReleased;   // Chunks returned once all events died
+    uint64_t peakLiveChunks;   // High water mark of chunks in use
+    uint64_t eventsAllocated;  // Events placed in chunks that are retired
+    uint64_t bytesAllocated;   // Bytes handed out of retired chunks
+    uint64_t largeAllocations; // Events too big for a chunk
+  };
+
+  // Every VTFEvent is allocated through this arena (see the class
+  // specific operator new and delete in VTFEvent).  Each thread bump
+  // allocates events out of its own large chunk, so creating an event
+  // does not go to the system allocator or take any lock.  Deleting an
+  // event only decrements the live count of the chunk it lives in, and
+  // the chunk is handed back to the system as a whole once the last
+  // event in it dies, which is what happens when writers delete the
+  // events they moved out of the HostDB and PLDB.
+  class EventArena
+  {
+  public:
+    static constexpr std::size_t chunkSize = 64 * 1024;
+    static constexpr std::size_t maxEventSize = 1024;
+
+    XDP_CORE_EXPORT static void* allocate(std::size_t size);
+    XDP_CORE_EXPORT static void deallocate(void* ptr, std::size_t size);
+
+    XDP_CORE_EXPORT static EventArenaStatistics getStatistics();
+  };
+
+} // end namespace xdp
+
+#endif
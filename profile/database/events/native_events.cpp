@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2021 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -36,7 +36,7 @@ namespace xdp {
   NativeSyncRead::NativeSyncRead(uint64_t s_id, double ts, uint64_t name) :
     NativeAPICall(s_id, ts, name)
   {
-    readStr = VPDatabase::Instance()->getDynamicInfo().addString("READ");
+    readStr = VPDatabase::Instance()->getDynamicInfo().addStaticString("READ");
   }
 
   void NativeSyncRead::dumpSync(std::ofstream& fout, uint32_t bucket)
@@ -48,7 +48,7 @@ namespace xdp {
   NativeSyncWrite::NativeSyncWrite(uint64_t s_id, double ts, uint64_t name) :
     NativeAPICall(s_id, ts, name)
   {
-    writeStr = VPDatabase::Instance()->getDynamicInfo().addString("WRITE");
+    writeStr = VPDatabase::Instance()->getDynamicInfo().addStaticString("WRITE");
   }
 
   void NativeSyncWrite::dumpSync(std::ofstream& fout, uint32_t bucket)
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -45,6 +45,28 @@ namespace xdp {
     dumpType(fout, true) ;    
   }
 
+  uint32_t VTFEvent::categorize()
+  {
+    uint32_t categories = 0 ;
+    if (isUserEvent())       categories |= CATEGORY_USER ;
+    if (isOpenCLAPI())       categories |= CATEGORY_OPENCL_API ;
+    if (isLOPAPI())          categories |= CATEGORY_LOP_API ;
+    if (isHALAPI())          categories |= CATEGORY_HAL_API ;
+    if (isHostEvent())       categories |= CATEGORY_HOST ;
+    if (isNativeHostEvent()) categories |= CATEGORY_NATIVE_HOST ;
+    if (isNativeRead())      categories |= CATEGORY_NATIVE_READ ;
+    if (isNativeWrite())     categories |= CATEGORY_NATIVE_WRITE ;
+    if (isOpenCLHostEvent()) categories |= CATEGORY_OPENCL_HOST ;
+    if (isLOPHostEvent())    categories |= CATEGORY_LOP_HOST ;
+    if (isHALHostEvent())    categories |= CATEGORY_HAL_HOST ;
+    if (isDeviceEvent())     categories |= CATEGORY_DEVICE ;
+    if (isReadBuffer())      categories |= CATEGORY_READ_BUFFER ;
+    if (isWriteBuffer())     categories |= CATEGORY_WRITE_BUFFER ;
+    if (isCopyBuffer())      categories |= CATEGORY_COPY_BUFFER ;
+    if (isKernelEnqueue())   categories |= CATEGORY_KERNEL_ENQUEUE ;
+    return categories ;
+  }
+
   void VTFEvent::dumpTimestamp(std::ofstream& fout)
   {
     // Host events are accurate up to microseconds.
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,10 +18,12 @@
 #ifndef VTF_EVENT_DOT_H
 #define VTF_EVENT_DOT_H
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 
 #include "xdp/config.h"
+#include "xdp/profile/database/events/event_arena.h"
 
 namespace xdp {
 
@@ -77,6 +79,40 @@ namespace xdp {
     UNKNOWN_EVENT = 70,
   } ;
 
+  // Bit flags that mirror the virtual filter predicates of VTFEvent.
+  // The database computes them once when an event is stored so that
+  // writers can select events with a mask test instead of calling the
+  // virtual predicates on every event of every pass.
+  enum VTFEventCategory : uint32_t {
+    CATEGORY_USER           = 0x1,
+    CATEGORY_OPENCL_API     = 0x2,
+    CATEGORY_LOP_API        = 0x4,
+    CATEGORY_HAL_API        = 0x8,
+    CATEGORY_HOST           = 0x10,
+    CATEGORY_NATIVE_HOST    = 0x20,
+    CATEGORY_NATIVE_READ    = 0x40,
+    CATEGORY_NATIVE_WRITE   = 0x80,
+    CATEGORY_OPENCL_HOST    = 0x100,
+    CATEGORY_LOP_HOST       = 0x200,
+    CATEGORY_HAL_HOST       = 0x400,
+    CATEGORY_DEVICE         = 0x800,
+    CATEGORY_READ_BUFFER    = 0x1000,
+    CATEGORY_WRITE_BUFFER   = 0x2000,
+    CATEGORY_COPY_BUFFER    = 0x4000,
+    CATEGORY_KERNEL_ENQUEUE = 0x8000,
+  } ;
+
+  // An event matches the filter if it belongs to any of the "include"
+  // categories and none of the "exclude" categories.
+  struct CategoryFilter
+  {
+    uint32_t include ;
+    uint32_t exclude ;
+
+    inline bool matches(uint32_t categories) const
+    { return (categories & include) != 0 && (categories & exclude) == 0 ; }
+  } ;
+
   class VTFEvent
   {
   private:
@@ -96,6 +132,14 @@ namespace xdp {
     XDP_CORE_EXPORT VTFEvent(uint64_t s_id, double ts, VTFEventType ty) ;
     XDP_CORE_EXPORT virtual ~VTFEvent() ;
 
+    // Events are created and destroyed in huge numbers, so all of them
+    // (including every derived class) live in the event arena instead
+    // of being individually allocated from the heap.
+    static void* operator new(std::size_t sz)
+      { return EventArena::allocate(sz) ; }
+    static void operator delete(void* ptr, std::size_t sz)
+      { EventArena::deallocate(ptr, sz) ; }
+
     // Getters and Setters
     inline double       getTimestamp()    const { return timestamp ; }
     inline void         setTimestamp(double ts) { timestamp = ts ; }
@@ -133,6 +177,9 @@ namespace xdp {
     virtual bool isKernelEnqueue() { return type == KERNEL_ENQUEUE ||
 	                                    type == LOP_KERNEL_ENQUEUE ; }
 
+    // Evaluate all of the filter predicates above into category flags
+    XDP_CORE_EXPORT uint32_t categorize() ;
+
     virtual uint64_t getDevice() { return 0 ; } // CHECK
     XDP_CORE_EXPORT virtual void dump(std::ofstream& fout, uint32_t bucket) ;
     virtual void dumpSync(std::ofstream& /*fout*/, uint32_t /*bucket*/) {};
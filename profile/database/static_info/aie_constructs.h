@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2021-2022 Xilinx, Inc
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef AIE_CONSTRUCTS_DOT_H
 #define AIE_CONSTRUCTS_DOT_H
@@ -198,6 +198,17 @@ namespace xdp {
     {}
   };
 
+  /*
+   * An immutable copy of all the AIE counters of a device.  Pollers hold
+   * on to a snapshot across sweeps and only get a new one when the
+   * counters have changed, which is tracked by the version.
+   */
+  struct AIECounterSnapshot
+  {
+    uint64_t version;
+    std::vector<AIECounter> counters;
+  };
+
   struct TraceGMIO
   {
     uint32_t id;
@@ -3,6 +3,10 @@
 
 #define XDP_CORE_SOURCE
 
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <mutex>
 #include <boost/algorithm/string.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -17,8 +21,157 @@ namespace xdp::aie {
 namespace pt = boost::property_tree;
 using severity_level = xrt_core::message::severity_level;
 
+namespace {
+
+    using IOMap = std::unordered_map<std::string, io_config>;
+
+    // Rows and columns are 8 bits wide
+    constexpr unsigned int NUM_TILE_COORDS = 256;
+
+    // A set of tile locations kept as the rows used in each column
+    class TileMask {
+        std::vector<std::bitset<NUM_TILE_COORDS>> rowsInColumn;
+
+    public:
+        TileMask() : rowsInColumn(NUM_TILE_COORDS) {}
+
+        bool test(const tile_type& tile) const
+        { return rowsInColumn[tile.col][tile.row]; }
+        void set(const tile_type& tile)
+        { rowsInColumn[tile.col].set(tile.row); }
+    };
+
+    // Tiles of one graph in aie_metadata.graphs or aie_metadata.EventGraphs.
+    // The column, row, and other lists are parallel and must be at least as
+    // long as the column list.
+    std::vector<tile_type>
+    parseGraphTiles(const pt::ptree& graph, const char* col_name,
+                    const char* row_name, const char* rowError,
+                    uint8_t rowOffset)
+    {
+        std::vector<tile_type> tiles;
+        for (auto& node : graph.get_child(col_name)) {
+            tile_type t;
+            t.col = xdp::aie::convertStringToUint8(node.second.data());
+            tiles.emplace_back(std::move(t));
+        }
+
+        size_t count = 0;
+        for (auto& node : graph.get_child(row_name))
+            tiles.at(count++).row = xdp::aie::convertStringToUint8(node.second.data()) + rowOffset;
+        xdp::aie::throwIfError(count < tiles.size(), rowError);
+        return tiles;
+    }
+
+} // end anonymous namespace
+
+struct AIEControlConfigFiletype::Index
+{
+    // A section that has not been queried yet is not parsed. A section
+    // that is not in the metadata is remembered as not found.
+    template <typename T>
+    struct Section {
+        bool built = false;
+        bool found = false;
+        T value;
+    };
+
+    // A PLIO or GMIO with its name split into graph and port
+    struct Port {
+        io_config io;
+        std::string graph;
+        std::string port;
+    };
+
+    struct Interfaces {
+        std::vector<Port> ports;
+        // Ports by port name and by logical name, in the order of ports
+        std::unordered_map<std::string, std::vector<uint32_t>> byName;
+        // Ports by shim column, in the order of ports
+        std::vector<std::vector<uint32_t>> byColumn =
+            std::vector<std::vector<uint32_t>>(NUM_TILE_COORDS);
+        std::bitset<NUM_TILE_COORDS> usedColumns;
+    };
+
+    struct Graph {
+        std::string name;
+        std::vector<tile_type> tiles;
+    };
+
+    struct Graphs {
+        std::vector<Graph> list;
+        // Graphs by name, in the order of list
+        std::unordered_map<std::string, std::vector<uint32_t>> byName;
+    };
+
+    struct EventGraph {
+        std::string name;
+        std::vector<tile_type> coreTiles;
+        std::vector<tile_type> dmaTiles;
+    };
+
+    struct SharedBuffer {
+        std::string graph;
+        std::string bufferName;
+        tile_type tile;
+    };
+
+    struct KernelTile {
+        std::string graph;
+        uint8_t col;
+        uint8_t row;
+    };
+
+    struct Kernels {
+        std::vector<KernelTile> tiles;
+        // Tiles by every part of the function name, in the order of tiles
+        std::unordered_map<std::string, std::vector<uint32_t>> byName;
+    };
+
+    std::mutex lock; // Protects the flags of every section and the gmios map
+    Section<IOMap> plios;
+    std::map<std::string, Section<IOMap>> gmios; // By metadata path
+    Section<Interfaces> interfaces;
+    Section<Graphs> graphs;
+    Section<std::vector<EventGraph>> eventGraphs;
+    Section<std::vector<SharedBuffer>> sharedBuffers;
+    Section<Kernels> kernels;
+
+    // Returns the section, parsing it the first time, or null if it is
+    // not in the metadata. Parsing is done without holding the lock since
+    // some sections are built from others. If parsing throws, nothing is
+    // kept and the next query fails the same way.
+    template <typename T, typename Parse>
+    const T* get(Section<T>& section, Parse parse)
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (section.built)
+                return section.found ? &section.value : nullptr;
+        }
+
+        T value;
+        bool found = parse(value);
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (!section.built) {
+            section.value = std::move(value);
+            section.found = found;
+            section.built = true;
+        }
+        return section.found ? &section.value : nullptr;
+    }
+
+    Section<IOMap>& gmioSection(const std::string& path)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return gmios[path];
+    }
+};
+
 AIEControlConfigFiletype::AIEControlConfigFiletype(boost::property_tree::ptree& aie_project)
-: BaseFiletypeImpl(aie_project) {}
+: BaseFiletypeImpl(aie_project)
+, index(std::make_shared<Index>()) {}
 
 std::string
 AIEControlConfigFiletype::getMessage(std::string secName) const
@@ -194,32 +347,35 @@ AIEControlConfigFiletype::getTraceGMIOs() const
 std::unordered_map<std::string, io_config> 
 AIEControlConfigFiletype::getPLIOs() const
 {
-    auto pliosMetadata = aie_meta.get_child_optional("aie_metadata.PLIOs");
-    if (!pliosMetadata) {
+    auto plios = index->get(index->plios, [this](IOMap& plios) {
+        auto pliosMetadata = aie_meta.get_child_optional("aie_metadata.PLIOs");
+        if (!pliosMetadata)
+            return false;
+
+        for (auto& plio_node : pliosMetadata.get()) {
+            io_config plio;
+
+            plio.type = io_type::PLIO;
+            plio.id = plio_node.second.get<uint32_t>("id");
+            plio.name = plio_node.second.get<std::string>("name");
+            plio.logicalName = plio_node.second.get<std::string>("logical_name");
+            plio.shimColumn = plio_node.second.get<uint8_t>("shim_column");
+            plio.streamId = plio_node.second.get<uint8_t>("stream_id");
+            plio.slaveOrMaster = plio_node.second.get<bool>("slaveOrMaster");
+            plio.channelNum = 0;
+            plio.burstLength = 0;
+
+            std::string plioKey = xdp::aie::getGraphUniqueId(plio);
+            plios[plioKey] = plio;
+        }
+        return true;
+    });
+
+    if (!plios) {
         xrt_core::message::send(severity_level::info, "XRT", getMessage("PLIOs"));
         return {};
     }
-
-    std::unordered_map<std::string, io_config> plios;
-
-    for (auto& plio_node : pliosMetadata.get()) {
-        io_config plio;
-
-        plio.type = io_type::PLIO;
-        plio.id = plio_node.second.get<uint32_t>("id");
-        plio.name = plio_node.second.get<std::string>("name");
-        plio.logicalName = plio_node.second.get<std::string>("logical_name");
-        plio.shimColumn = plio_node.second.get<uint8_t>("shim_column");
-        plio.streamId = plio_node.second.get<uint8_t>("stream_id");
-        plio.slaveOrMaster = plio_node.second.get<bool>("slaveOrMaster");
-        plio.channelNum = 0;
-        plio.burstLength = 0;
-
-        std::string plioKey = xdp::aie::getGraphUniqueId(plio);
-        plios[plioKey] = plio;
-    }
-
-    return plios;
+    return *plios;
 }
 
 std::unordered_map<std::string, io_config>
@@ -240,41 +396,44 @@ AIEControlConfigFiletype::getAllIOs() const
 std::unordered_map<std::string, io_config>
 AIEControlConfigFiletype::getChildGMIOs( const std::string& childStr) const
 {
-    auto gmiosMetadata = aie_meta.get_child_optional(childStr);
-    if (!gmiosMetadata) {
+    auto gmios = index->get(index->gmioSection(childStr), [this, &childStr](IOMap& gmios) {
+        auto gmiosMetadata = aie_meta.get_child_optional(childStr);
+        if (!gmiosMetadata)
+            return false;
+
+        for (auto& gmio_node : gmiosMetadata.get()) {
+            io_config gmio;
+
+            // Channel is reported as a unique number:
+            //   0 : S2MM channel 0 (master/output)
+            //   1 : S2MM channel 1
+            //   2 : MM2S channel 0 (slave/input)
+            //   3 : MM2S channel 1
+            auto slaveOrMaster = gmio_node.second.get<uint8_t>("type");
+            auto channelNumber = gmio_node.second.get<uint8_t>("channel_number");
+
+            gmio.type = io_type::GMIO;
+            gmio.id = gmio_node.second.get<uint32_t>("id");
+            gmio.name = gmio_node.second.get<std::string>("name");
+            gmio.logicalName = gmio_node.second.get<std::string>("logical_name");
+            gmio.slaveOrMaster = slaveOrMaster;
+            gmio.shimColumn = gmio_node.second.get<uint8_t>("shim_column");
+            gmio.channelNum = (slaveOrMaster == 0) ? (channelNumber - 2) : channelNumber;
+            gmio.streamId = gmio_node.second.get<uint8_t>("stream_id");
+            gmio.burstLength = gmio_node.second.get<uint8_t>("burst_length_in_16byte");
+            // BD ID defaults to UINT16_MAX (computed in offload based on platform)
+
+            std::string gmioKey = xdp::aie::getGraphUniqueId(gmio);
+            gmios[gmioKey] = gmio;
+        }
+        return true;
+    });
+
+    if (!gmios) {
         xrt_core::message::send(severity_level::info, "XRT", getMessage(childStr));
         return {};
     }
-
-    std::unordered_map<std::string, io_config> gmios;
-
-    for (auto& gmio_node : gmiosMetadata.get()) {
-        io_config gmio;
-
-        // Channel is reported as a unique number:
-        //   0 : S2MM channel 0 (master/output)
-        //   1 : S2MM channel 1
-        //   2 : MM2S channel 0 (slave/input)
-        //   3 : MM2S channel 1
-        auto slaveOrMaster = gmio_node.second.get<uint8_t>("type");
-        auto channelNumber = gmio_node.second.get<uint8_t>("channel_number");
-
-        gmio.type = io_type::GMIO;
-        gmio.id = gmio_node.second.get<uint32_t>("id");
-        gmio.name = gmio_node.second.get<std::string>("name");
-        gmio.logicalName = gmio_node.second.get<std::string>("logical_name");
-        gmio.slaveOrMaster = slaveOrMaster;
-        gmio.shimColumn = gmio_node.second.get<uint8_t>("shim_column");
-        gmio.channelNum = (slaveOrMaster == 0) ? (channelNumber - 2) : channelNumber;
-        gmio.streamId = gmio_node.second.get<uint8_t>("stream_id");
-        gmio.burstLength = gmio_node.second.get<uint8_t>("burst_length_in_16byte");
-        // BD ID defaults to UINT16_MAX (computed in offload based on platform)
-
-        std::string gmioKey = xdp::aie::getGraphUniqueId(gmio);
-        gmios[gmioKey] = gmio;
-    }
-
-    return gmios;
+    return *gmios;
 }
 
 std::vector<tile_type>
@@ -339,51 +498,87 @@ AIEControlConfigFiletype::getInterfaceTiles(const std::string& graphName,
         return getMicrocontrollers();
     }
 
-    auto ios = getAllIOs();
+    // Built from getAllIOs so subclasses that find GMIOs elsewhere are covered
+    auto& interfaces = *index->get(index->interfaces, [this](Index::Interfaces& interfaces) {
+        for (auto& io : getAllIOs()) {
+            auto& name   = io.second.name;
+            auto namePos = name.find_last_of(".");
+            auto i       = static_cast<uint32_t>(interfaces.ports.size());
+
+            interfaces.ports.push_back({io.second, name.substr(0, namePos), name.substr(namePos+1)});
+            auto& port = interfaces.ports.back();
+            interfaces.byName[port.port].push_back(i);
+            if (port.io.logicalName != port.port)
+                interfaces.byName[port.io.logicalName].push_back(i);
+            interfaces.byColumn[port.io.shimColumn].push_back(i);
+            interfaces.usedColumns.set(port.io.shimColumn);
+        }
+        return true;
+    });
+
+    // Only look at ports with the requested name or in the requested columns
+    std::vector<uint32_t> candidates;
+    if (portName.compare("all") != 0) {
+        auto it = interfaces.byName.find(portName);
+        if (it != interfaces.byName.end())
+            candidates = it->second;
+    }
+    else if (useColumn) {
+        for (unsigned int col = minCol; col <= maxCol; ++col) {
+            if (interfaces.usedColumns[col])
+                candidates.insert(candidates.end(), interfaces.byColumn[col].begin(),
+                                  interfaces.byColumn[col].end());
+        }
+        std::sort(candidates.begin(), candidates.end());
+    }
+    else {
+        candidates.resize(interfaces.ports.size());
+        for (uint32_t i = 0; i < candidates.size(); ++i)
+            candidates[i] = i;
+    }
 
-    for (auto& io : ios) {
-        auto isMaster    = io.second.slaveOrMaster;
-        auto streamId    = io.second.streamId;
-        auto channelNum  = io.second.channelNum;
-        auto shimCol     = io.second.shimColumn;
-        auto logicalName = io.second.logicalName;
-        auto name        = io.second.name;
-        auto type        = io.second.type;
-        auto namePos     = name.find_last_of(".");
-        auto currGraph   = name.substr(0, namePos);
-        auto currPort    = name.substr(namePos+1);
+    // Make sure it's desired polarity
+    // NOTE: input = slave (data flowing from PLIO)
+    //       output = master (data flowing to PLIO)
+    // Metric sets that don't follow this naming convention take both.
+    bool anyPolarity = (metricStr == "packets") ||
+                       (metricStr == METRIC_LATENCY) ||
+                       (metricStr == METRIC_BYTE_COUNT) ||
+                       (metricStr == "ddr_bandwidth") ||
+                       (metricStr == "read_bandwidth") ||
+                       (metricStr == "write_bandwidth") ||
+                       (metricStr == "peak_read_bandwidth") ||
+                       (metricStr == "peak_write_bandwidth") ||
+                       (metricStr == "detailed_ddr_read_bandwidth") ||
+                       (metricStr == "detailed_ddr_write_bandwidth");
+    bool useMasters = anyPolarity || (metricStr.find("output") != std::string::npos)
+                      || (metricStr.find("s2mm") != std::string::npos);
+    bool useSlaves  = anyPolarity || (metricStr.find("input") != std::string::npos)
+                      || (metricStr.find("mm2s") != std::string::npos);
+
+    // Read bandwidth only reports slaves and write bandwidth only masters
+    bool readOnly  = (metricStr == "read_bandwidth");
+    bool writeOnly = (metricStr == "write_bandwidth");
+
+    // Index in tiles of the tile found in each column, if any
+    std::vector<int> tileInColumn(NUM_TILE_COORDS, -1);
+
+    for (auto i : candidates) {
+        auto& port       = interfaces.ports[i];
+        auto isMaster    = port.io.slaveOrMaster;
+        auto streamId    = port.io.streamId;
+        auto channelNum  = port.io.channelNum;
+        auto shimCol     = port.io.shimColumn;
+        auto& name       = port.io.name;
+        auto type        = port.io.type;
 
         // Make sure this matches what we're looking for
-        if ((portName.compare("all") != 0)
-            && (portName.compare(currPort) != 0)
-            && (portName.compare(logicalName) != 0))
-            continue;
         if ((graphName.compare("all") != 0)
-            && (currGraph.find(graphName) == std::string::npos)
+            && (port.graph.find(graphName) == std::string::npos)
             && !useColumn)
             continue;
-
-        // Make sure it's desired polarity
-        // NOTE: input = slave (data flowing from PLIO)
-        //       output = master (data flowing to PLIO)
-        if ((isMaster && (metricStr.find("output") == std::string::npos)
-                && (metricStr.find("s2mm") == std::string::npos))
-            || (!isMaster && (metricStr.find("input") == std::string::npos)
-                && (metricStr.find("mm2s") == std::string::npos)))
-        {
-            // Catch metric sets that don't follow above naming convention
-            if ((metricStr != "packets") &&
-                (metricStr != METRIC_LATENCY) &&
-                (metricStr != METRIC_BYTE_COUNT) &&
-                (metricStr != "ddr_bandwidth") &&
-                (metricStr != "read_bandwidth") &&
-                (metricStr != "write_bandwidth") &&
-                (metricStr != "peak_read_bandwidth") &&
-                (metricStr != "peak_write_bandwidth") &&
-                (metricStr != "detailed_ddr_read_bandwidth") &&
-                (metricStr != "detailed_ddr_write_bandwidth"))
-                continue;
-        }
+        if (isMaster ? !useMasters : !useSlaves)
+            continue;
 
         // Make sure column is within specified range (if specified)
         if (useColumn && !((minCol <= shimCol) && (shimCol <= maxCol)))
@@ -399,21 +594,14 @@ AIEControlConfigFiletype::getInterfaceTiles(const std::string& graphName,
             continue;
         }
 
-        tile_type tile;
-        tile.col = shimCol;
-        tile.row = 0;
-        
+        bool addStream = readOnly ? !isMaster : (writeOnly ? isMaster : true);
+
         // Check if tile was already found
-        auto it = std::find_if(tiles.begin(), tiles.end(), compareTileByLoc(tile));
-        if (it != tiles.end()) {
+        if (tileInColumn[shimCol] >= 0) {
+            auto it = tiles.begin() + tileInColumn[shimCol];
+
             // Add to the existing lists of stream IDs and master/slave
-            if ((metricStr == "read_bandwidth") && (!isMaster)) {
-              it->stream_ids.push_back(streamId);
-              it->is_master_vec.push_back(isMaster);
-            } else if ((metricStr == "write_bandwidth") && (isMaster)) {
-              it->stream_ids.push_back(streamId);
-              it->is_master_vec.push_back(isMaster);
-            } else if ((metricStr != "read_bandwidth") && (metricStr != "write_bandwidth")) {
+            if (addStream) {
               it->stream_ids.push_back(streamId);
               it->is_master_vec.push_back(isMaster);
             }
@@ -440,15 +628,12 @@ AIEControlConfigFiletype::getInterfaceTiles(const std::string& graphName,
             }
         }
         else {
+            tile_type tile;
+            tile.col = shimCol;
+            tile.row = 0;
+
             // Add first stream ID and master/slave to vectors for new tile
-            if ((metricStr == "read_bandwidth") && (!isMaster)) {
-                tile.stream_ids.push_back(streamId);
-                tile.is_master_vec.push_back(isMaster);
-            } else if ((metricStr == "write_bandwidth") && (isMaster)) {
-                tile.stream_ids.push_back(streamId);
-                tile.is_master_vec.push_back(isMaster);
-            }
-            else if ((metricStr != "read_bandwidth") && (metricStr != "write_bandwidth")) {
+            if (addStream) {
                 tile.stream_ids.push_back(streamId);
                 tile.is_master_vec.push_back(isMaster);
             }
@@ -474,6 +659,7 @@ AIEControlConfigFiletype::getInterfaceTiles(const std::string& graphName,
             }
 
             tile.subtype = type;
+            tileInColumn[shimCol] = static_cast<int>(tiles.size());
             tiles.emplace_back(std::move(tile));
         }
     }
@@ -495,52 +681,67 @@ AIEControlConfigFiletype::getMemoryTiles(const std::string& graph_name,
         return {};
 
     // Grab all shared buffers
-    auto sharedBufferTree = 
-        aie_meta.get_child_optional("aie_metadata.TileMapping.SharedBufferToTileMapping");
-    if (!sharedBufferTree) {
+    auto sharedBuffers = index->get(index->sharedBuffers, [this](std::vector<Index::SharedBuffer>& sharedBuffers) {
+        auto sharedBufferTree = 
+            aie_meta.get_child_optional("aie_metadata.TileMapping.SharedBufferToTileMapping");
+        if (!sharedBufferTree)
+            return false;
+
+        // Always one row of interface tiles
+        uint8_t rowOffset = 1;
+
+        // Now parse all shared buffers
+        for (auto const &shared_buffer : sharedBufferTree.get()) {
+            Index::SharedBuffer buffer;
+            buffer.graph = shared_buffer.second.get<std::string>("graph");
+            buffer.bufferName = shared_buffer.second.get<std::string>("bufferName");
+
+            auto& tile = buffer.tile;
+            tile.col = shared_buffer.second.get<uint8_t>("column");
+            tile.row = shared_buffer.second.get<uint8_t>("row") + rowOffset;
+
+            // Store names of DMA channels for reporting purposes
+            for (auto& chan : shared_buffer.second.get_child("dmaChannels")) {
+                auto channel = chan.second.get<uint8_t>("channel");
+                if (channel >= NUM_MEM_CHANNELS) {
+                  xrt_core::message::send(severity_level::info, "XRT", "Unable to store dmaChannel");
+                  continue;
+                }
+
+                if (chan.second.get<std::string>("direction") == "s2mm")
+                  tile.s2mm_names[channel] = chan.second.get<std::string>("name");
+                else
+                  tile.mm2s_names[channel] = chan.second.get<std::string>("name");
+            }
+
+            sharedBuffers.emplace_back(std::move(buffer));
+        }
+        return true;
+    });
+
+    if (!sharedBuffers) {
         xrt_core::message::send(severity_level::info, "XRT", 
             getMessage("TileMapping.SharedBufferToTileMapping"));
         return {};
     }
 
-    std::vector<tile_type> allTiles;
     std::vector<tile_type> memTiles;
-    // Always one row of interface tiles
-    uint8_t rowOffset = 1;
 
-    // Now parse all shared buffers
-    for (auto const &shared_buffer : sharedBufferTree.get()) {
-        auto currGraph = shared_buffer.second.get<std::string>("graph");
-        if ((currGraph.find(graph_name) == std::string::npos)
+    for (auto& buffer : *sharedBuffers) {
+        if ((buffer.graph.find(graph_name) == std::string::npos)
             && (graph_name.compare("all") != 0))
             continue;
-        auto currBuffer = shared_buffer.second.get<std::string>("bufferName");
-        if ((currBuffer.find(buffer_name) == std::string::npos)
+        if ((buffer.bufferName.find(buffer_name) == std::string::npos)
             && (buffer_name.compare("all") != 0))
             continue;
 
-        tile_type tile;
-        tile.col = shared_buffer.second.get<uint8_t>("column");
-        tile.row = shared_buffer.second.get<uint8_t>("row") + rowOffset;
-
-        // Store names of DMA channels for reporting purposes
-        for (auto& chan : shared_buffer.second.get_child("dmaChannels")) {
-            auto channel = chan.second.get<uint8_t>("channel");
-            if (channel >= NUM_MEM_CHANNELS) {
-              xrt_core::message::send(severity_level::info, "XRT", "Unable to store dmaChannel");
-              continue;
-            }
-
-            if (chan.second.get<std::string>("direction") == "s2mm")
-              tile.s2mm_names[channel] = chan.second.get<std::string>("name");
-            else
-              tile.mm2s_names[channel] = chan.second.get<std::string>("name");
-        }
-
-        allTiles.emplace_back(std::move(tile));
+        // Skip repeats of the previous tile
+        if (!memTiles.empty() && (memTiles.back().col == buffer.tile.col)
+            && (memTiles.back().row == buffer.tile.row))
+            continue;
+        memTiles.push_back(buffer.tile);
     }
 
-    std::unique_copy(allTiles.begin(), allTiles.end(), std::back_inserter(memTiles), xdp::aie::tileCompare);
     return memTiles;
 }
 
@@ -548,58 +749,65 @@ AIEControlConfigFiletype::getMemoryTiles(const std::string& graph_name,
 std::vector<tile_type> 
 AIEControlConfigFiletype::getAIETiles(const std::string& graph_name) const
 {
-    auto graphsMetadata = aie_meta.get_child_optional("aie_metadata.graphs");
-    if (!graphsMetadata) {
+    auto graphs = index->get(index->graphs, [this](Index::Graphs& graphs) {
+        auto graphsMetadata = aie_meta.get_child_optional("aie_metadata.graphs");
+        if (!graphsMetadata)
+            return false;
+
+        auto rowOffset = getAIETileRowOffset();
+
+        for (auto& graph : graphsMetadata.get()) {
+            Index::Graph entry;
+            entry.name = graph.second.get<std::string>("name");
+            entry.tiles = parseGraphTiles(graph.second, "core_columns", "core_rows",
+                                          "core_rows < num_tiles", rowOffset);
+            auto& tiles = entry.tiles;
+            for (auto& t : tiles)
+                t.active_core = true;
+
+            size_t count = 0;
+            for (auto& node : graph.second.get_child("iteration_memory_columns"))
+                tiles.at(count++).is_master_vec.push_back(xdp::aie::convertStringToUint8(node.second.data()));
+            xdp::aie::throwIfError(count < tiles.size(),"iteration_memory_columns < num_tiles");
+
+            count = 0;
+            for (auto& node : graph.second.get_child("iteration_memory_rows"))
+                tiles.at(count++).stream_ids.push_back(xdp::aie::convertStringToUint8(node.second.data()));
+            xdp::aie::throwIfError(count < tiles.size(),"iteration_memory_rows < num_tiles");
+
+            count = 0;
+            for (auto& node : graph.second.get_child("iteration_memory_addresses"))
+                tiles.at(count++).itr_mem_addr = std::stoul(node.second.data());
+            xdp::aie::throwIfError(count < tiles.size(),"iteration_memory_addresses < num_tiles");
+
+            count = 0;
+            for (auto& node : graph.second.get_child("multirate_triggers"))
+                tiles.at(count++).is_trigger = (node.second.data() == "true");
+            xdp::aie::throwIfError(count < tiles.size(),"multirate_triggers < num_tiles");
+
+            graphs.byName[entry.name].push_back(static_cast<uint32_t>(graphs.list.size()));
+            graphs.list.emplace_back(std::move(entry));
+        }
+        return true;
+    });
+
+    if (!graphs) {
         xrt_core::message::send(severity_level::info, "XRT", getMessage("graphs"));
         return {};
     }
 
     std::vector<tile_type> tiles;
-    auto rowOffset = getAIETileRowOffset();
-    int startCount = 0;
-
-    for (auto& graph : graphsMetadata.get()) {
-        if ((graph.second.get<std::string>("name") != graph_name)
-            && (graph_name.compare("all") != 0))
-            continue;
-
-        int count = startCount;
-        for (auto& node : graph.second.get_child("core_columns")) {
-            tiles.push_back(tile_type());
-            auto& t = tiles.at(count++);
-            t.col = xdp::aie::convertStringToUint8(node.second.data());
-            t.active_core = true;
-        }
-
-        int num_tiles = count;
-        count = startCount;
-        for (auto& node : graph.second.get_child("core_rows"))
-            tiles.at(count++).row = xdp::aie::convertStringToUint8(node.second.data()) + rowOffset;
-        xdp::aie::throwIfError(count < num_tiles,"core_rows < num_tiles");
-
-        count = startCount;
-        for (auto& node : graph.second.get_child("iteration_memory_columns"))
-            tiles.at(count++).is_master_vec.push_back(xdp::aie::convertStringToUint8(node.second.data()));
-        xdp::aie::throwIfError(count < num_tiles,"iteration_memory_columns < num_tiles");
-
-        count = startCount;
-        for (auto& node : graph.second.get_child("iteration_memory_rows"))
-            tiles.at(count++).stream_ids.push_back(xdp::aie::convertStringToUint8(node.second.data()));
-        xdp::aie::throwIfError(count < num_tiles,"iteration_memory_rows < num_tiles");
-
-        count = startCount;
-        for (auto& node : graph.second.get_child("iteration_memory_addresses"))
-            tiles.at(count++).itr_mem_addr = std::stoul(node.second.data());
-        xdp::aie::throwIfError(count < num_tiles,"iteration_memory_addresses < num_tiles");
-
-        count = startCount;
-        for (auto& node : graph.second.get_child("multirate_triggers"))
-            tiles.at(count++).is_trigger = (node.second.data() == "true");
-        xdp::aie::throwIfError(count < num_tiles,"multirate_triggers < num_tiles");
-
-        startCount = count;
+    if (graph_name.compare("all") == 0) {
+        for (auto& graph : graphs->list)
+            tiles.insert(tiles.end(), graph.tiles.begin(), graph.tiles.end());
+        return tiles;
     }
 
+    auto it = graphs->byName.find(graph_name);
+    if (it == graphs->byName.end())
+        return tiles;
+    for (auto i : it->second)
+        tiles.insert(tiles.end(), graphs->list[i].tiles.begin(), graphs->list[i].tiles.end());
     return tiles;
 }
 
@@ -611,19 +819,28 @@ AIEControlConfigFiletype::getAllAIETiles(const std::string& graph_name) const
     tiles = getEventTiles(graph_name, module_type::core);
     auto dmaTiles = getEventTiles(graph_name, module_type::dma);
 
+    // All event tiles are of the same subtype, so location is enough to
+    // tell them apart
+    TileMask coreMask;
+    TileMask dmaMask;
+    for (auto& tile : tiles)
+        coreMask.set(tile);
+    for (auto& tile : dmaTiles)
+        dmaMask.set(tile);
+
     // Specify if active core tiles also have active DMAs
     for (auto& tile : tiles)
-        tile.active_memory = (std::find(dmaTiles.begin(), dmaTiles.end(), tile) != dmaTiles.end());
+        tile.active_memory = dmaMask.test(tile);
 
     // Identify and add DMA-only tiles to list
     for (auto& tile : dmaTiles) {
-        if (std::find(tiles.begin(), tiles.end(), tile) == tiles.end()) {
+        if (!coreMask.test(tile)) {
+            coreMask.set(tile);
             tile.active_core = false;
             tile.active_memory = true;
             tiles.push_back(tile);
         }
     }
-    //std::unique_copy(dmaTiles.begin(), dmaTiles.end(), back_inserter(tiles), xdp::aie::tileCompare);
     return tiles;
 }
 
@@ -634,47 +851,47 @@ AIEControlConfigFiletype::getEventTiles(const std::string& graph_name,
     if ((type == module_type::shim) || (type == module_type::mem_tile))
         return {};
 
-    auto graphsMetadata = aie_meta.get_child_optional("aie_metadata.EventGraphs");
-    if (!graphsMetadata) {
+    auto graphs = index->get(index->eventGraphs, [this](std::vector<Index::EventGraph>& graphs) {
+        auto graphsMetadata = aie_meta.get_child_optional("aie_metadata.EventGraphs");
+        if (!graphsMetadata)
+            return false;
+
+        auto rowOffset = getAIETileRowOffset();
+
+        for (auto& graph : graphsMetadata.get()) {
+            Index::EventGraph entry;
+            entry.name = graph.second.get<std::string>("name");
+            entry.coreTiles = parseGraphTiles(graph.second, "core_columns", "core_rows",
+                                              "rows < num_tiles", rowOffset);
+            for (auto& t : entry.coreTiles)
+                t.active_core = true;
+            entry.dmaTiles = parseGraphTiles(graph.second, "dma_columns", "dma_rows",
+                                             "rows < num_tiles", rowOffset);
+            for (auto& t : entry.dmaTiles)
+                t.active_memory = true;
+            graphs.emplace_back(std::move(entry));
+        }
+        return true;
+    });
+
+    if (!graphs) {
         xrt_core::message::send(severity_level::info, "XRT", getMessage("EventGraphs"));
         return {};
     }
 
-    const char* col_name = (type == module_type::core) ? "core_columns" : "dma_columns";
-    const char* row_name = (type == module_type::core) ?    "core_rows" :    "dma_rows";
-
     std::vector<tile_type> tiles;
-    auto rowOffset = getAIETileRowOffset();
-    int startCount = 0;
 
-    for (auto& graph : graphsMetadata.get()) {
+    for (auto& graph : *graphs) {
         // Make sure this is requested graph
         // NOTE: Only top-level graphs are currently listed in metadata,
         // so search is reversed to support sub-graph requests
         // (e.g., "mygraph" is found in "mygraph.subgraph1")
-        auto currGraph = graph.second.get<std::string>("name");
-        if ((graph_name.find(currGraph) == std::string::npos)
+        if ((graph_name.find(graph.name) == std::string::npos)
             && (graph_name.compare("all") != 0))
             continue;
 
-        int count = startCount;
-        for (auto& node : graph.second.get_child(col_name)) {
-            tiles.push_back(tile_type());
-            auto& t = tiles.at(count++);
-            t.col = xdp::aie::convertStringToUint8(node.second.data());
-            if (type == module_type::core)
-              t.active_core = true;
-            else
-              t.active_memory = true;
-        }
-
-        int num_tiles = count;
-        count = startCount;
-        for (auto& node : graph.second.get_child(row_name))
-            tiles.at(count++).row = xdp::aie::convertStringToUint8(node.second.data()) + rowOffset;
-        xdp::aie::throwIfError(count < num_tiles,"rows < num_tiles");
-
-        startCount = count;
+        auto& graphTiles = (type == module_type::core) ? graph.coreTiles : graph.dmaTiles;
+        tiles.insert(tiles.end(), graphTiles.begin(), graphTiles.end());
     }
 
     return tiles;
@@ -695,36 +912,59 @@ AIEControlConfigFiletype::getTiles(const std::string& graph_name,
         return getAllAIETiles(graph_name);
 
     // Search by graph-kernel pairs
-    auto kernelToTileMapping = aie_meta.get_child_optional("aie_metadata.TileMapping.AIEKernelToTileMapping");
-    if (!kernelToTileMapping && (kernel_name.compare("all") == 0))
+    auto kernels = index->get(index->kernels, [this](Index::Kernels& kernels) {
+        auto kernelToTileMapping = aie_meta.get_child_optional("aie_metadata.TileMapping.AIEKernelToTileMapping");
+        if (!kernelToTileMapping)
+            return false;
+
+        auto rowOffset = getAIETileRowOffset();
+
+        for (auto const &mapping : kernelToTileMapping.get()) {
+            auto i = static_cast<uint32_t>(kernels.tiles.size());
+
+            Index::KernelTile tile;
+            tile.graph = mapping.second.get<std::string>("graph");
+            tile.col = mapping.second.get<uint8_t>("column");
+            tile.row = mapping.second.get<uint8_t>("row") + rowOffset;
+            kernels.tiles.emplace_back(std::move(tile));
+
+            std::vector<std::string> names;
+            std::string functionStr = mapping.second.get<std::string>("function");
+            boost::split(names, functionStr, boost::is_any_of("."));
+            for (auto& name : names) {
+                auto& list = kernels.byName[name];
+                if (list.empty() || (list.back() != i))
+                    list.push_back(i);
+            }
+        }
+        return true;
+    });
+
+    if (!kernels && (kernel_name.compare("all") == 0))
         return getAIETiles(graph_name);
-    if (!kernelToTileMapping) {
+    if (!kernels) {
         xrt_core::message::send(severity_level::info, "XRT", getMessage("TileMapping.AIEKernelToTileMapping"));
         return {};
     }
 
     std::vector<tile_type> tiles;
-    auto rowOffset = getAIETileRowOffset();
 
-    // Traverse all tiles in kernel map
-    for (auto const &mapping : kernelToTileMapping.get()) {
+    // Only look at tiles used by the kernel
+    auto it = kernels->byName.find(kernel_name);
+    if (it == kernels->byName.end())
+        return tiles;
+
+    for (auto i : it->second) {
         // Make sure this tile is what we're looking for
-        auto currGraph = mapping.second.get<std::string>("graph");
-        if ((currGraph.find(graph_name) == std::string::npos)
+        auto& mapping = kernels->tiles[i];
+        if ((mapping.graph.find(graph_name) == std::string::npos)
             && (graph_name.compare("all") != 0)) 
             continue;
-        if (kernel_name.compare("all") != 0) {
-            std::vector<std::string> names;
-            std::string functionStr = mapping.second.get<std::string>("function");
-            boost::split(names, functionStr, boost::is_any_of("."));
-            if (std::find(names.begin(), names.end(), kernel_name) == names.end())
-                continue;
-        }
 
         // Store this tile
         tile_type tile;
-        tile.col = mapping.second.get<uint8_t>("column");
-        tile.row = mapping.second.get<uint8_t>("row") + rowOffset;
+        tile.col = mapping.col;
+        tile.row = mapping.row;
         tile.active_core = true;
         tile.active_memory = true;
         tiles.emplace_back(std::move(tile));
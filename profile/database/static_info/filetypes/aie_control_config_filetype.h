@@ -1,11 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef AIE_CONTROL_CONFIG_FILETYPE_DOT_H
 #define AIE_CONTROL_CONFIG_FILETYPE_DOT_H
 
 #include "base_filetype_impl.h"
 #include <boost/property_tree/ptree.hpp>
+#include <memory>
 
 // ***************************************************************
 // The implementation specific to the aie_control_config.json file
@@ -99,7 +100,15 @@ class AIEControlConfigFiletype : public xdp::aie::BaseFiletypeImpl {
 
     protected:
         std::string getMessage(std::string secName) const;
-        
+
+    private:
+        // The sections queried while configuring the plugins are parsed
+        // into flat, indexed tables the first time they are used, so
+        // repeated queries per graph, port, and metric do not walk the
+        // property tree again. aie_meta never changes after construction,
+        // so copies of this object share the tables.
+        struct Index;
+        std::shared_ptr<Index> index;
 };
 
 } // namespace xdp::aie
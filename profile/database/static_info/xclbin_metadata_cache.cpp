@@ -0,0 +1,145 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+
+#include "core/common/message.h"
+
+#include "xdp/profile/database/static_info/aie_util.h"
+#include "xdp/profile/database/static_info/filetypes/base_filetype_impl.h"
+#include "xdp/profile/database/static_info/pl_constructs.h"
+#include "xdp/profile/database/static_info/xclbin_metadata_cache.h"
+
+namespace xdp {
+
+  template <typename T>
+  std::shared_ptr<const T>
+  XclbinMetadataCache::lookup(const xrt_core::uuid& uuid, Slot<T> Entry::* slot,
+                              const std::function<std::shared_ptr<const T> ()>& parse)
+  {
+    // An xclbin without a UUID cannot be told apart from any other
+    if (!uuid)
+      return parse();
+
+    {
+      std::lock_guard<std::mutex> lock(cacheLock);
+      auto itr = entries.find(uuid);
+      if (itr != entries.end() && (itr->second.*slot).parsed)
+        return (itr->second.*slot).value;
+    }
+
+    // Parse without holding the lock.  If two threads parse the same
+    //  section at the same time, the first one to finish is kept.
+    auto value = parse();
+
+    std::lock_guard<std::mutex> lock(cacheLock);
+    auto itr = entries.find(uuid);
+    if (itr == entries.end()) {
+      if (entries.size() >= MAX_XCLBINS) {
+        entries.erase(insertionOrder.front());
+        insertionOrder.pop_front();
+      }
+      itr = entries.emplace(uuid, Entry()).first;
+      insertionOrder.push_back(uuid);
+
+      xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
+                              "Caching parsed metadata of xclbin " + uuid.to_string());
+    }
+
+    auto& cached = itr->second.*slot;
+    if (!cached.parsed) {
+      cached.parsed = true;
+      cached.value = value;
+    }
+    return cached.value;
+  }
+
+  std::shared_ptr<const XclbinMetadataCache::ptree>
+  XclbinMetadataCache::getSystemMetadata(const xrt_core::uuid& uuid, Section section)
+  {
+    return lookup<ptree>(uuid, &Entry::systemMetadata,
+      [&section]() -> std::shared_ptr<const ptree> {
+        if (section.first == nullptr || section.second == 0)
+          return nullptr;
+        try {
+          std::stringstream ss;
+          ss.write(section.first, section.second);
+
+          auto pt = std::make_shared<ptree>();
+          boost::property_tree::read_json(ss, *pt);
+          return pt;
+        } catch(...) {
+          return nullptr;
+        }
+      });
+  }
+
+  std::shared_ptr<const XclbinMetadataCache::ptree>
+  XclbinMetadataCache::getEmbeddedMetadata(const xrt_core::uuid& uuid, Section section)
+  {
+    return lookup<ptree>(uuid, &Entry::embeddedMetadata,
+      [&section]() -> std::shared_ptr<const ptree> {
+        if (section.first == nullptr || section.second == 0)
+          return nullptr;
+
+        std::stringstream ss;
+        ss.write(section.first, section.second);
+
+        auto pt = std::make_shared<ptree>();
+        boost::property_tree::read_xml(ss, *pt);
+        return pt;
+      });
+  }
+
+  std::shared_ptr<const aie::BaseFiletypeImpl>
+  XclbinMetadataCache::getAIEMetadata(const xrt_core::uuid& uuid, Section section)
+  {
+    return lookup<aie::BaseFiletypeImpl>(uuid, &Entry::aieMetadata,
+      [&section]() -> std::shared_ptr<const aie::BaseFiletypeImpl> {
+        if (section.first == nullptr || section.second == 0)
+          return nullptr;
+
+        ptree aieMetadata;
+        return aie::readAIEMetadata(section.first, section.second, aieMetadata);
+      });
+  }
+
+  std::shared_ptr<const IpMetadata>
+  XclbinMetadataCache::getIpMetadata(const xrt_core::uuid& uuid, Section section)
+  {
+    return lookup<IpMetadata>(uuid, &Entry::ipMetadata,
+      [&section]() -> std::shared_ptr<const IpMetadata> {
+        if (section.first == nullptr || section.second == 0)
+          return nullptr;
+        try {
+          std::stringstream ss;
+          ss.write(section.first, section.second);
+
+          ptree pt;
+          boost::property_tree::read_json(ss, pt);
+          return std::make_shared<IpMetadata>(pt);
+        } catch(...) {
+          return nullptr;
+        }
+      });
+  }
+
+} // end namespace xdp
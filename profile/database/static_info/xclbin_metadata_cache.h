@@ -0,0 +1,110 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef XCLBIN_METADATA_CACHE_DOT_H
+#define XCLBIN_METADATA_CACHE_DOT_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "core/common/uuid.h"
+
+namespace xdp {
+
+  namespace aie {
+    class BaseFiletypeImpl;
+  }
+  class IpMetadata;
+
+  // The parsed forms of the text sections of an xclbin (SYSTEM_METADATA,
+  //  EMBEDDED_METADATA, IP_METADATA, and the AIE metadata), keyed by the
+  //  xclbin UUID.  Applications that create hardware contexts for the
+  //  same few xclbins over and over only pay for the JSON and XML parsing
+  //  the first time each xclbin is seen.  Everything handed out is shared
+  //  and immutable, so it stays valid even after the xclbin is evicted.
+  class XclbinMetadataCache
+  {
+  public:
+    using ptree = boost::property_tree::ptree;
+    using Section = std::pair<const char*, size_t>;
+
+  private:
+    // Only the most recently added xclbins are kept
+    static constexpr std::size_t MAX_XCLBINS = 16;
+
+    // A section that has not been looked at yet is not parsed.  A section
+    //  that is missing or could not be parsed is cached as a null value.
+    template <typename T>
+    struct Slot
+    {
+      bool parsed = false;
+      std::shared_ptr<const T> value;
+    };
+
+    struct Entry
+    {
+      Slot<ptree> systemMetadata;
+      Slot<ptree> embeddedMetadata;
+      Slot<aie::BaseFiletypeImpl> aieMetadata;
+      Slot<IpMetadata> ipMetadata;
+    };
+
+    std::mutex cacheLock; // Protects everything below
+    std::map<xrt_core::uuid, Entry> entries;
+    std::deque<xrt_core::uuid> insertionOrder;
+
+    template <typename T>
+    std::shared_ptr<const T>
+    lookup(const xrt_core::uuid& uuid, Slot<T> Entry::* slot,
+           const std::function<std::shared_ptr<const T> ()>& parse);
+
+  public:
+    XclbinMetadataCache() = default;
+    ~XclbinMetadataCache() = default;
+
+    XclbinMetadataCache(const XclbinMetadataCache&) = delete;
+    XclbinMetadataCache& operator=(const XclbinMetadataCache&) = delete;
+
+    // Each of these returns null if the section is missing or could not
+    //  be parsed.  The section is only read the first time an xclbin is
+    //  seen, so passing it in again for a known xclbin costs nothing.
+    std::shared_ptr<const ptree>
+    getSystemMetadata(const xrt_core::uuid& uuid, Section section);
+
+    // EMBEDDED_METADATA is XML.  Errors while parsing it are passed on to
+    //  the caller and nothing is cached.
+    std::shared_ptr<const ptree>
+    getEmbeddedMetadata(const xrt_core::uuid& uuid, Section section);
+
+    // The reader for the AIE_TRACE_METADATA section, or the AIE_METADATA
+    //  section if there is none
+    std::shared_ptr<const aie::BaseFiletypeImpl>
+    getAIEMetadata(const xrt_core::uuid& uuid, Section section);
+
+    std::shared_ptr<const IpMetadata>
+    getIpMetadata(const xrt_core::uuid& uuid, Section section);
+  };
+
+} // end namespace xdp
+
+#endif
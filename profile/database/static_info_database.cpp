@@ -937,6 +937,39 @@ namespace xdp {
     return nullptr;
   }
 
+  std::shared_ptr<const AIECounterSnapshot>
+  VPStaticDatabase::getAIECounterSnapshot(uint64_t deviceId,
+                                          std::shared_ptr<const AIECounterSnapshot> cached)
+  {
+    // Read the version before looking at the counters so a change made
+    //  while the snapshot is being built always forces another rebuild
+    auto version = aieCounterVersion.load(std::memory_order_acquire) ;
+    if (cached && cached->version == version)
+      return cached ;
+
+    std::lock_guard<std::mutex> lock(deviceLock) ;
+
+    auto& published = aieCounterSnapshots[deviceId] ;
+    if (published && published->version == version)
+      return published ;
+
+    auto snapshot = std::make_shared<AIECounterSnapshot>() ;
+    snapshot->version = version ;
+
+    if (deviceInfo.find(deviceId) != deviceInfo.end()) {
+      ConfigInfo* config = deviceInfo[deviceId]->currentConfig() ;
+      XclbinInfo* xclbin = config ? config->getAieXclbin() : nullptr ;
+      if (xclbin) {
+        snapshot->counters.reserve(xclbin->aie.aieList.size()) ;
+        for (auto counter : xclbin->aie.aieList)
+          snapshot->counters.push_back(*counter) ;
+      }
+    }
+
+    published = snapshot ;
+    return published ;
+  }
+
   std::map<uint32_t, uint32_t>*
   VPStaticDatabase::getAIECoreCounterResources(uint64_t deviceId)
   {
@@ -1152,6 +1185,7 @@ namespace xdp {
       return ;
     deviceInfo[deviceId]->addAIECounter(i, col, row, num, start, end, reset,
                                         load, freq, mod, aieName, streamId) ;
+    ++aieCounterVersion ;
   }
 
   void VPStaticDatabase::addAIECounterResources(uint64_t deviceId,
@@ -1880,29 +1914,21 @@ namespace xdp {
   }
 
   void VPStaticDatabase::setXclbinName(XclbinInfo* currentXclbin,
-                                       const char* systemMetadataSection,
-                                       size_t systemMetadataSz)
+                                       const boost::property_tree::ptree* systemMetadata)
   {
     if (currentXclbin == nullptr)
       return;
 
     const char* defaultName = "default.xclbin";
 
-    if (systemMetadataSection == nullptr || systemMetadataSz <= 0) {
+    if (systemMetadata == nullptr) {
       // If there is no SYSTEM_METADATA section, use a default name
       currentXclbin->name = defaultName;
       return;
     }
 
     try {
-      std::stringstream ss;
-      ss.write(systemMetadataSection, systemMetadataSz);
-
-      // Create a property tree based off of the JSON
-      boost::property_tree::ptree pt;
-      boost::property_tree::read_json(ss, pt);
-
-      currentXclbin->name = pt.get<std::string>("system_diagram_metadata.xclbin.generated_by.xclbin_name", "");
+      currentXclbin->name = systemMetadata->get<std::string>("system_diagram_metadata.xclbin.generated_by.xclbin_name", "");
       if(!currentXclbin->name.empty()) {
         currentXclbin->name += ".xclbin";
       }
@@ -1912,32 +1938,22 @@ namespace xdp {
   }
 
   void VPStaticDatabase::addPortInfo(XclbinInfo* currentXclbin,
-                                     const char* systemMetadataSection,
-                                     size_t systemMetadataSz)
+                                     const boost::property_tree::ptree* systemMetadata)
   {
-    if (currentXclbin == nullptr || systemMetadataSection == nullptr ||
-        systemMetadataSz <= 0)
+    if (currentXclbin == nullptr || systemMetadata == nullptr)
       return;
 
-    // Parse the SYSTEM_METADATA section using boost property trees, which
-    // could throw exceptions in multiple ways.
+    // Walking the SYSTEM_METADATA property tree could throw exceptions
+    // in multiple ways.
     try {
-      std::stringstream ss;
-      ss.write(systemMetadataSection, systemMetadataSz);
+      const auto& top = systemMetadata->get_child("system_diagram_metadata");
 
-      // Create a property tree based off of the JSON
-      boost::property_tree::ptree pt;
-      boost::property_tree::read_json(ss, pt);
-
-      auto top = pt.get_child("system_diagram_metadata");
-
-      // Parse the xsa section for memory topology information
-      auto xsa = top.get_child("xsa");
-      auto device_topology = xsa.get_child("device_topology");
+      // The xsa section must have the memory topology information
+      top.get_child("xsa").get_child("device_topology");
 
       // Parse the xclbin section for compute unit port information
-      auto xclbin = top.get_child("xclbin");
-      auto user_regions = xclbin.get_child("user_regions");
+      const auto& xclbin = top.get_child("xclbin");
+      const auto& user_regions = xclbin.get_child("user_regions");
 
       // Temp data structures to hold mappings of each CU's argument to memory
       typedef std::pair<std::string, std::string> fullName;
@@ -1958,8 +1974,8 @@ namespace xdp {
       // We also need to know which argument goes to which memory
       for (auto& region : user_regions) {
         for (auto& connection : region.second.get_child("connectivity")) {
-          auto node1 = connection.second.get_child("node1");
-          auto node2 = connection.second.get_child("node2");
+          const auto& node1 = connection.second.get_child("node1");
+          const auto& node2 = connection.second.get_child("node2");
 
           auto arg = node1.get<std::string>("arg_name");
           auto cuId = node1.get<std::string>("id");
@@ -2048,54 +2064,40 @@ namespace xdp {
       return nullptr;
 
     auto data = device->get_axlf_section(IP_METADATA);
-    if (!data.first || !data.second)
+    auto ipMetadata = xclbinMetadata.getIpMetadata(xclbin->uuid, data);
+    if (!ipMetadata)
       return nullptr;
 
-    std::stringstream ss;
-    ss.write(data.first,data.second);
-    boost::property_tree::ptree pt;
-    try {
-      boost::property_tree::read_json(ss,pt);
-      return std::make_unique<IpMetadata>(pt);
-    } catch(...) {
-      return nullptr;
-    }
-    
+    // The caller gets its own copy of the shared parsed section
+    return std::make_unique<IpMetadata>(*ipMetadata);
   }
 
   void VPStaticDatabase::createComputeUnits(XclbinInfo* currentXclbin,
                                             const ip_layout* ipLayoutSection,
-                                            const char* systemMetadataSection,
-                                            size_t systemMetadataSz)
+                                            const boost::property_tree::ptree* systemMetadata)
   {
     if (currentXclbin == nullptr || ipLayoutSection == nullptr)
       return;
 
     //---------------------------------------------------------------------
     bool clockFlag = true;
-    boost::property_tree::ptree pt;
-    boost::property_tree::ptree user_regions;
+    static const boost::property_tree::ptree noRegions;
+    const boost::property_tree::ptree* user_regions = &noRegions;
 
-    if (systemMetadataSection == nullptr || systemMetadataSz <= 0) {
+    if (systemMetadata == nullptr) {
       clockFlag = false;
     }
 
     else {
 
-    // Parse the SYSTEM_METADATA section using boost property trees, which
-    // could throw exceptions in multiple ways.
+    // Walking the SYSTEM_METADATA property tree could throw exceptions
+    // in multiple ways.
     try{
-        std::stringstream ss;
-        ss.write(systemMetadataSection, systemMetadataSz);
-
-        // Create a property tree based off of the JSON
-        boost::property_tree::read_json(ss, pt);
-
-        auto top = pt.get_child("system_diagram_metadata");
+        const auto& top = systemMetadata->get_child("system_diagram_metadata");
 
         // Parse the xclbin section for compute unit port information
-        auto xclbin = top.get_child("xclbin");
-        user_regions = xclbin.get_child("user_regions");
+        const auto& xclbin = top.get_child("xclbin");
+        user_regions = &xclbin.get_child("user_regions");
     } catch(...) {
       // TODO: catch section
       clockFlag = false;
@@ -2133,7 +2135,7 @@ namespace xdp {
         try {
           // Keep track of all the compute unit names associated with the id
           // number so we can make the connection later.
-          for (auto& region : user_regions) {
+          for (auto& region : *user_regions) {
             for (auto& compute_unit : region.second.get_child("compute_units")) {
               auto cuNameSysMD = compute_unit.second.get<std::string>("cu_name");
               if ( 0 == cu->getName().compare(cuNameSysMD)) {
@@ -2228,26 +2230,18 @@ namespace xdp {
   }
 
   void VPStaticDatabase::annotateWorkgroupSize(XclbinInfo* currentXclbin,
-                                               const char* embeddedMetadataSection,
-                                               size_t embeddedMetadataSz)
+                                               const boost::property_tree::ptree* embeddedMetadata)
   {
-    if (currentXclbin == nullptr
-        || embeddedMetadataSection == nullptr
-        || embeddedMetadataSz <= 0)
+    if (currentXclbin == nullptr || embeddedMetadata == nullptr)
       return;
 
-    boost::property_tree::ptree xmlProject;
-    std::stringstream xmlStream;
-    xmlStream.write(embeddedMetadataSection, embeddedMetadataSz);
-    boost::property_tree::read_xml(xmlStream, xmlProject);
-
-    for(const auto& coreItem : xmlProject.get_child("project.platform.device.core")) {
+    for(const auto& coreItem : embeddedMetadata->get_child("project.platform.device.core")) {
       std::string coreItemName = coreItem.first;
       if(0 != coreItemName.compare("kernel")) {  // skip items other than "kernel"
         continue;
       }
-      auto kernel = coreItem;
-      auto kernelNameItem    = kernel.second.get_child("<xmlattr>");
+      const auto& kernel = coreItem;
+      const auto& kernelNameItem = kernel.second.get_child("<xmlattr>");
       std::string kernelName = kernelNameItem.get<std::string>("name", "");
 
       std::string x ;
@@ -2255,7 +2249,7 @@ namespace xdp {
       std::string z ;
 
       try {
-        auto workGroupSz = kernel.second.get_child("compileWorkGroupSize");
+        const auto& workGroupSz = kernel.second.get_child("compileWorkGroupSize");
         x = workGroupSz.get<std::string>("<xmlattr>.x", "");
         y = workGroupSz.get<std::string>("<xmlattr>.y", "");
         z = workGroupSz.get<std::string>("<xmlattr>.z", "");
@@ -2640,6 +2634,10 @@ namespace xdp {
 
   DeviceInfo* VPStaticDatabase::updateDevice(uint64_t deviceId, xrt::xclbin xrtXclbin, std::unique_ptr<xdp::Device> xdpDevice, bool clientBuild, bool readAIEdata)
   {
+    // Any AIE counters of the previous configuration go away.  The
+    //  version is bumped again once the new configuration is in place.
+    ++aieCounterVersion ;
+
     XclbinInfoType xclbinType = getXclbinType(xrtXclbin);
     // We need to update the device, but if we had an xclbin previously loaded
     //  then we need to mark it and remove the PL interface.  We'll
@@ -2713,6 +2711,7 @@ namespace xdp {
     initializeProfileMonitors(devInfo, std::move(xrtXclbin));
 
     devInfo->isReady = true;
+    ++aieCounterVersion ;
 
     if (xdpDevice != nullptr)
       createPLDeviceIntf(deviceId, std::move(xdpDevice), xclbinType);
@@ -2730,23 +2729,16 @@ namespace xdp {
       return;
     }
 
-    std::pair<const char*, size_t> systemMetadata =
-       xrt_core::xclbin_int::get_axlf_section(xrtXclbin, SYSTEM_METADATA);
+    auto systemMetadata = xclbinMetadata.getSystemMetadata(xrtXclbin.get_uuid(),
+      xrt_core::xclbin_int::get_axlf_section(xrtXclbin, SYSTEM_METADATA));
 
-    if (systemMetadata.first == nullptr || systemMetadata.second <= 0) {
+    if (systemMetadata == nullptr) {
       // There is no SYSTEM_METADATA section
       return;
     }
 
     try {
-      std::stringstream ss;
-      ss.write(systemMetadata.first, systemMetadata.second);
-
-      // Create a property tree based off of the JSON
-      boost::property_tree::ptree pt;
-      boost::property_tree::read_json(ss, pt);
-
-      deviceInfo[deviceId]->deviceName = pt.get<std::string>("system_diagram_metadata.xsa.name", "");
+      deviceInfo[deviceId]->deviceName = systemMetadata->get<std::string>("system_diagram_metadata.xsa.name", "");
     } catch(...) {
       return;
     }
@@ -2757,9 +2749,9 @@ namespace xdp {
     // If "checkDisk" is specified, then look on disk only for the files
     // Look for aie_trace_config first, then check for aie_control_config
     // only if we cannot find it.
-    boost::property_tree::ptree aieMetadata;
-    std::unique_ptr<aie::BaseFiletypeImpl> metadataReader;
     if (checkDisk) {
+      boost::property_tree::ptree aieMetadata;
+      std::unique_ptr<aie::BaseFiletypeImpl> metadataReader;
       metadataReader =
         aie::readAIEMetadata("aie_trace_config.json", aieMetadata);
       if (!metadataReader)
@@ -2783,10 +2775,8 @@ namespace xdp {
     if (!data.first || !data.second)
       data = xrt_core::xclbin_int::get_axlf_section(xrtXclbin, AIE_METADATA);
 
-    if (data.first && data.second) {
-      metadataReader =
-        aie::readAIEMetadata(data.first, data.second, aieMetadata);
-    }
+    // The reader is shared by every load of this xclbin
+    auto metadataReader = xclbinMetadata.getAIEMetadata(xrtXclbin.get_uuid(), data);
 
     if (!metadataReader) {
       xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT",
@@ -2798,7 +2788,7 @@ namespace xdp {
     }
   }
 
-  void VPStaticDatabase::addAIEmetadataReader(uint64_t deviceId, std::unique_ptr<aie::BaseFiletypeImpl> metadataReader)
+  void VPStaticDatabase::addAIEmetadataReader(uint64_t deviceId, std::shared_ptr<const aie::BaseFiletypeImpl> metadataReader)
   {
     std::lock_guard<std::mutex> lock(aieMetadataReaderLock) ;
     metadataReaders[deviceId] = std::move(metadataReader); 
@@ -2878,21 +2868,14 @@ namespace xdp {
 
     if (isEdge()) {
       // On Edge, we can try to get the "DATA_CLK" from the embedded metadata
-      std::pair<const char*, size_t> embeddedMetadata =
-        xrt_core::xclbin_int::get_axlf_section(xrtXclbin, EMBEDDED_METADATA);
+      auto embeddedMetadata = xclbinMetadata.getEmbeddedMetadata(xrtXclbin.get_uuid(),
+        xrt_core::xclbin_int::get_axlf_section(xrtXclbin, EMBEDDED_METADATA));
 
-      if (nullptr == embeddedMetadata.first || 0 == embeddedMetadata.second)
+      if (nullptr == embeddedMetadata)
         return defaultClockSpeed;
 
-      std::stringstream ss;
-      ss.write(embeddedMetadata.first, embeddedMetadata.second);
-
-      // Create a property tree based off of the XML
-      boost::property_tree::ptree pt;
-      boost::property_tree::read_xml(ss, pt);
-
       // Dig in and find all of the kernel clocks
-      for (auto& clock : pt.get_child("project.platform.device.core.kernelClocks")) {
+      for (auto& clock : embeddedMetadata->get_child("project.platform.device.core.kernelClocks")) {
         if (clock.first != "clock")
           continue;
 
@@ -2922,13 +2905,17 @@ namespace xdp {
     const ip_layout* ipLayoutSection =
       reinterpret_cast<const ip_layout*>(xrt_core::xclbin_int::get_axlf_section(xrtXclbin, IP_LAYOUT).first);
 
-    std::pair<const char*, size_t> systemMetadata =
+    std::pair<const char*, size_t> systemMetadataSection =
        xrt_core::xclbin_int::get_axlf_section(xrtXclbin, SYSTEM_METADATA);
 
     if(ipLayoutSection == nullptr)
       return true;
 
-    createComputeUnits(currentXclbin, ipLayoutSection,systemMetadata.first, systemMetadata.second);
+    // The JSON is only parsed the first time this xclbin is seen
+    auto systemMetadata =
+      xclbinMetadata.getSystemMetadata(currentXclbin->uuid, systemMetadataSection);
+
+    createComputeUnits(currentXclbin, ipLayoutSection, systemMetadata.get());
 
     // Step 2 -> Create the memory layout based on the MEM_TOPOLOGY section
     const mem_topology* memTopologySection =
@@ -2952,17 +2939,16 @@ namespace xdp {
 
     // Step 4 -> Annotate all the compute units with workgroup size using
     //           the EMBEDDED_METADATA section
-    std::pair<const char*, size_t> embeddedMetadata =
-       xrt_core::xclbin_int::get_axlf_section(xrtXclbin, EMBEDDED_METADATA);
+    auto embeddedMetadata = xclbinMetadata.getEmbeddedMetadata(currentXclbin->uuid,
+      xrt_core::xclbin_int::get_axlf_section(xrtXclbin, EMBEDDED_METADATA));
 
-    annotateWorkgroupSize(currentXclbin, embeddedMetadata.first,
-                          embeddedMetadata.second);
+    annotateWorkgroupSize(currentXclbin, embeddedMetadata.get());
 
     // Step 5 -> Fill in the details like the name of the xclbin using
     //           the SYSTEM_METADATA section
-    setXclbinName(currentXclbin, systemMetadata.first, systemMetadata.second);
-    db->updateSystemDiagram(systemMetadata.first, systemMetadata.second);
-    addPortInfo(currentXclbin, systemMetadata.first, systemMetadata.second);
+    setXclbinName(currentXclbin, systemMetadata.get());
+    db->updateSystemDiagram(systemMetadataSection.first, systemMetadataSection.second);
+    addPortInfo(currentXclbin, systemMetadata.get());
 
     return true;
   }
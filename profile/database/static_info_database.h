@@ -1,10 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright (C) 2016-2022 Xilinx, Inc
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef STATIC_INFO_DATABASE_DOT_H
 #define STATIC_INFO_DATABASE_DOT_H
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory> // for unique_ptr
@@ -19,6 +20,7 @@
 #include "xdp/profile/database/static_info/aie_util.h"
 #include "xdp/profile/database/static_info/aie_constructs.h"
 #include "xdp/profile/database/static_info/app_style.h"
+#include "xdp/profile/database/static_info/xclbin_metadata_cache.h"
 #include "xdp/profile/database/static_info/xclbin_types.h"
 #include "xdp/profile/database/static_info/filetypes/base_filetype_impl.h"
 
@@ -131,12 +133,21 @@ namespace xdp {
     std::mutex aieProfileConfigLock; 
     std::mutex aieMetadataReaderLock; 
 
+    // Bumped whenever the AIE counters of any device may have changed.
+    //  Snapshots built for an older version are rebuilt on next request.
+    std::atomic<uint64_t> aieCounterVersion{1};
+    std::map<uint64_t, std::shared_ptr<const AIECounterSnapshot>> aieCounterSnapshots; // Protected by deviceLock
+
     // AIE device (Supported devices only)
     std::function<void (void*)> deallocateAieDevice = nullptr ;
     // AIE device instances mapped to unique device id.
     std::map<uint64_t, void*> aieDeviceInstances;
     std::map<uint64_t, void*> aieDevices; // xaiefal::XAieDev
-    std::map<uint64_t, std::unique_ptr<aie::BaseFiletypeImpl>> metadataReaders;
+    std::map<uint64_t, std::shared_ptr<const aie::BaseFiletypeImpl>> metadataReaders;
+
+    // Parsed text sections of every xclbin loaded in this process, so
+    //  loading a known xclbin again skips the JSON and XML parsing
+    XclbinMetadataCache xclbinMetadata;
 
     /* The very first XDP Plugin update device (except PL Deadlock Plugin,
      * ML Timeline etc.) sets the Application Style internally.
@@ -147,14 +158,17 @@ namespace xdp {
     bool resetDeviceInfo(uint64_t deviceId, xdp::Device* xdpDevice, xrt_core::uuid new_xclbin_uuid);
 
     // Functions that create the overall structure of the Xclbin's PL region
-    void createComputeUnits(XclbinInfo*, const ip_layout*,const char*,size_t);
+    //  The parsed SYSTEM_METADATA and EMBEDDED_METADATA sections are
+    //  passed in as property trees, which are null if the section is missing.
+    void createComputeUnits(XclbinInfo*, const ip_layout*,
+                            const boost::property_tree::ptree*);
     void createMemories(XclbinInfo*, const mem_topology*);
     void createConnections(XclbinInfo*, const ip_layout*, const mem_topology*,
                            const connectivity*);
-    void annotateWorkgroupSize(XclbinInfo*, const char*, size_t);
-    void setXclbinName(XclbinInfo*, const char*, size_t);
+    void annotateWorkgroupSize(XclbinInfo*, const boost::property_tree::ptree*);
+    void setXclbinName(XclbinInfo*, const boost::property_tree::ptree*);
     void updateSystemDiagram(const char*, size_t);
-    void addPortInfo(XclbinInfo*, const char*, size_t);
+    void addPortInfo(XclbinInfo*, const boost::property_tree::ptree*);
 
     // Functions that initialize the structure of the debug/profiling IP
     void initializeAM(DeviceInfo* devInfo, const std::string& name,
@@ -376,6 +390,12 @@ namespace xdp {
     XDP_CORE_EXPORT uint64_t getNumAIECounter(uint64_t deviceId) ;
     XDP_CORE_EXPORT uint64_t getNumTraceGMIO(uint64_t deviceId) ;
     XDP_CORE_EXPORT AIECounter* getAIECounter(uint64_t deviceId, uint64_t idx) ;
+    // Returns the AIE counters of the device as an immutable snapshot.  If
+    //  the snapshot passed in is still current it is handed back without
+    //  taking any lock, so a polling loop can call this once per sweep.
+    XDP_CORE_EXPORT std::shared_ptr<const AIECounterSnapshot>
+    getAIECounterSnapshot(uint64_t deviceId,
+                          std::shared_ptr<const AIECounterSnapshot> cached = nullptr) ;
     XDP_CORE_EXPORT
     std::map<uint32_t, uint32_t>*
     getAIECoreCounterResources(uint64_t deviceId) ;
@@ -436,7 +456,7 @@ namespace xdp {
 
     XDP_CORE_EXPORT void readAIEMetadata(uint64_t deviceId, xrt::xclbin xrtXclbin, bool checkDisk);
     XDP_CORE_EXPORT const aie::BaseFiletypeImpl* getAIEmetadataReader(uint64_t deviceId = 0) ;
-    XDP_CORE_EXPORT void addAIEmetadataReader(uint64_t deviceId, std::unique_ptr<aie::BaseFiletypeImpl> metadataReader) ;
+    XDP_CORE_EXPORT void addAIEmetadataReader(uint64_t deviceId, std::shared_ptr<const aie::BaseFiletypeImpl> metadataReader) ;
 
     // ************************************************************************
     // ***** Functions for information from a specific xclbin on a device *****
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -15,6 +15,7 @@
  * under the License.
  */
 
+#include <atomic>
 #include <vector>
 #include <thread>
 #include <iostream>
@@ -25,8 +26,14 @@
 
 namespace xdp {
 
+  namespace {
+
+    std::atomic<uint64_t> nextInstanceId{1} ;
+
+  } // end anonymous namespace
+
   VPStatisticsDatabase::VPStatisticsDatabase(VPDatabase* d) :
-    db(d), numMigrateMemCalls(0), numHostP2PTransfers(0),
+    db(d), instanceId(nextInstanceId++), numMigrateMemCalls(0), numHostP2PTransfers(0),
     numObjectsReleased(0), contextEnabled(false),
     totalHostReadTime(0), totalHostWriteTime(0), totalBufferStartTime(0),
     totalBufferEndTime(0), firstKernelStartTime(0.0), lastKernelEndTime(0.0)
@@ -206,59 +213,93 @@ namespace xdp {
     }
   }
 
-  void VPStatisticsDatabase::logFunctionCallStart(const std::string& name,
-                                                  double timestamp)
+  VPStatisticsDatabase::ThreadCallStatistics*
+  VPStatisticsDatabase::getThreadCalls()
   {
-    std::lock_guard<std::mutex> lock(dbLock);
+    // Each thread caches the statistics it logs into for every database
+    //  instance so logging a call never touches a shared structure.
+    thread_local std::vector<std::pair<uint64_t, ThreadCallStatistics*>> cache ;
+    for (auto& entry : cache) {
+      if (entry.first == instanceId)
+        return entry.second ;
+    }
 
+    ThreadCallStatistics* calls = nullptr ;
+    {
+      std::lock_guard<std::mutex> lock(threadCallsLock) ;
+      threadCalls.push_back(std::make_unique<ThreadCallStatistics>()) ;
+      calls = threadCalls.back().get() ;
+    }
+    cache.emplace_back(instanceId, calls) ;
+    return calls ;
+  }
+
+  void VPStatisticsDatabase::logFunctionCallStart(std::string_view name,
+                                                  double timestamp)
+  {
     // Each function that we are tracking will have two distinct entry
     // points that we need to keep track of, the starting point
     // and the ending point.  In this function, we log the starting point
     // of a function call.  Since the calls could be coming in simultaneously
-    // from different threads, we also use the thread id to create
-    // a unique identifier.
-
-    auto threadId = std::this_thread::get_id();
-    auto key      = std::make_pair(name, threadId);
-    std::pair<double, double>value {timestamp, 0.0};
-
-    // Since a single thread can call a function multiple times, we store
-    // the starts in a vector.  If the thread makes a recursive call, we'll
-    // have multiple elements where the start value is set but the end value
-    // needs to be filled in.
-    if (callCount.find(key) == callCount.end()) {
-      std::vector<std::pair<double, double>> newVector;
-      newVector.push_back(value);
-      callCount[key] = newVector;
+    // from different threads, every thread logs into its own statistics.
+    auto calls = getThreadCalls() ;
+    {
+      std::lock_guard<std::mutex> lock(calls->lock) ;
+      auto iter = calls->functions.find(name) ;
+      if (iter == calls->functions.end())
+        iter = calls->functions.emplace(std::string(name),
+                                        ThreadCallStatistics::Function()).first ;
+
+      // Since a single thread can call a function multiple times, we store
+      // the starts in a vector.  If the thread makes a recursive call, we'll
+      // have multiple starts waiting for their end.
+      iter->second.openStarts.push_back(timestamp) ;
     }
-    else
-      callCount[key].push_back(value);
 
     // OpenCL specific information 
-    if (name == "clEnqueueMigrateMemObjects")
-      addMigrateMemCall();
+    if (name == "clEnqueueMigrateMemObjects") {
+      std::lock_guard<std::mutex> lock(dbLock) ;
+      addMigrateMemCall() ;
+    }
   }
 
-  void VPStatisticsDatabase::logFunctionCallEnd(const std::string& name,
+  void VPStatisticsDatabase::logFunctionCallEnd(std::string_view name,
                                                 double timestamp)
   {
-    std::lock_guard<std::mutex> lock(dbLock);
-
-    auto threadId = std::this_thread::get_id();
-    auto key      = std::make_pair(name, threadId);
-
-    // Since some calls might be recursive, we must go backwards to find
-    // the first call that has a start time set but no end time.  Since we've
-    // incorporated the thread id as part of our key, we will match recursive
-    // calls correctly
-    for (auto iter = callCount[key].rbegin();
-         iter != callCount[key].rend();
-         ++iter) {
-      if ((*iter).second == 0) {
-        (*iter).second = timestamp;
-        break;
+    auto calls = getThreadCalls() ;
+    std::lock_guard<std::mutex> lock(calls->lock) ;
+
+    auto iter = calls->functions.find(name) ;
+    if (iter == calls->functions.end())
+      return ;
+
+    // Since some calls might be recursive, the call that ends is always
+    // the most recent one that started on this thread.
+    auto& function = iter->second ;
+    if (function.openStarts.empty())
+      return ;
+    auto startTime = function.openStarts.back() ;
+    function.openStarts.pop_back() ;
+
+    function.stats.update(timestamp - startTime) ;
+  }
+
+  std::map<std::string, APICallStatistics>
+  VPStatisticsDatabase::getCallStatistics()
+  {
+    // Merge the statistics of every thread for each function
+    std::map<std::string, APICallStatistics> merged ;
+
+    std::lock_guard<std::mutex> lock(threadCallsLock) ;
+    for (auto& calls : threadCalls) {
+      std::lock_guard<std::mutex> callsLock(calls->lock) ;
+      for (auto& function : calls->functions) {
+        if (function.second.stats.count == 0)
+          continue ;
+        merged[function.first].merge(function.second.stats) ;
       }
     }
+    return merged ;
   }
 
   void VPStatisticsDatabase::logMemoryTransfer(uint64_t deviceId,
@@ -445,18 +486,17 @@ namespace xdp {
   void VPStatisticsDatabase::dumpCallCount(std::ofstream& fout)
   {
     // For each function call, across all of the threads, find out
-    //  the number of calls
+    //  the number of calls (including any that have not ended yet)
     std::map<std::string, uint64_t> counts ;
 
-    for (const auto& c : callCount)
     {
-      if (counts.find(c.first.first) == counts.end())
-      {
-        counts[c.first.first] = c.second.size() ;
-      }
-      else
-      {
-        counts[c.first.first] += c.second.size() ;
+      std::lock_guard<std::mutex> lock(threadCallsLock) ;
+      for (auto& calls : threadCalls) {
+        std::lock_guard<std::mutex> callsLock(calls->lock) ;
+        for (auto& function : calls->functions) {
+          counts[function.first] += function.second.stats.count +
+                                    function.second.openStarts.size() ;
+        }
       }
     }
 
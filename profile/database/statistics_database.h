@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,11 +18,17 @@
 #ifndef VP_STATISTICS_DATABASE_DOT_H
 #define VP_STATISTICS_DATABASE_DOT_H
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <tuple>
 #include <vector>
@@ -148,6 +154,131 @@ namespace xdp {
     }
   } ;
 
+  // A log-linear latency histogram.  Values below 2^subBucketBits get a
+  //  bucket each, and every power of two above that is split into
+  //  2^subBucketBits equal buckets, so any recorded value is within
+  //  about 3% of the bucket it is counted in no matter its magnitude.
+  //  The bucket array only grows as large as the biggest value seen.
+  class LatencyHistogram
+  {
+  private:
+    static constexpr uint32_t subBucketBits  = 5 ;
+    static constexpr uint64_t subBucketCount = 1ULL << subBucketBits ;
+
+    std::vector<uint64_t> buckets ;
+    uint64_t totalCount = 0 ;
+
+    static uint32_t mostSignificantBit(uint64_t value)
+    {
+      uint32_t msb = 0 ;
+      for (uint32_t shift = 32 ; shift > 0 ; shift >>= 1) {
+        if (value >> shift) {
+          value >>= shift ;
+          msb += shift ;
+        }
+      }
+      return msb ;
+    }
+
+    static std::size_t bucketIndex(uint64_t value)
+    {
+      if (value < subBucketCount)
+        return static_cast<std::size_t>(value) ;
+      uint32_t band = mostSignificantBit(value) - subBucketBits + 1 ;
+      return static_cast<std::size_t>((band << subBucketBits) +
+                                      (value >> (band - 1)) - subBucketCount) ;
+    }
+
+    // The midpoint of the range of values that land in a bucket
+    static double bucketValue(std::size_t index)
+    {
+      if (index < subBucketCount)
+        return static_cast<double>(index) ;
+      uint32_t band = static_cast<uint32_t>(index >> subBucketBits) ;
+      uint64_t sub  = (index & (subBucketCount - 1)) + subBucketCount ;
+      double lower = static_cast<double>(sub << (band - 1)) ;
+      double width = static_cast<double>(1ULL << (band - 1)) ;
+      return lower + (width / 2.0) ;
+    }
+
+  public:
+    void record(uint64_t value)
+    {
+      auto index = bucketIndex(value) ;
+      if (index >= buckets.size())
+        buckets.resize(index + 1, 0) ;
+      ++buckets[index] ;
+      ++totalCount ;
+    }
+
+    void merge(const LatencyHistogram& other)
+    {
+      if (other.buckets.size() > buckets.size())
+        buckets.resize(other.buckets.size(), 0) ;
+      for (std::size_t i = 0 ; i < other.buckets.size() ; ++i)
+        buckets[i] += other.buckets[i] ;
+      totalCount += other.totalCount ;
+    }
+
+    // The value at the given quantile (between 0 and 1)
+    double percentile(double quantile) const
+    {
+      if (totalCount == 0)
+        return 0.0 ;
+      auto rank = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(totalCount))) ;
+      if (rank == 0)
+        rank = 1 ;
+      uint64_t seen = 0 ;
+      for (std::size_t i = 0 ; i < buckets.size() ; ++i) {
+        seen += buckets[i] ;
+        if (seen >= rank)
+          return bucketValue(i) ;
+      }
+      return bucketValue(buckets.size() - 1) ;
+    }
+  } ;
+
+  // Aggregated statistics for every call of a single API.  Times are
+  //  in nanoseconds.
+  struct APICallStatistics
+  {
+    uint64_t count ;
+    double totalTime ;
+    double minTime ;
+    double maxTime ;
+    LatencyHistogram histogram ;
+
+    APICallStatistics() : count(0), totalTime(0),
+      minTime((std::numeric_limits<double>::max)()), maxTime(0) { }
+
+    void update(double executionTime)
+    {
+      ++count ;
+      totalTime += executionTime ;
+      if (executionTime < minTime) minTime = executionTime ;
+      if (executionTime > maxTime) maxTime = executionTime ;
+      histogram.record(executionTime > 0 ? static_cast<uint64_t>(executionTime) : 0) ;
+    }
+
+    void merge(const APICallStatistics& other)
+    {
+      count += other.count ;
+      totalTime += other.totalTime ;
+      if (other.minTime < minTime) minTime = other.minTime ;
+      if (other.maxTime > maxTime) maxTime = other.maxTime ;
+      histogram.merge(other.histogram) ;
+    }
+
+    // Bucket midpoints can lie outside the range actually seen, so
+    //  report percentiles clamped to the observed min and max
+    double percentile(double quantile) const
+    {
+      if (count == 0)
+        return 0.0 ;
+      return std::clamp(histogram.percentile(quantile), minTime, maxTime) ;
+    }
+  } ;
+
   struct MemoryChannelStatistics
   {
     uint64_t transactionCount ;
@@ -175,9 +306,29 @@ namespace xdp {
     VPDatabase* db ;
 
   private:
-    // Statistics on API calls (OpenCL and HAL) have to be thread specific
-    std::map<std::pair<std::string, std::thread::id>,
-             std::vector<std::pair<double, double>>> callCount ;
+    // Statistics on API calls (OpenCL and HAL) have to be thread specific.
+    //  Each thread aggregates its own calls as they end, so only the
+    //  start times of calls still in flight are kept.  The per thread
+    //  statistics are merged when a summary is generated.
+    struct ThreadCallStatistics
+    {
+      struct Function
+      {
+        // Start times of calls that have not ended yet.  Recursive calls
+        //  end in the reverse order they start.
+        std::vector<double> openStarts ;
+        APICallStatistics stats ;
+      } ;
+      std::map<std::string, Function, std::less<>> functions ;
+
+      // Only contended when a summary is being generated
+      std::mutex lock ;
+    } ;
+    std::vector<std::unique_ptr<ThreadCallStatistics>> threadCalls ;
+    std::mutex threadCallsLock ; // Protects the "threadCalls" vector
+    const uint64_t instanceId ;
+
+    ThreadCallStatistics* getThreadCalls() ;
 
     // **** User Level Event Statistics ****
     std::map<std::string, uint64_t> eventCounts ;
@@ -253,9 +404,7 @@ namespace xdp {
     XDP_CORE_EXPORT ~VPStatisticsDatabase() ;
 
     // Getters and setters
-    inline const std::map<std::pair<std::string, std::thread::id>,
-                    std::vector<std::pair<double, double>>>& getCallCount() 
-      { return callCount ; }
+    XDP_CORE_EXPORT std::map<std::string, APICallStatistics> getCallStatistics() ;
     inline const std::map<uint64_t, DeviceMemoryStatistics>& getMemoryStats() 
       { return memoryStats ; }
     inline const std::map<std::string, TimeStatistics>& getKernelExecutionStats() 
@@ -332,9 +481,9 @@ namespace xdp {
       { return totalRangeDurations; }
 
     // Logging Functions
-    XDP_CORE_EXPORT void logFunctionCallStart(const std::string& name, 
+    XDP_CORE_EXPORT void logFunctionCallStart(std::string_view name,
                                          double timestamp) ;
-    XDP_CORE_EXPORT void logFunctionCallEnd(const std::string& name, 
+    XDP_CORE_EXPORT void logFunctionCallEnd(std::string_view name,
                                        double timestamp) ;
 
     XDP_CORE_EXPORT void logMemoryTransfer(uint64_t deviceId, 
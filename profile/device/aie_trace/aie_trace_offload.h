@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2022 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,6 +18,7 @@
 #ifndef XDP_PROFILE_AIE_TRACE_OFFLOAD_H_
 #define XDP_PROFILE_AIE_TRACE_OFFLOAD_H_
 
+#include "xdp/profile/device/offload_interval_controller.h"
 #include "xdp/profile/device/tracedefs.h"
 
 /*
@@ -55,6 +56,8 @@ struct AIETraceBufferInfo
   uint32_t rollover_count;
   bool     isFull;
   bool     offloadDone;
+  // Bytes offloaded since the offload interval was last updated
+  uint64_t passBytes;
 
   AIETraceBufferInfo()
     : bufId(0),
@@ -62,7 +65,8 @@ struct AIETraceBufferInfo
       offset(0),
       rollover_count(0),
       isFull(false),
-      offloadDone(false)
+      offloadDone(false),
+      passBytes(0)
   {}
 };
 
@@ -110,6 +114,18 @@ public:
     inline void setContinuousTrace() { traceContinuous = true; }
     inline bool continuousTrace()    { return traceContinuous; }
     inline void setOffloadIntervalUs(uint64_t v) { offloadIntervalUs = v; }
+    // Adapt the offload interval to the trace rate, starting from the
+    //  interval set above, if xrt.ini asks for it.  Must be called after
+    //  setOffloadIntervalUs.
+    inline void enableAdaptiveInterval() {
+      adaptiveInterval = intervalController.configureFromConfig(offloadIntervalUs);
+    }
+    inline uint64_t getOffloadIntervalUs() {
+      return adaptiveInterval ? intervalController.getIntervalUs() : offloadIntervalUs;
+    }
+    inline double getOffloadHeadroom() {
+      return adaptiveInterval ? intervalController.getHeadroom() : 1.0;
+    }
 
     inline AIEOffloadThreadStatus getOffloadStatus() {
       std::lock_guard<std::mutex> lock(statusLock);
@@ -147,6 +163,8 @@ private:
     // Continuous Trace Offload (For PLIO)
     bool traceContinuous;
     uint64_t offloadIntervalUs;
+    bool adaptiveInterval = false;
+    OffloadIntervalController intervalController;
     bool bufferInitialized;
     std::mutex statusLock;
     AIEOffloadThreadStatus offloadStatus;
@@ -161,6 +179,7 @@ private:
     void readTraceGMIO(bool final);
     bool setupPSKernel();
     void continuousOffload();
+    uint64_t nextOffloadIntervalUs();
     bool keepOffloading();
     void offloadFinished();
     void checkCircularBufferSupport();
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,6 +17,7 @@
 
 #define XDP_PLUGIN_SOURCE
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -209,6 +210,8 @@ namespace xdp {
       bd.offloadDone = true;
     }
 
+    bd.passBytes += nBytes;
+
     // Log nBytes of trace
     traceLogger->addAIETraceData(index, (void*)in_bo_map, nBytes, true);
     return nBytes;
@@ -234,7 +237,18 @@ namespace xdp {
 
     while (keepOffloading()) {
       mReadTrace(false);
-      std::this_thread::sleep_for(std::chrono::microseconds(offloadIntervalUs));
+      std::this_thread::sleep_for(std::chrono::microseconds(nextOffloadIntervalUs()));
+    }
+
+    if (adaptiveInterval) {
+      auto& telemetry = intervalController.getTelemetry();
+      std::stringstream msg;
+      msg << "AIE trace offload interval (us) last: " << telemetry.intervalUs
+          << ", min: " << telemetry.minIntervalUsed
+          << ", max: " << telemetry.maxIntervalUsed
+          << ". Buffer headroom last: " << telemetry.headroom
+          << ", min: " << telemetry.minHeadroom;
+      xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT", msg.str());
     }
 
     // Note: This will call flush and reset on datamover
@@ -243,6 +257,22 @@ namespace xdp {
     offloadFinished();
   }
 
+  uint64_t AIETraceOffload::nextOffloadIntervalUs()
+  {
+    if (!adaptiveInterval)
+      return offloadIntervalUs;
+
+    // Buffers are the same size, so the one with the most new data is
+    //  the one closest to wrapping
+    uint64_t maxBytes = 0;
+    for (auto& bd : buffers) {
+      maxBytes = std::max(maxBytes, bd.passBytes);
+      bd.passBytes = 0;
+    }
+    double fill = bufAllocSz ? static_cast<double>(maxBytes) / bufAllocSz : 0.0;
+    return intervalController.update(fill);
+  }
+
   bool AIETraceOffload::keepOffloading() 
   { 
     std::lock_guard<std::mutex> lock(statusLock);
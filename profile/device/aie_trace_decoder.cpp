@@ -0,0 +1,362 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include <cstring>
+
+#include "xdp/profile/database/static_info/aie_constructs.h"
+#include "xdp/profile/device/aie_trace_decoder.h"
+
+namespace {
+
+  // Headers have odd parity over all 32 bits
+  inline bool hasOddParity(uint32_t word)
+  {
+    word ^= word >> 16;
+    word ^= word >> 8;
+    word ^= word >> 4;
+    word ^= word >> 2;
+    word ^= word >> 1;
+    return (word & 0x1) != 0;
+  }
+
+  inline uint32_t sourceKey(uint8_t column, uint8_t row, uint8_t packetType)
+  {
+    return (static_cast<uint32_t>(column) << 16)
+         | (static_cast<uint32_t>(row) << 8)
+         | packetType;
+  }
+
+  // Number of bytes in the frame that starts with this byte
+  inline uint8_t frameLength(uint8_t first)
+  {
+    if ((first & 0x80) == 0x00) return 1; // Single0
+    if ((first & 0xE0) == 0x80) return 2; // Single1
+    if ((first & 0xE0) == 0xA0) return 3; // Single2
+    if ((first & 0xF0) == 0xC0) return 2; // Multiple0
+    if ((first & 0xFC) == 0xD0) return 3; // Multiple1
+    if ((first & 0xFC) == 0xD4) return 4; // Multiple2
+    if ((first & 0xFC) == 0xD8) return 2; // Repeat1
+    if ((first & 0xFC) == 0xDC) return 4; // Sync
+    if ((first & 0xF0) == 0xE0) return 1; // Repeat0
+    if ((first & 0xFB) == 0xF0) return 8; // Start
+    return 1;                             // Filler, event sync, or unknown
+  }
+
+} // end anonymous namespace
+
+namespace xdp {
+
+  struct AIETraceDecoder::HeaderLayout
+  {
+    uint32_t reservedMask;
+    int      typeShift;
+    uint32_t typeMask;
+    int      rowShift;
+    uint32_t rowMask;
+    int      columnShift;
+    uint32_t columnMask;
+
+    inline bool isValid(uint32_t word) const
+      { return ((word & reservedMask) == 0) && hasOddParity(word); }
+    inline uint8_t getType(uint32_t word) const
+      { return static_cast<uint8_t>((word >> typeShift) & typeMask); }
+    inline uint8_t getRow(uint32_t word) const
+      { return static_cast<uint8_t>((word >> rowShift) & rowMask); }
+    inline uint8_t getColumn(uint32_t word) const
+      { return static_cast<uint8_t>((word >> columnShift) & columnMask); }
+  };
+
+  namespace {
+
+    // AIE1 and the AIE2 family (hw_gen 2-4 and 6-9) share 32-bit trace
+    //  streams and this header: reserved bits 30:28, 15, and 11:5,
+    //  packet type in 14:12, row in 20:16, and column in 27:21
+    constexpr AIETraceDecoder::HeaderLayout aie1Header =
+      { 0x70008FE0, 12, 0x7, 16, 0x1F, 21, 0x7F };
+
+    const AIETraceDecoder::HeaderLayout* getHeaderLayout(uint8_t hwGen)
+    {
+      if (hwGen >= 1 && hwGen <= 9 && hwGen != 5)
+        return &aie1Header;
+      return nullptr;
+    }
+
+  } // end anonymous namespace
+
+  AIETraceDecoder::AIETraceDecoder(uint8_t hwGen) :
+    layout(getHeaderLayout(hwGen))
+  {
+  }
+
+  bool AIETraceDecoder::isSupported(uint8_t hwGen)
+  {
+    return getHeaderLayout(hwGen) != nullptr;
+  }
+
+  std::size_t AIETraceDecoder::findOrAddSource(uint8_t column, uint8_t row,
+                                               uint8_t packetType)
+  {
+    auto key = sourceKey(column, row, packetType);
+    auto found = sourceIndex.find(key);
+    if (found != sourceIndex.end())
+      return found->second;
+
+    AIETraceTileEvents tile;
+    tile.column = column;
+    tile.row = row;
+    tile.packetType = packetType;
+    tiles.push_back(std::move(tile));
+    states.emplace_back();
+
+    sourceIndex[key] = tiles.size() - 1;
+    return tiles.size() - 1;
+  }
+
+  void AIETraceDecoder::addSource(uint8_t column, uint8_t row,
+                                  uint8_t packetType,
+                                  const uint32_t (&slotEvents)[NUM_TRACE_EVENTS])
+  {
+    auto& tile = tiles[findOrAddSource(column, row, packetType)];
+    tile.configured = true;
+    std::memcpy(tile.slotEvents, slotEvents, sizeof(tile.slotEvents));
+  }
+
+  void AIETraceDecoder::configure(const std::vector<std::unique_ptr<aie_cfg_tile>>& cfgTiles)
+  {
+    for (auto& cfgTile : cfgTiles) {
+      auto column = static_cast<uint8_t>(cfgTile->column);
+      auto row = static_cast<uint8_t>(cfgTile->row);
+
+      auto add = [&](const aie_cfg_base& cfg) {
+        addSource(column, row, static_cast<uint8_t>(cfg.packet_type),
+                  cfg.traced_events);
+      };
+
+      switch (cfgTile->type) {
+      case module_type::core:
+        if (cfgTile->active_core)
+          add(cfgTile->core_trace_config);
+        if (cfgTile->active_memory)
+          add(cfgTile->memory_trace_config);
+        break;
+      case module_type::dma:
+        add(cfgTile->memory_trace_config);
+        break;
+      case module_type::mem_tile:
+        add(cfgTile->memory_tile_trace_config);
+        break;
+      case module_type::shim:
+        add(cfgTile->interface_tile_trace_config);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  void AIETraceDecoder::decode(const uint32_t* words, uint64_t numWords)
+  {
+    if (layout == nullptr)
+      return;
+
+    for (uint64_t i = 0; i < numWords; ++i) {
+      uint32_t word = words[i];
+
+      if (payloadLeft == 0) {
+        if (!layout->isValid(word)) {
+          ++numInvalidWords;
+          continue;
+        }
+        currentSource = findOrAddSource(layout->getColumn(word),
+                                        layout->getRow(word),
+                                        layout->getType(word));
+        payloadLeft = PACKET_WORDS - 1;
+        ++numPackets;
+        continue;
+      }
+
+      decodeByte(currentSource, static_cast<uint8_t>(word >> 24));
+      decodeByte(currentSource, static_cast<uint8_t>(word >> 16));
+      decodeByte(currentSource, static_cast<uint8_t>(word >> 8));
+      decodeByte(currentSource, static_cast<uint8_t>(word));
+      --payloadLeft;
+    }
+  }
+
+  void AIETraceDecoder::decodeByte(std::size_t source, uint8_t byte)
+  {
+    auto& state = states[source];
+    if (state.numPending == 0)
+      state.needed = frameLength(byte);
+
+    state.pending[state.numPending++] = byte;
+    if (state.numPending < state.needed)
+      return;
+
+    decodeFrame(source);
+    state.numPending = 0;
+  }
+
+  void AIETraceDecoder::decodeFrame(std::size_t source)
+  {
+    auto& state = states[source];
+    const uint8_t* b = state.pending;
+
+    uint8_t slotMask = 0;
+    uint32_t cycles = 0;
+
+    switch (state.needed) {
+    case 1:
+      if ((b[0] & 0x80) == 0x00) {                     // Single0
+        slotMask = static_cast<uint8_t>(1 << ((b[0] >> 4) & 0x7));
+        cycles = b[0] & 0xF;
+      }
+      else if ((b[0] & 0xF0) == 0xE0) {                // Repeat0
+        for (uint32_t r = 0; r < (b[0] & 0xFu); ++r) {
+          state.timer += state.lastCycles;
+          addEvents(source, state.lastSlots);
+        }
+        return;
+      }
+      else {
+        if (b[0] != 0xFE && b[0] != 0xFF)              // Filler, event sync
+          ++numUnknownFrames;
+        return;
+      }
+      break;
+    case 2:
+      if ((b[0] & 0xE0) == 0x80) {                     // Single1
+        slotMask = static_cast<uint8_t>(1 << ((b[0] >> 2) & 0x7));
+        cycles = ((b[0] & 0x3u) << 8) | b[1];
+      }
+      else if ((b[0] & 0xF0) == 0xC0) {                // Multiple0
+        slotMask = static_cast<uint8_t>(((b[0] & 0xF) << 4) | (b[1] >> 4));
+        cycles = b[1] & 0xF;
+      }
+      else {                                           // Repeat1
+        uint32_t repeats = ((b[0] & 0x3u) << 8) | b[1];
+        for (uint32_t r = 0; r < repeats; ++r) {
+          state.timer += state.lastCycles;
+          addEvents(source, state.lastSlots);
+        }
+        return;
+      }
+      break;
+    case 3:
+      if ((b[0] & 0xE0) == 0xA0) {                     // Single2
+        slotMask = static_cast<uint8_t>(1 << ((b[0] >> 2) & 0x7));
+        cycles = ((b[0] & 0x3u) << 16) | (static_cast<uint32_t>(b[1]) << 8) | b[2];
+      }
+      else {                                           // Multiple1
+        slotMask = static_cast<uint8_t>(((b[0] & 0x3) << 6) | (b[1] >> 2));
+        cycles = ((b[1] & 0x3u) << 8) | b[2];
+      }
+      break;
+    case 4:
+      if ((b[0] & 0xFC) == 0xDC)                       // Sync
+        return;
+      // Multiple2
+      slotMask = static_cast<uint8_t>(((b[0] & 0x3) << 6) | (b[1] >> 2));
+      cycles = ((b[1] & 0x3u) << 16) | (static_cast<uint32_t>(b[2]) << 8) | b[3];
+      break;
+    case 8: {                                          // Start
+      uint64_t timer = 0;
+      for (int i = 1; i < 8; ++i)
+        timer = (timer << 8) | b[i];
+      state.timer = timer;
+      state.lastSlots = 0;
+      state.lastCycles = 0;
+      return;
+    }
+    default:
+      return;
+    }
+
+    state.timer += cycles;
+    state.lastSlots = slotMask;
+    state.lastCycles = cycles;
+    addEvents(source, slotMask);
+  }
+
+  void AIETraceDecoder::addEvents(std::size_t source, uint8_t slotMask)
+  {
+    auto& tile = tiles[source];
+    auto timer = states[source].timer;
+    for (uint8_t slot = 0; slotMask != 0; ++slot, slotMask >>= 1) {
+      if ((slotMask & 0x1) == 0)
+        continue;
+      tile.timestamps.push_back(timer);
+      tile.slots.push_back(slot);
+      ++numEvents;
+    }
+  }
+
+  std::vector<AIETraceTileEvents> AIETraceDecoder::takeEvents()
+  {
+    std::vector<AIETraceTileEvents> taken;
+    taken.reserve(tiles.size());
+    for (auto& tile : tiles) {
+      AIETraceTileEvents copy;
+      copy.column = tile.column;
+      copy.row = tile.row;
+      copy.packetType = tile.packetType;
+      copy.configured = tile.configured;
+      std::memcpy(copy.slotEvents, tile.slotEvents, sizeof(copy.slotEvents));
+      copy.timestamps.swap(tile.timestamps);
+      copy.slots.swap(tile.slots);
+      taken.push_back(std::move(copy));
+    }
+    return taken;
+  }
+
+  void AIETraceEventSummary::add(const std::vector<AIETraceTileEvents>& tiles)
+  {
+    for (auto& tile : tiles) {
+      for (std::size_t i = 0; i < tile.size(); ++i) {
+        auto slot = tile.slots[i];
+        auto key = (sourceKey(tile.column, tile.row, tile.packetType) << 8) | slot;
+        auto found = countIndex.find(key);
+        if (found == countIndex.end()) {
+          SlotCount count;
+          count.column = tile.column;
+          count.row = tile.row;
+          count.packetType = tile.packetType;
+          count.slot = slot;
+          count.event = tile.getEvent(i);
+          count.firstTimestamp = tile.timestamps[i];
+          counts.push_back(count);
+          found = countIndex.emplace(key, counts.size() - 1).first;
+        }
+        auto& count = counts[found->second];
+        ++count.count;
+        count.lastTimestamp = tile.timestamps[i];
+      }
+    }
+  }
+
+  void AIETraceEventSummary::write(std::ostream& out) const
+  {
+    out << "column,row,packet_type,slot,event,count,first_timestamp,last_timestamp\n";
+    for (auto& count : counts) {
+      out << +count.column << "," << +count.row << "," << +count.packetType
+          << "," << +count.slot << "," << count.event << "," << count.count
+          << "," << count.firstTimestamp << "," << count.lastTimestamp << "\n";
+    }
+  }
+
+} // end namespace xdp
@@ -0,0 +1,175 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef XDP_AIE_TRACE_DECODER_DOT_H
+#define XDP_AIE_TRACE_DECODER_DOT_H
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "xdp/config.h"
+#include "xdp/profile/device/tracedefs.h"
+
+namespace xdp {
+
+  class aie_cfg_tile;
+
+  // Everything decoded so far from one traced module.  A tile with both
+  //  core and memory module trace shows up twice, once per packet type.
+  //  Events are kept as parallel arrays of cycle timestamps and trace
+  //  slots, and slotEvents maps a slot to the hardware event that was
+  //  configured in it.
+  struct AIETraceTileEvents
+  {
+    uint8_t column = 0;
+    uint8_t row = 0;
+    uint8_t packetType = 0;
+    // False if no trace configuration was given for this module, in
+    //  which case slotEvents is all zero
+    bool configured = false;
+    uint32_t slotEvents[NUM_TRACE_EVENTS] = { 0 };
+
+    std::vector<uint64_t> timestamps;
+    std::vector<uint8_t> slots;
+
+    inline std::size_t size() const { return timestamps.size(); }
+    inline uint32_t getEvent(std::size_t i) const
+      { return slotEvents[slots[i]]; }
+  };
+
+  // Decodes the packet switched stream that the AIE trace units write
+  //  to one offload stream.  Every packet is a header word followed by
+  //  seven payload words.  The header gives the column, row, and packet
+  //  type of the module that sent it, and the payload is that module's
+  //  byte stream of trace frames, most significant byte of each word
+  //  first.  Frames carry the slots (0-7) that fired and the cycles
+  //  since the previous frame, and a start frame sets the full timer.
+  //
+  //  The header and frame formats are those of AIE1 and the AIE2
+  //  family.  AIE2PS and later generations pack trace differently and
+  //  are not decoded (see isSupported).
+  //
+  //  Frames continue from one packet of a module to its next, and
+  //  packets may be split between calls to decode, so trace can be fed
+  //  in as it is offloaded.  Headers that fail the parity or reserved
+  //  bit checks are skipped one word at a time until the stream lines
+  //  up with a packet again.
+  class AIETraceDecoder
+  {
+  public:
+    static constexpr uint32_t PACKET_WORDS = 8;
+
+    // Field positions of a packet header in one hardware generation
+    struct HeaderLayout;
+
+  private:
+    const HeaderLayout* layout = nullptr;
+
+    struct SourceState
+    {
+      uint8_t pending[8] = { 0 };
+      uint8_t numPending = 0;
+      uint8_t needed = 0;
+
+      uint64_t timer = 0;
+      // Last event frame, which repeat frames refer to
+      uint8_t lastSlots = 0;
+      uint32_t lastCycles = 0;
+    };
+
+    std::vector<AIETraceTileEvents> tiles;
+    std::vector<SourceState> states;
+    std::unordered_map<uint32_t, std::size_t> sourceIndex;
+
+    // Position in the packet currently being decoded
+    std::size_t currentSource = 0;
+    uint32_t payloadLeft = 0;
+
+    uint64_t numPackets = 0;
+    uint64_t numInvalidWords = 0;
+    uint64_t numUnknownFrames = 0;
+    uint64_t numEvents = 0;
+
+    std::size_t findOrAddSource(uint8_t column, uint8_t row, uint8_t packetType);
+    void decodeByte(std::size_t source, uint8_t byte);
+    void decodeFrame(std::size_t source);
+    void addEvents(std::size_t source, uint8_t slotMask);
+
+  public:
+    // Decodes nothing if the generation is not supported
+    XDP_CORE_EXPORT explicit AIETraceDecoder(uint8_t hwGen);
+
+    XDP_CORE_EXPORT static bool isSupported(uint8_t hwGen);
+
+    // Slot to event mapping of one module.  Packets from modules that
+    //  were never added are still decoded but report only slots.
+    XDP_CORE_EXPORT void addSource(uint8_t column, uint8_t row,
+                                   uint8_t packetType,
+                                   const uint32_t (&slotEvents)[NUM_TRACE_EVENTS]);
+    // Add every traced module in the configuration kept by the static
+    //  database (see AieTraceConfigWriter)
+    XDP_CORE_EXPORT
+    void configure(const std::vector<std::unique_ptr<aie_cfg_tile>>& cfgTiles);
+
+    XDP_CORE_EXPORT void decode(const uint32_t* words, uint64_t numWords);
+
+    inline const std::vector<AIETraceTileEvents>& getTiles() const
+      { return tiles; }
+    // Hand over the events decoded so far and start collecting anew.
+    //  The decode state of every module is kept, so frames and packets
+    //  that straddle the call are not lost.
+    XDP_CORE_EXPORT std::vector<AIETraceTileEvents> takeEvents();
+
+    inline uint64_t getNumPackets() const { return numPackets; }
+    inline uint64_t getNumInvalidWords() const { return numInvalidWords; }
+    inline uint64_t getNumUnknownFrames() const { return numUnknownFrames; }
+    inline uint64_t getNumEvents() const { return numEvents; }
+  };
+
+  // Folds decoded events into a count per module and trace slot, with
+  //  the cycle timestamps of the first and last event, so decoded trace
+  //  is summarized in constant memory however long the run is.
+  class AIETraceEventSummary
+  {
+  private:
+    struct SlotCount
+    {
+      uint8_t column = 0;
+      uint8_t row = 0;
+      uint8_t packetType = 0;
+      uint8_t slot = 0;
+      uint32_t event = 0;
+      uint64_t count = 0;
+      uint64_t firstTimestamp = 0;
+      uint64_t lastTimestamp = 0;
+    };
+
+    std::vector<SlotCount> counts;
+    std::unordered_map<uint32_t, std::size_t> countIndex;
+
+  public:
+    XDP_CORE_EXPORT void add(const std::vector<AIETraceTileEvents>& tiles);
+    // One CSV line per module and slot that saw events
+    XDP_CORE_EXPORT void write(std::ostream& out) const;
+    inline bool empty() const { return counts.empty(); }
+  };
+
+} // end namespace xdp
+
+#endif
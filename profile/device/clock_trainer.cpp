@@ -0,0 +1,123 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#define XDP_CORE_SOURCE
+
+#include <cmath>
+
+#include "xdp/profile/device/clock_trainer.h"
+
+namespace xdp {
+
+  void ClockTrainer::configure(double nominal, bool bounded,
+                               std::size_t windowSize)
+  {
+    nominalSlope = nominal;
+    boundedSlope = bounded;
+    window = (windowSize < 2) ? 2 : windowSize;
+
+    anchored = false;
+    anchorDevice = 0;
+    anchorHost = 0;
+    points.clear();
+    slope = nominal;
+    offset = 0.0;
+    rmsResidual = 0.0;
+    consecutiveRejects = 0;
+    numRejected = 0;
+  }
+
+  void ClockTrainer::addPoint(uint64_t deviceTimestamp, uint64_t hostTimestamp)
+  {
+    if (!anchored) {
+      anchored = true;
+      anchorDevice = deviceTimestamp;
+      anchorHost = hostTimestamp;
+    }
+
+    Point point;
+    point.device = static_cast<double>(static_cast<int64_t>(deviceTimestamp - anchorDevice));
+    point.host = static_cast<double>(static_cast<int64_t>(hostTimestamp - anchorHost));
+
+    if (points.size() >= MIN_POINTS_FOR_REJECTION) {
+      double residual = std::fabs(point.host - (slope * point.device + offset));
+      double limit = REJECT_FACTOR * rmsResidual;
+      if (limit < REJECT_FLOOR_NS)
+        limit = REJECT_FLOOR_NS;
+
+      if (residual > limit) {
+        ++numRejected;
+        if (++consecutiveRejects < MAX_CONSECUTIVE_REJECTS)
+          return;
+        // The clocks have stepped, so the old points no longer apply
+        points.clear();
+      }
+    }
+    consecutiveRejects = 0;
+
+    points.push_back(point);
+    if (points.size() > window)
+      points.pop_front();
+    fit();
+  }
+
+  void ClockTrainer::fit()
+  {
+    double n = static_cast<double>(points.size());
+    double meanDevice = 0.0;
+    double meanHost = 0.0;
+    for (auto& point : points) {
+      meanDevice += point.device;
+      meanHost += point.host;
+    }
+    meanDevice /= n;
+    meanHost /= n;
+
+    slope = nominalSlope;
+    std::size_t minPoints = boundedSlope ? MIN_POINTS_FOR_SLOPE : 2;
+    if (points.size() >= minPoints) {
+      double sxx = 0.0;
+      double sxy = 0.0;
+      for (auto& point : points) {
+        double dx = point.device - meanDevice;
+        sxx += dx * dx;
+        sxy += dx * (point.host - meanHost);
+      }
+      if (sxx > 0.0) {
+        double fitted = sxy / sxx;
+        if (!boundedSlope ||
+            std::fabs(fitted - nominalSlope) <= MAX_SLOPE_DEVIATION * nominalSlope)
+          slope = fitted;
+      }
+    }
+    offset = meanHost - slope * meanDevice;
+
+    double squares = 0.0;
+    for (auto& point : points) {
+      double residual = point.host - (slope * point.device + offset);
+      squares += residual * residual;
+    }
+    rmsResidual = std::sqrt(squares / n);
+  }
+
+  double ClockTrainer::getOffset() const
+  {
+    return static_cast<double>(anchorHost) + offset
+           - slope * static_cast<double>(anchorDevice);
+  }
+
+} // end namespace xdp
@@ -0,0 +1,99 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef XDP_CLOCK_TRAINER_DOT_H
+#define XDP_CLOCK_TRAINER_DOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  // Maps device timestamps to host time (in ns) from the clock training
+  //  points found in the trace.  The model is a least-squares line fit
+  //  over the most recent points, so it follows drift between the device
+  //  and host clocks over a long run instead of extrapolating from the
+  //  start.  A point that lands far off the line is dropped as jitter,
+  //  unless several in a row do, which means the clocks really moved.
+  class ClockTrainer
+  {
+  public:
+    static constexpr std::size_t DEFAULT_WINDOW = 32;
+
+  private:
+    // Points are kept relative to the first accepted point so the sums
+    //  keep their precision
+    struct Point
+    {
+      double device;
+      double host;
+    };
+
+    static constexpr std::size_t MIN_POINTS_FOR_SLOPE     = 4;
+    static constexpr std::size_t MIN_POINTS_FOR_REJECTION = 4;
+    static constexpr unsigned int MAX_CONSECUTIVE_REJECTS = 3;
+    // A point is rejected if it is farther from the line than this many
+    //  times the RMS residual, and at least the floor (in ns)
+    static constexpr double REJECT_FACTOR    = 8.0;
+    static constexpr double REJECT_FLOOR_NS  = 10000.0;
+    // With a bounded slope, fitted slopes further than this from the
+    //  nominal one are not trusted
+    static constexpr double MAX_SLOPE_DEVIATION = 0.01;
+
+    double nominalSlope = 1.0;
+    bool boundedSlope = false;
+    std::size_t window = DEFAULT_WINDOW;
+
+    bool anchored = false;
+    uint64_t anchorDevice = 0;
+    uint64_t anchorHost = 0;
+    std::deque<Point> points;
+
+    double slope = 1.0;
+    double offset = 0.0;       // Relative to the anchor
+    double rmsResidual = 0.0;
+
+    unsigned int consecutiveRejects = 0;
+    uint64_t numRejected = 0;
+
+    void fit();
+
+  public:
+    // nominalSlope is in ns per device cycle.  When boundedSlope is set
+    //  the fitted slope may only move slightly away from it, which is the
+    //  case when the device clock frequency is known.
+    XDP_CORE_EXPORT void configure(double nominal, bool bounded,
+                                   std::size_t windowSize = DEFAULT_WINDOW);
+
+    XDP_CORE_EXPORT void addPoint(uint64_t deviceTimestamp,
+                                  uint64_t hostTimestamp);
+
+    // host = getSlope() * device + getOffset()
+    inline double getSlope() const { return slope; }
+    XDP_CORE_EXPORT double getOffset() const;
+
+    inline std::size_t getNumPoints() const { return points.size(); }
+    inline uint64_t getNumRejected() const { return numRejected; }
+    inline double getRMSResidual() const { return rmsResidual; }
+  };
+
+} // end namespace xdp
+
+#endif
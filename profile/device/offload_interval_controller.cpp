@@ -0,0 +1,109 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#define XDP_CORE_SOURCE
+
+#include <algorithm>
+
+#include "core/common/config_reader.h"
+#include "xdp/profile/device/offload_interval_controller.h"
+
+namespace xdp {
+
+  void OffloadIntervalController::configure(uint64_t initialUs,
+                                            uint64_t minUs, uint64_t maxUs)
+  {
+    minIntervalUs = std::max<uint64_t>(minUs, 1);
+    maxIntervalUs = std::max(maxUs, minIntervalUs);
+    auto interval = std::clamp(initialUs, minIntervalUs, maxIntervalUs);
+
+    smoothedRate = 0.0;
+    started = false;
+    intervalUs = interval;
+    headroom = 1.0;
+
+    stats = Telemetry();
+    stats.intervalUs = interval;
+    stats.minIntervalUsed = interval;
+    stats.maxIntervalUsed = interval;
+  }
+
+  bool OffloadIntervalController::configureFromConfig(uint64_t initialUs)
+  {
+    if (!xrt_core::config::detail::get_bool_value("Debug.trace_offload_adaptive_interval", false))
+      return false;
+
+    configure(initialUs,
+              xrt_core::config::detail::get_uint_value("Debug.trace_offload_min_interval_us", 100),
+              xrt_core::config::detail::get_uint_value("Debug.trace_offload_max_interval_us", 100000));
+    return true;
+  }
+
+  uint64_t OffloadIntervalController::update(double fillFraction)
+  {
+    auto now = std::chrono::steady_clock::now();
+    auto interval = intervalUs.load();
+    if (!started) {
+      // Nothing to measure the first read against
+      started = true;
+      lastUpdate = now;
+      return interval;
+    }
+
+    double elapsed =
+      std::chrono::duration<double>(now - lastUpdate).count();
+    lastUpdate = now;
+    if (elapsed <= 0.0)
+      return interval;
+
+    // A burst is taken at face value, a slowdown is smoothed out
+    double rate = std::max(fillFraction, 0.0) / elapsed;
+    if (rate >= smoothedRate)
+      smoothedRate = rate;
+    else
+      smoothedRate += RATE_WEIGHT * (rate - smoothedRate);
+
+    double next = static_cast<double>(maxIntervalUs);
+    if (smoothedRate > 0.0)
+      next = (TARGET_FILL / smoothedRate) * 1e6;
+
+    double grown = static_cast<double>(interval) * MAX_GROWTH;
+    if (next > grown)
+      next = grown;
+
+    next = std::clamp(next, static_cast<double>(minIntervalUs),
+                      static_cast<double>(maxIntervalUs));
+    interval = static_cast<uint64_t>(next);
+
+    double left = 1.0 - (smoothedRate * next / 1e6);
+    left = std::clamp(left, 0.0, 1.0);
+
+    intervalUs = interval;
+    headroom = left;
+
+    stats.intervalUs = interval;
+    stats.minIntervalUsed = std::min(stats.minIntervalUsed, interval);
+    stats.maxIntervalUsed = std::max(stats.maxIntervalUsed, interval);
+    stats.headroom = left;
+    stats.minHeadroom = std::min(stats.minHeadroom, left);
+    stats.fillRate = smoothedRate;
+    ++stats.numUpdates;
+
+    return interval;
+  }
+
+} // end namespace xdp
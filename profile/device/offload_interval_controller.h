@@ -0,0 +1,98 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef XDP_OFFLOAD_INTERVAL_CONTROLLER_DOT_H
+#define XDP_OFFLOAD_INTERVAL_CONTROLLER_DOT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  // Picks the sleep between two reads of a trace buffer from how fast the
+  //  buffer is being filled.  After every read the offload thread reports
+  //  the fraction of a buffer that was written since the previous read
+  //  (the fullest buffer if there are several).  Bursts shorten the
+  //  interval right away so the buffer is read before it wraps, and an
+  //  idle device lets the interval grow gradually so the thread stops
+  //  polling for nothing.  The interval always stays within the bounds.
+  class OffloadIntervalController
+  {
+  public:
+    // What the controller is currently doing, for reporting
+    struct Telemetry
+    {
+      uint64_t intervalUs = 0;
+      uint64_t minIntervalUsed = 0;
+      uint64_t maxIntervalUsed = 0;
+      // Fraction of the buffer still free when the next read happens at
+      //  the current fill rate and interval.  Zero means data will be lost.
+      double headroom = 1.0;
+      double minHeadroom = 1.0;
+      // Fill rate in buffers per second
+      double fillRate = 0.0;
+      uint64_t numUpdates = 0;
+    };
+
+  private:
+    // Aim to read when a buffer is this full
+    static constexpr double TARGET_FILL = 0.25;
+    // An idle or slow device grows the interval by at most this factor
+    //  per read
+    static constexpr double MAX_GROWTH = 1.5;
+    // Weight of the newest measurement in the smoothed fill rate
+    static constexpr double RATE_WEIGHT = 0.25;
+
+    uint64_t minIntervalUs = 0;
+    uint64_t maxIntervalUs = 0;
+    double smoothedRate = 0.0;
+    std::chrono::steady_clock::time_point lastUpdate;
+    bool started = false;
+
+    // Read by other threads for reporting
+    std::atomic<uint64_t> intervalUs{0};
+    std::atomic<double> headroom{1.0};
+
+    Telemetry stats;
+
+  public:
+    XDP_CORE_EXPORT void configure(uint64_t initialUs, uint64_t minUs,
+                                   uint64_t maxUs);
+    // Configure with the bounds from xrt.ini if
+    //  Debug.trace_offload_adaptive_interval is set.  Returns false, and
+    //  leaves the controller unused, if it is not.
+    XDP_CORE_EXPORT bool configureFromConfig(uint64_t initialUs);
+
+    // Report the fraction of a buffer written since the previous call
+    //  and get the time to sleep before the next read.
+    XDP_CORE_EXPORT uint64_t update(double fillFraction);
+
+    inline uint64_t getIntervalUs() const { return intervalUs.load(); }
+    inline double getHeadroom() const { return headroom.load(); }
+    inline uint64_t getMinIntervalUs() const { return minIntervalUs; }
+
+    // Only consistent when called from the offload thread or after it
+    //  has finished
+    inline const Telemetry& getTelemetry() const { return stats; }
+  };
+
+} // end namespace xdp
+
+#endif
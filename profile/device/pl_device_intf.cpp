@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -1089,6 +1089,30 @@ void *PLDeviceIntf::syncTraceBuf(size_t id, uint64_t offset, uint64_t bytes) {
   return static_cast<char *>(addr) + offset;
 }
 
+void* PLDeviceIntf::mapTraceBuf(size_t id) {
+  std::lock_guard<std::mutex> lock(traceLock);
+  return mDevice->map(id);
+}
+
+void PLDeviceIntf::unmapTraceBuf(size_t id) {
+  std::lock_guard<std::mutex> lock(traceLock);
+  mDevice->unmap(id);
+}
+
+/**
+ * Same as syncTraceBuf for a buffer that was mapped with mapTraceBuf.
+ * The returned address stays valid until the buffer is unmapped.
+ */
+void* PLDeviceIntf::syncMappedTraceBuf(size_t id, void* mapping,
+                                       uint64_t offset, uint64_t bytes) {
+  std::lock_guard<std::mutex> lock(traceLock);
+  if (!mapping)
+    return nullptr;
+
+  mDevice->sync(id, bytes, offset, xdp::Device::direction::DEVICE2HOST);
+  return static_cast<char *>(mapping) + offset;
+}
+
 xclBufferExportHandle PLDeviceIntf::exportTraceBuf(size_t id) {
   std::lock_guard<std::mutex> lock(traceLock);
   return mDevice->exportBuffer(id);
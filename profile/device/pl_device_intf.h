@@ -3,7 +3,7 @@
 
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  * Author(s): Paul Schumacher
  *          : Anurag Dubey
  *          : Tianhao Zhou
@@ -120,6 +120,14 @@ class PLDeviceIntf {
     void freeTraceBuf(size_t id);
     XDP_CORE_EXPORT
     void* syncTraceBuf(size_t id ,uint64_t offset, uint64_t bytes);
+    // Keep a trace buffer mapped until unmapTraceBuf is called, so regions
+    // synced with syncMappedTraceBuf can be read in place
+    XDP_CORE_EXPORT
+    void* mapTraceBuf(size_t id);
+    XDP_CORE_EXPORT
+    void unmapTraceBuf(size_t id);
+    XDP_CORE_EXPORT
+    void* syncMappedTraceBuf(size_t id, void* mapping, uint64_t offset, uint64_t bytes);
     XDP_CORE_EXPORT
     xclBufferExportHandle exportTraceBuf(size_t id);
     XDP_CORE_EXPORT
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -25,6 +25,12 @@
 #include "core/common/message.h"
 #include "xrt/experimental/xrt_profile.h"
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <thread>
+
 #ifdef _WIN32
 #pragma warning (disable : 4244)
 /* Disable warnings for conversion from uint32_t to uint16_t */
@@ -43,11 +49,16 @@ namespace xdp {
 
     traceClockRateMHz = db->getStaticInfo().getPLMaxClockRateMHz(deviceId);
     clockTrainSlope = 1000.0/traceClockRateMHz;
+    // In hardware the trace clock frequency is known, so the fitted slope
+    //  only corrects for drift
+    clockTrainer.configure(clockTrainSlope, xdp::getFlowMode() == HW);
 
     ConfigInfo* config = (db->getStaticInfo()).getCurrentlyLoadedConfig(devId);
     xclbin = config->getPlXclbin();
-    if (!xclbin)
+    if (!xclbin) {
+      assignShards();
       return;
+    }
 
     // Use the total number of Accelerator Monitors for the size
     auto numAM = (db->getStaticInfo()).getNumAM(deviceId, xclbin);
@@ -59,9 +70,12 @@ namespace xdp {
     //  any configured for just trace.
     aimLastTrans.resize((db->getStaticInfo()).getNumUserAIM(deviceId, xclbin));
     asmLastTrans.resize((db->getStaticInfo()).getNumUserASM(deviceId, xclbin));
+
+    assignShards();
   }
 
-  void PLDeviceTraceLogger::addCUEndEvent(double hostTimestamp,
+  void PLDeviceTraceLogger::addCUEndEvent(TraceShard& shard,
+                                          double hostTimestamp,
                                           uint64_t deviceTimestamp,
                                           uint32_t s,
                                           int32_t cuId)
@@ -78,21 +92,17 @@ namespace xdp {
     auto event = new KernelEvent(startEventID,
                                  hostTimestamp, KERNEL, deviceId, s, cuId);
     event->setDeviceTimestamp(deviceTimestamp);
-    db->getDynamicInfo().addEvent(event);
-    (db->getStats()).setLastKernelEndTime(hostTimestamp);
-
-    // Log a CU execution in our statistics database
-    // NOTE: At this stage, we don't know the global work size, so let's
-    //       leave it to the database to fill that in.
-    auto cu = db->getStaticInfo().getCU(deviceId, cuId);
-    (db->getStats()).logComputeUnitExecution(cu->getName(),
-                                             cu->getKernelName(),
-                                             cu->getDim(),
-                                             "",
-                                             executionTime);
+    addEvent(shard, event);
+    if (hostTimestamp > shard.lastKernelEndTime)
+      shard.lastKernelEndTime = hostTimestamp;
+
+    // The CU execution is logged in our statistics database once the
+    //  shard is done
+    shard.cuExecutions.emplace_back(cuId, executionTime);
   }
 
-  void PLDeviceTraceLogger::addCUEvent(uint64_t trace,
+  void PLDeviceTraceLogger::addCUEvent(TraceShard& shard,
+                                       uint64_t trace,
                                        double hostTimestamp,
                                        uint32_t slot,
                                        uint64_t monTraceId,
@@ -111,13 +121,13 @@ namespace xdp {
       if (cuStarts[slot].empty())
         return;
 
-      addCUEndEvent(hostTimestamp, deviceTimestamp, slot, cuId);
+      addCUEndEvent(shard, hostTimestamp, deviceTimestamp, slot, cuId);
     }
     else {
       // start event
       event = new KernelEvent(0, hostTimestamp, KERNEL, deviceId, slot, cuId);
       event->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(event);
+      addEvent(shard, event);
       DeviceEventInfo info;
       info.type = event->getEventType();
       info.eventID = event->getEventId();
@@ -130,12 +140,13 @@ namespace xdp {
       if(1 == cuStarts[slot].size()) {
         traceIDs[slot] = 0; // When current CU starts, reset stall status
       }
-      if (db->getStats().getFirstKernelStartTime() == 0.0)
-        (db->getStats()).setFirstKernelStartTime(hostTimestamp);
+      if (shard.firstKernelStartTime == 0.0)
+        shard.firstKernelStartTime = hostTimestamp;
     }
   }
 
-  void PLDeviceTraceLogger::addStallEvent(uint64_t trace,
+  void PLDeviceTraceLogger::addStallEvent(TraceShard& shard,
+                                          uint64_t trace,
                                           double hostTimestamp,
                                           uint32_t slot,
                                           uint64_t monTraceId,
@@ -157,13 +168,13 @@ namespace xdp {
                               slot,
                               cuId);
       event->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(event);
+      addEvent(shard, event);
     }
     else {
       // Start event
       event = new KernelStall(0, hostTimestamp, type, deviceId, slot, cuId);
       event->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(event);
+      addEvent(shard, event);
       DeviceEventInfo info;
       info.type = event->getEventType();
       info.eventID = event->getEventId();
@@ -173,7 +184,7 @@ namespace xdp {
     }
   }
 
-  void PLDeviceTraceLogger::addAMEvent(uint64_t trace, double hostTimestamp)
+  void PLDeviceTraceLogger::addAMEvent(TraceShard& shard, uint64_t trace, double hostTimestamp)
   {
     uint64_t traceID = getTraceId(trace);
     uint64_t deviceTimestamp = getDeviceTimestamp(trace);
@@ -195,18 +206,18 @@ namespace xdp {
     // A single trace packet could have multiple events happening simultaneously
 
     if (traceID & CU_MASK) {
-      addCUEvent(trace, hostTimestamp, slot, monTraceID, cuId);
+      addCUEvent(shard, trace, hostTimestamp, slot, monTraceID, cuId);
     }
     if (traceID & STALL_INT_MASK) {
-      addStallEvent(trace, hostTimestamp, slot, monTraceID, cuId,
+      addStallEvent(shard, trace, hostTimestamp, slot, monTraceID, cuId,
                     KERNEL_STALL_DATAFLOW, STALL_INT_MASK);
     }
     if (traceID & STALL_STR_MASK) {
-      addStallEvent(trace, hostTimestamp, slot, monTraceID, cuId,
+      addStallEvent(shard, trace, hostTimestamp, slot, monTraceID, cuId,
                     KERNEL_STALL_PIPE, STALL_STR_MASK);
     }
     if (traceID & STALL_EXT_MASK) {
-      addStallEvent(trace, hostTimestamp, slot, monTraceID, cuId,
+      addStallEvent(shard, trace, hostTimestamp, slot, monTraceID, cuId,
                     KERNEL_STALL_EXT_MEM, STALL_EXT_MASK);
     }
 
@@ -216,12 +227,12 @@ namespace xdp {
     // If a CU just ended completely, we need to tie off any hanging
     //  reads, writes, and stalls
     if ((traceID & CU_MASK) && cuStarts[slot].empty()) {
-      addApproximateDataTransferEndEvents(cuId);
-      addApproximateStallEndEvents(trace, hostTimestamp, slot, monTraceID, cuId);
+      addApproximateDataTransferEndEvents(shard, cuId);
+      addApproximateStallEndEvents(shard, trace, hostTimestamp, slot, monTraceID, cuId);
     }
   }
 
-  void PLDeviceTraceLogger::addAIMEvent(uint64_t trace, double hostTimestamp)
+  void PLDeviceTraceLogger::addAIMEvent(TraceShard& shard, uint64_t trace, double hostTimestamp)
   {
     uint64_t traceID = getTraceId(trace);
 
@@ -245,10 +256,10 @@ namespace xdp {
     int32_t cuId = mon->cuIndex;
     VTFEventType ty = (traceID & 0x1) ? KERNEL_WRITE : KERNEL_READ;
 
-    addKernelDataTransferEvent(ty, trace, slot, cuId, hostTimestamp, memStrId);
+    addKernelDataTransferEvent(shard, ty, trace, slot, cuId, hostTimestamp, memStrId);
   }
 
-  void PLDeviceTraceLogger::addASMEvent(uint64_t trace, double hostTimestamp)
+  void PLDeviceTraceLogger::addASMEvent(TraceShard& shard, uint64_t trace, double hostTimestamp)
   {
     auto traceId = getTraceId(trace);
     auto eventFlags = getEventFlags(trace);
@@ -290,7 +301,7 @@ namespace xdp {
       // start event
       strmEvent = new DeviceStreamAccess(0, hostTimestamp, streamEventType, deviceId, slot, cuId);
       strmEvent->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(strmEvent);
+      addEvent(shard, strmEvent);
       DeviceEventInfo info;
       info.type = strmEvent->getEventType();
       info.eventID = strmEvent->getEventId();
@@ -304,7 +315,7 @@ namespace xdp {
         // add dummy start event
         strmEvent = new DeviceStreamAccess(0, hostTimestamp, streamEventType, deviceId, slot, cuId);
         strmEvent->setDeviceTimestamp(deviceTimestamp);
-        db->getDynamicInfo().addEvent(strmEvent);
+        addEvent(shard, strmEvent);
         matchingStart.type = strmEvent->getEventType();
         matchingStart.eventID = strmEvent->getEventId();
         matchingStart.hostTimestamp = hostTimestamp;
@@ -314,13 +325,14 @@ namespace xdp {
       // add end event
       strmEvent = new DeviceStreamAccess(matchingStart.eventID, hostTimestamp, streamEventType, deviceId, slot, cuId);
       strmEvent->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(strmEvent);
+      addEvent(shard, strmEvent);
       asmLastTrans[slot] = deviceTimestamp;
     }
   }
 
   void PLDeviceTraceLogger::
-  addKernelDataTransferEvent(VTFEventType ty,
+  addKernelDataTransferEvent(TraceShard& shard,
+                             VTFEventType ty,
                              uint64_t trace,
                              uint32_t slot,
                              int32_t cuId,
@@ -346,13 +358,13 @@ namespace xdp {
                                  ty, deviceId, slot, cuId,
                                  memStrId);
         memEvent->setDeviceTimestamp(deviceTimestamp);
-        db->getDynamicInfo().addEvent(memEvent);
+        addEvent(shard, memEvent);
         aimLastTrans[slot] = deviceTimestamp;
       }
 
       memEvent = new DeviceMemoryAccess(0, hostTimestamp, ty, deviceId, slot, cuId, memStrId);
       memEvent->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(memEvent);
+      addEvent(shard, memEvent);
       DeviceEventInfo info;
       info.type = memEvent->getEventType();
       info.eventID = memEvent->getEventId();
@@ -367,7 +379,7 @@ namespace xdp {
         // We need to add a dummy start event for this observed end event
         memEvent = new DeviceMemoryAccess(0, hostTimestamp, ty, deviceId, slot, cuId, memStrId);
         memEvent->setDeviceTimestamp(deviceTimestamp);
-        db->getDynamicInfo().addEvent(memEvent);
+        addEvent(shard, memEvent);
         matchingStart.type = memEvent->getEventType();
         matchingStart.eventID = memEvent->getEventId();
         matchingStart.hostTimestamp = hostTimestamp;
@@ -388,13 +400,13 @@ namespace xdp {
                                             hostTimestamp, ty,
                                             deviceId, slot, cuId, memStrId);
           memEvent->setDeviceTimestamp(deviceTimestamp);
-          db->getDynamicInfo().addEvent(memEvent);
+          addEvent(shard, memEvent);
 
           // Now create the dummy start
           memEvent = new DeviceMemoryAccess(0, hostTimestamp, ty,
                                             deviceId, slot, cuId, memStrId);
           memEvent->setDeviceTimestamp(deviceTimestamp);
-          db->getDynamicInfo().addEvent(memEvent);
+          addEvent(shard, memEvent);
           matchingStart.type = memEvent->getEventType();
           matchingStart.eventID = memEvent->getEventId();
           matchingStart.hostTimestamp = hostTimestamp;
@@ -409,12 +421,12 @@ namespace xdp {
                                         hostTimestamp, ty,
                                         deviceId, slot, cuId, memStrId);
       memEvent->setDeviceTimestamp(deviceTimestamp);
-      db->getDynamicInfo().addEvent(memEvent);
+      addEvent(shard, memEvent);
       aimLastTrans[slot] = deviceTimestamp;
     }
   }
 
- void PLDeviceTraceLogger::addApproximateCUEndEvents()
+  void PLDeviceTraceLogger::addApproximateCUEndEvents(TraceShard& shard)
   {
     for(uint32_t amIndex = 0; amIndex < cuStarts.size(); ++amIndex) {
       if(cuStarts[amIndex].empty()) {
@@ -475,12 +487,13 @@ namespace xdp {
 
       // end event
       double hostTimestamp = convertDeviceToHostTimestamp(cuLastTimestamp);
-      addCUEndEvent(hostTimestamp, cuLastTimestamp, amIndex, cuId);
+      addCUEndEvent(shard, hostTimestamp, cuLastTimestamp, amIndex, cuId);
     }
   }
 
   void
-  PLDeviceTraceLogger::addApproximateDataTransferEvent(VTFEventType type,
+  PLDeviceTraceLogger::addApproximateDataTransferEvent(TraceShard& shard,
+                                                       VTFEventType type,
                                                        uint64_t aimTraceID,
                                                        int32_t amId,
                                                        int32_t cuId,
@@ -522,10 +535,10 @@ namespace xdp {
                              type,
                              deviceId, amId, cuId, memStrId);
     endEvent->setDeviceTimestamp(transApproxEndTimestamp);
-    db->getDynamicInfo().addEvent(endEvent);
+    addEvent(shard, endEvent);
   }
 
-  void PLDeviceTraceLogger::addApproximateDataTransferEndEvents()
+  void PLDeviceTraceLogger::addApproximateDataTransferEndEvents(TraceShard& shard)
   {
     // Go through all of our AIMs that have trace enabled.  If any of them
     //  have any outstanding reads or writes, then finish them based off of
@@ -560,12 +573,12 @@ namespace xdp {
         }
       }
 
-      addApproximateDataTransferEvent(KERNEL_READ, aimReadId, amId, cuId, memStrId);
-      addApproximateDataTransferEvent(KERNEL_WRITE, aimWriteId, amId, cuId, memStrId);
+      addApproximateDataTransferEvent(shard, KERNEL_READ, aimReadId, amId, cuId, memStrId);
+      addApproximateDataTransferEvent(shard, KERNEL_WRITE, aimWriteId, amId, cuId, memStrId);
     }
   }
 
-  void PLDeviceTraceLogger::addApproximateDataTransferEndEvents(int32_t cuId)
+  void PLDeviceTraceLogger::addApproximateDataTransferEndEvents(TraceShard& shard, int32_t cuId)
   {
     if (cuId == -1)
       return;
@@ -595,12 +608,12 @@ namespace xdp {
       if (cu) {
         amId = cu->getAccelMon();
       }
-      addApproximateDataTransferEvent(KERNEL_READ, aimSlotID, amId, cuId, memStrId);
-      addApproximateDataTransferEvent(KERNEL_WRITE, aimSlotID + 1, amId, cuId, memStrId);
+      addApproximateDataTransferEvent(shard, KERNEL_READ, aimSlotID, amId, cuId, memStrId);
+      addApproximateDataTransferEvent(shard, KERNEL_WRITE, aimSlotID + 1, amId, cuId, memStrId);
     }
   }
 
-  void PLDeviceTraceLogger::addApproximateStreamEndEvents()
+  void PLDeviceTraceLogger::addApproximateStreamEndEvents(TraceShard& shard)
   {
     // Find unfinished ASM events
     bool unfinishedASMevents = false;
@@ -624,13 +637,13 @@ namespace xdp {
       }
 
       VTFEventType streamEventType = (mon->isStreamRead) ? KERNEL_STREAM_READ : KERNEL_STREAM_WRITE;
-      addApproximateStreamEndEvent(asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
+      addApproximateStreamEndEvent(shard, asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
 
       streamEventType = (mon->isStreamRead) ? KERNEL_STREAM_READ_STALL : KERNEL_STREAM_WRITE_STALL;
-      addApproximateStreamEndEvent(asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
+      addApproximateStreamEndEvent(shard, asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
 
       streamEventType = (mon->isStreamRead) ? KERNEL_STREAM_READ_STARVE : KERNEL_STREAM_WRITE_STARVE;
-      addApproximateStreamEndEvent(asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
+      addApproximateStreamEndEvent(shard, asmIndex, asmTraceID, streamEventType, cuId, amId, cuLastTimestamp, asmAppxLastTransTimeStamp, unfinishedASMevents);
 
       asmLastTrans[asmIndex] = asmAppxLastTransTimeStamp;
     }
@@ -641,7 +654,7 @@ namespace xdp {
     }
   }
 
-  void PLDeviceTraceLogger::addApproximateStallEndEvents(uint64_t trace, double hostTimestamp, uint32_t s, uint64_t monTraceID, int32_t cuId)
+  void PLDeviceTraceLogger::addApproximateStallEndEvents(TraceShard& shard, uint64_t trace, double hostTimestamp, uint32_t s, uint64_t monTraceID, int32_t cuId)
   {
     if (traceIDs[s] == 0)
       return;
@@ -649,20 +662,20 @@ namespace xdp {
     const double halfCycleTimeInMs = (0.5/traceClockRateMHz)/1000.0;
 
     if (traceIDs[s] & STALL_INT_MASK) {
-      addStallEvent(trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID, cuId,
+      addStallEvent(shard, trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID, cuId,
                     KERNEL_STALL_DATAFLOW, STALL_INT_MASK);
     }
     if (traceIDs[s] & STALL_STR_MASK) {
-      addStallEvent(trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID,
+      addStallEvent(shard, trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID,
                     cuId, KERNEL_STALL_PIPE, STALL_STR_MASK);
     }
     if (traceIDs[s] & STALL_EXT_MASK) {
-      addStallEvent(trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID, cuId,
+      addStallEvent(shard, trace, hostTimestamp-halfCycleTimeInMs, s, monTraceID, cuId,
                     KERNEL_STALL_EXT_MEM, STALL_EXT_MASK);
     }
   }
 
-  void PLDeviceTraceLogger::addApproximateStreamEndEvent(uint64_t asmIndex, uint64_t asmTraceID, VTFEventType streamEventType,
+  void PLDeviceTraceLogger::addApproximateStreamEndEvent(TraceShard& shard, uint64_t asmIndex, uint64_t asmTraceID, VTFEventType streamEventType,
                                                                  int32_t cuId, int32_t  amId, uint64_t cuLastTimestamp,
                                                                  uint64_t &asmAppxLastTransTimeStamp, bool &unfinishedASMevents)
   {
@@ -689,7 +702,7 @@ namespace xdp {
       DeviceStreamAccess* strmEvent = new DeviceStreamAccess(matchingStart.eventID, asmAppxEndHostTimestamp,
                                                            streamEventType, deviceId, asmIndex, cuId);
       strmEvent->setDeviceTimestamp(asmAppxEndTimestamp);
-      db->getDynamicInfo().addEvent(strmEvent);
+      addEvent(shard, strmEvent);
 
       matchingStart = db->getDynamicInfo().matchingDeviceEventStart(deviceId, asmTraceID, streamEventType);
     }
@@ -699,32 +712,16 @@ namespace xdp {
   // corresponding host timestamps.  We need at least two training packets
   // to plot a line and get the slopes we use for adjusting timestamps.
   // As the device progresses, we'll encounter additional training packets and
-  // they may not be continuous, so this function uses static variables
-  // to keep track of the last packet we've seen.
+  // they may not be continuous, so the first point is kept in the logger
+  // until the second one shows up.
   void PLDeviceTraceLogger::trainDeviceHostTimestamps(uint64_t deviceTimestamp, uint64_t hostTimestamp)
   {
-    static double y1 = 0.0;
-    static double y2 = 0.0;
-    static double x1 = 0.0;
-    static double x2 = 0.0;
-
-    if (!y1 && !x1) {
-      y1 = static_cast <double> (hostTimestamp);
-      x1 = static_cast <double> (deviceTimestamp);
-    } else {
-      y2 = static_cast <double> (hostTimestamp);
-      x2 = static_cast <double> (deviceTimestamp);
-      // slope in ns/cycle
-      if (xdp::getFlowMode() == HW) {
-        clockTrainSlope = 1000.0/traceClockRateMHz;
-      } else {
-        clockTrainSlope = (y2 - y1) / (x2 - x1);
-      }
-      clockTrainOffset = y2 - clockTrainSlope * x2;
-      // next time update x1, y1
-      y1 = 0.0;
-      x1 = 0.0;
-    }
+    // Timestamps converted after this point use the updated model, so
+    //  conversion follows the clocks as they drift during the run
+    clockTrainer.addPoint(deviceTimestamp, hostTimestamp);
+    // slope in ns/cycle
+    clockTrainSlope = clockTrainer.getSlope();
+    clockTrainOffset = clockTrainer.getOffset();
   }
 
   // Convert device timestamp to host time domain (in msec)
@@ -733,6 +730,241 @@ namespace xdp {
     return ((clockTrainSlope * (double)deviceTimestamp) + clockTrainOffset)/1e6;
   }
 
+  // Everything that shares decoding state goes to the same shard.  An AM
+  //  ending a CU execution ties off the transfers of the AIMs on that CU
+  //  and the approximations use the last transaction of the CU's AM, so
+  //  all monitors of a CU are decoded together.  Monitors not attached to
+  //  a CU are independent of everything else.
+  void PLDeviceTraceLogger::assignShards()
+  {
+    // Shard 0 also takes packets from monitors we don't know about.
+    //  Those are dropped when they are decoded.
+    shards.resize(1);
+    if (!xclbin)
+      return;
+
+    std::map<int32_t, uint32_t> cuShards;
+    auto shardFor = [&](Monitor* mon) -> uint32_t {
+      if (!mon || mon->cuIndex == -1) {
+        shards.emplace_back();
+        return static_cast<uint32_t>(shards.size() - 1);
+      }
+      auto iter = cuShards.find(mon->cuIndex);
+      if (iter != cuShards.end())
+        return iter->second;
+      shards.emplace_back();
+      auto index = static_cast<uint32_t>(shards.size() - 1);
+      cuShards[mon->cuIndex] = index;
+      return index;
+    };
+
+    auto& staticInfo = db->getStaticInfo();
+    amShards.resize(cuStarts.size());
+    for (uint64_t slot = 0; slot < amShards.size(); ++slot)
+      amShards[slot] = shardFor(staticInfo.getAMonitor(deviceId, xclbin, slot));
+
+    aimShards.resize(std::max<uint64_t>(aimLastTrans.size(),
+                                        staticInfo.getNumAIM(deviceId, xclbin)));
+    for (uint64_t slot = 0; slot < aimShards.size(); ++slot)
+      aimShards[slot] = shardFor(staticInfo.getAIMonitor(deviceId, xclbin, slot));
+
+    asmShards.resize(asmLastTrans.size());
+    for (uint64_t slot = 0; slot < asmShards.size(); ++slot)
+      asmShards[slot] = shardFor(staticInfo.getASMonitor(deviceId, xclbin, slot));
+
+    auto hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    auto numThreads = std::min<std::size_t>({hardwareThreads, shards.size(), MAX_DECODE_THREADS});
+    if (numThreads > 1)
+      workers = std::make_unique<TraceWorkerPool>(static_cast<unsigned int>(numThreads));
+  }
+
+  void PLDeviceTraceLogger::addEvent(TraceShard& shard, VTFEvent* event)
+  {
+    // The id is needed right away to match start and end events
+    db->getDynamicInfo().issueId(event);
+    shard.events.push_back(event);
+  }
+
+  void PLDeviceTraceLogger::decodeShard(TraceShard& shard)
+  {
+    for (auto& entry : shard.packets) {
+      switch (entry.type) {
+      case PLTraceClassifier::AM:
+        addAMEvent(shard, entry.packet, entry.hostTimestamp);
+        break;
+      case PLTraceClassifier::AIM:
+        addAIMEvent(shard, entry.packet, entry.hostTimestamp);
+        break;
+      default:
+        addASMEvent(shard, entry.packet, entry.hostTimestamp);
+        break;
+      }
+    }
+    shard.packets.clear();
+
+    // Approximate ends can be earlier than events added before them
+    std::stable_sort(shard.events.begin(), shard.events.end(),
+                     [](VTFEvent* l, VTFEvent* r)
+                     { return l->getTimestamp() < r->getTimestamp(); });
+  }
+
+  // Merge the events of every finished shard by timestamp and add them to
+  //  the database in one go, then log the statistics the shards collected.
+  //  This is always done on a single thread.
+  void PLDeviceTraceLogger::commitShards(std::vector<TraceShard*>& finished)
+  {
+    std::size_t total = 0;
+    for (auto shard : finished)
+      total += shard->events.size();
+
+    std::vector<VTFEvent*> merged;
+    merged.reserve(total);
+
+    // (timestamp, shard), smallest first.  Ties go to the lower shard so
+    //  the merge is deterministic.
+    using Head = std::pair<double, std::size_t>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    std::vector<std::size_t> positions(finished.size(), 0);
+    for (std::size_t i = 0; i < finished.size(); ++i) {
+      if (!finished[i]->events.empty())
+        heads.emplace(finished[i]->events.front()->getTimestamp(), i);
+    }
+    while (!heads.empty()) {
+      auto i = heads.top().second;
+      heads.pop();
+      auto& events = finished[i]->events;
+      merged.push_back(events[positions[i]++]);
+      if (positions[i] < events.size())
+        heads.emplace(events[positions[i]]->getTimestamp(), i);
+    }
+    db->getDynamicInfo().addDeviceEvents(deviceId, merged);
+
+    auto& stats = db->getStats();
+    double firstKernelStartTime = 0.0;
+    for (auto shard : finished) {
+      shard->events.clear();
+
+      if (shard->firstKernelStartTime != 0.0 &&
+          (firstKernelStartTime == 0.0 || shard->firstKernelStartTime < firstKernelStartTime))
+        firstKernelStartTime = shard->firstKernelStartTime;
+      shard->firstKernelStartTime = 0.0;
+
+      if (shard->lastKernelEndTime > stats.getLastKernelEndTime())
+        stats.setLastKernelEndTime(shard->lastKernelEndTime);
+      shard->lastKernelEndTime = 0.0;
+
+      // Log a CU execution in our statistics database
+      // NOTE: At this stage, we don't know the global work size, so let's
+      //       leave it to the database to fill that in.
+      for (auto& execution : shard->cuExecutions) {
+        auto cu = db->getStaticInfo().getCU(deviceId, execution.first);
+        stats.logComputeUnitExecution(cu->getName(),
+                                      cu->getKernelName(),
+                                      cu->getDim(),
+                                      "",
+                                      execution.second);
+      }
+      shard->cuExecutions.clear();
+    }
+
+    // Only the first kernel start ever seen is kept
+    if (firstKernelStartTime != 0.0 && stats.getFirstKernelStartTime() == 0.0)
+      stats.setFirstKernelStartTime(firstKernelStartTime);
+  }
+
+  void PLDeviceTraceLogger::addClockTrainingPacket(uint64_t packet,
+                                                   uint64_t deviceTimestamp)
+  {
+    auto clockTrainingDeviceTimestamp = deviceTimestamp;
+    if (clockTrainingModulus == 0) {
+      if (clockTrainingDeviceTimestamp >= firstTimestamp) {
+        clockTrainingDeviceTimestamp =
+          clockTrainingDeviceTimestamp - firstTimestamp;
+      }
+      else {
+        clockTrainingDeviceTimestamp =
+          clockTrainingDeviceTimestamp + (0x1FFFFFFFFFFF - firstTimestamp);
+      }
+    }
+    clockTrainingHostTimestamp |= ((packet >> 45) & 0xFFFF) << (16 * clockTrainingModulus);
+    ++clockTrainingModulus;
+    if (clockTrainingModulus == 4) {
+      // It requires four complete clock training packets before
+      //  we can perform the clock training algorithm
+      trainDeviceHostTimestamps(clockTrainingDeviceTimestamp,
+                                clockTrainingHostTimestamp);
+      clockTrainingHostTimestamp = 0;
+      clockTrainingModulus = 0;
+    }
+  }
+
+  void PLDeviceTraceLogger::classifyBlock(const uint64_t* packets, uint64_t count)
+  {
+    classifier.classify(packets, count, firstTimestamp);
+    auto deviceTimestamps = classifier.getDeviceTimestamps();
+    if (hostTimestamps.size() < count)
+      hostTimestamps.resize(count);
+    auto host = hostTimestamps.data();
+
+    // Every stretch of packets between clock training packets is converted
+    //  in one go with the training in effect at that point
+    auto clockIndices = classifier.getIndices(PLTraceClassifier::CLOCK_TRAINING);
+    auto numClock = classifier.getCount(PLTraceClassifier::CLOCK_TRAINING);
+    uint64_t converted = 0;
+    for (uint64_t i = 0; i < numClock; ++i) {
+      auto index = clockIndices[i];
+      classifier.convertToHostTimestamps(deviceTimestamps + converted,
+                                         host + converted, index - converted,
+                                         clockTrainSlope, clockTrainOffset);
+      addClockTrainingPacket(packets[index], deviceTimestamps[index]);
+      converted = index + 1;
+    }
+    classifier.convertToHostTimestamps(deviceTimestamps + converted,
+                                       host + converted, count - converted,
+                                       clockTrainSlope, clockTrainOffset);
+
+    // Walk the AM, AIM, and ASM lists together so every shard gets its
+    //  packets in trace order
+    constexpr int numTypes = 3;
+    const PLTraceClassifier::PacketClass types[numTypes] =
+      { PLTraceClassifier::AM, PLTraceClassifier::AIM, PLTraceClassifier::ASM };
+    const uint32_t* lists[numTypes];
+    uint64_t sizes[numTypes];
+    uint64_t positions[numTypes] = { 0 };
+    for (int t = 0; t < numTypes; ++t) {
+      lists[t] = classifier.getIndices(types[t]);
+      sizes[t] = classifier.getCount(types[t]);
+    }
+
+    while (true) {
+      int next = -1;
+      for (int t = 0; t < numTypes; ++t) {
+        if (positions[t] < sizes[t] &&
+            (next == -1 || lists[t][positions[t]] < lists[next][positions[next]]))
+          next = t;
+      }
+      if (next == -1)
+        break;
+
+      auto index = lists[next][positions[next]++];
+      auto packet = packets[index];
+      auto traceId = getTraceId(packet);
+
+      uint32_t shard = 0;
+      if (types[next] == PLTraceClassifier::AM)
+        shard = shardOf(amShards, (traceId - util::min_trace_id_am) / 16);
+      else if (types[next] == PLTraceClassifier::AIM)
+        shard = shardOf(aimShards, traceId / 2);
+      else
+        shard = shardOf(asmShards, traceId - util::min_trace_id_asm);
+
+      shards[shard].packets.push_back({packet, host[index], types[next]});
+
+      // keep track of latest timestamp that comes through trace
+      mLatestHostTimestampMs = host[index];
+    }
+  }
+
   void PLDeviceTraceLogger::processTraceData(void* data, uint64_t numBytes)
   {
     if (numBytes == 0)
@@ -746,95 +978,61 @@ namespace xdp {
     // Try to find 8 contiguous clock training packets.  Anything before that
     //  is garbage from the previous run
     // Note: This needs to be done only in beginning chunk of data
-    static bool found = false;
-    if (!found) {
-      for (uint64_t i = 0; i < numPackets - 8; ++i) {
+    if (!foundClockTraining && numPackets >= 8) {
+      for (uint64_t i = 0; i <= numPackets - 8; ++i) {
         for (uint64_t j = i; j < i + 8; ++j) {
           uint64_t packet = (static_cast<uint64_t*>(data))[j];
           if (!isClockTraining(packet))
             break;
           if (j == (i + 7)) {
             start = i ;
-            found = true;
+            foundClockTraining = true;
           }
         }
-        if (found)
+        if (foundClockTraining)
           break;
       }
     }
 
-    // Clock Training state is preserved across calls
-    static uint32_t modulus = 0;
-    static uint64_t clockTrainingHostTimestamp = 0;
-
-    for (uint64_t i = start ; i < numPackets ; ++i) {
-      uint64_t packet = (static_cast<uint64_t*>(data))[i];
-      auto deviceTimestamp = getDeviceTimestamp(packet);
-      auto traceId = getTraceId(packet);
-      auto clockTrainingDeviceTimestamp = deviceTimestamp;
-
-      /*
-      if (i == start && firstTimestamp == 0) {
-        firstTimestamp = deviceTimestamp ;
-      }
-      */
-
-      if (isClockTraining(packet)) {
-        if (modulus == 0) {
-          if (clockTrainingDeviceTimestamp >= firstTimestamp) {
-            clockTrainingDeviceTimestamp =
-              clockTrainingDeviceTimestamp - firstTimestamp;
-          }
-          else {
-            clockTrainingDeviceTimestamp =
-              clockTrainingDeviceTimestamp + (0x1FFFFFFFFFFF - firstTimestamp);
-          }
-        }
-        clockTrainingHostTimestamp |= ((packet >> 45) & 0xFFFF) << (16 * modulus);
-        ++modulus;
-        if (modulus == 4) {
-          // It requires four complete clock training packets before
-          //  we can perform the clock training algorithm
-          trainDeviceHostTimestamps(clockTrainingDeviceTimestamp,
-                                    clockTrainingHostTimestamp);
-          clockTrainingHostTimestamp = 0;
-          clockTrainingDeviceTimestamp = 0;
-          modulus = 0;
-        }
-        continue;
-      }
-
-      bool AMPacket  = (traceId >= util::min_trace_id_am &&
-                        traceId <= util::max_trace_id_am);
-      bool AIMPacket = (traceId <= util::max_trace_id_aim); // min trace id aim == 0
-      bool ASMPacket = (traceId >= util::min_trace_id_asm &&
-                        traceId <  util::max_trace_id_asm);
-      if (!AMPacket && !AIMPacket && !ASMPacket) {
-        continue;
-      }
+    // Clock training has to be applied in trace order, so host timestamps
+    //  are assigned here and the packets are handed to their shards
+    auto packets = static_cast<const uint64_t*>(data) + start;
+    for (uint64_t remaining = numPackets - start; remaining > 0; ) {
+      auto count = std::min(remaining, CLASSIFY_BLOCK_PACKETS);
+      classifyBlock(packets, count);
+      packets += count;
+      remaining -= count;
+    }
 
-      double hostTimestamp = convertDeviceToHostTimestamp(deviceTimestamp);
-      if (AMPacket) {
-        addAMEvent(packet, hostTimestamp);
-      }
-      if (AIMPacket) {
-        addAIMEvent(packet, hostTimestamp);
-      }
-      if (ASMPacket) {
-        addASMEvent(packet, hostTimestamp);
-      }
+    std::vector<TraceShard*> active;
+    for (auto& shard : shards) {
+      if (!shard.packets.empty())
+        active.push_back(&shard);
+    }
 
-      // keep track of latest timestamp that comes through trace
-      mLatestHostTimestampMs = hostTimestamp;
+    if (workers && active.size() > 1 && numPackets >= PARALLEL_DECODE_MIN_PACKETS) {
+      workers->run(active.size(), [&](std::size_t i) { decodeShard(*active[i]); });
+    }
+    else {
+      for (auto shard : active)
+        decodeShard(*shard);
     }
 
+    commitShards(active);
   }
 
   void PLDeviceTraceLogger::endProcessTraceData()
   {
-    addApproximateCUEndEvents();
-    addApproximateDataTransferEndEvents();
-    addApproximateStreamEndEvents();
+    TraceShard approximations;
+    addApproximateCUEndEvents(approximations);
+    addApproximateDataTransferEndEvents(approximations);
+    addApproximateStreamEndEvents(approximations);
+
+    std::stable_sort(approximations.events.begin(), approximations.events.end(),
+                     [](VTFEvent* l, VTFEvent* r)
+                     { return l->getTimestamp() < r->getTimestamp(); });
+    std::vector<TraceShard*> finished = { &approximations };
+    commitShards(finished);
   }
 
   void PLDeviceTraceLogger::addEventMarkers(bool isFIFOFull, bool isTS2MMFull)
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -18,19 +18,81 @@
 #ifndef _XDP_PROFILE_DEVICE_BASE_TRACE_LOGGER_H
 #define _XDP_PROFILE_DEVICE_BASE_TRACE_LOGGER_H
 
+#include <list>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "xdp/config.h"
+#include "xdp/profile/device/clock_trainer.h"
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/database/events/device_events.h"
+#include "xdp/profile/device/pl_trace_classifier.h"
+#include "xdp/profile/device/trace_worker_pool.h"
 
 namespace xdp {
 
   // The responsiblity of this class is to convert raw Device PL events
   //  into database events and log them into the database
+  //
+  // Every AM, AIM, and ASM keeps its own decoding state, and the only
+  //  state shared between monitors is between the monitors of the same
+  //  CU.  Each buffer of trace is split into shards, one per CU plus one
+  //  per monitor not attached to a CU, and the shards are decoded in
+  //  parallel.  Clock training packets apply to everything after them in
+  //  the buffer, so host timestamps are assigned in a serial pass before
+  //  the packets are handed to the shards.
   class PLDeviceTraceLogger
   {
    private:
+    // The packets of one shard along with everything decoding them
+    //  produces that must be added to the shared databases afterwards
+    struct TraceShard
+    {
+      struct Packet
+      {
+        uint64_t packet;
+        double hostTimestamp;
+        PLTraceClassifier::PacketClass type;
+      };
+      // In trace order
+      std::vector<Packet> packets;
+
+      // Events created, with ids already issued
+      std::vector<VTFEvent*> events;
+
+      // CU index and execution time of every CU execution that finished
+      std::vector<std::pair<int32_t, double>> cuExecutions;
+      double firstKernelStartTime = 0.0;
+      double lastKernelEndTime = 0.0;
+    };
+
+    std::vector<TraceShard> shards;
+    // The shard of each AM, AIM, and ASM slot
+    std::vector<uint32_t> amShards;
+    std::vector<uint32_t> aimShards;
+    std::vector<uint32_t> asmShards;
+    std::unique_ptr<TraceWorkerPool> workers;
+
+    // Raw packets are classified and given host timestamps in blocks
+    //  of this many packets
+    static constexpr uint64_t CLASSIFY_BLOCK_PACKETS = 65536;
+    PLTraceClassifier classifier;
+    std::vector<double> hostTimestamps;
+    void classifyBlock(const uint64_t* packets, uint64_t count);
+    void addClockTrainingPacket(uint64_t packet, uint64_t deviceTimestamp);
+
+    // Below this many packets a buffer is decoded on the calling thread
+    static constexpr uint64_t PARALLEL_DECODE_MIN_PACKETS = 4096;
+    static constexpr std::size_t MAX_DECODE_THREADS = 8;
+
+    void assignShards();
+    inline uint32_t shardOf(const std::vector<uint32_t>& slots, uint64_t slot)
+      { return (slot < slots.size()) ? slots[slot] : 0; }
+    void decodeShard(TraceShard& shard);
+    void addEvent(TraceShard& shard, VTFEvent* event);
+    void commitShards(std::vector<TraceShard*>& finished);
+
     uint64_t deviceId = 0;
     XclbinInfo* xclbin = nullptr;
     VPDatabase* db = nullptr;
@@ -62,39 +124,47 @@ namespace xdp {
     double traceClockRateMHz;
     double clockTrainSlope;
 
+    // Clock training state carried from one buffer of trace to the next
+    bool foundClockTraining = false;
+    uint32_t clockTrainingModulus = 0;
+    uint64_t clockTrainingHostTimestamp = 0;
+    // Fits clockTrainSlope and clockTrainOffset to the training points
+    ClockTrainer clockTrainer;
+
     bool warnCUIncomplete=false;
 
     void trainDeviceHostTimestamps(uint64_t deviceTimestamp, uint64_t hostTimestamp);
     double convertDeviceToHostTimestamp(uint64_t deviceTimestamp);
 
     // Functions for adding device events based on the monitor type
-    void addAMEvent (uint64_t trace, double hostTimestamp) ;
-    void addAIMEvent(uint64_t trace, double hostTimestamp) ;
-    void addASMEvent(uint64_t trace, double hostTimestamp) ;
+    void addAMEvent (TraceShard& shard, uint64_t trace, double hostTimestamp) ;
+    void addAIMEvent(TraceShard& shard, uint64_t trace, double hostTimestamp) ;
+    void addASMEvent(TraceShard& shard, uint64_t trace, double hostTimestamp) ;
 
     // Functions for adding specific types of device events from the
     //  raw device data
-    void addCUEvent(uint64_t trace, double hostTimestamp,
+    void addCUEvent(TraceShard& shard, uint64_t trace, double hostTimestamp,
                     uint32_t slot, uint64_t monTraceId, int32_t cuId) ;
-    void addStallEvent(uint64_t trace, double hostTimestamp,
+    void addStallEvent(TraceShard& shard, uint64_t trace, double hostTimestamp,
                        uint32_t slot, uint64_t monTraceId, int32_t cuId,
                        VTFEventType type, uint64_t mask) ;
-    void addKernelDataTransferEvent(VTFEventType ty, uint64_t trace,
-                                    uint32_t slot, int32_t cuId,
-                                    double hostTimestamp, uint64_t memStrId) ;
+    void addKernelDataTransferEvent(TraceShard& shard, VTFEventType ty,
+                                    uint64_t trace, uint32_t slot,
+                                    int32_t cuId, double hostTimestamp,
+                                    uint64_t memStrId) ;
 
-    void addCUEndEvent(double hostTimestamp, uint64_t deviceTimestamp,
-                       uint32_t s, int32_t cuId);
+    void addCUEndEvent(TraceShard& shard, double hostTimestamp,
+                       uint64_t deviceTimestamp, uint32_t s, int32_t cuId);
 
     // Functions for handling dropped device packets
-    void addApproximateCUEndEvents();
-    void addApproximateDataTransferEndEvents();
-    void addApproximateDataTransferEndEvents(int32_t cuId);
-    void addApproximateStreamEndEvents();
-    void addApproximateStallEndEvents(uint64_t trace, double hostTimestamp, uint32_t slot, uint64_t monTraceId, int32_t cuId) ;
-
-    void addApproximateDataTransferEvent(VTFEventType type, uint64_t aimTraceID, int32_t amId, int32_t cuId, uint64_t memStrId);
-    void addApproximateStreamEndEvent(uint64_t asmIndex, uint64_t asmTraceID, VTFEventType streamEventType,
+    void addApproximateCUEndEvents(TraceShard& shard);
+    void addApproximateDataTransferEndEvents(TraceShard& shard);
+    void addApproximateDataTransferEndEvents(TraceShard& shard, int32_t cuId);
+    void addApproximateStreamEndEvents(TraceShard& shard);
+    void addApproximateStallEndEvents(TraceShard& shard, uint64_t trace, double hostTimestamp, uint32_t slot, uint64_t monTraceId, int32_t cuId) ;
+
+    void addApproximateDataTransferEvent(TraceShard& shard, VTFEventType type, uint64_t aimTraceID, int32_t amId, int32_t cuId, uint64_t memStrId);
+    void addApproximateStreamEndEvent(TraceShard& shard, uint64_t asmIndex, uint64_t asmTraceID, VTFEventType streamEventType,
                                       int32_t cuId, int32_t  amId, uint64_t cuLastTimestamp,
                                       uint64_t &asmAppxLastTransTimeStamp, bool &unfinishedASMevents);
 
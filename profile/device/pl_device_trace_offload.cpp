@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -21,6 +21,8 @@
 #include "xdp/profile/device/pl_device_trace_logger.h"
 #include "xrt/experimental/xrt_profile.h"
 
+#include <sstream>
+
 namespace xdp {
 
 PLDeviceTraceOffload::
@@ -60,6 +62,12 @@ PLDeviceTraceOffload::
   }
 }
 
+void PLDeviceTraceOffload::
+enable_adaptive_interval()
+{
+  adaptive = interval_controller.configureFromConfig(sleep_interval_ms * 1000);
+}
+
 void PLDeviceTraceOffload::
 offload_device_continuous()
 {
@@ -72,7 +80,23 @@ offload_device_continuous()
     train_clock();
     // Can't flush datamover in middle of offload
     m_read_trace(false);
-    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_interval_ms));
+    if (adaptive) {
+      auto interval_us = interval_controller.update(pass_fill.exchange(0.0));
+      std::this_thread::sleep_for(std::chrono::microseconds(interval_us));
+    }
+    else
+      std::this_thread::sleep_for(std::chrono::milliseconds(sleep_interval_ms));
+  }
+
+  if (adaptive) {
+    auto& telemetry = interval_controller.getTelemetry();
+    std::stringstream msg;
+    msg << "Trace offload interval (us) last: " << telemetry.intervalUs
+        << ", min: " << telemetry.minIntervalUsed
+        << ", max: " << telemetry.maxIntervalUsed
+        << ". Buffer headroom last: " << telemetry.headroom
+        << ", min: " << telemetry.minHeadroom;
+    xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT", msg.str());
   }
 
   // Do final forced read
@@ -127,20 +151,17 @@ process_trace()
 
   bool q_read = false;
   bool q_empty = true;
-  std::unique_ptr<unsigned char[]> buf;
-  uint64_t size = 0;
+  TraceChunk chunk;
   do {
     q_read=false;
     ts2mm_info.process_queue_lock.lock();
     if (!ts2mm_info.data_queue.empty()) {
-      buf = std::move(ts2mm_info.data_queue.front());
-      size = ts2mm_info.size_queue.front();
+      chunk = std::move(ts2mm_info.data_queue.front());
       ts2mm_info.data_queue.pop();
-      ts2mm_info.size_queue.pop();
       q_read = true;
       q_empty = ts2mm_info.data_queue.empty();
     }
-    if (ts2mm_info.size_queue.size() > TS2MM_QUEUE_SZ_WARN_THRESHOLD) {
+    if (ts2mm_info.data_queue.size() > TS2MM_QUEUE_SZ_WARN_THRESHOLD) {
       std::call_once(ts2mm_queue_warning_flag, [](){
         xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", TS2MM_WARN_MSG_QUEUE_SZ);
       });
@@ -149,9 +170,18 @@ process_trace()
 
     // Processing takes a lot more time compared to everything else
     if (q_read) {
-      debug_stream << "Process " << size << " bytes of trace" << std::endl;
-      deviceTraceLogger->processTraceData(buf.get(), size) ;
-      buf.reset();
+      debug_stream << "Process " << chunk.size << " bytes of trace" << std::endl;
+      deviceTraceLogger->processTraceData(chunk.data, chunk.size) ;
+
+      if (chunk.copy) {
+        chunk.copy.reset();
+      }
+      else {
+        // Zero copy : the region can now be handed back to the offload
+        std::lock_guard<std::mutex> lock(ts2mm_info.process_queue_lock);
+        ts2mm_info.pending_bytes[chunk.index] -= chunk.size;
+        ts2mm_info.pending_cv.notify_all();
+      }
     }
   } while (!q_empty);
 }
@@ -294,31 +324,37 @@ read_trace_s2mm(bool force)
     if (bd.offload_done)
       continue;
 
+    // In zero copy mode, regions already offloaded from this buffer are
+    //  decoded straight out of it.  The final read has to wait for them.
+    uint64_t pending = 0;
+    if (bd.mapping) {
+      std::unique_lock<std::mutex> lock(ts2mm_info.process_queue_lock);
+      if (force)
+        ts2mm_info.pending_cv.wait(lock, [&]() { return ts2mm_info.pending_bytes[i] == 0; });
+      pending = ts2mm_info.pending_bytes[i];
+    }
+
     auto bytes_written = dev_intf->getWordCountTs2mm(i, force) * TRACE_PACKET_SIZE;
     auto bytes_read = bd.rollover_count * bd.alloc_size + bd.used_size;
 
+    if (adaptive && bd.alloc_size && bytes_written > bytes_read) {
+      auto fill = static_cast<double>(bytes_written - bytes_read) / bd.alloc_size;
+      if (fill > pass_fill.load())
+        pass_fill = fill;
+    }
+
     // Offload cannot keep up with the DMA
     if (bytes_written > bytes_read + bd.alloc_size) {
-      // Don't read any data
-      bd.offload_done = true;
-
-       debug_stream
-        << "ts2mm_ " << i << " Reading from 0x"
-        << std::hex << bd.offset << " to 0x" << bd.used_size << std::dec
-        << " Bytes Read : " << bytes_read
-        << " Bytes Written : " << bytes_written
-        << " Rollovers : " << bd.rollover_count
-        << std::endl;
-
-      // Add warnings and user markers
-      xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", TS2MM_WARN_MSG_CIRC_BUF_OVERWRITE);
-      xrt::profile::user_event events;
-      events.mark("Trace Buffer Overwrite Detected");
-      // Fatal condition. Abort offload
-      stop_offload();
+      report_overwrite(i, bytes_read, bytes_written);
       return;
     }
 
+    // Back-pressure : leave the offload pointer where it is until the
+    //  processing thread has decoded what was handed out last time.
+    //  New trace stays in the device buffer until then.
+    if (pending)
+      continue;
+
     // Start Offload from previous offset
     bd.offset = bd.used_size;
     if (bd.offset == bd.alloc_size) {
@@ -349,8 +385,11 @@ read_trace_s2mm(bool force)
         << std::endl;
     }
 
-    if (!sync_and_log(i))
+    if (!sync_and_log(i)) {
+      if (bd.overwritten)
+        return;
       continue;
+    }
 
     // Do another sync if we're crossing circular buffer boundary
     if (ts2mm_info.use_circ_buf && cir_buf_rollover_bytes) {
@@ -380,7 +419,9 @@ sync_and_log(uint64_t index)
 
   uint64_t nBytes = bd.used_size - bd.offset;
   auto start = std::chrono::steady_clock::now();
-  void* host_buf = dev_intf->syncTraceBuf(bd.bufId, bd.offset, nBytes);
+  void* host_buf = bd.mapping
+    ? dev_intf->syncMappedTraceBuf(bd.bufId, bd.mapping, bd.offset, nBytes)
+    : dev_intf->syncTraceBuf(bd.bufId, bd.offset, nBytes);
   auto end = std::chrono::steady_clock::now();
 
   debug_stream
@@ -393,12 +434,36 @@ sync_and_log(uint64_t index)
     return false;
   }
 
-  auto tmp = std::make_unique<unsigned char[]>(nBytes);
-  std::memcpy(tmp.get(), host_buf, nBytes);
+  TraceChunk chunk;
+  chunk.index = index;
+  chunk.size = nBytes;
+  if (bd.mapping) {
+    // The buffer stays mapped until reset_s2mm, and the region is not
+    //  synced again until it has been decoded
+    chunk.data = static_cast<unsigned char*>(host_buf);
+  }
+  else {
+    chunk.copy = std::make_unique<unsigned char[]>(nBytes);
+    std::memcpy(chunk.copy.get(), host_buf, nBytes);
+    chunk.data = chunk.copy.get();
+  }
+
+  // The DMA keeps writing a circular buffer while it is offloaded.  Make
+  //  sure it did not wrap around into this region before it was copied.
+  if (ts2mm_info.use_circ_buf) {
+    auto region_start = bd.rollover_count * bd.alloc_size + bd.offset;
+    auto bytes_written = dev_intf->getWordCountTs2mm(index, false) * TRACE_PACKET_SIZE;
+    if (bytes_written > region_start + bd.alloc_size) {
+      report_overwrite(index, region_start, bytes_written);
+      return false;
+    }
+  }
+
   // Push new data into queue for processing
   ts2mm_info.process_queue_lock.lock();
-  ts2mm_info.data_queue.push(std::move(tmp));
-  ts2mm_info.size_queue.push(nBytes);
+  if (bd.mapping)
+    ts2mm_info.pending_bytes[index] += nBytes;
+  ts2mm_info.data_queue.push(std::move(chunk));
   ts2mm_info.process_queue_lock.unlock();
 
   // Print warning if processing large amount of trace
@@ -413,6 +478,31 @@ sync_and_log(uint64_t index)
   return true;
 }
 
+void PLDeviceTraceOffload::
+report_overwrite(uint64_t index, uint64_t bytes_read, uint64_t bytes_written)
+{
+  auto& bd = ts2mm_info.buffers[index];
+
+  // Don't read any data
+  bd.offload_done = true;
+  bd.overwritten = true;
+
+  debug_stream
+    << "ts2mm_ " << index << " Reading from 0x"
+    << std::hex << bd.offset << " to 0x" << bd.used_size << std::dec
+    << " Bytes Read : " << bytes_read
+    << " Bytes Written : " << bytes_written
+    << " Rollovers : " << bd.rollover_count
+    << std::endl;
+
+  // Add warnings and user markers
+  xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", TS2MM_WARN_MSG_CIRC_BUF_OVERWRITE);
+  xrt::profile::user_event events;
+  events.mark("Trace Buffer Overwrite Detected");
+  // Fatal condition. Abort offload
+  stop_offload();
+}
+
 bool PLDeviceTraceOffload::
 init_s2mm(bool circ_buf, const std::vector<uint64_t> &buf_sizes)
 {
@@ -422,13 +512,20 @@ init_s2mm(bool circ_buf, const std::vector<uint64_t> &buf_sizes)
   if (!ts2mm_info.buffers.empty())
     reset_s2mm();
   ts2mm_info.buffers.resize(ts2mm_info.num_ts2mm);
+  ts2mm_info.pending_bytes.assign(ts2mm_info.num_ts2mm, 0);
 
   if (buf_sizes.empty())
     return false;
 
   // Check if allocated buffer and sleep interval can keep up with offload
   if (dev_intf->supportsCircBufPL() && circ_buf) {
-    if (sleep_interval_ms != 0) {
+    if (adaptive) {
+      // The fastest the buffer can be offloaded is at the minimum interval
+      ts2mm_info.circ_buf_cur_rate =
+        buf_sizes.front() * (1000000 / interval_controller.getMinIntervalUs());
+      if (ts2mm_info.circ_buf_cur_rate >= ts2mm_info.circ_buf_min_rate)
+        ts2mm_info.use_circ_buf = true;
+    } else if (sleep_interval_ms != 0) {
       ts2mm_info.circ_buf_cur_rate = buf_sizes.front() * (1000 / sleep_interval_ms);
       if (ts2mm_info.circ_buf_cur_rate >= ts2mm_info.circ_buf_min_rate)
         ts2mm_info.use_circ_buf = true;
@@ -437,6 +534,12 @@ init_s2mm(bool circ_buf, const std::vector<uint64_t> &buf_sizes)
     }
   }
 
+  // The DMA does not wait for the offload in circular mode, so it could
+  //  overwrite a region while it is being decoded in place
+  if (zero_copy && ts2mm_info.use_circ_buf)
+    xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT",
+                            TS2MM_WARN_MSG_ZERO_COPY_CIRC_BUF);
+
   for (uint64_t i = 0; i < ts2mm_info.num_ts2mm; i++) {
     auto& bd = ts2mm_info.buffers[i];
     bd.alloc_size = buf_sizes[i];
@@ -449,6 +552,12 @@ init_s2mm(bool circ_buf, const std::vector<uint64_t> &buf_sizes)
     bd.address = dev_intf->getTraceBufDeviceAddr(bd.bufId);
     dev_intf->initTS2MM(i, bd.alloc_size, bd.address, ts2mm_info.use_circ_buf);
 
+    // Zero copy decodes regions in place, which is only safe if the DMA
+    //  cannot wrap around into them.  Regions of a buffer that cannot be
+    //  mapped are copied.
+    if (zero_copy && !ts2mm_info.use_circ_buf)
+      bd.mapping = dev_intf->mapTraceBuf(bd.bufId);
+
     debug_stream
     << "PLDeviceTraceOffload::init_s2mm with each size : " << bd.alloc_size
     << " initiated " << i << " ts2mm " << std::endl;
@@ -463,7 +572,20 @@ reset_s2mm()
   if (ts2mm_info.buffers.empty())
     return;
 
+  // Regions still queued may point into the mapped buffers
+  for (auto& bd : ts2mm_info.buffers) {
+    if (bd.mapping) {
+      process_trace();
+      break;
+    }
+  }
+
   for (uint64_t i = 0; i < ts2mm_info.num_ts2mm; i++) {
+    if (ts2mm_info.buffers[i].mapping) {
+      dev_intf->unmapTraceBuf(ts2mm_info.buffers[i].bufId);
+      ts2mm_info.buffers[i].mapping = nullptr;
+    }
+
     // Need to re-initialize datamover with circular buffer off for reset to work properly
     if (ts2mm_info.use_circ_buf)
       dev_intf->initTS2MM(i, 0, ts2mm_info.buffers[i].address, 0);
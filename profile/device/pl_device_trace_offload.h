@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2019-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -20,6 +20,7 @@
 
 #include "core/common/message.h"
 #include "xdp/config.h"
+#include "xdp/profile/device/offload_interval_controller.h"
 #include "xdp/profile/device/pl_device_intf.h"
 #include "xdp/profile/device/pl_device_trace_logger.h"
 #include "xdp/profile/device/tracedefs.h"
@@ -27,6 +28,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
 #include <functional>
@@ -35,6 +37,7 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace xdp {
 
@@ -61,6 +64,10 @@ struct TraceBufferInfo {
   bool     full;
   bool     offload_done;
   bool     big_trace_warn_done;
+  bool     overwritten;
+  // Zero copy mode : host mapping of the buffer, held from init_s2mm
+  //  until reset_s2mm
+  void*    mapping;
   
   TraceBufferInfo()
     : bufId(0),
@@ -72,11 +79,25 @@ struct TraceBufferInfo {
       rollover_count(0),
       full(false),
       offload_done(false),
-      big_trace_warn_done(false)
+      big_trace_warn_done(false),
+      overwritten(false),
+      mapping(nullptr)
   {}
        
 };
 
+// A region of a TS2MM buffer waiting to be decoded.  Normally the region
+// is copied out of the buffer when it is offloaded.  In zero copy mode
+// "data" points straight into the host mapping of the buffer and the
+// region must be decoded before the offload pointer of that buffer moves.
+// Circular buffers are always copied since the DMA keeps writing them.
+struct TraceChunk {
+  uint64_t index = 0; // TS2MM the data was offloaded from
+  std::unique_ptr<unsigned char[]> copy;
+  unsigned char* data = nullptr;
+  uint64_t size = 0;
+};
+
 struct Ts2mmInfo {
   size_t   num_ts2mm;
   uint64_t full_buf_size;
@@ -89,10 +110,14 @@ struct Ts2mmInfo {
   uint64_t circ_buf_min_rate = TS2MM_DEF_BUF_SIZE * 100;
   uint64_t circ_buf_cur_rate;
 
-  std::queue<std::unique_ptr<unsigned char[]>> data_queue;
-  std::queue<uint64_t> size_queue;
+  std::queue<TraceChunk> data_queue;
   std::mutex process_queue_lock;
 
+  // Zero copy mode : bytes of each buffer queued but not yet decoded.
+  //  Protected by process_queue_lock.
+  std::vector<uint64_t> pending_bytes;
+  std::condition_variable pending_cv;
+
   Ts2mmInfo()
     : num_ts2mm(0),
       full_buf_size(0),
@@ -157,6 +182,24 @@ public:
   inline bool continuous_offload() { return continuous ; }
   inline void set_continuous(bool value = true) { continuous = value ; }
 
+  // Decode TS2MM trace directly from the host mapping of the buffer
+  //  instead of copying every offloaded region.  Must be set before
+  //  offload starts.
+  inline bool zero_copy_offload() { return zero_copy ; }
+  inline void set_zero_copy(bool value = true) { zero_copy = value ; }
+
+  // Let the continuous offload interval follow the rate the trace
+  //  buffers fill, if xrt.ini asks for it.  Must be set before
+  //  read_trace_init.
+  XDP_CORE_EXPORT void enable_adaptive_interval();
+  inline bool adaptive_interval() { return adaptive ; }
+  // Current offload interval and how much of a buffer is expected to be
+  //  left free at the next read
+  inline uint64_t get_offload_interval_us()
+    { return adaptive ? interval_controller.getIntervalUs() : sleep_interval_ms * 1000 ; }
+  inline double get_offload_headroom()
+    { return adaptive ? interval_controller.getHeadroom() : 1.0 ; }
+
 private:
   void read_trace_fifo(bool force=true);
   void read_trace_s2mm(bool force=true);
@@ -169,6 +212,7 @@ private:
   void offload_finished();
   void process_trace_continuous();
   bool sync_and_log(uint64_t index);
+  void report_overwrite(uint64_t index, uint64_t bytes_read, uint64_t bytes_written);
 
 protected:
   PLDeviceIntf* dev_intf;
@@ -190,6 +234,13 @@ private:
   std::thread offload_thread;
   std::thread process_thread;
   bool continuous = false;
+  bool zero_copy = false;
+
+  // Adaptive offload interval
+  bool adaptive = false;
+  OffloadIntervalController interval_controller;
+  // Largest fraction of a buffer written between two reads
+  std::atomic<double> pass_fill{0.0};
 
   // Clock Training Params
   bool m_force_clk_train = true;
@@ -0,0 +1,226 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include "xdp/profile/device/pl_trace_classifier.h"
+#include "xdp/profile/device/utility.h"
+
+// The AVX2 code is compiled for that target function by function and only
+//  called after checking the processor at run time, so the rest of the
+//  library does not need to be built for AVX2.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define XDP_PL_TRACE_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+  // Layout of a PL trace packet
+  constexpr uint64_t TIMESTAMP_MASK     = 0x1FFFFFFFFFFF;
+  constexpr int      TRACE_ID_SHIFT     = 49;
+  constexpr uint64_t TRACE_ID_MASK      = 0xFFF;
+  constexpr int      CLOCK_TRAINING_BIT = 63;
+
+  inline uint8_t classOf(uint64_t packet)
+  {
+    using xdp::PLTraceClassifier;
+    namespace util = xdp::util;
+
+    if ((packet >> CLOCK_TRAINING_BIT) & 0x1)
+      return PLTraceClassifier::CLOCK_TRAINING;
+
+    auto traceId = (packet >> TRACE_ID_SHIFT) & TRACE_ID_MASK;
+    if (traceId >= util::min_trace_id_am && traceId <= util::max_trace_id_am)
+      return PLTraceClassifier::AM;
+    if (traceId <= util::max_trace_id_aim) // min trace id aim == 0
+      return PLTraceClassifier::AIM;
+    if (traceId >= util::min_trace_id_asm && traceId < util::max_trace_id_asm)
+      return PLTraceClassifier::ASM;
+    return PLTraceClassifier::NUM_CLASSES;
+  }
+
+  inline double toHost(uint64_t device, double slope, double offset)
+  {
+    return ((slope * static_cast<double>(device)) + offset)/1e6;
+  }
+
+#ifdef XDP_PL_TRACE_AVX2
+  bool processorHasAVX2()
+  {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+  }
+
+  __attribute__((target("avx2")))
+  void convertAVX2(const uint64_t* device, double* host, uint64_t count,
+                   double slope, double offset)
+  {
+    // Integers below 2^52 become doubles exactly by placing them in the
+    //  mantissa of 2^52 and subtracting 2^52.  Device timestamps are 45
+    //  bits, so only wrapped timestamps take the scalar path.
+    const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256d magic     = _mm256_set1_pd(4503599627370496.0); // 2^52
+    const __m256i highBits  = _mm256_set1_epi64x(static_cast<long long>(0xFFF0000000000000ULL));
+    const __m256d vSlope    = _mm256_set1_pd(slope);
+    const __m256d vOffset   = _mm256_set1_pd(offset);
+    const __m256d vScale    = _mm256_set1_pd(1e6);
+
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      __m256i ts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(device + i));
+      if (!_mm256_testz_si256(ts, highBits)) {
+        for (uint64_t j = i; j < i + 4; ++j)
+          host[j] = toHost(device[j], slope, offset);
+        continue;
+      }
+      __m256d d = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(ts, magicBits)), magic);
+      // Multiply and add separately (no FMA) to round like the scalar code
+      __m256d h = _mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(vSlope, d), vOffset), vScale);
+      _mm256_storeu_pd(host + i, h);
+    }
+    for (; i < count; ++i)
+      host[i] = toHost(device[i], slope, offset);
+  }
+
+  // Classify packets four at a time.  Returns the number of packets
+  //  handled, the rest (fewer than four) are left for the scalar loop.
+  __attribute__((target("avx2")))
+  uint64_t classifyAVX2(const uint64_t* packets, uint64_t count,
+                        uint64_t firstTimestamp, uint64_t* timestamps,
+                        uint32_t** lists, uint64_t* counts)
+  {
+    using xdp::PLTraceClassifier;
+    namespace util = xdp::util;
+
+    const __m256i timestampMask = _mm256_set1_epi64x(static_cast<long long>(TIMESTAMP_MASK));
+    const __m256i first         = _mm256_set1_epi64x(static_cast<long long>(firstTimestamp));
+    const __m256i idMask        = _mm256_set1_epi64x(static_cast<long long>(TRACE_ID_MASK));
+    const __m256i zero          = _mm256_setzero_si256();
+    // Ranges are checked as (low - 1) < id < (high + 1)
+    const __m256i amLow   = _mm256_set1_epi64x(util::min_trace_id_am - 1);
+    const __m256i amHigh  = _mm256_set1_epi64x(util::max_trace_id_am + 1);
+    const __m256i aimHigh = _mm256_set1_epi64x(util::max_trace_id_aim + 1);
+    const __m256i asmLow  = _mm256_set1_epi64x(util::min_trace_id_asm - 1);
+    const __m256i asmHigh = _mm256_set1_epi64x(util::max_trace_id_asm);
+
+    uint64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      __m256i packet = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packets + i));
+
+      __m256i ts = _mm256_sub_epi64(_mm256_and_si256(packet, timestampMask), first);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(timestamps + i), ts);
+
+      // The top bit marks clock training packets, which is the sign bit
+      __m256i clock = _mm256_cmpgt_epi64(zero, packet);
+      __m256i id = _mm256_and_si256(_mm256_srli_epi64(packet, TRACE_ID_SHIFT), idMask);
+
+      __m256i am = _mm256_and_si256(_mm256_cmpgt_epi64(id, amLow),
+                                    _mm256_cmpgt_epi64(amHigh, id));
+      __m256i aim = _mm256_cmpgt_epi64(aimHigh, id);
+      __m256i asmPacket = _mm256_and_si256(_mm256_cmpgt_epi64(id, asmLow),
+                                           _mm256_cmpgt_epi64(asmHigh, id));
+
+      int masks[PLTraceClassifier::NUM_CLASSES];
+      masks[PLTraceClassifier::CLOCK_TRAINING] =
+        _mm256_movemask_pd(_mm256_castsi256_pd(clock));
+      masks[PLTraceClassifier::AM] =
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_andnot_si256(clock, am)));
+      masks[PLTraceClassifier::AIM] =
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_andnot_si256(clock, aim)));
+      masks[PLTraceClassifier::ASM] =
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_andnot_si256(clock, asmPacket)));
+
+      for (int type = 0; type < PLTraceClassifier::NUM_CLASSES; ++type) {
+        for (int bits = masks[type]; bits != 0; bits &= bits - 1) {
+          auto lane = static_cast<uint32_t>(__builtin_ctz(static_cast<unsigned int>(bits)));
+          lists[type][counts[type]++] = static_cast<uint32_t>(i) + lane;
+        }
+      }
+    }
+    return i;
+  }
+#endif
+
+} // end anonymous namespace
+
+namespace xdp {
+
+  PLTraceClassifier::PLTraceClassifier(bool allowSIMD)
+  {
+#ifdef XDP_PL_TRACE_AVX2
+    useAVX2 = allowSIMD && processorHasAVX2();
+#else
+    (void)allowSIMD;
+#endif
+  }
+
+  void PLTraceClassifier::classifyScalar(const uint64_t* packets,
+                                         uint64_t begin, uint64_t end,
+                                         uint64_t firstTimestamp)
+  {
+    uint64_t* timestamps = deviceTimestamps.data();
+    for (uint64_t i = begin; i < end; ++i) {
+      timestamps[i] = (packets[i] & TIMESTAMP_MASK) - firstTimestamp;
+      auto type = classOf(packets[i]);
+      if (type != NUM_CLASSES)
+        classIndices[type][classCounts[type]++] = static_cast<uint32_t>(i);
+    }
+  }
+
+  void PLTraceClassifier::classify(const uint64_t* packets, uint64_t count,
+                                   uint64_t firstTimestamp)
+  {
+    // Every buffer is big enough for the worst case so the loops can
+    //  store without checking
+    if (deviceTimestamps.size() < count) {
+      deviceTimestamps.resize(count);
+      for (auto& list : classIndices)
+        list.resize(count);
+    }
+    for (auto& classCount : classCounts)
+      classCount = 0;
+
+    uint64_t done = 0;
+#ifdef XDP_PL_TRACE_AVX2
+    if (useAVX2) {
+      uint32_t* lists[NUM_CLASSES];
+      for (int type = 0; type < NUM_CLASSES; ++type)
+        lists[type] = classIndices[type].data();
+      done = classifyAVX2(packets, count, firstTimestamp,
+                          deviceTimestamps.data(), lists, classCounts);
+    }
+#endif
+    classifyScalar(packets, done, count, firstTimestamp);
+  }
+
+  void PLTraceClassifier::convertToHostTimestamps(const uint64_t* device,
+                                                  double* host,
+                                                  uint64_t count,
+                                                  double slope,
+                                                  double offset) const
+  {
+#ifdef XDP_PL_TRACE_AVX2
+    if (useAVX2) {
+      convertAVX2(device, host, count, slope, offset);
+      return;
+    }
+#endif
+    for (uint64_t i = 0; i < count; ++i)
+      host[i] = toHost(device[i], slope, offset);
+  }
+
+} // end namespace xdp
@@ -0,0 +1,90 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef XDP_PL_TRACE_CLASSIFIER_DOT_H
+#define XDP_PL_TRACE_CLASSIFIER_DOT_H
+
+#include <cstdint>
+#include <vector>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  // A pre-pass over raw PL trace packets.  In one sweep over a block of
+  //  packets it extracts every device timestamp and sorts the packets
+  //  into one index list per packet type, so the decoders only look at
+  //  packets of the type they handle.  On x86 processors with AVX2 four
+  //  packets are classified at a time.  Everywhere else a scalar loop
+  //  produces the same result.
+  class PLTraceClassifier
+  {
+  public:
+    enum PacketClass : uint8_t {
+      CLOCK_TRAINING = 0,
+      AM,
+      AIM,
+      ASM,
+      NUM_CLASSES
+    };
+
+    // Blocks passed to classify must not have more packets than this
+    static constexpr uint64_t MAX_BLOCK_PACKETS = 1ULL << 31;
+
+  private:
+    bool useAVX2 = false;
+
+    // Device timestamp of every packet in the block
+    std::vector<uint64_t> deviceTimestamps;
+    // Index in the block of every packet of each class, in order.
+    //  Packets that are not clock training and don't come from an AM,
+    //  AIM, or ASM are not in any list.  The buffers only ever grow, so
+    //  the number of valid entries is kept separately.
+    std::vector<uint32_t> classIndices[NUM_CLASSES];
+    uint64_t classCounts[NUM_CLASSES] = { 0 };
+
+    void classifyScalar(const uint64_t* packets, uint64_t begin,
+                        uint64_t end, uint64_t firstTimestamp);
+
+  public:
+    // SIMD is used when the processor supports it unless allowSIMD is false
+    XDP_CORE_EXPORT explicit PLTraceClassifier(bool allowSIMD = true);
+
+    XDP_CORE_EXPORT void classify(const uint64_t* packets, uint64_t count,
+                                  uint64_t firstTimestamp);
+
+    // Results of the last call to classify
+    inline const uint64_t* getDeviceTimestamps() const
+      { return deviceTimestamps.data(); }
+    inline const uint32_t* getIndices(PacketClass type) const
+      { return classIndices[type].data(); }
+    inline uint64_t getCount(PacketClass type) const
+      { return classCounts[type]; }
+    inline bool usingSIMD() const { return useAVX2; }
+
+    // host[i] = (slope * device[i] + offset) / 1e6 for every i, which is
+    //  how trained device timestamps are converted to milliseconds.  The
+    //  SIMD version gives bit for bit the same results.
+    XDP_CORE_EXPORT void convertToHostTimestamps(const uint64_t* device,
+                                                 double* host,
+                                                 uint64_t count,
+                                                 double slope,
+                                                 double offset) const;
+  };
+
+} // end namespace xdp
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#define XDP_CORE_SOURCE
+
+#include "xdp/profile/device/trace_worker_pool.h"
+
+namespace xdp {
+
+  TraceWorkerPool::TraceWorkerPool(unsigned int numThreads)
+  {
+    for (unsigned int i = 1; i < numThreads; ++i)
+      workers.emplace_back(&TraceWorkerPool::work, this);
+  }
+
+  TraceWorkerPool::~TraceWorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(poolLock);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+      worker.join();
+  }
+
+  void TraceWorkerPool::drain(const Task& task)
+  {
+    for (auto i = nextTask++; i < batchSize; i = nextTask++) {
+      try {
+        task(i);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(poolLock);
+        if (!failure)
+          failure = std::current_exception();
+      }
+    }
+  }
+
+  void TraceWorkerPool::work()
+  {
+    uint64_t seen = 0;
+    while (true) {
+      const Task* task = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(poolLock);
+        wake.wait(lock, [&]() { return stopping || generation != seen; });
+        if (stopping)
+          return;
+        seen = generation;
+        task = batch;
+      }
+
+      drain(*task);
+
+      std::lock_guard<std::mutex> lock(poolLock);
+      if (--busyWorkers == 0)
+        done.notify_all();
+    }
+  }
+
+  void TraceWorkerPool::run(std::size_t numTasks, const Task& task)
+  {
+    if (numTasks == 0)
+      return;
+
+    if (workers.empty() || numTasks == 1) {
+      for (std::size_t i = 0; i < numTasks; ++i)
+        task(i);
+      return;
+    }
+
+    std::lock_guard<std::mutex> runGuard(runLock);
+    {
+      std::lock_guard<std::mutex> lock(poolLock);
+      batch = &task;
+      batchSize = numTasks;
+      nextTask = 0;
+      busyWorkers = workers.size();
+      failure = nullptr;
+      ++generation;
+    }
+    wake.notify_all();
+
+    drain(task);
+
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(poolLock);
+      done.wait(lock, [&]() { return busyWorkers == 0; });
+      batch = nullptr;
+      error = failure;
+      failure = nullptr;
+    }
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+} // end namespace xdp
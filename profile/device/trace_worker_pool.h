@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+#ifndef XDP_TRACE_WORKER_POOL_DOT_H
+#define XDP_TRACE_WORKER_POOL_DOT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "xdp/config.h"
+
+namespace xdp {
+
+  // A fixed set of threads that trace decoders use to work on
+  //  independent pieces of a trace buffer at the same time.  The pool
+  //  runs one batch of tasks at a time and the calling thread works on
+  //  the batch along with the workers.
+  class TraceWorkerPool
+  {
+  public:
+    using Task = std::function<void (std::size_t)>;
+
+  private:
+    std::vector<std::thread> workers;
+
+    std::mutex poolLock;  // Protects everything below
+    std::condition_variable wake;
+    std::condition_variable done;
+    const Task* batch = nullptr;
+    std::size_t batchSize = 0;
+    std::atomic<std::size_t> nextTask{0};
+    std::size_t busyWorkers = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+    std::exception_ptr failure;
+
+    std::mutex runLock;   // Only one batch runs at a time
+
+    void work();
+    void drain(const Task& task);
+
+  public:
+    // numThreads includes the calling thread, so a pool of one thread
+    //  runs every batch serially.
+    XDP_CORE_EXPORT explicit TraceWorkerPool(unsigned int numThreads);
+    XDP_CORE_EXPORT ~TraceWorkerPool();
+
+    TraceWorkerPool(const TraceWorkerPool&) = delete;
+    TraceWorkerPool& operator=(const TraceWorkerPool&) = delete;
+
+    // Call task(0) ... task(numTasks - 1) and return when all of them
+    //  have finished.  If a task throws, the first exception is rethrown
+    //  here once the batch is done.
+    XDP_CORE_EXPORT void run(std::size_t numTasks, const Task& task);
+
+    inline std::size_t size() const { return workers.size() + 1; }
+  };
+
+} // end namespace xdp
+
+#endif
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2025 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -84,6 +84,11 @@ namespace xdp {
     return usedRegisters->getRegisterAddr(regName);
   }
 
+  uint16_t AieDebugMetadata::lookupRegisterId(uint64_t regVal)
+  {
+    return usedRegisters->getRegisterNames().findByAddress(regVal);
+  }
+
   /****************************************************************************
    * Convert xrt.ini setting to vector
    ***************************************************************************/
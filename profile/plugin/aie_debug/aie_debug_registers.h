@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved
+
+#ifndef AIE_DEBUG_REGISTERS_H
+#define AIE_DEBUG_REGISTERS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace xdp {
+
+// Same ordering as std::string comparison of the names
+constexpr int compareRegisterNames(const char* a, const char* b) {
+  while (*a != '\0' && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return static_cast<int>(static_cast<unsigned char>(*a))
+       - static_cast<int>(static_cast<unsigned char>(*b));
+}
+
+struct RegisterName {
+  const char* name;
+  uint64_t address;
+};
+
+/*************************************************************************************
+The register name tables map between the names and relative addresses of the registers
+that AIE debug can read on one AIE hw generation. They are built at compile time from the
+constants in aie_base/generations. Registers are sorted by name and a register's index
+in that order is its id. A second array lists the ids sorted by address. Where several
+registers share an address, that array holds the one the debug output has always
+reported for it.
+**************************************************************************************/
+class RegisterNameTable {
+  public:
+    static constexpr uint16_t INVALID_ID = UINT16_MAX;
+
+    constexpr RegisterNameTable() = default;
+    constexpr RegisterNameTable(const RegisterName* r, uint16_t numR,
+                                const uint16_t* a, uint16_t numA)
+      : registers(r), numRegisters(numR), byAddress(a), numAddresses(numA) {}
+
+    uint16_t size() const { return numRegisters; }
+    const char* getName(uint16_t id) const { return registers[id].name; }
+    uint64_t getAddress(uint16_t id) const { return registers[id].address; }
+
+    uint16_t findByName(const char* name) const {
+      auto last = registers + numRegisters;
+      auto found = std::lower_bound(registers, last, name,
+        [](const RegisterName& r, const char* n) {
+          return compareRegisterNames(r.name, n) < 0;
+        });
+      if ((found == last) || (compareRegisterNames(found->name, name) != 0))
+        return INVALID_ID;
+      return static_cast<uint16_t>(found - registers);
+    }
+    uint16_t findByName(const std::string& name) const {
+      return findByName(name.c_str());
+    }
+
+    uint16_t findByAddress(uint64_t address) const {
+      auto last = byAddress + numAddresses;
+      auto found = std::lower_bound(byAddress, last, address,
+        [this](uint16_t id, uint64_t a) { return registers[id].address < a; });
+      if ((found == last) || (registers[*found].address != address))
+        return INVALID_ID;
+      return *found;
+    }
+
+  private:
+    const RegisterName* registers = nullptr;
+    uint16_t numRegisters = 0;
+    const uint16_t* byAddress = nullptr;
+    uint16_t numAddresses = 0;
+};
+
+constexpr bool isSortedByName(const RegisterName* registers, std::size_t size) {
+  for (std::size_t i = 1; i < size; ++i) {
+    if (compareRegisterNames(registers[i - 1].name, registers[i].name) >= 0)
+      return false;
+  }
+  return true;
+}
+
+constexpr bool isSortedByAddress(const RegisterName* registers,
+                                 const uint16_t* ids, std::size_t size) {
+  for (std::size_t i = 1; i < size; ++i) {
+    if (registers[ids[i - 1]].address >= registers[ids[i]].address)
+      return false;
+  }
+  return true;
+}
+
+RegisterNameTable getAIE1RegisterNames();
+RegisterNameTable getAIE2RegisterNames();
+RegisterNameTable getAIE2psRegisterNames();
+
+} // end namespace xdp
+
+#endif
@@ -0,0 +1,689 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved
+
+#define XDP_PLUGIN_SOURCE
+
+#include <iterator>
+
+#include "xdp/profile/plugin/aie_base/generations/aie1_registers.h"
+#include "xdp/profile/plugin/aie_debug/aie_debug_registers.h"
+
+namespace xdp {
+
+/*************************************************************************************
+ AIE1 Registers
+ *************************************************************************************/
+namespace {
+
+constexpr RegisterName registers[] = {
+  {"cm_combo_event_control", aie1::cm_combo_event_control},
+  {"cm_combo_event_inputs", aie1::cm_combo_event_inputs},
+  {"cm_core_control", aie1::cm_core_control},
+  {"cm_core_status", aie1::cm_core_status},
+  {"cm_debug_control0", aie1::cm_debug_control0},
+  {"cm_debug_control1", aie1::cm_debug_control1},
+  {"cm_debug_control2", aie1::cm_debug_control2},
+  {"cm_debug_status", aie1::cm_debug_status},
+  {"cm_ecc_scrubbing_event", aie1::cm_ecc_scrubbing_event},
+  {"cm_enable_events", aie1::cm_enable_events},
+  {"cm_error_halt_control", aie1::cm_error_halt_control},
+  {"cm_error_halt_event", aie1::cm_error_halt_event},
+  {"cm_event_broadcast0", aie1::cm_event_broadcast0},
+  {"cm_event_broadcast1", aie1::cm_event_broadcast1},
+  {"cm_event_broadcast10", aie1::cm_event_broadcast10},
+  {"cm_event_broadcast11", aie1::cm_event_broadcast11},
+  {"cm_event_broadcast12", aie1::cm_event_broadcast12},
+  {"cm_event_broadcast13", aie1::cm_event_broadcast13},
+  {"cm_event_broadcast14", aie1::cm_event_broadcast14},
+  {"cm_event_broadcast15", aie1::cm_event_broadcast15},
+  {"cm_event_broadcast2", aie1::cm_event_broadcast2},
+  {"cm_event_broadcast3", aie1::cm_event_broadcast3},
+  {"cm_event_broadcast4", aie1::cm_event_broadcast4},
+  {"cm_event_broadcast5", aie1::cm_event_broadcast5},
+  {"cm_event_broadcast6", aie1::cm_event_broadcast6},
+  {"cm_event_broadcast7", aie1::cm_event_broadcast7},
+  {"cm_event_broadcast8", aie1::cm_event_broadcast8},
+  {"cm_event_broadcast9", aie1::cm_event_broadcast9},
+  {"cm_event_broadcast_block_east_clr", aie1::cm_event_broadcast_block_east_clr},
+  {"cm_event_broadcast_block_east_set", aie1::cm_event_broadcast_block_east_set},
+  {"cm_event_broadcast_block_east_value", aie1::cm_event_broadcast_block_east_value},
+  {"cm_event_broadcast_block_north_clr", aie1::cm_event_broadcast_block_north_clr},
+  {"cm_event_broadcast_block_north_set", aie1::cm_event_broadcast_block_north_set},
+  {"cm_event_broadcast_block_north_value", aie1::cm_event_broadcast_block_north_value},
+  {"cm_event_broadcast_block_south_clr", aie1::cm_event_broadcast_block_south_clr},
+  {"cm_event_broadcast_block_south_set", aie1::cm_event_broadcast_block_south_set},
+  {"cm_event_broadcast_block_south_value", aie1::cm_event_broadcast_block_south_value},
+  {"cm_event_broadcast_block_west_clr", aie1::cm_event_broadcast_block_west_clr},
+  {"cm_event_broadcast_block_west_set", aie1::cm_event_broadcast_block_west_set},
+  {"cm_event_broadcast_block_west_value", aie1::cm_event_broadcast_block_west_value},
+  {"cm_event_generate", aie1::cm_event_generate},
+  {"cm_event_group_0_enable", aie1::cm_event_group_0_enable},
+  {"cm_event_group_broadcast_enable", aie1::cm_event_group_broadcast_enable},
+  {"cm_event_group_core_program_flow_enable", aie1::cm_event_group_core_program_flow_enable},
+  {"cm_event_group_core_stall_enable", aie1::cm_event_group_core_stall_enable},
+  {"cm_event_group_errors0_enable", aie1::cm_event_group_errors0_enable},
+  {"cm_event_group_errors1_enable", aie1::cm_event_group_errors1_enable},
+  {"cm_event_group_pc_enable", aie1::cm_event_group_pc_enable},
+  {"cm_event_group_stream_switch_enable", aie1::cm_event_group_stream_switch_enable},
+  {"cm_event_group_user_event_enable", aie1::cm_event_group_user_event_enable},
+  {"cm_event_status0", aie1::cm_event_status0},
+  {"cm_event_status1", aie1::cm_event_status1},
+  {"cm_event_status2", aie1::cm_event_status2},
+  {"cm_event_status3", aie1::cm_event_status3},
+  {"cm_mc0", aie1::cm_mc0},
+  {"cm_mc1", aie1::cm_mc1},
+  {"cm_md0", aie1::cm_md0},
+  {"cm_md1", aie1::cm_md1},
+  {"cm_pc_event0", aie1::cm_pc_event0},
+  {"cm_pc_event1", aie1::cm_pc_event1},
+  {"cm_pc_event2", aie1::cm_pc_event2},
+  {"cm_pc_event3", aie1::cm_pc_event3},
+  {"cm_performance_control0", aie1::cm_performance_control0},
+  {"cm_performance_control1", aie1::cm_performance_control1},
+  {"cm_performance_control2", aie1::cm_performance_control2},
+  {"cm_performance_counter0", aie1::cm_performance_counter0},
+  {"cm_performance_counter0_event_value", aie1::cm_performance_counter0_event_value},
+  {"cm_performance_counter1", aie1::cm_performance_counter1},
+  {"cm_performance_counter1_event_value", aie1::cm_performance_counter1_event_value},
+  {"cm_performance_counter2", aie1::cm_performance_counter2},
+  {"cm_performance_counter2_event_value", aie1::cm_performance_counter2_event_value},
+  {"cm_performance_counter3", aie1::cm_performance_counter3},
+  {"cm_performance_counter3_event_value", aie1::cm_performance_counter3_event_value},
+  {"cm_program_counter", aie1::cm_program_counter},
+  {"cm_reset_event", aie1::cm_reset_event},
+  {"cm_stream_switch_event_port_selection_0", aie1::cm_stream_switch_event_port_selection_0},
+  {"cm_stream_switch_event_port_selection_1", aie1::cm_stream_switch_event_port_selection_1},
+  {"cm_stream_switch_master_config_aie_core0", aie1::cm_stream_switch_master_config_aie_core0},
+  {"cm_stream_switch_master_config_aie_core1", aie1::cm_stream_switch_master_config_aie_core1},
+  {"cm_stream_switch_master_config_dma0", aie1::cm_stream_switch_master_config_dma0},
+  {"cm_stream_switch_master_config_dma1", aie1::cm_stream_switch_master_config_dma1},
+  {"cm_stream_switch_master_config_east0", aie1::cm_stream_switch_master_config_east0},
+  {"cm_stream_switch_master_config_east1", aie1::cm_stream_switch_master_config_east1},
+  {"cm_stream_switch_master_config_east2", aie1::cm_stream_switch_master_config_east2},
+  {"cm_stream_switch_master_config_east3", aie1::cm_stream_switch_master_config_east3},
+  {"cm_stream_switch_master_config_fifo0", aie1::cm_stream_switch_master_config_fifo0},
+  {"cm_stream_switch_master_config_fifo1", aie1::cm_stream_switch_master_config_fifo1},
+  {"cm_stream_switch_master_config_north0", aie1::cm_stream_switch_master_config_north0},
+  {"cm_stream_switch_master_config_north1", aie1::cm_stream_switch_master_config_north1},
+  {"cm_stream_switch_master_config_north2", aie1::cm_stream_switch_master_config_north2},
+  {"cm_stream_switch_master_config_north3", aie1::cm_stream_switch_master_config_north3},
+  {"cm_stream_switch_master_config_north4", aie1::cm_stream_switch_master_config_north4},
+  {"cm_stream_switch_master_config_north5", aie1::cm_stream_switch_master_config_north5},
+  {"cm_stream_switch_master_config_south0", aie1::cm_stream_switch_master_config_south0},
+  {"cm_stream_switch_master_config_south1", aie1::cm_stream_switch_master_config_south1},
+  {"cm_stream_switch_master_config_south2", aie1::cm_stream_switch_master_config_south2},
+  {"cm_stream_switch_master_config_south3", aie1::cm_stream_switch_master_config_south3},
+  {"cm_stream_switch_master_config_tile_ctrl", aie1::cm_stream_switch_master_config_tile_ctrl},
+  {"cm_stream_switch_master_config_west0", aie1::cm_stream_switch_master_config_west0},
+  {"cm_stream_switch_master_config_west1", aie1::cm_stream_switch_master_config_west1},
+  {"cm_stream_switch_master_config_west2", aie1::cm_stream_switch_master_config_west2},
+  {"cm_stream_switch_master_config_west3", aie1::cm_stream_switch_master_config_west3},
+  {"cm_stream_switch_slave_aie_core0_slot0", aie1::cm_stream_switch_slave_aie_core0_slot0},
+  {"cm_stream_switch_slave_aie_core0_slot1", aie1::cm_stream_switch_slave_aie_core0_slot1},
+  {"cm_stream_switch_slave_aie_core0_slot2", aie1::cm_stream_switch_slave_aie_core0_slot2},
+  {"cm_stream_switch_slave_aie_core0_slot3", aie1::cm_stream_switch_slave_aie_core0_slot3},
+  {"cm_stream_switch_slave_aie_core1_slot0", aie1::cm_stream_switch_slave_aie_core1_slot0},
+  {"cm_stream_switch_slave_aie_core1_slot1", aie1::cm_stream_switch_slave_aie_core1_slot1},
+  {"cm_stream_switch_slave_aie_core1_slot2", aie1::cm_stream_switch_slave_aie_core1_slot2},
+  {"cm_stream_switch_slave_aie_core1_slot3", aie1::cm_stream_switch_slave_aie_core1_slot3},
+  {"cm_stream_switch_slave_aie_trace_slot0", aie1::cm_stream_switch_slave_aie_trace_slot0},
+  {"cm_stream_switch_slave_aie_trace_slot1", aie1::cm_stream_switch_slave_aie_trace_slot1},
+  {"cm_stream_switch_slave_aie_trace_slot2", aie1::cm_stream_switch_slave_aie_trace_slot2},
+  {"cm_stream_switch_slave_aie_trace_slot3", aie1::cm_stream_switch_slave_aie_trace_slot3},
+  {"cm_stream_switch_slave_config_aie_core0", aie1::cm_stream_switch_slave_config_aie_core0},
+  {"cm_stream_switch_slave_config_aie_core1", aie1::cm_stream_switch_slave_config_aie_core1},
+  {"cm_stream_switch_slave_config_aie_trace", aie1::cm_stream_switch_slave_config_aie_trace},
+  {"cm_stream_switch_slave_config_dma_0", aie1::cm_stream_switch_slave_config_dma_0},
+  {"cm_stream_switch_slave_config_dma_1", aie1::cm_stream_switch_slave_config_dma_1},
+  {"cm_stream_switch_slave_config_east_0", aie1::cm_stream_switch_slave_config_east_0},
+  {"cm_stream_switch_slave_config_east_1", aie1::cm_stream_switch_slave_config_east_1},
+  {"cm_stream_switch_slave_config_east_2", aie1::cm_stream_switch_slave_config_east_2},
+  {"cm_stream_switch_slave_config_east_3", aie1::cm_stream_switch_slave_config_east_3},
+  {"cm_stream_switch_slave_config_fifo_0", aie1::cm_stream_switch_slave_config_fifo_0},
+  {"cm_stream_switch_slave_config_fifo_1", aie1::cm_stream_switch_slave_config_fifo_1},
+  {"cm_stream_switch_slave_config_mem_trace", aie1::cm_stream_switch_slave_config_mem_trace},
+  {"cm_stream_switch_slave_config_north_0", aie1::cm_stream_switch_slave_config_north_0},
+  {"cm_stream_switch_slave_config_north_1", aie1::cm_stream_switch_slave_config_north_1},
+  {"cm_stream_switch_slave_config_north_2", aie1::cm_stream_switch_slave_config_north_2},
+  {"cm_stream_switch_slave_config_north_3", aie1::cm_stream_switch_slave_config_north_3},
+  {"cm_stream_switch_slave_config_south_0", aie1::cm_stream_switch_slave_config_south_0},
+  {"cm_stream_switch_slave_config_south_1", aie1::cm_stream_switch_slave_config_south_1},
+  {"cm_stream_switch_slave_config_south_2", aie1::cm_stream_switch_slave_config_south_2},
+  {"cm_stream_switch_slave_config_south_3", aie1::cm_stream_switch_slave_config_south_3},
+  {"cm_stream_switch_slave_config_south_4", aie1::cm_stream_switch_slave_config_south_4},
+  {"cm_stream_switch_slave_config_south_5", aie1::cm_stream_switch_slave_config_south_5},
+  {"cm_stream_switch_slave_config_tile_ctrl", aie1::cm_stream_switch_slave_config_tile_ctrl},
+  {"cm_stream_switch_slave_config_west_0", aie1::cm_stream_switch_slave_config_west_0},
+  {"cm_stream_switch_slave_config_west_1", aie1::cm_stream_switch_slave_config_west_1},
+  {"cm_stream_switch_slave_config_west_2", aie1::cm_stream_switch_slave_config_west_2},
+  {"cm_stream_switch_slave_config_west_3", aie1::cm_stream_switch_slave_config_west_3},
+  {"cm_stream_switch_slave_dma_0_slot0", aie1::cm_stream_switch_slave_dma_0_slot0},
+  {"cm_stream_switch_slave_dma_0_slot1", aie1::cm_stream_switch_slave_dma_0_slot1},
+  {"cm_stream_switch_slave_dma_0_slot2", aie1::cm_stream_switch_slave_dma_0_slot2},
+  {"cm_stream_switch_slave_dma_0_slot3", aie1::cm_stream_switch_slave_dma_0_slot3},
+  {"cm_stream_switch_slave_dma_1_slot0", aie1::cm_stream_switch_slave_dma_1_slot0},
+  {"cm_stream_switch_slave_dma_1_slot1", aie1::cm_stream_switch_slave_dma_1_slot1},
+  {"cm_stream_switch_slave_dma_1_slot2", aie1::cm_stream_switch_slave_dma_1_slot2},
+  {"cm_stream_switch_slave_dma_1_slot3", aie1::cm_stream_switch_slave_dma_1_slot3},
+  {"cm_stream_switch_slave_east_0_slot0", aie1::cm_stream_switch_slave_east_0_slot0},
+  {"cm_stream_switch_slave_east_0_slot1", aie1::cm_stream_switch_slave_east_0_slot1},
+  {"cm_stream_switch_slave_east_0_slot2", aie1::cm_stream_switch_slave_east_0_slot2},
+  {"cm_stream_switch_slave_east_0_slot3", aie1::cm_stream_switch_slave_east_0_slot3},
+  {"cm_stream_switch_slave_east_1_slot0", aie1::cm_stream_switch_slave_east_1_slot0},
+  {"cm_stream_switch_slave_east_1_slot1", aie1::cm_stream_switch_slave_east_1_slot1},
+  {"cm_stream_switch_slave_east_1_slot2", aie1::cm_stream_switch_slave_east_1_slot2},
+  {"cm_stream_switch_slave_east_1_slot3", aie1::cm_stream_switch_slave_east_1_slot3},
+  {"cm_stream_switch_slave_east_2_slot0", aie1::cm_stream_switch_slave_east_2_slot0},
+  {"cm_stream_switch_slave_east_2_slot1", aie1::cm_stream_switch_slave_east_2_slot1},
+  {"cm_stream_switch_slave_east_2_slot2", aie1::cm_stream_switch_slave_east_2_slot2},
+  {"cm_stream_switch_slave_east_2_slot3", aie1::cm_stream_switch_slave_east_2_slot3},
+  {"cm_stream_switch_slave_east_3_slot0", aie1::cm_stream_switch_slave_east_3_slot0},
+  {"cm_stream_switch_slave_east_3_slot1", aie1::cm_stream_switch_slave_east_3_slot1},
+  {"cm_stream_switch_slave_east_3_slot2", aie1::cm_stream_switch_slave_east_3_slot2},
+  {"cm_stream_switch_slave_east_3_slot3", aie1::cm_stream_switch_slave_east_3_slot3},
+  {"cm_stream_switch_slave_fifo_0_slot0", aie1::cm_stream_switch_slave_fifo_0_slot0},
+  {"cm_stream_switch_slave_fifo_0_slot1", aie1::cm_stream_switch_slave_fifo_0_slot1},
+  {"cm_stream_switch_slave_fifo_0_slot2", aie1::cm_stream_switch_slave_fifo_0_slot2},
+  {"cm_stream_switch_slave_fifo_0_slot3", aie1::cm_stream_switch_slave_fifo_0_slot3},
+  {"cm_stream_switch_slave_fifo_1_slot0", aie1::cm_stream_switch_slave_fifo_1_slot0},
+  {"cm_stream_switch_slave_fifo_1_slot1", aie1::cm_stream_switch_slave_fifo_1_slot1},
+  {"cm_stream_switch_slave_fifo_1_slot2", aie1::cm_stream_switch_slave_fifo_1_slot2},
+  {"cm_stream_switch_slave_fifo_1_slot3", aie1::cm_stream_switch_slave_fifo_1_slot3},
+  {"cm_stream_switch_slave_mem_trace_slot0", aie1::cm_stream_switch_slave_mem_trace_slot0},
+  {"cm_stream_switch_slave_mem_trace_slot1", aie1::cm_stream_switch_slave_mem_trace_slot1},
+  {"cm_stream_switch_slave_mem_trace_slot2", aie1::cm_stream_switch_slave_mem_trace_slot2},
+  {"cm_stream_switch_slave_mem_trace_slot3", aie1::cm_stream_switch_slave_mem_trace_slot3},
+  {"cm_stream_switch_slave_north_0_slot0", aie1::cm_stream_switch_slave_north_0_slot0},
+  {"cm_stream_switch_slave_north_0_slot1", aie1::cm_stream_switch_slave_north_0_slot1},
+  {"cm_stream_switch_slave_north_0_slot2", aie1::cm_stream_switch_slave_north_0_slot2},
+  {"cm_stream_switch_slave_north_0_slot3", aie1::cm_stream_switch_slave_north_0_slot3},
+  {"cm_stream_switch_slave_north_1_slot0", aie1::cm_stream_switch_slave_north_1_slot0},
+  {"cm_stream_switch_slave_north_1_slot1", aie1::cm_stream_switch_slave_north_1_slot1},
+  {"cm_stream_switch_slave_north_1_slot2", aie1::cm_stream_switch_slave_north_1_slot2},
+  {"cm_stream_switch_slave_north_1_slot3", aie1::cm_stream_switch_slave_north_1_slot3},
+  {"cm_stream_switch_slave_north_2_slot0", aie1::cm_stream_switch_slave_north_2_slot0},
+  {"cm_stream_switch_slave_north_2_slot1", aie1::cm_stream_switch_slave_north_2_slot1},
+  {"cm_stream_switch_slave_north_2_slot2", aie1::cm_stream_switch_slave_north_2_slot2},
+  {"cm_stream_switch_slave_north_2_slot3", aie1::cm_stream_switch_slave_north_2_slot3},
+  {"cm_stream_switch_slave_north_3_slot0", aie1::cm_stream_switch_slave_north_3_slot0},
+  {"cm_stream_switch_slave_north_3_slot1", aie1::cm_stream_switch_slave_north_3_slot1},
+  {"cm_stream_switch_slave_north_3_slot2", aie1::cm_stream_switch_slave_north_3_slot2},
+  {"cm_stream_switch_slave_north_3_slot3", aie1::cm_stream_switch_slave_north_3_slot3},
+  {"cm_stream_switch_slave_south_0_slot0", aie1::cm_stream_switch_slave_south_0_slot0},
+  {"cm_stream_switch_slave_south_0_slot1", aie1::cm_stream_switch_slave_south_0_slot1},
+  {"cm_stream_switch_slave_south_0_slot2", aie1::cm_stream_switch_slave_south_0_slot2},
+  {"cm_stream_switch_slave_south_0_slot3", aie1::cm_stream_switch_slave_south_0_slot3},
+  {"cm_stream_switch_slave_south_1_slot0", aie1::cm_stream_switch_slave_south_1_slot0},
+  {"cm_stream_switch_slave_south_1_slot1", aie1::cm_stream_switch_slave_south_1_slot1},
+  {"cm_stream_switch_slave_south_1_slot2", aie1::cm_stream_switch_slave_south_1_slot2},
+  {"cm_stream_switch_slave_south_1_slot3", aie1::cm_stream_switch_slave_south_1_slot3},
+  {"cm_stream_switch_slave_south_2_slot0", aie1::cm_stream_switch_slave_south_2_slot0},
+  {"cm_stream_switch_slave_south_2_slot1", aie1::cm_stream_switch_slave_south_2_slot1},
+  {"cm_stream_switch_slave_south_2_slot2", aie1::cm_stream_switch_slave_south_2_slot2},
+  {"cm_stream_switch_slave_south_2_slot3", aie1::cm_stream_switch_slave_south_2_slot3},
+  {"cm_stream_switch_slave_south_3_slot0", aie1::cm_stream_switch_slave_south_3_slot0},
+  {"cm_stream_switch_slave_south_3_slot1", aie1::cm_stream_switch_slave_south_3_slot1},
+  {"cm_stream_switch_slave_south_3_slot2", aie1::cm_stream_switch_slave_south_3_slot2},
+  {"cm_stream_switch_slave_south_3_slot3", aie1::cm_stream_switch_slave_south_3_slot3},
+  {"cm_stream_switch_slave_south_4_slot0", aie1::cm_stream_switch_slave_south_4_slot0},
+  {"cm_stream_switch_slave_south_4_slot1", aie1::cm_stream_switch_slave_south_4_slot1},
+  {"cm_stream_switch_slave_south_4_slot2", aie1::cm_stream_switch_slave_south_4_slot2},
+  {"cm_stream_switch_slave_south_4_slot3", aie1::cm_stream_switch_slave_south_4_slot3},
+  {"cm_stream_switch_slave_south_5_slot0", aie1::cm_stream_switch_slave_south_5_slot0},
+  {"cm_stream_switch_slave_south_5_slot1", aie1::cm_stream_switch_slave_south_5_slot1},
+  {"cm_stream_switch_slave_south_5_slot2", aie1::cm_stream_switch_slave_south_5_slot2},
+  {"cm_stream_switch_slave_south_5_slot3", aie1::cm_stream_switch_slave_south_5_slot3},
+  {"cm_stream_switch_slave_tile_ctrl_slot0", aie1::cm_stream_switch_slave_tile_ctrl_slot0},
+  {"cm_stream_switch_slave_tile_ctrl_slot1", aie1::cm_stream_switch_slave_tile_ctrl_slot1},
+  {"cm_stream_switch_slave_tile_ctrl_slot2", aie1::cm_stream_switch_slave_tile_ctrl_slot2},
+  {"cm_stream_switch_slave_tile_ctrl_slot3", aie1::cm_stream_switch_slave_tile_ctrl_slot3},
+  {"cm_stream_switch_slave_west_0_slot0", aie1::cm_stream_switch_slave_west_0_slot0},
+  {"cm_stream_switch_slave_west_0_slot1", aie1::cm_stream_switch_slave_west_0_slot1},
+  {"cm_stream_switch_slave_west_0_slot2", aie1::cm_stream_switch_slave_west_0_slot2},
+  {"cm_stream_switch_slave_west_0_slot3", aie1::cm_stream_switch_slave_west_0_slot3},
+  {"cm_stream_switch_slave_west_1_slot0", aie1::cm_stream_switch_slave_west_1_slot0},
+  {"cm_stream_switch_slave_west_1_slot1", aie1::cm_stream_switch_slave_west_1_slot1},
+  {"cm_stream_switch_slave_west_1_slot2", aie1::cm_stream_switch_slave_west_1_slot2},
+  {"cm_stream_switch_slave_west_1_slot3", aie1::cm_stream_switch_slave_west_1_slot3},
+  {"cm_stream_switch_slave_west_2_slot0", aie1::cm_stream_switch_slave_west_2_slot0},
+  {"cm_stream_switch_slave_west_2_slot1", aie1::cm_stream_switch_slave_west_2_slot1},
+  {"cm_stream_switch_slave_west_2_slot2", aie1::cm_stream_switch_slave_west_2_slot2},
+  {"cm_stream_switch_slave_west_2_slot3", aie1::cm_stream_switch_slave_west_2_slot3},
+  {"cm_stream_switch_slave_west_3_slot0", aie1::cm_stream_switch_slave_west_3_slot0},
+  {"cm_stream_switch_slave_west_3_slot1", aie1::cm_stream_switch_slave_west_3_slot1},
+  {"cm_stream_switch_slave_west_3_slot2", aie1::cm_stream_switch_slave_west_3_slot2},
+  {"cm_stream_switch_slave_west_3_slot3", aie1::cm_stream_switch_slave_west_3_slot3},
+  {"cm_tile_clock_control", aie1::cm_tile_clock_control},
+  {"cm_tile_control", aie1::cm_tile_control},
+  {"cm_tile_control_packet_handler_status", aie1::cm_tile_control_packet_handler_status},
+  {"cm_timer_control", aie1::cm_timer_control},
+  {"cm_timer_high", aie1::cm_timer_high},
+  {"cm_timer_low", aie1::cm_timer_low},
+  {"cm_timer_trig_event_high_value", aie1::cm_timer_trig_event_high_value},
+  {"cm_timer_trig_event_low_value", aie1::cm_timer_trig_event_low_value},
+  {"cm_trace_control0", aie1::cm_trace_control0},
+  {"cm_trace_control1", aie1::cm_trace_control1},
+  {"cm_trace_event0", aie1::cm_trace_event0},
+  {"cm_trace_event1", aie1::cm_trace_event1},
+  {"cm_trace_status", aie1::cm_trace_status},
+  {"mem_performance_counter0", aie1::mem_performance_counter0},
+  {"mm_all_lock_state_value", aie1::mm_all_lock_state_value},
+  {"mm_checkbit_error_generation", aie1::mm_checkbit_error_generation},
+  {"mm_combo_event_control", aie1::mm_combo_event_control},
+  {"mm_combo_event_inputs", aie1::mm_combo_event_inputs},
+  {"mm_dma_bd0_2d_x", aie1::mm_dma_bd0_2d_x},
+  {"mm_dma_bd0_2d_y", aie1::mm_dma_bd0_2d_y},
+  {"mm_dma_bd0_addr_a", aie1::mm_dma_bd0_addr_a},
+  {"mm_dma_bd0_addr_b", aie1::mm_dma_bd0_addr_b},
+  {"mm_dma_bd0_control", aie1::mm_dma_bd0_control},
+  {"mm_dma_bd0_interleaved_state", aie1::mm_dma_bd0_interleaved_state},
+  {"mm_dma_bd0_packet", aie1::mm_dma_bd0_packet},
+  {"mm_dma_bd10_2d_x", aie1::mm_dma_bd10_2d_x},
+  {"mm_dma_bd10_2d_y", aie1::mm_dma_bd10_2d_y},
+  {"mm_dma_bd10_addr_a", aie1::mm_dma_bd10_addr_a},
+  {"mm_dma_bd10_addr_b", aie1::mm_dma_bd10_addr_b},
+  {"mm_dma_bd10_control", aie1::mm_dma_bd10_control},
+  {"mm_dma_bd10_interleaved_state", aie1::mm_dma_bd10_interleaved_state},
+  {"mm_dma_bd10_packet", aie1::mm_dma_bd10_packet},
+  {"mm_dma_bd11_2d_x", aie1::mm_dma_bd11_2d_x},
+  {"mm_dma_bd11_2d_y", aie1::mm_dma_bd11_2d_y},
+  {"mm_dma_bd11_addr_a", aie1::mm_dma_bd11_addr_a},
+  {"mm_dma_bd11_addr_b", aie1::mm_dma_bd11_addr_b},
+  {"mm_dma_bd11_control", aie1::mm_dma_bd11_control},
+  {"mm_dma_bd11_interleaved_state", aie1::mm_dma_bd11_interleaved_state},
+  {"mm_dma_bd11_packet", aie1::mm_dma_bd11_packet},
+  {"mm_dma_bd12_2d_x", aie1::mm_dma_bd12_2d_x},
+  {"mm_dma_bd12_2d_y", aie1::mm_dma_bd12_2d_y},
+  {"mm_dma_bd12_addr_a", aie1::mm_dma_bd12_addr_a},
+  {"mm_dma_bd12_addr_b", aie1::mm_dma_bd12_addr_b},
+  {"mm_dma_bd12_control", aie1::mm_dma_bd12_control},
+  {"mm_dma_bd12_interleaved_state", aie1::mm_dma_bd12_interleaved_state},
+  {"mm_dma_bd12_packet", aie1::mm_dma_bd12_packet},
+  {"mm_dma_bd13_2d_x", aie1::mm_dma_bd13_2d_x},
+  {"mm_dma_bd13_2d_y", aie1::mm_dma_bd13_2d_y},
+  {"mm_dma_bd13_addr_a", aie1::mm_dma_bd13_addr_a},
+  {"mm_dma_bd13_addr_b", aie1::mm_dma_bd13_addr_b},
+  {"mm_dma_bd13_control", aie1::mm_dma_bd13_control},
+  {"mm_dma_bd13_interleaved_state", aie1::mm_dma_bd13_interleaved_state},
+  {"mm_dma_bd13_packet", aie1::mm_dma_bd13_packet},
+  {"mm_dma_bd14_2d_x", aie1::mm_dma_bd14_2d_x},
+  {"mm_dma_bd14_2d_y", aie1::mm_dma_bd14_2d_y},
+  {"mm_dma_bd14_addr_a", aie1::mm_dma_bd14_addr_a},
+  {"mm_dma_bd14_addr_b", aie1::mm_dma_bd14_addr_b},
+  {"mm_dma_bd14_control", aie1::mm_dma_bd14_control},
+  {"mm_dma_bd14_interleaved_state", aie1::mm_dma_bd14_interleaved_state},
+  {"mm_dma_bd14_packet", aie1::mm_dma_bd14_packet},
+  {"mm_dma_bd15_2d_x", aie1::mm_dma_bd15_2d_x},
+  {"mm_dma_bd15_2d_y", aie1::mm_dma_bd15_2d_y},
+  {"mm_dma_bd15_addr_a", aie1::mm_dma_bd15_addr_a},
+  {"mm_dma_bd15_addr_b", aie1::mm_dma_bd15_addr_b},
+  {"mm_dma_bd15_control", aie1::mm_dma_bd15_control},
+  {"mm_dma_bd15_interleaved_state", aie1::mm_dma_bd15_interleaved_state},
+  {"mm_dma_bd15_packet", aie1::mm_dma_bd15_packet},
+  {"mm_dma_bd1_2d_x", aie1::mm_dma_bd1_2d_x},
+  {"mm_dma_bd1_2d_y", aie1::mm_dma_bd1_2d_y},
+  {"mm_dma_bd1_addr_a", aie1::mm_dma_bd1_addr_a},
+  {"mm_dma_bd1_addr_b", aie1::mm_dma_bd1_addr_b},
+  {"mm_dma_bd1_control", aie1::mm_dma_bd1_control},
+  {"mm_dma_bd1_interleaved_state", aie1::mm_dma_bd1_interleaved_state},
+  {"mm_dma_bd1_packet", aie1::mm_dma_bd1_packet},
+  {"mm_dma_bd2_2d_x", aie1::mm_dma_bd2_2d_x},
+  {"mm_dma_bd2_2d_y", aie1::mm_dma_bd2_2d_y},
+  {"mm_dma_bd2_addr_a", aie1::mm_dma_bd2_addr_a},
+  {"mm_dma_bd2_addr_b", aie1::mm_dma_bd2_addr_b},
+  {"mm_dma_bd2_control", aie1::mm_dma_bd2_control},
+  {"mm_dma_bd2_interleaved_state", aie1::mm_dma_bd2_interleaved_state},
+  {"mm_dma_bd2_packet", aie1::mm_dma_bd2_packet},
+  {"mm_dma_bd3_2d_x", aie1::mm_dma_bd3_2d_x},
+  {"mm_dma_bd3_2d_y", aie1::mm_dma_bd3_2d_y},
+  {"mm_dma_bd3_addr_a", aie1::mm_dma_bd3_addr_a},
+  {"mm_dma_bd3_addr_b", aie1::mm_dma_bd3_addr_b},
+  {"mm_dma_bd3_control", aie1::mm_dma_bd3_control},
+  {"mm_dma_bd3_interleaved_state", aie1::mm_dma_bd3_interleaved_state},
+  {"mm_dma_bd3_packet", aie1::mm_dma_bd3_packet},
+  {"mm_dma_bd4_2d_x", aie1::mm_dma_bd4_2d_x},
+  {"mm_dma_bd4_2d_y", aie1::mm_dma_bd4_2d_y},
+  {"mm_dma_bd4_addr_a", aie1::mm_dma_bd4_addr_a},
+  {"mm_dma_bd4_addr_b", aie1::mm_dma_bd4_addr_b},
+  {"mm_dma_bd4_control", aie1::mm_dma_bd4_control},
+  {"mm_dma_bd4_interleaved_state", aie1::mm_dma_bd4_interleaved_state},
+  {"mm_dma_bd4_packet", aie1::mm_dma_bd4_packet},
+  {"mm_dma_bd5_2d_x", aie1::mm_dma_bd5_2d_x},
+  {"mm_dma_bd5_2d_y", aie1::mm_dma_bd5_2d_y},
+  {"mm_dma_bd5_addr_a", aie1::mm_dma_bd5_addr_a},
+  {"mm_dma_bd5_addr_b", aie1::mm_dma_bd5_addr_b},
+  {"mm_dma_bd5_control", aie1::mm_dma_bd5_control},
+  {"mm_dma_bd5_interleaved_state", aie1::mm_dma_bd5_interleaved_state},
+  {"mm_dma_bd5_packet", aie1::mm_dma_bd5_packet},
+  {"mm_dma_bd6_2d_x", aie1::mm_dma_bd6_2d_x},
+  {"mm_dma_bd6_2d_y", aie1::mm_dma_bd6_2d_y},
+  {"mm_dma_bd6_addr_a", aie1::mm_dma_bd6_addr_a},
+  {"mm_dma_bd6_addr_b", aie1::mm_dma_bd6_addr_b},
+  {"mm_dma_bd6_control", aie1::mm_dma_bd6_control},
+  {"mm_dma_bd6_interleaved_state", aie1::mm_dma_bd6_interleaved_state},
+  {"mm_dma_bd6_packet", aie1::mm_dma_bd6_packet},
+  {"mm_dma_bd7_2d_x", aie1::mm_dma_bd7_2d_x},
+  {"mm_dma_bd7_2d_y", aie1::mm_dma_bd7_2d_y},
+  {"mm_dma_bd7_addr_a", aie1::mm_dma_bd7_addr_a},
+  {"mm_dma_bd7_addr_b", aie1::mm_dma_bd7_addr_b},
+  {"mm_dma_bd7_control", aie1::mm_dma_bd7_control},
+  {"mm_dma_bd7_interleaved_state", aie1::mm_dma_bd7_interleaved_state},
+  {"mm_dma_bd7_packet", aie1::mm_dma_bd7_packet},
+  {"mm_dma_bd8_2d_x", aie1::mm_dma_bd8_2d_x},
+  {"mm_dma_bd8_2d_y", aie1::mm_dma_bd8_2d_y},
+  {"mm_dma_bd8_addr_a", aie1::mm_dma_bd8_addr_a},
+  {"mm_dma_bd8_addr_b", aie1::mm_dma_bd8_addr_b},
+  {"mm_dma_bd8_control", aie1::mm_dma_bd8_control},
+  {"mm_dma_bd8_interleaved_state", aie1::mm_dma_bd8_interleaved_state},
+  {"mm_dma_bd8_packet", aie1::mm_dma_bd8_packet},
+  {"mm_dma_bd9_2d_x", aie1::mm_dma_bd9_2d_x},
+  {"mm_dma_bd9_2d_y", aie1::mm_dma_bd9_2d_y},
+  {"mm_dma_bd9_addr_a", aie1::mm_dma_bd9_addr_a},
+  {"mm_dma_bd9_addr_b", aie1::mm_dma_bd9_addr_b},
+  {"mm_dma_bd9_control", aie1::mm_dma_bd9_control},
+  {"mm_dma_bd9_interleaved_state", aie1::mm_dma_bd9_interleaved_state},
+  {"mm_dma_bd9_packet", aie1::mm_dma_bd9_packet},
+  {"mm_dma_fifo_counter", aie1::mm_dma_fifo_counter},
+  {"mm_dma_mm2s_0_ctrl", aie1::mm_dma_mm2s_0_ctrl},
+  {"mm_dma_mm2s_0_start_queue", aie1::mm_dma_mm2s_0_start_queue},
+  {"mm_dma_mm2s_1_ctrl", aie1::mm_dma_mm2s_1_ctrl},
+  {"mm_dma_mm2s_1_start_queue", aie1::mm_dma_mm2s_1_start_queue},
+  {"mm_dma_mm2s_status", aie1::mm_dma_mm2s_status},
+  {"mm_dma_s2mm_0_ctrl", aie1::mm_dma_s2mm_0_ctrl},
+  {"mm_dma_s2mm_0_start_queue", aie1::mm_dma_s2mm_0_start_queue},
+  {"mm_dma_s2mm_1_ctrl", aie1::mm_dma_s2mm_1_ctrl},
+  {"mm_dma_s2mm_1_start_queue", aie1::mm_dma_s2mm_1_start_queue},
+  {"mm_dma_s2mm_status", aie1::mm_dma_s2mm_status},
+  {"mm_ecc_failing_address", aie1::mm_ecc_failing_address},
+  {"mm_ecc_scrubbing_event", aie1::mm_ecc_scrubbing_event},
+  {"mm_event_broadcast0", aie1::mm_event_broadcast0},
+  {"mm_event_broadcast1", aie1::mm_event_broadcast1},
+  {"mm_event_broadcast10", aie1::mm_event_broadcast10},
+  {"mm_event_broadcast11", aie1::mm_event_broadcast11},
+  {"mm_event_broadcast12", aie1::mm_event_broadcast12},
+  {"mm_event_broadcast13", aie1::mm_event_broadcast13},
+  {"mm_event_broadcast14", aie1::mm_event_broadcast14},
+  {"mm_event_broadcast15", aie1::mm_event_broadcast15},
+  {"mm_event_broadcast2", aie1::mm_event_broadcast2},
+  {"mm_event_broadcast3", aie1::mm_event_broadcast3},
+  {"mm_event_broadcast4", aie1::mm_event_broadcast4},
+  {"mm_event_broadcast5", aie1::mm_event_broadcast5},
+  {"mm_event_broadcast6", aie1::mm_event_broadcast6},
+  {"mm_event_broadcast7", aie1::mm_event_broadcast7},
+  {"mm_event_broadcast8", aie1::mm_event_broadcast8},
+  {"mm_event_broadcast9", aie1::mm_event_broadcast9},
+  {"mm_event_broadcast_block_east_clr", aie1::mm_event_broadcast_block_east_clr},
+  {"mm_event_broadcast_block_east_set", aie1::mm_event_broadcast_block_east_set},
+  {"mm_event_broadcast_block_east_value", aie1::mm_event_broadcast_block_east_value},
+  {"mm_event_broadcast_block_north_clr", aie1::mm_event_broadcast_block_north_clr},
+  {"mm_event_broadcast_block_north_set", aie1::mm_event_broadcast_block_north_set},
+  {"mm_event_broadcast_block_north_value", aie1::mm_event_broadcast_block_north_value},
+  {"mm_event_broadcast_block_south_clr", aie1::mm_event_broadcast_block_south_clr},
+  {"mm_event_broadcast_block_south_set", aie1::mm_event_broadcast_block_south_set},
+  {"mm_event_broadcast_block_south_value", aie1::mm_event_broadcast_block_south_value},
+  {"mm_event_broadcast_block_west_clr", aie1::mm_event_broadcast_block_west_clr},
+  {"mm_event_broadcast_block_west_set", aie1::mm_event_broadcast_block_west_set},
+  {"mm_event_broadcast_block_west_value", aie1::mm_event_broadcast_block_west_value},
+  {"mm_event_generate", aie1::mm_event_generate},
+  {"mm_event_group_0_enable", aie1::mm_event_group_0_enable},
+  {"mm_event_group_broadcast_enable", aie1::mm_event_group_broadcast_enable},
+  {"mm_event_group_dma_enable", aie1::mm_event_group_dma_enable},
+  {"mm_event_group_error_enable", aie1::mm_event_group_error_enable},
+  {"mm_event_group_lock_enable", aie1::mm_event_group_lock_enable},
+  {"mm_event_group_memory_conflict_enable", aie1::mm_event_group_memory_conflict_enable},
+  {"mm_event_group_user_event_enable", aie1::mm_event_group_user_event_enable},
+  {"mm_event_group_watchpoint_enable", aie1::mm_event_group_watchpoint_enable},
+  {"mm_event_status0", aie1::mm_event_status0},
+  {"mm_event_status1", aie1::mm_event_status1},
+  {"mm_event_status2", aie1::mm_event_status2},
+  {"mm_event_status3", aie1::mm_event_status3},
+  {"mm_lock0_acquire_nv", aie1::mm_lock0_acquire_nv},
+  {"mm_lock0_acquire_v0", aie1::mm_lock0_acquire_v0},
+  {"mm_lock0_acquire_v1", aie1::mm_lock0_acquire_v1},
+  {"mm_lock0_release_nv", aie1::mm_lock0_release_nv},
+  {"mm_lock0_release_v0", aie1::mm_lock0_release_v0},
+  {"mm_lock0_release_v1", aie1::mm_lock0_release_v1},
+  {"mm_lock10_acquire_nv", aie1::mm_lock10_acquire_nv},
+  {"mm_lock10_acquire_v0", aie1::mm_lock10_acquire_v0},
+  {"mm_lock10_acquire_v1", aie1::mm_lock10_acquire_v1},
+  {"mm_lock10_release_nv", aie1::mm_lock10_release_nv},
+  {"mm_lock10_release_v0", aie1::mm_lock10_release_v0},
+  {"mm_lock10_release_v1", aie1::mm_lock10_release_v1},
+  {"mm_lock11_acquire_nv", aie1::mm_lock11_acquire_nv},
+  {"mm_lock11_acquire_v0", aie1::mm_lock11_acquire_v0},
+  {"mm_lock11_acquire_v1", aie1::mm_lock11_acquire_v1},
+  {"mm_lock11_release_nv", aie1::mm_lock11_release_nv},
+  {"mm_lock11_release_v0", aie1::mm_lock11_release_v0},
+  {"mm_lock11_release_v1", aie1::mm_lock11_release_v1},
+  {"mm_lock12_acquire_nv", aie1::mm_lock12_acquire_nv},
+  {"mm_lock12_acquire_v0", aie1::mm_lock12_acquire_v0},
+  {"mm_lock12_acquire_v1", aie1::mm_lock12_acquire_v1},
+  {"mm_lock12_release_nv", aie1::mm_lock12_release_nv},
+  {"mm_lock12_release_v0", aie1::mm_lock12_release_v0},
+  {"mm_lock12_release_v1", aie1::mm_lock12_release_v1},
+  {"mm_lock13_acquire_nv", aie1::mm_lock13_acquire_nv},
+  {"mm_lock13_acquire_v0", aie1::mm_lock13_acquire_v0},
+  {"mm_lock13_acquire_v1", aie1::mm_lock13_acquire_v1},
+  {"mm_lock13_release_nv", aie1::mm_lock13_release_nv},
+  {"mm_lock13_release_v0", aie1::mm_lock13_release_v0},
+  {"mm_lock13_release_v1", aie1::mm_lock13_release_v1},
+  {"mm_lock14_acquire_nv", aie1::mm_lock14_acquire_nv},
+  {"mm_lock14_acquire_v0", aie1::mm_lock14_acquire_v0},
+  {"mm_lock14_acquire_v1", aie1::mm_lock14_acquire_v1},
+  {"mm_lock14_release_nv", aie1::mm_lock14_release_nv},
+  {"mm_lock14_release_v0", aie1::mm_lock14_release_v0},
+  {"mm_lock14_release_v1", aie1::mm_lock14_release_v1},
+  {"mm_lock15_acquire_nv", aie1::mm_lock15_acquire_nv},
+  {"mm_lock15_acquire_v0", aie1::mm_lock15_acquire_v0},
+  {"mm_lock15_acquire_v1", aie1::mm_lock15_acquire_v1},
+  {"mm_lock15_release_nv", aie1::mm_lock15_release_nv},
+  {"mm_lock15_release_v0", aie1::mm_lock15_release_v0},
+  {"mm_lock15_release_v1", aie1::mm_lock15_release_v1},
+  {"mm_lock1_acquire_nv", aie1::mm_lock1_acquire_nv},
+  {"mm_lock1_acquire_v0", aie1::mm_lock1_acquire_v0},
+  {"mm_lock1_acquire_v1", aie1::mm_lock1_acquire_v1},
+  {"mm_lock1_release_nv", aie1::mm_lock1_release_nv},
+  {"mm_lock1_release_v0", aie1::mm_lock1_release_v0},
+  {"mm_lock1_release_v1", aie1::mm_lock1_release_v1},
+  {"mm_lock2_acquire_nv", aie1::mm_lock2_acquire_nv},
+  {"mm_lock2_acquire_v0", aie1::mm_lock2_acquire_v0},
+  {"mm_lock2_acquire_v1", aie1::mm_lock2_acquire_v1},
+  {"mm_lock2_release_nv", aie1::mm_lock2_release_nv},
+  {"mm_lock2_release_v0", aie1::mm_lock2_release_v0},
+  {"mm_lock2_release_v1", aie1::mm_lock2_release_v1},
+  {"mm_lock3_acquire_nv", aie1::mm_lock3_acquire_nv},
+  {"mm_lock3_acquire_v0", aie1::mm_lock3_acquire_v0},
+  {"mm_lock3_acquire_v1", aie1::mm_lock3_acquire_v1},
+  {"mm_lock3_release_nv", aie1::mm_lock3_release_nv},
+  {"mm_lock3_release_v0", aie1::mm_lock3_release_v0},
+  {"mm_lock3_release_v1", aie1::mm_lock3_release_v1},
+  {"mm_lock4_acquire_nv", aie1::mm_lock4_acquire_nv},
+  {"mm_lock4_acquire_v0", aie1::mm_lock4_acquire_v0},
+  {"mm_lock4_acquire_v1", aie1::mm_lock4_acquire_v1},
+  {"mm_lock4_release_nv", aie1::mm_lock4_release_nv},
+  {"mm_lock4_release_v0", aie1::mm_lock4_release_v0},
+  {"mm_lock4_release_v1", aie1::mm_lock4_release_v1},
+  {"mm_lock5_acquire_nv", aie1::mm_lock5_acquire_nv},
+  {"mm_lock5_acquire_v0", aie1::mm_lock5_acquire_v0},
+  {"mm_lock5_acquire_v1", aie1::mm_lock5_acquire_v1},
+  {"mm_lock5_release_nv", aie1::mm_lock5_release_nv},
+  {"mm_lock5_release_v0", aie1::mm_lock5_release_v0},
+  {"mm_lock5_release_v1", aie1::mm_lock5_release_v1},
+  {"mm_lock6_acquire_nv", aie1::mm_lock6_acquire_nv},
+  {"mm_lock6_acquire_v0", aie1::mm_lock6_acquire_v0},
+  {"mm_lock6_acquire_v1", aie1::mm_lock6_acquire_v1},
+  {"mm_lock6_release_nv", aie1::mm_lock6_release_nv},
+  {"mm_lock6_release_v0", aie1::mm_lock6_release_v0},
+  {"mm_lock6_release_v1", aie1::mm_lock6_release_v1},
+  {"mm_lock7_acquire_nv", aie1::mm_lock7_acquire_nv},
+  {"mm_lock7_acquire_v0", aie1::mm_lock7_acquire_v0},
+  {"mm_lock7_acquire_v1", aie1::mm_lock7_acquire_v1},
+  {"mm_lock7_release_nv", aie1::mm_lock7_release_nv},
+  {"mm_lock7_release_v0", aie1::mm_lock7_release_v0},
+  {"mm_lock7_release_v1", aie1::mm_lock7_release_v1},
+  {"mm_lock8_acquire_nv", aie1::mm_lock8_acquire_nv},
+  {"mm_lock8_acquire_v0", aie1::mm_lock8_acquire_v0},
+  {"mm_lock8_acquire_v1", aie1::mm_lock8_acquire_v1},
+  {"mm_lock8_release_nv", aie1::mm_lock8_release_nv},
+  {"mm_lock8_release_v0", aie1::mm_lock8_release_v0},
+  {"mm_lock8_release_v1", aie1::mm_lock8_release_v1},
+  {"mm_lock9_acquire_nv", aie1::mm_lock9_acquire_nv},
+  {"mm_lock9_acquire_v0", aie1::mm_lock9_acquire_v0},
+  {"mm_lock9_acquire_v1", aie1::mm_lock9_acquire_v1},
+  {"mm_lock9_release_nv", aie1::mm_lock9_release_nv},
+  {"mm_lock9_release_v0", aie1::mm_lock9_release_v0},
+  {"mm_lock9_release_v1", aie1::mm_lock9_release_v1},
+  {"mm_lock_event_value_control_0", aie1::mm_lock_event_value_control_0},
+  {"mm_lock_event_value_control_1", aie1::mm_lock_event_value_control_1},
+  {"mm_parity_failing_address", aie1::mm_parity_failing_address},
+  {"mm_performance_control0", aie1::mm_performance_control0},
+  {"mm_performance_control1", aie1::mm_performance_control1},
+  {"mm_performance_counter0", aie1::mm_performance_counter0},
+  {"mm_performance_counter0_event_value", aie1::mm_performance_counter0_event_value},
+  {"mm_performance_counter1", aie1::mm_performance_counter1},
+  {"mm_performance_counter1_event_value", aie1::mm_performance_counter1_event_value},
+  {"mm_reserved0", aie1::mm_reserved0},
+  {"mm_reserved1", aie1::mm_reserved1},
+  {"mm_reserved2", aie1::mm_reserved2},
+  {"mm_reserved3", aie1::mm_reserved3},
+  {"mm_reset_control", aie1::mm_reset_control},
+  {"mm_spare_reg", aie1::mm_spare_reg},
+  {"mm_timer_control", aie1::mm_timer_control},
+  {"mm_timer_high", aie1::mm_timer_high},
+  {"mm_timer_low", aie1::mm_timer_low},
+  {"mm_timer_trig_event_high_value", aie1::mm_timer_trig_event_high_value},
+  {"mm_timer_trig_event_low_value", aie1::mm_timer_trig_event_low_value},
+  {"mm_trace_control0", aie1::mm_trace_control0},
+  {"mm_trace_control1", aie1::mm_trace_control1},
+  {"mm_trace_event0", aie1::mm_trace_event0},
+  {"mm_trace_event1", aie1::mm_trace_event1},
+  {"mm_trace_status", aie1::mm_trace_status},
+  {"mm_watchpoint0", aie1::mm_watchpoint0},
+  {"mm_watchpoint1", aie1::mm_watchpoint1},
+  {"shim_all_lock_state_value", aie1::shim_all_lock_state_value},
+  {"shim_dma_bd0_addr_low", aie1::shim_dma_bd0_addr_low},
+  {"shim_dma_bd0_axi_config", aie1::shim_dma_bd0_axi_config},
+  {"shim_dma_bd0_buffer_length", aie1::shim_dma_bd0_buffer_length},
+  {"shim_dma_bd0_control", aie1::shim_dma_bd0_control},
+  {"shim_dma_bd0_packet", aie1::shim_dma_bd0_packet},
+  {"shim_dma_bd_step_size", aie1::shim_dma_bd_step_size},
+  {"shim_dma_s2mm_0_ctrl", aie1::shim_dma_s2mm_0_ctrl},
+  {"shim_dma_s2mm_0_start_queue", aie1::shim_dma_s2mm_0_start_queue},
+  {"shim_dma_s2mm_step_size", aie1::shim_dma_s2mm_step_size},
+  {"shim_event_broadcast_a_0", aie1::shim_event_broadcast_a_0},
+  {"shim_event_broadcast_a_1", aie1::shim_event_broadcast_a_1},
+  {"shim_event_broadcast_a_10", aie1::shim_event_broadcast_a_10},
+  {"shim_event_broadcast_a_11", aie1::shim_event_broadcast_a_11},
+  {"shim_event_broadcast_a_12", aie1::shim_event_broadcast_a_12},
+  {"shim_event_broadcast_a_13", aie1::shim_event_broadcast_a_13},
+  {"shim_event_broadcast_a_14", aie1::shim_event_broadcast_a_14},
+  {"shim_event_broadcast_a_15", aie1::shim_event_broadcast_a_15},
+  {"shim_event_broadcast_a_2", aie1::shim_event_broadcast_a_2},
+  {"shim_event_broadcast_a_3", aie1::shim_event_broadcast_a_3},
+  {"shim_event_broadcast_a_4", aie1::shim_event_broadcast_a_4},
+  {"shim_event_broadcast_a_5", aie1::shim_event_broadcast_a_5},
+  {"shim_event_broadcast_a_6", aie1::shim_event_broadcast_a_6},
+  {"shim_event_broadcast_a_7", aie1::shim_event_broadcast_a_7},
+  {"shim_event_broadcast_a_8", aie1::shim_event_broadcast_a_8},
+  {"shim_event_broadcast_a_9", aie1::shim_event_broadcast_a_9},
+  {"shim_event_broadcast_a_block_east_clr", aie1::shim_event_broadcast_a_block_east_clr},
+  {"shim_event_broadcast_a_block_east_set", aie1::shim_event_broadcast_a_block_east_set},
+  {"shim_event_broadcast_a_block_east_value", aie1::shim_event_broadcast_a_block_east_value},
+  {"shim_event_broadcast_a_block_north_clr", aie1::shim_event_broadcast_a_block_north_clr},
+  {"shim_event_broadcast_a_block_north_set", aie1::shim_event_broadcast_a_block_north_set},
+  {"shim_event_broadcast_a_block_north_value", aie1::shim_event_broadcast_a_block_north_value},
+  {"shim_event_broadcast_a_block_south_clr", aie1::shim_event_broadcast_a_block_south_clr},
+  {"shim_event_broadcast_a_block_south_set", aie1::shim_event_broadcast_a_block_south_set},
+  {"shim_event_broadcast_a_block_south_value", aie1::shim_event_broadcast_a_block_south_value},
+  {"shim_event_broadcast_a_block_west_clr", aie1::shim_event_broadcast_a_block_west_clr},
+  {"shim_event_broadcast_a_block_west_set", aie1::shim_event_broadcast_a_block_west_set},
+  {"shim_event_broadcast_a_block_west_value", aie1::shim_event_broadcast_a_block_west_value},
+  {"shim_event_generate", aie1::shim_event_generate},
+  {"shim_event_group_dma_enable", aie1::shim_event_group_dma_enable},
+  {"shim_event_status0", aie1::shim_event_status0},
+  {"shim_event_status1", aie1::shim_event_status1},
+  {"shim_event_status2", aie1::shim_event_status2},
+  {"shim_event_status3", aie1::shim_event_status3},
+  {"shim_performance_control0", aie1::shim_performance_control0},
+  {"shim_performance_control1", aie1::shim_performance_control1},
+  {"shim_performance_counter0", aie1::shim_performance_counter0},
+  {"shim_performance_counter0_event_value", aie1::shim_performance_counter0_event_value},
+  {"shim_performance_counter1", aie1::shim_performance_counter1},
+  {"shim_performance_counter1_event_value", aie1::shim_performance_counter1_event_value},
+  {"shim_stream_switch_event_port_selection_0", aie1::shim_stream_switch_event_port_selection_0},
+  {"shim_stream_switch_event_port_selection_1", aie1::shim_stream_switch_event_port_selection_1},
+  {"shim_timer_high", aie1::shim_timer_high},
+  {"shim_timer_low", aie1::shim_timer_low},
+  {"shim_timer_trig_event_high_value", aie1::shim_timer_trig_event_high_value},
+  {"shim_timer_trig_event_low_value", aie1::shim_timer_trig_event_low_value},
+  {"shim_trace_control0", aie1::shim_trace_control0},
+  {"shim_trace_control1", aie1::shim_trace_control1},
+  {"shim_trace_event0", aie1::shim_trace_event0},
+  {"shim_trace_event1", aie1::shim_trace_event1},
+  {"shim_trace_status", aie1::shim_trace_status},
+};
+
+// Ids of registers in order of address
+constexpr uint16_t byAddress[] = {
+  250, 553, 550, 520, 521, 522, 524, 523, 525, 252, 379, 378,
+  519, 530, 532, 408, 380, 381, 388, 389, 390, 391, 392, 393,
+  394, 395, 382, 383, 384, 385, 386, 387, 403, 402, 404, 406,
+  405, 407, 400, 399, 401, 397, 396, 398, 537, 538, 541, 539,
+  540, 536, 535, 534, 533, 542, 543, 417, 418, 419, 420, 526,
+  527, 528, 529, 254, 253, 409, 416, 411, 413, 414, 412, 410,
+  415, 544, 531, 545, 547, 255, 546, 261, 260, 259, 306, 307,
+  304, 305, 310, 309, 308, 313, 314, 311, 312, 317, 316, 315,
+  320, 321, 318, 319, 324, 323, 322, 327, 328, 325, 326, 331,
+  330, 329, 334, 335, 332, 333, 338, 337, 336, 341, 342, 339,
+  340, 345, 344, 343, 348, 349, 346, 347, 352, 351, 350, 355,
+  356, 353, 354, 359, 358, 357, 362, 363, 360, 361, 366, 365,
+  364, 551, 552, 262, 263, 268, 267, 266, 271, 272, 269, 270,
+  275, 274, 273, 278, 279, 276, 277, 282, 281, 280, 285, 286,
+  283, 284, 289, 288, 287, 292, 293, 290, 291, 296, 295, 294,
+  299, 300, 297, 298, 303, 302, 301, 373, 374, 375, 376, 368,
+  369, 370, 371, 377, 372, 367, 424, 425, 426, 421, 422, 423,
+  466, 467, 468, 463, 464, 465, 472, 473, 474, 469, 470, 471,
+  478, 479, 480, 475, 476, 477, 484, 485, 486, 481, 482, 483,
+  490, 491, 492, 487, 488, 489, 496, 497, 498, 493, 494, 495,
+  502, 503, 504, 499, 500, 501, 508, 509, 510, 505, 506, 507,
+  514, 515, 516, 511, 512, 513, 430, 431, 432, 427, 428, 429,
+  436, 437, 438, 433, 434, 435, 442, 443, 444, 439, 440, 441,
+  448, 449, 450, 445, 446, 447, 454, 455, 456, 451, 452, 453,
+  460, 461, 462, 457, 458, 459, 251, 517, 518, 73, 56, 57,
+  54, 55, 588, 63, 589, 590, 592, 69, 71, 591, 68, 70,
+  72, 2, 3, 9, 74, 4, 5, 6, 7, 58, 59, 60,
+  61, 10, 11, 8, 240, 582, 12, 555, 20, 21, 22, 23,
+  24, 25, 26, 27, 14, 15, 16, 17, 18, 19, 35, 34,
+  578, 38, 579, 581, 32, 573, 33, 29, 28, 30, 245, 246,
+  604, 247, 248, 244, 598, 597, 241, 50, 51, 52, 53, 1,
+  0, 41, 583, 44, 43, 45, 46, 48, 42, 49, 238, 239,
+  237, 77, 78, 79, 80, 97, 85, 86, 93, 94, 95, 96,
+  98, 99, 100, 101, 87, 88, 89, 90, 91, 92, 81, 82,
+  83, 84, 114, 115, 117, 118, 136, 123, 124, 130, 131, 132,
+  133, 134, 135, 137, 138, 139, 140, 126, 127, 128, 129, 119,
+  120, 121, 122, 116, 125, 102, 103, 104, 105, 106, 107, 108,
+  109, 141, 142, 143, 144, 145, 146, 147, 148, 217, 218, 219,
+  220, 165, 166, 167, 168, 169, 170, 171, 172, 193, 194, 195,
+  196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 221, 222, 223,
+  224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+  236, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+  188, 189, 190, 191, 192, 149, 150, 151, 152, 153, 154, 155,
+  156, 157, 158, 159, 160, 161, 162, 163, 164, 110, 111, 112,
+  113, 173, 174, 175, 176, 75, 76,
+};
+
+static_assert(isSortedByName(registers, std::size(registers)),
+              "AIE1 registers must be sorted by name");
+static_assert(isSortedByAddress(registers, byAddress, std::size(byAddress)),
+              "AIE1 register ids must be sorted by address");
+
+} // end anonymous namespace
+
+RegisterNameTable getAIE1RegisterNames()
+{
+  return RegisterNameTable(registers, static_cast<uint16_t>(std::size(registers)),
+                           byAddress, static_cast<uint16_t>(std::size(byAddress)));
+}
+
+} // end namespace xdp
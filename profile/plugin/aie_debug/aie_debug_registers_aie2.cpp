@@ -0,0 +1,1533 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved
+
+#define XDP_PLUGIN_SOURCE
+
+#include <iterator>
+
+#include "xdp/profile/plugin/aie_base/generations/aie2_registers.h"
+#include "xdp/profile/plugin/aie_debug/aie_debug_registers.h"
+
+namespace xdp {
+
+/*************************************************************************************
+ AIE2 Registers
+ *************************************************************************************/
+namespace {
+
+constexpr RegisterName registers[] = {
+  {"cm_accumulator_control", aie2::cm_accumulator_control},
+  {"cm_combo_event_control", aie2::cm_combo_event_control},
+  {"cm_combo_event_inputs", aie2::cm_combo_event_inputs},
+  {"cm_core_control", aie2::cm_core_control},
+  {"cm_core_processor_bus", aie2::cm_core_processor_bus},
+  {"cm_core_status", aie2::cm_core_status},
+  {"cm_debug_control0", aie2::cm_debug_control0},
+  {"cm_debug_control1", aie2::cm_debug_control1},
+  {"cm_debug_control2", aie2::cm_debug_control2},
+  {"cm_debug_status", aie2::cm_debug_status},
+  {"cm_ecc_scrubbing_event", aie2::cm_ecc_scrubbing_event},
+  {"cm_edge_detection_event_control", aie2::cm_edge_detection_event_control},
+  {"cm_enable_events", aie2::cm_enable_events},
+  {"cm_error_halt_control", aie2::cm_error_halt_control},
+  {"cm_error_halt_event", aie2::cm_error_halt_event},
+  {"cm_event_broadcast0", aie2::cm_event_broadcast0},
+  {"cm_event_broadcast1", aie2::cm_event_broadcast1},
+  {"cm_event_broadcast10", aie2::cm_event_broadcast10},
+  {"cm_event_broadcast11", aie2::cm_event_broadcast11},
+  {"cm_event_broadcast12", aie2::cm_event_broadcast12},
+  {"cm_event_broadcast13", aie2::cm_event_broadcast13},
+  {"cm_event_broadcast14", aie2::cm_event_broadcast14},
+  {"cm_event_broadcast15", aie2::cm_event_broadcast15},
+  {"cm_event_broadcast2", aie2::cm_event_broadcast2},
+  {"cm_event_broadcast3", aie2::cm_event_broadcast3},
+  {"cm_event_broadcast4", aie2::cm_event_broadcast4},
+  {"cm_event_broadcast5", aie2::cm_event_broadcast5},
+  {"cm_event_broadcast6", aie2::cm_event_broadcast6},
+  {"cm_event_broadcast7", aie2::cm_event_broadcast7},
+  {"cm_event_broadcast8", aie2::cm_event_broadcast8},
+  {"cm_event_broadcast9", aie2::cm_event_broadcast9},
+  {"cm_event_broadcast_block_east_clr", aie2::cm_event_broadcast_block_east_clr},
+  {"cm_event_broadcast_block_east_set", aie2::cm_event_broadcast_block_east_set},
+  {"cm_event_broadcast_block_east_value", aie2::cm_event_broadcast_block_east_value},
+  {"cm_event_broadcast_block_north_clr", aie2::cm_event_broadcast_block_north_clr},
+  {"cm_event_broadcast_block_north_set", aie2::cm_event_broadcast_block_north_set},
+  {"cm_event_broadcast_block_north_value", aie2::cm_event_broadcast_block_north_value},
+  {"cm_event_broadcast_block_south_clr", aie2::cm_event_broadcast_block_south_clr},
+  {"cm_event_broadcast_block_south_set", aie2::cm_event_broadcast_block_south_set},
+  {"cm_event_broadcast_block_south_value", aie2::cm_event_broadcast_block_south_value},
+  {"cm_event_broadcast_block_west_clr", aie2::cm_event_broadcast_block_west_clr},
+  {"cm_event_broadcast_block_west_set", aie2::cm_event_broadcast_block_west_set},
+  {"cm_event_broadcast_block_west_value", aie2::cm_event_broadcast_block_west_value},
+  {"cm_event_generate", aie2::cm_event_generate},
+  {"cm_event_group_0_enable", aie2::cm_event_group_0_enable},
+  {"cm_event_group_broadcast_enable", aie2::cm_event_group_broadcast_enable},
+  {"cm_event_group_core_program_flow_enable", aie2::cm_event_group_core_program_flow_enable},
+  {"cm_event_group_core_stall_enable", aie2::cm_event_group_core_stall_enable},
+  {"cm_event_group_errors0_enable", aie2::cm_event_group_errors0_enable},
+  {"cm_event_group_errors1_enable", aie2::cm_event_group_errors1_enable},
+  {"cm_event_group_pc_enable", aie2::cm_event_group_pc_enable},
+  {"cm_event_group_stream_switch_enable", aie2::cm_event_group_stream_switch_enable},
+  {"cm_event_group_user_event_enable", aie2::cm_event_group_user_event_enable},
+  {"cm_event_status0", aie2::cm_event_status0},
+  {"cm_event_status1", aie2::cm_event_status1},
+  {"cm_event_status2", aie2::cm_event_status2},
+  {"cm_event_status3", aie2::cm_event_status3},
+  {"cm_memory_control", aie2::cm_memory_control},
+  {"cm_module_clock_control", aie2::cm_module_clock_control},
+  {"cm_module_reset_control", aie2::cm_module_reset_control},
+  {"cm_pc_event0", aie2::cm_pc_event0},
+  {"cm_pc_event1", aie2::cm_pc_event1},
+  {"cm_pc_event2", aie2::cm_pc_event2},
+  {"cm_pc_event3", aie2::cm_pc_event3},
+  {"cm_performance_control0", aie2::cm_performance_control0},
+  {"cm_performance_control1", aie2::cm_performance_control1},
+  {"cm_performance_control2", aie2::cm_performance_control2},
+  {"cm_performance_counter0", aie2::cm_performance_counter0},
+  {"cm_performance_counter0_event_value", aie2::cm_performance_counter0_event_value},
+  {"cm_performance_counter1", aie2::cm_performance_counter1},
+  {"cm_performance_counter1_event_value", aie2::cm_performance_counter1_event_value},
+  {"cm_performance_counter2", aie2::cm_performance_counter2},
+  {"cm_performance_counter2_event_value", aie2::cm_performance_counter2_event_value},
+  {"cm_performance_counter3", aie2::cm_performance_counter3},
+  {"cm_performance_counter3_event_value", aie2::cm_performance_counter3_event_value},
+  {"cm_program_counter", aie2::cm_program_counter},
+  {"cm_reset_event", aie2::cm_reset_event},
+  {"cm_stream_switch_adaptive_clock_gate_abort_period", aie2::cm_stream_switch_adaptive_clock_gate_abort_period},
+  {"cm_stream_switch_adaptive_clock_gate_status", aie2::cm_stream_switch_adaptive_clock_gate_status},
+  {"cm_stream_switch_deterministic_merge_arb0_ctrl", aie2::cm_stream_switch_deterministic_merge_arb0_ctrl},
+  {"cm_stream_switch_deterministic_merge_arb0_slave0_1", aie2::cm_stream_switch_deterministic_merge_arb0_slave0_1},
+  {"cm_stream_switch_deterministic_merge_arb0_slave2_3", aie2::cm_stream_switch_deterministic_merge_arb0_slave2_3},
+  {"cm_stream_switch_deterministic_merge_arb1_ctrl", aie2::cm_stream_switch_deterministic_merge_arb1_ctrl},
+  {"cm_stream_switch_deterministic_merge_arb1_slave0_1", aie2::cm_stream_switch_deterministic_merge_arb1_slave0_1},
+  {"cm_stream_switch_deterministic_merge_arb1_slave2_3", aie2::cm_stream_switch_deterministic_merge_arb1_slave2_3},
+  {"cm_stream_switch_event_port_selection_0", aie2::cm_stream_switch_event_port_selection_0},
+  {"cm_stream_switch_event_port_selection_1", aie2::cm_stream_switch_event_port_selection_1},
+  {"cm_stream_switch_master_config_aie_core0", aie2::cm_stream_switch_master_config_aie_core0},
+  {"cm_stream_switch_master_config_dma0", aie2::cm_stream_switch_master_config_dma0},
+  {"cm_stream_switch_master_config_dma1", aie2::cm_stream_switch_master_config_dma1},
+  {"cm_stream_switch_master_config_east0", aie2::cm_stream_switch_master_config_east0},
+  {"cm_stream_switch_master_config_east1", aie2::cm_stream_switch_master_config_east1},
+  {"cm_stream_switch_master_config_east2", aie2::cm_stream_switch_master_config_east2},
+  {"cm_stream_switch_master_config_east3", aie2::cm_stream_switch_master_config_east3},
+  {"cm_stream_switch_master_config_fifo0", aie2::cm_stream_switch_master_config_fifo0},
+  {"cm_stream_switch_master_config_north0", aie2::cm_stream_switch_master_config_north0},
+  {"cm_stream_switch_master_config_north1", aie2::cm_stream_switch_master_config_north1},
+  {"cm_stream_switch_master_config_north2", aie2::cm_stream_switch_master_config_north2},
+  {"cm_stream_switch_master_config_north3", aie2::cm_stream_switch_master_config_north3},
+  {"cm_stream_switch_master_config_north4", aie2::cm_stream_switch_master_config_north4},
+  {"cm_stream_switch_master_config_north5", aie2::cm_stream_switch_master_config_north5},
+  {"cm_stream_switch_master_config_south0", aie2::cm_stream_switch_master_config_south0},
+  {"cm_stream_switch_master_config_south1", aie2::cm_stream_switch_master_config_south1},
+  {"cm_stream_switch_master_config_south2", aie2::cm_stream_switch_master_config_south2},
+  {"cm_stream_switch_master_config_south3", aie2::cm_stream_switch_master_config_south3},
+  {"cm_stream_switch_master_config_tile_ctrl", aie2::cm_stream_switch_master_config_tile_ctrl},
+  {"cm_stream_switch_master_config_west0", aie2::cm_stream_switch_master_config_west0},
+  {"cm_stream_switch_master_config_west1", aie2::cm_stream_switch_master_config_west1},
+  {"cm_stream_switch_master_config_west2", aie2::cm_stream_switch_master_config_west2},
+  {"cm_stream_switch_master_config_west3", aie2::cm_stream_switch_master_config_west3},
+  {"cm_stream_switch_parity_injection", aie2::cm_stream_switch_parity_injection},
+  {"cm_stream_switch_parity_status", aie2::cm_stream_switch_parity_status},
+  {"cm_stream_switch_slave_aie_core0_slot0", aie2::cm_stream_switch_slave_aie_core0_slot0},
+  {"cm_stream_switch_slave_aie_core0_slot1", aie2::cm_stream_switch_slave_aie_core0_slot1},
+  {"cm_stream_switch_slave_aie_core0_slot2", aie2::cm_stream_switch_slave_aie_core0_slot2},
+  {"cm_stream_switch_slave_aie_core0_slot3", aie2::cm_stream_switch_slave_aie_core0_slot3},
+  {"cm_stream_switch_slave_aie_trace_slot0", aie2::cm_stream_switch_slave_aie_trace_slot0},
+  {"cm_stream_switch_slave_aie_trace_slot1", aie2::cm_stream_switch_slave_aie_trace_slot1},
+  {"cm_stream_switch_slave_aie_trace_slot2", aie2::cm_stream_switch_slave_aie_trace_slot2},
+  {"cm_stream_switch_slave_aie_trace_slot3", aie2::cm_stream_switch_slave_aie_trace_slot3},
+  {"cm_stream_switch_slave_config_aie_core0", aie2::cm_stream_switch_slave_config_aie_core0},
+  {"cm_stream_switch_slave_config_aie_trace", aie2::cm_stream_switch_slave_config_aie_trace},
+  {"cm_stream_switch_slave_config_dma_0", aie2::cm_stream_switch_slave_config_dma_0},
+  {"cm_stream_switch_slave_config_dma_1", aie2::cm_stream_switch_slave_config_dma_1},
+  {"cm_stream_switch_slave_config_east_0", aie2::cm_stream_switch_slave_config_east_0},
+  {"cm_stream_switch_slave_config_east_1", aie2::cm_stream_switch_slave_config_east_1},
+  {"cm_stream_switch_slave_config_east_2", aie2::cm_stream_switch_slave_config_east_2},
+  {"cm_stream_switch_slave_config_east_3", aie2::cm_stream_switch_slave_config_east_3},
+  {"cm_stream_switch_slave_config_fifo_0", aie2::cm_stream_switch_slave_config_fifo_0},
+  {"cm_stream_switch_slave_config_mem_trace", aie2::cm_stream_switch_slave_config_mem_trace},
+  {"cm_stream_switch_slave_config_north_0", aie2::cm_stream_switch_slave_config_north_0},
+  {"cm_stream_switch_slave_config_north_1", aie2::cm_stream_switch_slave_config_north_1},
+  {"cm_stream_switch_slave_config_north_2", aie2::cm_stream_switch_slave_config_north_2},
+  {"cm_stream_switch_slave_config_north_3", aie2::cm_stream_switch_slave_config_north_3},
+  {"cm_stream_switch_slave_config_south_0", aie2::cm_stream_switch_slave_config_south_0},
+  {"cm_stream_switch_slave_config_south_1", aie2::cm_stream_switch_slave_config_south_1},
+  {"cm_stream_switch_slave_config_south_2", aie2::cm_stream_switch_slave_config_south_2},
+  {"cm_stream_switch_slave_config_south_3", aie2::cm_stream_switch_slave_config_south_3},
+  {"cm_stream_switch_slave_config_south_4", aie2::cm_stream_switch_slave_config_south_4},
+  {"cm_stream_switch_slave_config_south_5", aie2::cm_stream_switch_slave_config_south_5},
+  {"cm_stream_switch_slave_config_tile_ctrl", aie2::cm_stream_switch_slave_config_tile_ctrl},
+  {"cm_stream_switch_slave_config_west_0", aie2::cm_stream_switch_slave_config_west_0},
+  {"cm_stream_switch_slave_config_west_1", aie2::cm_stream_switch_slave_config_west_1},
+  {"cm_stream_switch_slave_config_west_2", aie2::cm_stream_switch_slave_config_west_2},
+  {"cm_stream_switch_slave_config_west_3", aie2::cm_stream_switch_slave_config_west_3},
+  {"cm_stream_switch_slave_dma_0_slot0", aie2::cm_stream_switch_slave_dma_0_slot0},
+  {"cm_stream_switch_slave_dma_0_slot1", aie2::cm_stream_switch_slave_dma_0_slot1},
+  {"cm_stream_switch_slave_dma_0_slot2", aie2::cm_stream_switch_slave_dma_0_slot2},
+  {"cm_stream_switch_slave_dma_0_slot3", aie2::cm_stream_switch_slave_dma_0_slot3},
+  {"cm_stream_switch_slave_dma_1_slot0", aie2::cm_stream_switch_slave_dma_1_slot0},
+  {"cm_stream_switch_slave_dma_1_slot1", aie2::cm_stream_switch_slave_dma_1_slot1},
+  {"cm_stream_switch_slave_dma_1_slot2", aie2::cm_stream_switch_slave_dma_1_slot2},
+  {"cm_stream_switch_slave_dma_1_slot3", aie2::cm_stream_switch_slave_dma_1_slot3},
+  {"cm_stream_switch_slave_east_0_slot0", aie2::cm_stream_switch_slave_east_0_slot0},
+  {"cm_stream_switch_slave_east_0_slot1", aie2::cm_stream_switch_slave_east_0_slot1},
+  {"cm_stream_switch_slave_east_0_slot2", aie2::cm_stream_switch_slave_east_0_slot2},
+  {"cm_stream_switch_slave_east_0_slot3", aie2::cm_stream_switch_slave_east_0_slot3},
+  {"cm_stream_switch_slave_east_1_slot0", aie2::cm_stream_switch_slave_east_1_slot0},
+  {"cm_stream_switch_slave_east_1_slot1", aie2::cm_stream_switch_slave_east_1_slot1},
+  {"cm_stream_switch_slave_east_1_slot2", aie2::cm_stream_switch_slave_east_1_slot2},
+  {"cm_stream_switch_slave_east_1_slot3", aie2::cm_stream_switch_slave_east_1_slot3},
+  {"cm_stream_switch_slave_east_2_slot0", aie2::cm_stream_switch_slave_east_2_slot0},
+  {"cm_stream_switch_slave_east_2_slot1", aie2::cm_stream_switch_slave_east_2_slot1},
+  {"cm_stream_switch_slave_east_2_slot2", aie2::cm_stream_switch_slave_east_2_slot2},
+  {"cm_stream_switch_slave_east_2_slot3", aie2::cm_stream_switch_slave_east_2_slot3},
+  {"cm_stream_switch_slave_east_3_slot0", aie2::cm_stream_switch_slave_east_3_slot0},
+  {"cm_stream_switch_slave_east_3_slot1", aie2::cm_stream_switch_slave_east_3_slot1},
+  {"cm_stream_switch_slave_east_3_slot2", aie2::cm_stream_switch_slave_east_3_slot2},
+  {"cm_stream_switch_slave_east_3_slot3", aie2::cm_stream_switch_slave_east_3_slot3},
+  {"cm_stream_switch_slave_fifo_0_slot0", aie2::cm_stream_switch_slave_fifo_0_slot0},
+  {"cm_stream_switch_slave_fifo_0_slot1", aie2::cm_stream_switch_slave_fifo_0_slot1},
+  {"cm_stream_switch_slave_fifo_0_slot2", aie2::cm_stream_switch_slave_fifo_0_slot2},
+  {"cm_stream_switch_slave_fifo_0_slot3", aie2::cm_stream_switch_slave_fifo_0_slot3},
+  {"cm_stream_switch_slave_mem_trace_slot0", aie2::cm_stream_switch_slave_mem_trace_slot0},
+  {"cm_stream_switch_slave_mem_trace_slot1", aie2::cm_stream_switch_slave_mem_trace_slot1},
+  {"cm_stream_switch_slave_mem_trace_slot2", aie2::cm_stream_switch_slave_mem_trace_slot2},
+  {"cm_stream_switch_slave_mem_trace_slot3", aie2::cm_stream_switch_slave_mem_trace_slot3},
+  {"cm_stream_switch_slave_north_0_slot0", aie2::cm_stream_switch_slave_north_0_slot0},
+  {"cm_stream_switch_slave_north_0_slot1", aie2::cm_stream_switch_slave_north_0_slot1},
+  {"cm_stream_switch_slave_north_0_slot2", aie2::cm_stream_switch_slave_north_0_slot2},
+  {"cm_stream_switch_slave_north_0_slot3", aie2::cm_stream_switch_slave_north_0_slot3},
+  {"cm_stream_switch_slave_north_1_slot0", aie2::cm_stream_switch_slave_north_1_slot0},
+  {"cm_stream_switch_slave_north_1_slot1", aie2::cm_stream_switch_slave_north_1_slot1},
+  {"cm_stream_switch_slave_north_1_slot2", aie2::cm_stream_switch_slave_north_1_slot2},
+  {"cm_stream_switch_slave_north_1_slot3", aie2::cm_stream_switch_slave_north_1_slot3},
+  {"cm_stream_switch_slave_north_2_slot0", aie2::cm_stream_switch_slave_north_2_slot0},
+  {"cm_stream_switch_slave_north_2_slot1", aie2::cm_stream_switch_slave_north_2_slot1},
+  {"cm_stream_switch_slave_north_2_slot2", aie2::cm_stream_switch_slave_north_2_slot2},
+  {"cm_stream_switch_slave_north_2_slot3", aie2::cm_stream_switch_slave_north_2_slot3},
+  {"cm_stream_switch_slave_north_3_slot0", aie2::cm_stream_switch_slave_north_3_slot0},
+  {"cm_stream_switch_slave_north_3_slot1", aie2::cm_stream_switch_slave_north_3_slot1},
+  {"cm_stream_switch_slave_north_3_slot2", aie2::cm_stream_switch_slave_north_3_slot2},
+  {"cm_stream_switch_slave_north_3_slot3", aie2::cm_stream_switch_slave_north_3_slot3},
+  {"cm_stream_switch_slave_south_0_slot0", aie2::cm_stream_switch_slave_south_0_slot0},
+  {"cm_stream_switch_slave_south_0_slot1", aie2::cm_stream_switch_slave_south_0_slot1},
+  {"cm_stream_switch_slave_south_0_slot2", aie2::cm_stream_switch_slave_south_0_slot2},
+  {"cm_stream_switch_slave_south_0_slot3", aie2::cm_stream_switch_slave_south_0_slot3},
+  {"cm_stream_switch_slave_south_1_slot0", aie2::cm_stream_switch_slave_south_1_slot0},
+  {"cm_stream_switch_slave_south_1_slot1", aie2::cm_stream_switch_slave_south_1_slot1},
+  {"cm_stream_switch_slave_south_1_slot2", aie2::cm_stream_switch_slave_south_1_slot2},
+  {"cm_stream_switch_slave_south_1_slot3", aie2::cm_stream_switch_slave_south_1_slot3},
+  {"cm_stream_switch_slave_south_2_slot0", aie2::cm_stream_switch_slave_south_2_slot0},
+  {"cm_stream_switch_slave_south_2_slot1", aie2::cm_stream_switch_slave_south_2_slot1},
+  {"cm_stream_switch_slave_south_2_slot2", aie2::cm_stream_switch_slave_south_2_slot2},
+  {"cm_stream_switch_slave_south_2_slot3", aie2::cm_stream_switch_slave_south_2_slot3},
+  {"cm_stream_switch_slave_south_3_slot0", aie2::cm_stream_switch_slave_south_3_slot0},
+  {"cm_stream_switch_slave_south_3_slot1", aie2::cm_stream_switch_slave_south_3_slot1},
+  {"cm_stream_switch_slave_south_3_slot2", aie2::cm_stream_switch_slave_south_3_slot2},
+  {"cm_stream_switch_slave_south_3_slot3", aie2::cm_stream_switch_slave_south_3_slot3},
+  {"cm_stream_switch_slave_south_4_slot0", aie2::cm_stream_switch_slave_south_4_slot0},
+  {"cm_stream_switch_slave_south_4_slot1", aie2::cm_stream_switch_slave_south_4_slot1},
+  {"cm_stream_switch_slave_south_4_slot2", aie2::cm_stream_switch_slave_south_4_slot2},
+  {"cm_stream_switch_slave_south_4_slot3", aie2::cm_stream_switch_slave_south_4_slot3},
+  {"cm_stream_switch_slave_south_5_slot0", aie2::cm_stream_switch_slave_south_5_slot0},
+  {"cm_stream_switch_slave_south_5_slot1", aie2::cm_stream_switch_slave_south_5_slot1},
+  {"cm_stream_switch_slave_south_5_slot2", aie2::cm_stream_switch_slave_south_5_slot2},
+  {"cm_stream_switch_slave_south_5_slot3", aie2::cm_stream_switch_slave_south_5_slot3},
+  {"cm_stream_switch_slave_tile_ctrl_slot0", aie2::cm_stream_switch_slave_tile_ctrl_slot0},
+  {"cm_stream_switch_slave_tile_ctrl_slot1", aie2::cm_stream_switch_slave_tile_ctrl_slot1},
+  {"cm_stream_switch_slave_tile_ctrl_slot2", aie2::cm_stream_switch_slave_tile_ctrl_slot2},
+  {"cm_stream_switch_slave_tile_ctrl_slot3", aie2::cm_stream_switch_slave_tile_ctrl_slot3},
+  {"cm_stream_switch_slave_west_0_slot0", aie2::cm_stream_switch_slave_west_0_slot0},
+  {"cm_stream_switch_slave_west_0_slot1", aie2::cm_stream_switch_slave_west_0_slot1},
+  {"cm_stream_switch_slave_west_0_slot2", aie2::cm_stream_switch_slave_west_0_slot2},
+  {"cm_stream_switch_slave_west_0_slot3", aie2::cm_stream_switch_slave_west_0_slot3},
+  {"cm_stream_switch_slave_west_1_slot0", aie2::cm_stream_switch_slave_west_1_slot0},
+  {"cm_stream_switch_slave_west_1_slot1", aie2::cm_stream_switch_slave_west_1_slot1},
+  {"cm_stream_switch_slave_west_1_slot2", aie2::cm_stream_switch_slave_west_1_slot2},
+  {"cm_stream_switch_slave_west_1_slot3", aie2::cm_stream_switch_slave_west_1_slot3},
+  {"cm_stream_switch_slave_west_2_slot0", aie2::cm_stream_switch_slave_west_2_slot0},
+  {"cm_stream_switch_slave_west_2_slot1", aie2::cm_stream_switch_slave_west_2_slot1},
+  {"cm_stream_switch_slave_west_2_slot2", aie2::cm_stream_switch_slave_west_2_slot2},
+  {"cm_stream_switch_slave_west_2_slot3", aie2::cm_stream_switch_slave_west_2_slot3},
+  {"cm_stream_switch_slave_west_3_slot0", aie2::cm_stream_switch_slave_west_3_slot0},
+  {"cm_stream_switch_slave_west_3_slot1", aie2::cm_stream_switch_slave_west_3_slot1},
+  {"cm_stream_switch_slave_west_3_slot2", aie2::cm_stream_switch_slave_west_3_slot2},
+  {"cm_stream_switch_slave_west_3_slot3", aie2::cm_stream_switch_slave_west_3_slot3},
+  {"cm_tile_control", aie2::cm_tile_control},
+  {"cm_tile_control_packet_handler_status", aie2::cm_tile_control_packet_handler_status},
+  {"cm_timer_control", aie2::cm_timer_control},
+  {"cm_timer_high", aie2::cm_timer_high},
+  {"cm_timer_low", aie2::cm_timer_low},
+  {"cm_timer_trig_event_high_value", aie2::cm_timer_trig_event_high_value},
+  {"cm_timer_trig_event_low_value", aie2::cm_timer_trig_event_low_value},
+  {"cm_trace_control0", aie2::cm_trace_control0},
+  {"cm_trace_control1", aie2::cm_trace_control1},
+  {"cm_trace_event0", aie2::cm_trace_event0},
+  {"cm_trace_event1", aie2::cm_trace_event1},
+  {"cm_trace_status", aie2::cm_trace_status},
+  {"mem_checkbit_error_generation", aie2::mem_checkbit_error_generation},
+  {"mem_combo_event_control", aie2::mem_combo_event_control},
+  {"mem_combo_event_inputs", aie2::mem_combo_event_inputs},
+  {"mem_cssd_trigger", aie2::mem_cssd_trigger},
+  {"mem_dma_bd0_0", aie2::mem_dma_bd0_0},
+  {"mem_dma_bd0_1", aie2::mem_dma_bd0_1},
+  {"mem_dma_bd0_2", aie2::mem_dma_bd0_2},
+  {"mem_dma_bd0_3", aie2::mem_dma_bd0_3},
+  {"mem_dma_bd0_4", aie2::mem_dma_bd0_4},
+  {"mem_dma_bd0_5", aie2::mem_dma_bd0_5},
+  {"mem_dma_bd0_6", aie2::mem_dma_bd0_6},
+  {"mem_dma_bd0_7", aie2::mem_dma_bd0_7},
+  {"mem_dma_bd10_0", aie2::mem_dma_bd10_0},
+  {"mem_dma_bd10_1", aie2::mem_dma_bd10_1},
+  {"mem_dma_bd10_2", aie2::mem_dma_bd10_2},
+  {"mem_dma_bd10_3", aie2::mem_dma_bd10_3},
+  {"mem_dma_bd10_4", aie2::mem_dma_bd10_4},
+  {"mem_dma_bd10_5", aie2::mem_dma_bd10_5},
+  {"mem_dma_bd10_6", aie2::mem_dma_bd10_6},
+  {"mem_dma_bd10_7", aie2::mem_dma_bd10_7},
+  {"mem_dma_bd11_0", aie2::mem_dma_bd11_0},
+  {"mem_dma_bd11_1", aie2::mem_dma_bd11_1},
+  {"mem_dma_bd11_2", aie2::mem_dma_bd11_2},
+  {"mem_dma_bd11_3", aie2::mem_dma_bd11_3},
+  {"mem_dma_bd11_4", aie2::mem_dma_bd11_4},
+  {"mem_dma_bd11_5", aie2::mem_dma_bd11_5},
+  {"mem_dma_bd11_6", aie2::mem_dma_bd11_6},
+  {"mem_dma_bd11_7", aie2::mem_dma_bd11_7},
+  {"mem_dma_bd12_0", aie2::mem_dma_bd12_0},
+  {"mem_dma_bd12_1", aie2::mem_dma_bd12_1},
+  {"mem_dma_bd12_2", aie2::mem_dma_bd12_2},
+  {"mem_dma_bd12_3", aie2::mem_dma_bd12_3},
+  {"mem_dma_bd12_4", aie2::mem_dma_bd12_4},
+  {"mem_dma_bd12_5", aie2::mem_dma_bd12_5},
+  {"mem_dma_bd12_6", aie2::mem_dma_bd12_6},
+  {"mem_dma_bd12_7", aie2::mem_dma_bd12_7},
+  {"mem_dma_bd13_0", aie2::mem_dma_bd13_0},
+  {"mem_dma_bd13_1", aie2::mem_dma_bd13_1},
+  {"mem_dma_bd13_2", aie2::mem_dma_bd13_2},
+  {"mem_dma_bd13_3", aie2::mem_dma_bd13_3},
+  {"mem_dma_bd13_4", aie2::mem_dma_bd13_4},
+  {"mem_dma_bd13_5", aie2::mem_dma_bd13_5},
+  {"mem_dma_bd13_6", aie2::mem_dma_bd13_6},
+  {"mem_dma_bd13_7", aie2::mem_dma_bd13_7},
+  {"mem_dma_bd14_0", aie2::mem_dma_bd14_0},
+  {"mem_dma_bd14_1", aie2::mem_dma_bd14_1},
+  {"mem_dma_bd14_2", aie2::mem_dma_bd14_2},
+  {"mem_dma_bd14_3", aie2::mem_dma_bd14_3},
+  {"mem_dma_bd14_4", aie2::mem_dma_bd14_4},
+  {"mem_dma_bd14_5", aie2::mem_dma_bd14_5},
+  {"mem_dma_bd14_6", aie2::mem_dma_bd14_6},
+  {"mem_dma_bd14_7", aie2::mem_dma_bd14_7},
+  {"mem_dma_bd15_0", aie2::mem_dma_bd15_0},
+  {"mem_dma_bd15_1", aie2::mem_dma_bd15_1},
+  {"mem_dma_bd15_2", aie2::mem_dma_bd15_2},
+  {"mem_dma_bd15_3", aie2::mem_dma_bd15_3},
+  {"mem_dma_bd15_4", aie2::mem_dma_bd15_4},
+  {"mem_dma_bd15_5", aie2::mem_dma_bd15_5},
+  {"mem_dma_bd15_6", aie2::mem_dma_bd15_6},
+  {"mem_dma_bd15_7", aie2::mem_dma_bd15_7},
+  {"mem_dma_bd16_0", aie2::mem_dma_bd16_0},
+  {"mem_dma_bd16_1", aie2::mem_dma_bd16_1},
+  {"mem_dma_bd16_2", aie2::mem_dma_bd16_2},
+  {"mem_dma_bd16_3", aie2::mem_dma_bd16_3},
+  {"mem_dma_bd16_4", aie2::mem_dma_bd16_4},
+  {"mem_dma_bd16_5", aie2::mem_dma_bd16_5},
+  {"mem_dma_bd16_6", aie2::mem_dma_bd16_6},
+  {"mem_dma_bd16_7", aie2::mem_dma_bd16_7},
+  {"mem_dma_bd17_0", aie2::mem_dma_bd17_0},
+  {"mem_dma_bd17_1", aie2::mem_dma_bd17_1},
+  {"mem_dma_bd17_2", aie2::mem_dma_bd17_2},
+  {"mem_dma_bd17_3", aie2::mem_dma_bd17_3},
+  {"mem_dma_bd17_4", aie2::mem_dma_bd17_4},
+  {"mem_dma_bd17_5", aie2::mem_dma_bd17_5},
+  {"mem_dma_bd17_6", aie2::mem_dma_bd17_6},
+  {"mem_dma_bd17_7", aie2::mem_dma_bd17_7},
+  {"mem_dma_bd18_0", aie2::mem_dma_bd18_0},
+  {"mem_dma_bd18_1", aie2::mem_dma_bd18_1},
+  {"mem_dma_bd18_2", aie2::mem_dma_bd18_2},
+  {"mem_dma_bd18_3", aie2::mem_dma_bd18_3},
+  {"mem_dma_bd18_4", aie2::mem_dma_bd18_4},
+  {"mem_dma_bd18_5", aie2::mem_dma_bd18_5},
+  {"mem_dma_bd18_6", aie2::mem_dma_bd18_6},
+  {"mem_dma_bd18_7", aie2::mem_dma_bd18_7},
+  {"mem_dma_bd19_0", aie2::mem_dma_bd19_0},
+  {"mem_dma_bd19_1", aie2::mem_dma_bd19_1},
+  {"mem_dma_bd19_2", aie2::mem_dma_bd19_2},
+  {"mem_dma_bd19_3", aie2::mem_dma_bd19_3},
+  {"mem_dma_bd19_4", aie2::mem_dma_bd19_4},
+  {"mem_dma_bd19_5", aie2::mem_dma_bd19_5},
+  {"mem_dma_bd19_6", aie2::mem_dma_bd19_6},
+  {"mem_dma_bd19_7", aie2::mem_dma_bd19_7},
+  {"mem_dma_bd1_0", aie2::mem_dma_bd1_0},
+  {"mem_dma_bd1_1", aie2::mem_dma_bd1_1},
+  {"mem_dma_bd1_2", aie2::mem_dma_bd1_2},
+  {"mem_dma_bd1_3", aie2::mem_dma_bd1_3},
+  {"mem_dma_bd1_4", aie2::mem_dma_bd1_4},
+  {"mem_dma_bd1_5", aie2::mem_dma_bd1_5},
+  {"mem_dma_bd1_6", aie2::mem_dma_bd1_6},
+  {"mem_dma_bd1_7", aie2::mem_dma_bd1_7},
+  {"mem_dma_bd20_0", aie2::mem_dma_bd20_0},
+  {"mem_dma_bd20_1", aie2::mem_dma_bd20_1},
+  {"mem_dma_bd20_2", aie2::mem_dma_bd20_2},
+  {"mem_dma_bd20_3", aie2::mem_dma_bd20_3},
+  {"mem_dma_bd20_4", aie2::mem_dma_bd20_4},
+  {"mem_dma_bd20_5", aie2::mem_dma_bd20_5},
+  {"mem_dma_bd20_6", aie2::mem_dma_bd20_6},
+  {"mem_dma_bd20_7", aie2::mem_dma_bd20_7},
+  {"mem_dma_bd21_0", aie2::mem_dma_bd21_0},
+  {"mem_dma_bd21_1", aie2::mem_dma_bd21_1},
+  {"mem_dma_bd21_2", aie2::mem_dma_bd21_2},
+  {"mem_dma_bd21_3", aie2::mem_dma_bd21_3},
+  {"mem_dma_bd21_4", aie2::mem_dma_bd21_4},
+  {"mem_dma_bd21_5", aie2::mem_dma_bd21_5},
+  {"mem_dma_bd21_6", aie2::mem_dma_bd21_6},
+  {"mem_dma_bd21_7", aie2::mem_dma_bd21_7},
+  {"mem_dma_bd22_0", aie2::mem_dma_bd22_0},
+  {"mem_dma_bd22_1", aie2::mem_dma_bd22_1},
+  {"mem_dma_bd22_2", aie2::mem_dma_bd22_2},
+  {"mem_dma_bd22_3", aie2::mem_dma_bd22_3},
+  {"mem_dma_bd22_4", aie2::mem_dma_bd22_4},
+  {"mem_dma_bd22_5", aie2::mem_dma_bd22_5},
+  {"mem_dma_bd22_6", aie2::mem_dma_bd22_6},
+  {"mem_dma_bd22_7", aie2::mem_dma_bd22_7},
+  {"mem_dma_bd23_0", aie2::mem_dma_bd23_0},
+  {"mem_dma_bd23_1", aie2::mem_dma_bd23_1},
+  {"mem_dma_bd23_2", aie2::mem_dma_bd23_2},
+  {"mem_dma_bd23_3", aie2::mem_dma_bd23_3},
+  {"mem_dma_bd23_4", aie2::mem_dma_bd23_4},
+  {"mem_dma_bd23_5", aie2::mem_dma_bd23_5},
+  {"mem_dma_bd23_6", aie2::mem_dma_bd23_6},
+  {"mem_dma_bd23_7", aie2::mem_dma_bd23_7},
+  {"mem_dma_bd24_0", aie2::mem_dma_bd24_0},
+  {"mem_dma_bd24_1", aie2::mem_dma_bd24_1},
+  {"mem_dma_bd24_2", aie2::mem_dma_bd24_2},
+  {"mem_dma_bd24_3", aie2::mem_dma_bd24_3},
+  {"mem_dma_bd24_4", aie2::mem_dma_bd24_4},
+  {"mem_dma_bd24_5", aie2::mem_dma_bd24_5},
+  {"mem_dma_bd24_6", aie2::mem_dma_bd24_6},
+  {"mem_dma_bd24_7", aie2::mem_dma_bd24_7},
+  {"mem_dma_bd25_0", aie2::mem_dma_bd25_0},
+  {"mem_dma_bd25_1", aie2::mem_dma_bd25_1},
+  {"mem_dma_bd25_2", aie2::mem_dma_bd25_2},
+  {"mem_dma_bd25_3", aie2::mem_dma_bd25_3},
+  {"mem_dma_bd25_4", aie2::mem_dma_bd25_4},
+  {"mem_dma_bd25_5", aie2::mem_dma_bd25_5},
+  {"mem_dma_bd25_6", aie2::mem_dma_bd25_6},
+  {"mem_dma_bd25_7", aie2::mem_dma_bd25_7},
+  {"mem_dma_bd26_0", aie2::mem_dma_bd26_0},
+  {"mem_dma_bd26_1", aie2::mem_dma_bd26_1},
+  {"mem_dma_bd26_2", aie2::mem_dma_bd26_2},
+  {"mem_dma_bd26_3", aie2::mem_dma_bd26_3},
+  {"mem_dma_bd26_4", aie2::mem_dma_bd26_4},
+  {"mem_dma_bd26_5", aie2::mem_dma_bd26_5},
+  {"mem_dma_bd26_6", aie2::mem_dma_bd26_6},
+  {"mem_dma_bd26_7", aie2::mem_dma_bd26_7},
+  {"mem_dma_bd27_0", aie2::mem_dma_bd27_0},
+  {"mem_dma_bd27_1", aie2::mem_dma_bd27_1},
+  {"mem_dma_bd27_2", aie2::mem_dma_bd27_2},
+  {"mem_dma_bd27_3", aie2::mem_dma_bd27_3},
+  {"mem_dma_bd27_4", aie2::mem_dma_bd27_4},
+  {"mem_dma_bd27_5", aie2::mem_dma_bd27_5},
+  {"mem_dma_bd27_6", aie2::mem_dma_bd27_6},
+  {"mem_dma_bd27_7", aie2::mem_dma_bd27_7},
+  {"mem_dma_bd28_0", aie2::mem_dma_bd28_0},
+  {"mem_dma_bd28_1", aie2::mem_dma_bd28_1},
+  {"mem_dma_bd28_2", aie2::mem_dma_bd28_2},
+  {"mem_dma_bd28_3", aie2::mem_dma_bd28_3},
+  {"mem_dma_bd28_4", aie2::mem_dma_bd28_4},
+  {"mem_dma_bd28_5", aie2::mem_dma_bd28_5},
+  {"mem_dma_bd28_6", aie2::mem_dma_bd28_6},
+  {"mem_dma_bd28_7", aie2::mem_dma_bd28_7},
+  {"mem_dma_bd29_0", aie2::mem_dma_bd29_0},
+  {"mem_dma_bd29_1", aie2::mem_dma_bd29_1},
+  {"mem_dma_bd29_2", aie2::mem_dma_bd29_2},
+  {"mem_dma_bd29_3", aie2::mem_dma_bd29_3},
+  {"mem_dma_bd29_4", aie2::mem_dma_bd29_4},
+  {"mem_dma_bd29_5", aie2::mem_dma_bd29_5},
+  {"mem_dma_bd29_6", aie2::mem_dma_bd29_6},
+  {"mem_dma_bd29_7", aie2::mem_dma_bd29_7},
+  {"mem_dma_bd2_0", aie2::mem_dma_bd2_0},
+  {"mem_dma_bd2_1", aie2::mem_dma_bd2_1},
+  {"mem_dma_bd2_2", aie2::mem_dma_bd2_2},
+  {"mem_dma_bd2_3", aie2::mem_dma_bd2_3},
+  {"mem_dma_bd2_4", aie2::mem_dma_bd2_4},
+  {"mem_dma_bd2_5", aie2::mem_dma_bd2_5},
+  {"mem_dma_bd2_6", aie2::mem_dma_bd2_6},
+  {"mem_dma_bd2_7", aie2::mem_dma_bd2_7},
+  {"mem_dma_bd30_0", aie2::mem_dma_bd30_0},
+  {"mem_dma_bd30_1", aie2::mem_dma_bd30_1},
+  {"mem_dma_bd30_2", aie2::mem_dma_bd30_2},
+  {"mem_dma_bd30_3", aie2::mem_dma_bd30_3},
+  {"mem_dma_bd30_4", aie2::mem_dma_bd30_4},
+  {"mem_dma_bd30_5", aie2::mem_dma_bd30_5},
+  {"mem_dma_bd30_6", aie2::mem_dma_bd30_6},
+  {"mem_dma_bd30_7", aie2::mem_dma_bd30_7},
+  {"mem_dma_bd31_0", aie2::mem_dma_bd31_0},
+  {"mem_dma_bd31_1", aie2::mem_dma_bd31_1},
+  {"mem_dma_bd31_2", aie2::mem_dma_bd31_2},
+  {"mem_dma_bd31_3", aie2::mem_dma_bd31_3},
+  {"mem_dma_bd31_4", aie2::mem_dma_bd31_4},
+  {"mem_dma_bd31_5", aie2::mem_dma_bd31_5},
+  {"mem_dma_bd31_6", aie2::mem_dma_bd31_6},
+  {"mem_dma_bd31_7", aie2::mem_dma_bd31_7},
+  {"mem_dma_bd32_0", aie2::mem_dma_bd32_0},
+  {"mem_dma_bd32_1", aie2::mem_dma_bd32_1},
+  {"mem_dma_bd32_2", aie2::mem_dma_bd32_2},
+  {"mem_dma_bd32_3", aie2::mem_dma_bd32_3},
+  {"mem_dma_bd32_4", aie2::mem_dma_bd32_4},
+  {"mem_dma_bd32_5", aie2::mem_dma_bd32_5},
+  {"mem_dma_bd32_6", aie2::mem_dma_bd32_6},
+  {"mem_dma_bd32_7", aie2::mem_dma_bd32_7},
+  {"mem_dma_bd33_0", aie2::mem_dma_bd33_0},
+  {"mem_dma_bd33_1", aie2::mem_dma_bd33_1},
+  {"mem_dma_bd33_2", aie2::mem_dma_bd33_2},
+  {"mem_dma_bd33_3", aie2::mem_dma_bd33_3},
+  {"mem_dma_bd33_4", aie2::mem_dma_bd33_4},
+  {"mem_dma_bd33_5", aie2::mem_dma_bd33_5},
+  {"mem_dma_bd33_6", aie2::mem_dma_bd33_6},
+  {"mem_dma_bd33_7", aie2::mem_dma_bd33_7},
+  {"mem_dma_bd34_0", aie2::mem_dma_bd34_0},
+  {"mem_dma_bd34_1", aie2::mem_dma_bd34_1},
+  {"mem_dma_bd34_2", aie2::mem_dma_bd34_2},
+  {"mem_dma_bd34_3", aie2::mem_dma_bd34_3},
+  {"mem_dma_bd34_4", aie2::mem_dma_bd34_4},
+  {"mem_dma_bd34_5", aie2::mem_dma_bd34_5},
+  {"mem_dma_bd34_6", aie2::mem_dma_bd34_6},
+  {"mem_dma_bd34_7", aie2::mem_dma_bd34_7},
+  {"mem_dma_bd35_0", aie2::mem_dma_bd35_0},
+  {"mem_dma_bd35_1", aie2::mem_dma_bd35_1},
+  {"mem_dma_bd35_2", aie2::mem_dma_bd35_2},
+  {"mem_dma_bd35_3", aie2::mem_dma_bd35_3},
+  {"mem_dma_bd35_4", aie2::mem_dma_bd35_4},
+  {"mem_dma_bd35_5", aie2::mem_dma_bd35_5},
+  {"mem_dma_bd35_6", aie2::mem_dma_bd35_6},
+  {"mem_dma_bd35_7", aie2::mem_dma_bd35_7},
+  {"mem_dma_bd36_0", aie2::mem_dma_bd36_0},
+  {"mem_dma_bd36_1", aie2::mem_dma_bd36_1},
+  {"mem_dma_bd36_2", aie2::mem_dma_bd36_2},
+  {"mem_dma_bd36_3", aie2::mem_dma_bd36_3},
+  {"mem_dma_bd36_4", aie2::mem_dma_bd36_4},
+  {"mem_dma_bd36_5", aie2::mem_dma_bd36_5},
+  {"mem_dma_bd36_6", aie2::mem_dma_bd36_6},
+  {"mem_dma_bd36_7", aie2::mem_dma_bd36_7},
+  {"mem_dma_bd37_0", aie2::mem_dma_bd37_0},
+  {"mem_dma_bd37_1", aie2::mem_dma_bd37_1},
+  {"mem_dma_bd37_2", aie2::mem_dma_bd37_2},
+  {"mem_dma_bd37_3", aie2::mem_dma_bd37_3},
+  {"mem_dma_bd37_4", aie2::mem_dma_bd37_4},
+  {"mem_dma_bd37_5", aie2::mem_dma_bd37_5},
+  {"mem_dma_bd37_6", aie2::mem_dma_bd37_6},
+  {"mem_dma_bd37_7", aie2::mem_dma_bd37_7},
+  {"mem_dma_bd38_0", aie2::mem_dma_bd38_0},
+  {"mem_dma_bd38_1", aie2::mem_dma_bd38_1},
+  {"mem_dma_bd38_2", aie2::mem_dma_bd38_2},
+  {"mem_dma_bd38_3", aie2::mem_dma_bd38_3},
+  {"mem_dma_bd38_4", aie2::mem_dma_bd38_4},
+  {"mem_dma_bd38_5", aie2::mem_dma_bd38_5},
+  {"mem_dma_bd38_6", aie2::mem_dma_bd38_6},
+  {"mem_dma_bd38_7", aie2::mem_dma_bd38_7},
+  {"mem_dma_bd39_0", aie2::mem_dma_bd39_0},
+  {"mem_dma_bd39_1", aie2::mem_dma_bd39_1},
+  {"mem_dma_bd39_2", aie2::mem_dma_bd39_2},
+  {"mem_dma_bd39_3", aie2::mem_dma_bd39_3},
+  {"mem_dma_bd39_4", aie2::mem_dma_bd39_4},
+  {"mem_dma_bd39_5", aie2::mem_dma_bd39_5},
+  {"mem_dma_bd39_6", aie2::mem_dma_bd39_6},
+  {"mem_dma_bd39_7", aie2::mem_dma_bd39_7},
+  {"mem_dma_bd3_0", aie2::mem_dma_bd3_0},
+  {"mem_dma_bd3_1", aie2::mem_dma_bd3_1},
+  {"mem_dma_bd3_2", aie2::mem_dma_bd3_2},
+  {"mem_dma_bd3_3", aie2::mem_dma_bd3_3},
+  {"mem_dma_bd3_4", aie2::mem_dma_bd3_4},
+  {"mem_dma_bd3_5", aie2::mem_dma_bd3_5},
+  {"mem_dma_bd3_6", aie2::mem_dma_bd3_6},
+  {"mem_dma_bd3_7", aie2::mem_dma_bd3_7},
+  {"mem_dma_bd40_0", aie2::mem_dma_bd40_0},
+  {"mem_dma_bd40_1", aie2::mem_dma_bd40_1},
+  {"mem_dma_bd40_2", aie2::mem_dma_bd40_2},
+  {"mem_dma_bd40_3", aie2::mem_dma_bd40_3},
+  {"mem_dma_bd40_4", aie2::mem_dma_bd40_4},
+  {"mem_dma_bd40_5", aie2::mem_dma_bd40_5},
+  {"mem_dma_bd40_6", aie2::mem_dma_bd40_6},
+  {"mem_dma_bd40_7", aie2::mem_dma_bd40_7},
+  {"mem_dma_bd41_0", aie2::mem_dma_bd41_0},
+  {"mem_dma_bd41_1", aie2::mem_dma_bd41_1},
+  {"mem_dma_bd41_2", aie2::mem_dma_bd41_2},
+  {"mem_dma_bd41_3", aie2::mem_dma_bd41_3},
+  {"mem_dma_bd41_4", aie2::mem_dma_bd41_4},
+  {"mem_dma_bd41_5", aie2::mem_dma_bd41_5},
+  {"mem_dma_bd41_6", aie2::mem_dma_bd41_6},
+  {"mem_dma_bd41_7", aie2::mem_dma_bd41_7},
+  {"mem_dma_bd42_0", aie2::mem_dma_bd42_0},
+  {"mem_dma_bd42_1", aie2::mem_dma_bd42_1},
+  {"mem_dma_bd42_2", aie2::mem_dma_bd42_2},
+  {"mem_dma_bd42_3", aie2::mem_dma_bd42_3},
+  {"mem_dma_bd42_4", aie2::mem_dma_bd42_4},
+  {"mem_dma_bd42_5", aie2::mem_dma_bd42_5},
+  {"mem_dma_bd42_6", aie2::mem_dma_bd42_6},
+  {"mem_dma_bd42_7", aie2::mem_dma_bd42_7},
+  {"mem_dma_bd43_0", aie2::mem_dma_bd43_0},
+  {"mem_dma_bd43_1", aie2::mem_dma_bd43_1},
+  {"mem_dma_bd43_2", aie2::mem_dma_bd43_2},
+  {"mem_dma_bd43_3", aie2::mem_dma_bd43_3},
+  {"mem_dma_bd43_4", aie2::mem_dma_bd43_4},
+  {"mem_dma_bd43_5", aie2::mem_dma_bd43_5},
+  {"mem_dma_bd43_6", aie2::mem_dma_bd43_6},
+  {"mem_dma_bd43_7", aie2::mem_dma_bd43_7},
+  {"mem_dma_bd44_0", aie2::mem_dma_bd44_0},
+  {"mem_dma_bd44_1", aie2::mem_dma_bd44_1},
+  {"mem_dma_bd44_2", aie2::mem_dma_bd44_2},
+  {"mem_dma_bd44_3", aie2::mem_dma_bd44_3},
+  {"mem_dma_bd44_4", aie2::mem_dma_bd44_4},
+  {"mem_dma_bd44_5", aie2::mem_dma_bd44_5},
+  {"mem_dma_bd44_6", aie2::mem_dma_bd44_6},
+  {"mem_dma_bd44_7", aie2::mem_dma_bd44_7},
+  {"mem_dma_bd45_0", aie2::mem_dma_bd45_0},
+  {"mem_dma_bd45_1", aie2::mem_dma_bd45_1},
+  {"mem_dma_bd45_2", aie2::mem_dma_bd45_2},
+  {"mem_dma_bd45_3", aie2::mem_dma_bd45_3},
+  {"mem_dma_bd45_4", aie2::mem_dma_bd45_4},
+  {"mem_dma_bd45_5", aie2::mem_dma_bd45_5},
+  {"mem_dma_bd45_6", aie2::mem_dma_bd45_6},
+  {"mem_dma_bd45_7", aie2::mem_dma_bd45_7},
+  {"mem_dma_bd46_0", aie2::mem_dma_bd46_0},
+  {"mem_dma_bd46_1", aie2::mem_dma_bd46_1},
+  {"mem_dma_bd46_2", aie2::mem_dma_bd46_2},
+  {"mem_dma_bd46_3", aie2::mem_dma_bd46_3},
+  {"mem_dma_bd46_4", aie2::mem_dma_bd46_4},
+  {"mem_dma_bd46_5", aie2::mem_dma_bd46_5},
+  {"mem_dma_bd46_6", aie2::mem_dma_bd46_6},
+  {"mem_dma_bd46_7", aie2::mem_dma_bd46_7},
+  {"mem_dma_bd47_0", aie2::mem_dma_bd47_0},
+  {"mem_dma_bd47_1", aie2::mem_dma_bd47_1},
+  {"mem_dma_bd47_2", aie2::mem_dma_bd47_2},
+  {"mem_dma_bd47_3", aie2::mem_dma_bd47_3},
+  {"mem_dma_bd47_4", aie2::mem_dma_bd47_4},
+  {"mem_dma_bd47_5", aie2::mem_dma_bd47_5},
+  {"mem_dma_bd47_6", aie2::mem_dma_bd47_6},
+  {"mem_dma_bd47_7", aie2::mem_dma_bd47_7},
+  {"mem_dma_bd4_0", aie2::mem_dma_bd4_0},
+  {"mem_dma_bd4_1", aie2::mem_dma_bd4_1},
+  {"mem_dma_bd4_2", aie2::mem_dma_bd4_2},
+  {"mem_dma_bd4_3", aie2::mem_dma_bd4_3},
+  {"mem_dma_bd4_4", aie2::mem_dma_bd4_4},
+  {"mem_dma_bd4_5", aie2::mem_dma_bd4_5},
+  {"mem_dma_bd4_6", aie2::mem_dma_bd4_6},
+  {"mem_dma_bd4_7", aie2::mem_dma_bd4_7},
+  {"mem_dma_bd5_0", aie2::mem_dma_bd5_0},
+  {"mem_dma_bd5_1", aie2::mem_dma_bd5_1},
+  {"mem_dma_bd5_2", aie2::mem_dma_bd5_2},
+  {"mem_dma_bd5_3", aie2::mem_dma_bd5_3},
+  {"mem_dma_bd5_4", aie2::mem_dma_bd5_4},
+  {"mem_dma_bd5_5", aie2::mem_dma_bd5_5},
+  {"mem_dma_bd5_6", aie2::mem_dma_bd5_6},
+  {"mem_dma_bd5_7", aie2::mem_dma_bd5_7},
+  {"mem_dma_bd6_0", aie2::mem_dma_bd6_0},
+  {"mem_dma_bd6_1", aie2::mem_dma_bd6_1},
+  {"mem_dma_bd6_2", aie2::mem_dma_bd6_2},
+  {"mem_dma_bd6_3", aie2::mem_dma_bd6_3},
+  {"mem_dma_bd6_4", aie2::mem_dma_bd6_4},
+  {"mem_dma_bd6_5", aie2::mem_dma_bd6_5},
+  {"mem_dma_bd6_6", aie2::mem_dma_bd6_6},
+  {"mem_dma_bd6_7", aie2::mem_dma_bd6_7},
+  {"mem_dma_bd7_0", aie2::mem_dma_bd7_0},
+  {"mem_dma_bd7_1", aie2::mem_dma_bd7_1},
+  {"mem_dma_bd7_2", aie2::mem_dma_bd7_2},
+  {"mem_dma_bd7_3", aie2::mem_dma_bd7_3},
+  {"mem_dma_bd7_4", aie2::mem_dma_bd7_4},
+  {"mem_dma_bd7_5", aie2::mem_dma_bd7_5},
+  {"mem_dma_bd7_6", aie2::mem_dma_bd7_6},
+  {"mem_dma_bd7_7", aie2::mem_dma_bd7_7},
+  {"mem_dma_bd8_0", aie2::mem_dma_bd8_0},
+  {"mem_dma_bd8_1", aie2::mem_dma_bd8_1},
+  {"mem_dma_bd8_2", aie2::mem_dma_bd8_2},
+  {"mem_dma_bd8_3", aie2::mem_dma_bd8_3},
+  {"mem_dma_bd8_4", aie2::mem_dma_bd8_4},
+  {"mem_dma_bd8_5", aie2::mem_dma_bd8_5},
+  {"mem_dma_bd8_6", aie2::mem_dma_bd8_6},
+  {"mem_dma_bd8_7", aie2::mem_dma_bd8_7},
+  {"mem_dma_bd9_0", aie2::mem_dma_bd9_0},
+  {"mem_dma_bd9_1", aie2::mem_dma_bd9_1},
+  {"mem_dma_bd9_2", aie2::mem_dma_bd9_2},
+  {"mem_dma_bd9_3", aie2::mem_dma_bd9_3},
+  {"mem_dma_bd9_4", aie2::mem_dma_bd9_4},
+  {"mem_dma_bd9_5", aie2::mem_dma_bd9_5},
+  {"mem_dma_bd9_6", aie2::mem_dma_bd9_6},
+  {"mem_dma_bd9_7", aie2::mem_dma_bd9_7},
+  {"mem_dma_event_channel_selection", aie2::mem_dma_event_channel_selection},
+  {"mem_dma_mm2s_0_ctrl", aie2::mem_dma_mm2s_0_ctrl},
+  {"mem_dma_mm2s_0_start_queue", aie2::mem_dma_mm2s_0_start_queue},
+  {"mem_dma_mm2s_1_ctrl", aie2::mem_dma_mm2s_1_ctrl},
+  {"mem_dma_mm2s_1_start_queue", aie2::mem_dma_mm2s_1_start_queue},
+  {"mem_dma_mm2s_2_ctrl", aie2::mem_dma_mm2s_2_ctrl},
+  {"mem_dma_mm2s_2_start_queue", aie2::mem_dma_mm2s_2_start_queue},
+  {"mem_dma_mm2s_3_ctrl", aie2::mem_dma_mm2s_3_ctrl},
+  {"mem_dma_mm2s_3_start_queue", aie2::mem_dma_mm2s_3_start_queue},
+  {"mem_dma_mm2s_4_ctrl", aie2::mem_dma_mm2s_4_ctrl},
+  {"mem_dma_mm2s_4_start_queue", aie2::mem_dma_mm2s_4_start_queue},
+  {"mem_dma_mm2s_5_ctrl", aie2::mem_dma_mm2s_5_ctrl},
+  {"mem_dma_mm2s_5_start_queue", aie2::mem_dma_mm2s_5_start_queue},
+  {"mem_dma_mm2s_status_0", aie2::mem_dma_mm2s_status_0},
+  {"mem_dma_mm2s_status_1", aie2::mem_dma_mm2s_status_1},
+  {"mem_dma_mm2s_status_2", aie2::mem_dma_mm2s_status_2},
+  {"mem_dma_mm2s_status_3", aie2::mem_dma_mm2s_status_3},
+  {"mem_dma_mm2s_status_4", aie2::mem_dma_mm2s_status_4},
+  {"mem_dma_mm2s_status_5", aie2::mem_dma_mm2s_status_5},
+  {"mem_dma_s2mm_0_ctrl", aie2::mem_dma_s2mm_0_ctrl},
+  {"mem_dma_s2mm_0_start_queue", aie2::mem_dma_s2mm_0_start_queue},
+  {"mem_dma_s2mm_1_ctrl", aie2::mem_dma_s2mm_1_ctrl},
+  {"mem_dma_s2mm_1_start_queue", aie2::mem_dma_s2mm_1_start_queue},
+  {"mem_dma_s2mm_2_ctrl", aie2::mem_dma_s2mm_2_ctrl},
+  {"mem_dma_s2mm_2_start_queue", aie2::mem_dma_s2mm_2_start_queue},
+  {"mem_dma_s2mm_3_ctrl", aie2::mem_dma_s2mm_3_ctrl},
+  {"mem_dma_s2mm_3_start_queue", aie2::mem_dma_s2mm_3_start_queue},
+  {"mem_dma_s2mm_4_ctrl", aie2::mem_dma_s2mm_4_ctrl},
+  {"mem_dma_s2mm_4_start_queue", aie2::mem_dma_s2mm_4_start_queue},
+  {"mem_dma_s2mm_5_ctrl", aie2::mem_dma_s2mm_5_ctrl},
+  {"mem_dma_s2mm_5_start_queue", aie2::mem_dma_s2mm_5_start_queue},
+  {"mem_dma_s2mm_current_write_count_0", aie2::mem_dma_s2mm_current_write_count_0},
+  {"mem_dma_s2mm_current_write_count_1", aie2::mem_dma_s2mm_current_write_count_1},
+  {"mem_dma_s2mm_current_write_count_2", aie2::mem_dma_s2mm_current_write_count_2},
+  {"mem_dma_s2mm_current_write_count_3", aie2::mem_dma_s2mm_current_write_count_3},
+  {"mem_dma_s2mm_current_write_count_4", aie2::mem_dma_s2mm_current_write_count_4},
+  {"mem_dma_s2mm_current_write_count_5", aie2::mem_dma_s2mm_current_write_count_5},
+  {"mem_dma_s2mm_fot_count_fifo_pop_0", aie2::mem_dma_s2mm_fot_count_fifo_pop_0},
+  {"mem_dma_s2mm_fot_count_fifo_pop_1", aie2::mem_dma_s2mm_fot_count_fifo_pop_1},
+  {"mem_dma_s2mm_fot_count_fifo_pop_2", aie2::mem_dma_s2mm_fot_count_fifo_pop_2},
+  {"mem_dma_s2mm_fot_count_fifo_pop_3", aie2::mem_dma_s2mm_fot_count_fifo_pop_3},
+  {"mem_dma_s2mm_fot_count_fifo_pop_4", aie2::mem_dma_s2mm_fot_count_fifo_pop_4},
+  {"mem_dma_s2mm_fot_count_fifo_pop_5", aie2::mem_dma_s2mm_fot_count_fifo_pop_5},
+  {"mem_dma_s2mm_status_0", aie2::mem_dma_s2mm_status_0},
+  {"mem_dma_s2mm_status_1", aie2::mem_dma_s2mm_status_1},
+  {"mem_dma_s2mm_status_2", aie2::mem_dma_s2mm_status_2},
+  {"mem_dma_s2mm_status_3", aie2::mem_dma_s2mm_status_3},
+  {"mem_dma_s2mm_status_4", aie2::mem_dma_s2mm_status_4},
+  {"mem_dma_s2mm_status_5", aie2::mem_dma_s2mm_status_5},
+  {"mem_ecc_failing_address", aie2::mem_ecc_failing_address},
+  {"mem_ecc_scrubbing_event", aie2::mem_ecc_scrubbing_event},
+  {"mem_edge_detection_event_control", aie2::mem_edge_detection_event_control},
+  {"mem_event_broadcast0", aie2::mem_event_broadcast0},
+  {"mem_event_broadcast1", aie2::mem_event_broadcast1},
+  {"mem_event_broadcast10", aie2::mem_event_broadcast10},
+  {"mem_event_broadcast11", aie2::mem_event_broadcast11},
+  {"mem_event_broadcast12", aie2::mem_event_broadcast12},
+  {"mem_event_broadcast13", aie2::mem_event_broadcast13},
+  {"mem_event_broadcast14", aie2::mem_event_broadcast14},
+  {"mem_event_broadcast15", aie2::mem_event_broadcast15},
+  {"mem_event_broadcast2", aie2::mem_event_broadcast2},
+  {"mem_event_broadcast3", aie2::mem_event_broadcast3},
+  {"mem_event_broadcast4", aie2::mem_event_broadcast4},
+  {"mem_event_broadcast5", aie2::mem_event_broadcast5},
+  {"mem_event_broadcast6", aie2::mem_event_broadcast6},
+  {"mem_event_broadcast7", aie2::mem_event_broadcast7},
+  {"mem_event_broadcast8", aie2::mem_event_broadcast8},
+  {"mem_event_broadcast9", aie2::mem_event_broadcast9},
+  {"mem_event_broadcast_a_block_east_clr", aie2::mem_event_broadcast_a_block_east_clr},
+  {"mem_event_broadcast_a_block_east_set", aie2::mem_event_broadcast_a_block_east_set},
+  {"mem_event_broadcast_a_block_east_value", aie2::mem_event_broadcast_a_block_east_value},
+  {"mem_event_broadcast_a_block_north_clr", aie2::mem_event_broadcast_a_block_north_clr},
+  {"mem_event_broadcast_a_block_north_set", aie2::mem_event_broadcast_a_block_north_set},
+  {"mem_event_broadcast_a_block_north_value", aie2::mem_event_broadcast_a_block_north_value},
+  {"mem_event_broadcast_a_block_south_clr", aie2::mem_event_broadcast_a_block_south_clr},
+  {"mem_event_broadcast_a_block_south_set", aie2::mem_event_broadcast_a_block_south_set},
+  {"mem_event_broadcast_a_block_south_value", aie2::mem_event_broadcast_a_block_south_value},
+  {"mem_event_broadcast_a_block_west_clr", aie2::mem_event_broadcast_a_block_west_clr},
+  {"mem_event_broadcast_a_block_west_set", aie2::mem_event_broadcast_a_block_west_set},
+  {"mem_event_broadcast_a_block_west_value", aie2::mem_event_broadcast_a_block_west_value},
+  {"mem_event_broadcast_b_block_east_clr", aie2::mem_event_broadcast_b_block_east_clr},
+  {"mem_event_broadcast_b_block_east_set", aie2::mem_event_broadcast_b_block_east_set},
+  {"mem_event_broadcast_b_block_east_value", aie2::mem_event_broadcast_b_block_east_value},
+  {"mem_event_broadcast_b_block_north_clr", aie2::mem_event_broadcast_b_block_north_clr},
+  {"mem_event_broadcast_b_block_north_set", aie2::mem_event_broadcast_b_block_north_set},
+  {"mem_event_broadcast_b_block_north_value", aie2::mem_event_broadcast_b_block_north_value},
+  {"mem_event_broadcast_b_block_south_clr", aie2::mem_event_broadcast_b_block_south_clr},
+  {"mem_event_broadcast_b_block_south_set", aie2::mem_event_broadcast_b_block_south_set},
+  {"mem_event_broadcast_b_block_south_value", aie2::mem_event_broadcast_b_block_south_value},
+  {"mem_event_broadcast_b_block_west_clr", aie2::mem_event_broadcast_b_block_west_clr},
+  {"mem_event_broadcast_b_block_west_set", aie2::mem_event_broadcast_b_block_west_set},
+  {"mem_event_broadcast_b_block_west_value", aie2::mem_event_broadcast_b_block_west_value},
+  {"mem_event_generate", aie2::mem_event_generate},
+  {"mem_event_group_0_enable", aie2::mem_event_group_0_enable},
+  {"mem_event_group_broadcast_enable", aie2::mem_event_group_broadcast_enable},
+  {"mem_event_group_dma_enable", aie2::mem_event_group_dma_enable},
+  {"mem_event_group_error_enable", aie2::mem_event_group_error_enable},
+  {"mem_event_group_lock_enable", aie2::mem_event_group_lock_enable},
+  {"mem_event_group_memory_conflict_enable", aie2::mem_event_group_memory_conflict_enable},
+  {"mem_event_group_stream_switch_enable", aie2::mem_event_group_stream_switch_enable},
+  {"mem_event_group_user_event_enable", aie2::mem_event_group_user_event_enable},
+  {"mem_event_group_watchpoint_enable", aie2::mem_event_group_watchpoint_enable},
+  {"mem_event_status0", aie2::mem_event_status0},
+  {"mem_event_status1", aie2::mem_event_status1},
+  {"mem_event_status2", aie2::mem_event_status2},
+  {"mem_event_status3", aie2::mem_event_status3},
+  {"mem_event_status4", aie2::mem_event_status4},
+  {"mem_event_status5", aie2::mem_event_status5},
+  {"mem_lock0_value", aie2::mem_lock0_value},
+  {"mem_lock10_value", aie2::mem_lock10_value},
+  {"mem_lock11_value", aie2::mem_lock11_value},
+  {"mem_lock12_value", aie2::mem_lock12_value},
+  {"mem_lock13_value", aie2::mem_lock13_value},
+  {"mem_lock14_value", aie2::mem_lock14_value},
+  {"mem_lock15_value", aie2::mem_lock15_value},
+  {"mem_lock16_value", aie2::mem_lock16_value},
+  {"mem_lock17_value", aie2::mem_lock17_value},
+  {"mem_lock18_value", aie2::mem_lock18_value},
+  {"mem_lock19_value", aie2::mem_lock19_value},
+  {"mem_lock1_value", aie2::mem_lock1_value},
+  {"mem_lock20_value", aie2::mem_lock20_value},
+  {"mem_lock21_value", aie2::mem_lock21_value},
+  {"mem_lock22_value", aie2::mem_lock22_value},
+  {"mem_lock23_value", aie2::mem_lock23_value},
+  {"mem_lock24_value", aie2::mem_lock24_value},
+  {"mem_lock25_value", aie2::mem_lock25_value},
+  {"mem_lock26_value", aie2::mem_lock26_value},
+  {"mem_lock27_value", aie2::mem_lock27_value},
+  {"mem_lock28_value", aie2::mem_lock28_value},
+  {"mem_lock29_value", aie2::mem_lock29_value},
+  {"mem_lock2_value", aie2::mem_lock2_value},
+  {"mem_lock30_value", aie2::mem_lock30_value},
+  {"mem_lock31_value", aie2::mem_lock31_value},
+  {"mem_lock32_value", aie2::mem_lock32_value},
+  {"mem_lock33_value", aie2::mem_lock33_value},
+  {"mem_lock34_value", aie2::mem_lock34_value},
+  {"mem_lock35_value", aie2::mem_lock35_value},
+  {"mem_lock36_value", aie2::mem_lock36_value},
+  {"mem_lock37_value", aie2::mem_lock37_value},
+  {"mem_lock38_value", aie2::mem_lock38_value},
+  {"mem_lock39_value", aie2::mem_lock39_value},
+  {"mem_lock3_value", aie2::mem_lock3_value},
+  {"mem_lock40_value", aie2::mem_lock40_value},
+  {"mem_lock41_value", aie2::mem_lock41_value},
+  {"mem_lock42_value", aie2::mem_lock42_value},
+  {"mem_lock43_value", aie2::mem_lock43_value},
+  {"mem_lock44_value", aie2::mem_lock44_value},
+  {"mem_lock45_value", aie2::mem_lock45_value},
+  {"mem_lock46_value", aie2::mem_lock46_value},
+  {"mem_lock47_value", aie2::mem_lock47_value},
+  {"mem_lock48_value", aie2::mem_lock48_value},
+  {"mem_lock49_value", aie2::mem_lock49_value},
+  {"mem_lock4_value", aie2::mem_lock4_value},
+  {"mem_lock50_value", aie2::mem_lock50_value},
+  {"mem_lock51_value", aie2::mem_lock51_value},
+  {"mem_lock52_value", aie2::mem_lock52_value},
+  {"mem_lock53_value", aie2::mem_lock53_value},
+  {"mem_lock54_value", aie2::mem_lock54_value},
+  {"mem_lock55_value", aie2::mem_lock55_value},
+  {"mem_lock56_value", aie2::mem_lock56_value},
+  {"mem_lock57_value", aie2::mem_lock57_value},
+  {"mem_lock58_value", aie2::mem_lock58_value},
+  {"mem_lock59_value", aie2::mem_lock59_value},
+  {"mem_lock5_value", aie2::mem_lock5_value},
+  {"mem_lock60_value", aie2::mem_lock60_value},
+  {"mem_lock61_value", aie2::mem_lock61_value},
+  {"mem_lock62_value", aie2::mem_lock62_value},
+  {"mem_lock63_value", aie2::mem_lock63_value},
+  {"mem_lock6_value", aie2::mem_lock6_value},
+  {"mem_lock7_value", aie2::mem_lock7_value},
+  {"mem_lock8_value", aie2::mem_lock8_value},
+  {"mem_lock9_value", aie2::mem_lock9_value},
+  {"mem_lock_request", aie2::mem_lock_request},
+  {"mem_locks_event_selection_0", aie2::mem_locks_event_selection_0},
+  {"mem_locks_event_selection_1", aie2::mem_locks_event_selection_1},
+  {"mem_locks_event_selection_2", aie2::mem_locks_event_selection_2},
+  {"mem_locks_event_selection_3", aie2::mem_locks_event_selection_3},
+  {"mem_locks_event_selection_4", aie2::mem_locks_event_selection_4},
+  {"mem_locks_event_selection_5", aie2::mem_locks_event_selection_5},
+  {"mem_locks_event_selection_6", aie2::mem_locks_event_selection_6},
+  {"mem_locks_event_selection_7", aie2::mem_locks_event_selection_7},
+  {"mem_locks_overflow_0", aie2::mem_locks_overflow_0},
+  {"mem_locks_overflow_1", aie2::mem_locks_overflow_1},
+  {"mem_locks_underflow_0", aie2::mem_locks_underflow_0},
+  {"mem_locks_underflow_1", aie2::mem_locks_underflow_1},
+  {"mem_memory_control", aie2::mem_memory_control},
+  {"mem_module_clock_control", aie2::mem_module_clock_control},
+  {"mem_module_reset_control", aie2::mem_module_reset_control},
+  {"mem_performance_control0", aie2::mem_performance_control0},
+  {"mem_performance_control1", aie2::mem_performance_control1},
+  {"mem_performance_control2", aie2::mem_performance_control2},
+  {"mem_performance_counter0", aie2::mem_performance_counter0},
+  {"mem_performance_counter0_event_value", aie2::mem_performance_counter0_event_value},
+  {"mem_performance_counter1", aie2::mem_performance_counter1},
+  {"mem_performance_counter1_event_value", aie2::mem_performance_counter1_event_value},
+  {"mem_performance_counter2", aie2::mem_performance_counter2},
+  {"mem_performance_counter2_event_value", aie2::mem_performance_counter2_event_value},
+  {"mem_performance_counter3", aie2::mem_performance_counter3},
+  {"mem_performance_counter3_event_value", aie2::mem_performance_counter3_event_value},
+  {"mem_reserved0", aie2::mem_reserved0},
+  {"mem_reserved1", aie2::mem_reserved1},
+  {"mem_reserved2", aie2::mem_reserved2},
+  {"mem_reserved3", aie2::mem_reserved3},
+  {"mem_spare_reg", aie2::mem_spare_reg},
+  {"mem_stream_switch_adaptive_clock_gate_abort_period", aie2::mem_stream_switch_adaptive_clock_gate_abort_period},
+  {"mem_stream_switch_adaptive_clock_gate_status", aie2::mem_stream_switch_adaptive_clock_gate_status},
+  {"mem_stream_switch_deterministic_merge_arb0_ctrl", aie2::mem_stream_switch_deterministic_merge_arb0_ctrl},
+  {"mem_stream_switch_deterministic_merge_arb0_slave0_1", aie2::mem_stream_switch_deterministic_merge_arb0_slave0_1},
+  {"mem_stream_switch_deterministic_merge_arb0_slave2_3", aie2::mem_stream_switch_deterministic_merge_arb0_slave2_3},
+  {"mem_stream_switch_deterministic_merge_arb1_ctrl", aie2::mem_stream_switch_deterministic_merge_arb1_ctrl},
+  {"mem_stream_switch_deterministic_merge_arb1_slave0_1", aie2::mem_stream_switch_deterministic_merge_arb1_slave0_1},
+  {"mem_stream_switch_deterministic_merge_arb1_slave2_3", aie2::mem_stream_switch_deterministic_merge_arb1_slave2_3},
+  {"mem_stream_switch_event_port_selection_0", aie2::mem_stream_switch_event_port_selection_0},
+  {"mem_stream_switch_event_port_selection_1", aie2::mem_stream_switch_event_port_selection_1},
+  {"mem_stream_switch_master_config_dma0", aie2::mem_stream_switch_master_config_dma0},
+  {"mem_stream_switch_master_config_dma1", aie2::mem_stream_switch_master_config_dma1},
+  {"mem_stream_switch_master_config_dma2", aie2::mem_stream_switch_master_config_dma2},
+  {"mem_stream_switch_master_config_dma3", aie2::mem_stream_switch_master_config_dma3},
+  {"mem_stream_switch_master_config_dma4", aie2::mem_stream_switch_master_config_dma4},
+  {"mem_stream_switch_master_config_dma5", aie2::mem_stream_switch_master_config_dma5},
+  {"mem_stream_switch_master_config_north0", aie2::mem_stream_switch_master_config_north0},
+  {"mem_stream_switch_master_config_north1", aie2::mem_stream_switch_master_config_north1},
+  {"mem_stream_switch_master_config_north2", aie2::mem_stream_switch_master_config_north2},
+  {"mem_stream_switch_master_config_north3", aie2::mem_stream_switch_master_config_north3},
+  {"mem_stream_switch_master_config_north4", aie2::mem_stream_switch_master_config_north4},
+  {"mem_stream_switch_master_config_north5", aie2::mem_stream_switch_master_config_north5},
+  {"mem_stream_switch_master_config_south0", aie2::mem_stream_switch_master_config_south0},
+  {"mem_stream_switch_master_config_south1", aie2::mem_stream_switch_master_config_south1},
+  {"mem_stream_switch_master_config_south2", aie2::mem_stream_switch_master_config_south2},
+  {"mem_stream_switch_master_config_south3", aie2::mem_stream_switch_master_config_south3},
+  {"mem_stream_switch_master_config_tile_ctrl", aie2::mem_stream_switch_master_config_tile_ctrl},
+  {"mem_stream_switch_parity_injection", aie2::mem_stream_switch_parity_injection},
+  {"mem_stream_switch_parity_status", aie2::mem_stream_switch_parity_status},
+  {"mem_stream_switch_slave_config_dma_0", aie2::mem_stream_switch_slave_config_dma_0},
+  {"mem_stream_switch_slave_config_dma_1", aie2::mem_stream_switch_slave_config_dma_1},
+  {"mem_stream_switch_slave_config_dma_2", aie2::mem_stream_switch_slave_config_dma_2},
+  {"mem_stream_switch_slave_config_dma_3", aie2::mem_stream_switch_slave_config_dma_3},
+  {"mem_stream_switch_slave_config_dma_4", aie2::mem_stream_switch_slave_config_dma_4},
+  {"mem_stream_switch_slave_config_dma_5", aie2::mem_stream_switch_slave_config_dma_5},
+  {"mem_stream_switch_slave_config_north_0", aie2::mem_stream_switch_slave_config_north_0},
+  {"mem_stream_switch_slave_config_north_1", aie2::mem_stream_switch_slave_config_north_1},
+  {"mem_stream_switch_slave_config_north_2", aie2::mem_stream_switch_slave_config_north_2},
+  {"mem_stream_switch_slave_config_north_3", aie2::mem_stream_switch_slave_config_north_3},
+  {"mem_stream_switch_slave_config_south_0", aie2::mem_stream_switch_slave_config_south_0},
+  {"mem_stream_switch_slave_config_south_1", aie2::mem_stream_switch_slave_config_south_1},
+  {"mem_stream_switch_slave_config_south_2", aie2::mem_stream_switch_slave_config_south_2},
+  {"mem_stream_switch_slave_config_south_3", aie2::mem_stream_switch_slave_config_south_3},
+  {"mem_stream_switch_slave_config_south_4", aie2::mem_stream_switch_slave_config_south_4},
+  {"mem_stream_switch_slave_config_south_5", aie2::mem_stream_switch_slave_config_south_5},
+  {"mem_stream_switch_slave_config_tile_ctrl", aie2::mem_stream_switch_slave_config_tile_ctrl},
+  {"mem_stream_switch_slave_config_trace", aie2::mem_stream_switch_slave_config_trace},
+  {"mem_stream_switch_slave_dma_0_slot0", aie2::mem_stream_switch_slave_dma_0_slot0},
+  {"mem_stream_switch_slave_dma_0_slot1", aie2::mem_stream_switch_slave_dma_0_slot1},
+  {"mem_stream_switch_slave_dma_0_slot2", aie2::mem_stream_switch_slave_dma_0_slot2},
+  {"mem_stream_switch_slave_dma_0_slot3", aie2::mem_stream_switch_slave_dma_0_slot3},
+  {"mem_stream_switch_slave_dma_1_slot0", aie2::mem_stream_switch_slave_dma_1_slot0},
+  {"mem_stream_switch_slave_dma_1_slot1", aie2::mem_stream_switch_slave_dma_1_slot1},
+  {"mem_stream_switch_slave_dma_1_slot2", aie2::mem_stream_switch_slave_dma_1_slot2},
+  {"mem_stream_switch_slave_dma_1_slot3", aie2::mem_stream_switch_slave_dma_1_slot3},
+  {"mem_stream_switch_slave_dma_2_slot0", aie2::mem_stream_switch_slave_dma_2_slot0},
+  {"mem_stream_switch_slave_dma_2_slot1", aie2::mem_stream_switch_slave_dma_2_slot1},
+  {"mem_stream_switch_slave_dma_2_slot2", aie2::mem_stream_switch_slave_dma_2_slot2},
+  {"mem_stream_switch_slave_dma_2_slot3", aie2::mem_stream_switch_slave_dma_2_slot3},
+  {"mem_stream_switch_slave_dma_3_slot0", aie2::mem_stream_switch_slave_dma_3_slot0},
+  {"mem_stream_switch_slave_dma_3_slot1", aie2::mem_stream_switch_slave_dma_3_slot1},
+  {"mem_stream_switch_slave_dma_3_slot2", aie2::mem_stream_switch_slave_dma_3_slot2},
+  {"mem_stream_switch_slave_dma_3_slot3", aie2::mem_stream_switch_slave_dma_3_slot3},
+  {"mem_stream_switch_slave_dma_4_slot0", aie2::mem_stream_switch_slave_dma_4_slot0},
+  {"mem_stream_switch_slave_dma_4_slot1", aie2::mem_stream_switch_slave_dma_4_slot1},
+  {"mem_stream_switch_slave_dma_4_slot2", aie2::mem_stream_switch_slave_dma_4_slot2},
+  {"mem_stream_switch_slave_dma_4_slot3", aie2::mem_stream_switch_slave_dma_4_slot3},
+  {"mem_stream_switch_slave_dma_5_slot0", aie2::mem_stream_switch_slave_dma_5_slot0},
+  {"mem_stream_switch_slave_dma_5_slot1", aie2::mem_stream_switch_slave_dma_5_slot1},
+  {"mem_stream_switch_slave_dma_5_slot2", aie2::mem_stream_switch_slave_dma_5_slot2},
+  {"mem_stream_switch_slave_dma_5_slot3", aie2::mem_stream_switch_slave_dma_5_slot3},
+  {"mem_stream_switch_slave_north_0_slot0", aie2::mem_stream_switch_slave_north_0_slot0},
+  {"mem_stream_switch_slave_north_0_slot1", aie2::mem_stream_switch_slave_north_0_slot1},
+  {"mem_stream_switch_slave_north_0_slot2", aie2::mem_stream_switch_slave_north_0_slot2},
+  {"mem_stream_switch_slave_north_0_slot3", aie2::mem_stream_switch_slave_north_0_slot3},
+  {"mem_stream_switch_slave_north_1_slot0", aie2::mem_stream_switch_slave_north_1_slot0},
+  {"mem_stream_switch_slave_north_1_slot1", aie2::mem_stream_switch_slave_north_1_slot1},
+  {"mem_stream_switch_slave_north_1_slot2", aie2::mem_stream_switch_slave_north_1_slot2},
+  {"mem_stream_switch_slave_north_1_slot3", aie2::mem_stream_switch_slave_north_1_slot3},
+  {"mem_stream_switch_slave_north_2_slot0", aie2::mem_stream_switch_slave_north_2_slot0},
+  {"mem_stream_switch_slave_north_2_slot1", aie2::mem_stream_switch_slave_north_2_slot1},
+  {"mem_stream_switch_slave_north_2_slot2", aie2::mem_stream_switch_slave_north_2_slot2},
+  {"mem_stream_switch_slave_north_2_slot3", aie2::mem_stream_switch_slave_north_2_slot3},
+  {"mem_stream_switch_slave_north_3_slot0", aie2::mem_stream_switch_slave_north_3_slot0},
+  {"mem_stream_switch_slave_north_3_slot1", aie2::mem_stream_switch_slave_north_3_slot1},
+  {"mem_stream_switch_slave_north_3_slot2", aie2::mem_stream_switch_slave_north_3_slot2},
+  {"mem_stream_switch_slave_north_3_slot3", aie2::mem_stream_switch_slave_north_3_slot3},
+  {"mem_stream_switch_slave_south_0_slot0", aie2::mem_stream_switch_slave_south_0_slot0},
+  {"mem_stream_switch_slave_south_0_slot1", aie2::mem_stream_switch_slave_south_0_slot1},
+  {"mem_stream_switch_slave_south_0_slot2", aie2::mem_stream_switch_slave_south_0_slot2},
+  {"mem_stream_switch_slave_south_0_slot3", aie2::mem_stream_switch_slave_south_0_slot3},
+  {"mem_stream_switch_slave_south_1_slot0", aie2::mem_stream_switch_slave_south_1_slot0},
+  {"mem_stream_switch_slave_south_1_slot1", aie2::mem_stream_switch_slave_south_1_slot1},
+  {"mem_stream_switch_slave_south_1_slot2", aie2::mem_stream_switch_slave_south_1_slot2},
+  {"mem_stream_switch_slave_south_1_slot3", aie2::mem_stream_switch_slave_south_1_slot3},
+  {"mem_stream_switch_slave_south_2_slot0", aie2::mem_stream_switch_slave_south_2_slot0},
+  {"mem_stream_switch_slave_south_2_slot1", aie2::mem_stream_switch_slave_south_2_slot1},
+  {"mem_stream_switch_slave_south_2_slot2", aie2::mem_stream_switch_slave_south_2_slot2},
+  {"mem_stream_switch_slave_south_2_slot3", aie2::mem_stream_switch_slave_south_2_slot3},
+  {"mem_stream_switch_slave_south_3_slot0", aie2::mem_stream_switch_slave_south_3_slot0},
+  {"mem_stream_switch_slave_south_3_slot1", aie2::mem_stream_switch_slave_south_3_slot1},
+  {"mem_stream_switch_slave_south_3_slot2", aie2::mem_stream_switch_slave_south_3_slot2},
+  {"mem_stream_switch_slave_south_3_slot3", aie2::mem_stream_switch_slave_south_3_slot3},
+  {"mem_stream_switch_slave_south_4_slot0", aie2::mem_stream_switch_slave_south_4_slot0},
+  {"mem_stream_switch_slave_south_4_slot1", aie2::mem_stream_switch_slave_south_4_slot1},
+  {"mem_stream_switch_slave_south_4_slot2", aie2::mem_stream_switch_slave_south_4_slot2},
+  {"mem_stream_switch_slave_south_4_slot3", aie2::mem_stream_switch_slave_south_4_slot3},
+  {"mem_stream_switch_slave_south_5_slot0", aie2::mem_stream_switch_slave_south_5_slot0},
+  {"mem_stream_switch_slave_south_5_slot1", aie2::mem_stream_switch_slave_south_5_slot1},
+  {"mem_stream_switch_slave_south_5_slot2", aie2::mem_stream_switch_slave_south_5_slot2},
+  {"mem_stream_switch_slave_south_5_slot3", aie2::mem_stream_switch_slave_south_5_slot3},
+  {"mem_stream_switch_slave_tile_ctrl_slot0", aie2::mem_stream_switch_slave_tile_ctrl_slot0},
+  {"mem_stream_switch_slave_tile_ctrl_slot1", aie2::mem_stream_switch_slave_tile_ctrl_slot1},
+  {"mem_stream_switch_slave_tile_ctrl_slot2", aie2::mem_stream_switch_slave_tile_ctrl_slot2},
+  {"mem_stream_switch_slave_tile_ctrl_slot3", aie2::mem_stream_switch_slave_tile_ctrl_slot3},
+  {"mem_stream_switch_slave_trace_slot0", aie2::mem_stream_switch_slave_trace_slot0},
+  {"mem_stream_switch_slave_trace_slot1", aie2::mem_stream_switch_slave_trace_slot1},
+  {"mem_stream_switch_slave_trace_slot2", aie2::mem_stream_switch_slave_trace_slot2},
+  {"mem_stream_switch_slave_trace_slot3", aie2::mem_stream_switch_slave_trace_slot3},
+  {"mem_tile_control", aie2::mem_tile_control},
+  {"mem_tile_control_packet_handler_status", aie2::mem_tile_control_packet_handler_status},
+  {"mem_timer_control", aie2::mem_timer_control},
+  {"mem_timer_high", aie2::mem_timer_high},
+  {"mem_timer_low", aie2::mem_timer_low},
+  {"mem_timer_trig_event_high_value", aie2::mem_timer_trig_event_high_value},
+  {"mem_timer_trig_event_low_value", aie2::mem_timer_trig_event_low_value},
+  {"mem_trace_control0", aie2::mem_trace_control0},
+  {"mem_trace_control1", aie2::mem_trace_control1},
+  {"mem_trace_event0", aie2::mem_trace_event0},
+  {"mem_trace_event1", aie2::mem_trace_event1},
+  {"mem_trace_status", aie2::mem_trace_status},
+  {"mem_watchpoint0", aie2::mem_watchpoint0},
+  {"mem_watchpoint1", aie2::mem_watchpoint1},
+  {"mem_watchpoint2", aie2::mem_watchpoint2},
+  {"mem_watchpoint3", aie2::mem_watchpoint3},
+  {"mm_checkbit_error_generation", aie2::mm_checkbit_error_generation},
+  {"mm_combo_event_control", aie2::mm_combo_event_control},
+  {"mm_combo_event_inputs", aie2::mm_combo_event_inputs},
+  {"mm_dma_bd0_0", aie2::mm_dma_bd0_0},
+  {"mm_dma_bd0_1", aie2::mm_dma_bd0_1},
+  {"mm_dma_bd0_2", aie2::mm_dma_bd0_2},
+  {"mm_dma_bd0_3", aie2::mm_dma_bd0_3},
+  {"mm_dma_bd0_4", aie2::mm_dma_bd0_4},
+  {"mm_dma_bd0_5", aie2::mm_dma_bd0_5},
+  {"mm_dma_bd10_0", aie2::mm_dma_bd10_0},
+  {"mm_dma_bd10_1", aie2::mm_dma_bd10_1},
+  {"mm_dma_bd10_2", aie2::mm_dma_bd10_2},
+  {"mm_dma_bd10_3", aie2::mm_dma_bd10_3},
+  {"mm_dma_bd10_4", aie2::mm_dma_bd10_4},
+  {"mm_dma_bd10_5", aie2::mm_dma_bd10_5},
+  {"mm_dma_bd11_0", aie2::mm_dma_bd11_0},
+  {"mm_dma_bd11_1", aie2::mm_dma_bd11_1},
+  {"mm_dma_bd11_2", aie2::mm_dma_bd11_2},
+  {"mm_dma_bd11_3", aie2::mm_dma_bd11_3},
+  {"mm_dma_bd11_4", aie2::mm_dma_bd11_4},
+  {"mm_dma_bd11_5", aie2::mm_dma_bd11_5},
+  {"mm_dma_bd12_0", aie2::mm_dma_bd12_0},
+  {"mm_dma_bd12_1", aie2::mm_dma_bd12_1},
+  {"mm_dma_bd12_2", aie2::mm_dma_bd12_2},
+  {"mm_dma_bd12_3", aie2::mm_dma_bd12_3},
+  {"mm_dma_bd12_4", aie2::mm_dma_bd12_4},
+  {"mm_dma_bd12_5", aie2::mm_dma_bd12_5},
+  {"mm_dma_bd13_0", aie2::mm_dma_bd13_0},
+  {"mm_dma_bd13_1", aie2::mm_dma_bd13_1},
+  {"mm_dma_bd13_2", aie2::mm_dma_bd13_2},
+  {"mm_dma_bd13_3", aie2::mm_dma_bd13_3},
+  {"mm_dma_bd13_4", aie2::mm_dma_bd13_4},
+  {"mm_dma_bd13_5", aie2::mm_dma_bd13_5},
+  {"mm_dma_bd14_0", aie2::mm_dma_bd14_0},
+  {"mm_dma_bd14_1", aie2::mm_dma_bd14_1},
+  {"mm_dma_bd14_2", aie2::mm_dma_bd14_2},
+  {"mm_dma_bd14_3", aie2::mm_dma_bd14_3},
+  {"mm_dma_bd14_4", aie2::mm_dma_bd14_4},
+  {"mm_dma_bd14_5", aie2::mm_dma_bd14_5},
+  {"mm_dma_bd15_0", aie2::mm_dma_bd15_0},
+  {"mm_dma_bd15_1", aie2::mm_dma_bd15_1},
+  {"mm_dma_bd15_2", aie2::mm_dma_bd15_2},
+  {"mm_dma_bd15_3", aie2::mm_dma_bd15_3},
+  {"mm_dma_bd15_4", aie2::mm_dma_bd15_4},
+  {"mm_dma_bd15_5", aie2::mm_dma_bd15_5},
+  {"mm_dma_bd1_0", aie2::mm_dma_bd1_0},
+  {"mm_dma_bd1_1", aie2::mm_dma_bd1_1},
+  {"mm_dma_bd1_2", aie2::mm_dma_bd1_2},
+  {"mm_dma_bd1_3", aie2::mm_dma_bd1_3},
+  {"mm_dma_bd1_4", aie2::mm_dma_bd1_4},
+  {"mm_dma_bd1_5", aie2::mm_dma_bd1_5},
+  {"mm_dma_bd2_0", aie2::mm_dma_bd2_0},
+  {"mm_dma_bd2_1", aie2::mm_dma_bd2_1},
+  {"mm_dma_bd2_2", aie2::mm_dma_bd2_2},
+  {"mm_dma_bd2_3", aie2::mm_dma_bd2_3},
+  {"mm_dma_bd2_4", aie2::mm_dma_bd2_4},
+  {"mm_dma_bd2_5", aie2::mm_dma_bd2_5},
+  {"mm_dma_bd3_0", aie2::mm_dma_bd3_0},
+  {"mm_dma_bd3_1", aie2::mm_dma_bd3_1},
+  {"mm_dma_bd3_2", aie2::mm_dma_bd3_2},
+  {"mm_dma_bd3_3", aie2::mm_dma_bd3_3},
+  {"mm_dma_bd3_4", aie2::mm_dma_bd3_4},
+  {"mm_dma_bd3_5", aie2::mm_dma_bd3_5},
+  {"mm_dma_bd4_0", aie2::mm_dma_bd4_0},
+  {"mm_dma_bd4_1", aie2::mm_dma_bd4_1},
+  {"mm_dma_bd4_2", aie2::mm_dma_bd4_2},
+  {"mm_dma_bd4_3", aie2::mm_dma_bd4_3},
+  {"mm_dma_bd4_4", aie2::mm_dma_bd4_4},
+  {"mm_dma_bd4_5", aie2::mm_dma_bd4_5},
+  {"mm_dma_bd5_0", aie2::mm_dma_bd5_0},
+  {"mm_dma_bd5_1", aie2::mm_dma_bd5_1},
+  {"mm_dma_bd5_2", aie2::mm_dma_bd5_2},
+  {"mm_dma_bd5_3", aie2::mm_dma_bd5_3},
+  {"mm_dma_bd5_4", aie2::mm_dma_bd5_4},
+  {"mm_dma_bd5_5", aie2::mm_dma_bd5_5},
+  {"mm_dma_bd6_0", aie2::mm_dma_bd6_0},
+  {"mm_dma_bd6_1", aie2::mm_dma_bd6_1},
+  {"mm_dma_bd6_2", aie2::mm_dma_bd6_2},
+  {"mm_dma_bd6_3", aie2::mm_dma_bd6_3},
+  {"mm_dma_bd6_4", aie2::mm_dma_bd6_4},
+  {"mm_dma_bd6_5", aie2::mm_dma_bd6_5},
+  {"mm_dma_bd7_0", aie2::mm_dma_bd7_0},
+  {"mm_dma_bd7_1", aie2::mm_dma_bd7_1},
+  {"mm_dma_bd7_2", aie2::mm_dma_bd7_2},
+  {"mm_dma_bd7_3", aie2::mm_dma_bd7_3},
+  {"mm_dma_bd7_4", aie2::mm_dma_bd7_4},
+  {"mm_dma_bd7_5", aie2::mm_dma_bd7_5},
+  {"mm_dma_bd8_0", aie2::mm_dma_bd8_0},
+  {"mm_dma_bd8_1", aie2::mm_dma_bd8_1},
+  {"mm_dma_bd8_2", aie2::mm_dma_bd8_2},
+  {"mm_dma_bd8_3", aie2::mm_dma_bd8_3},
+  {"mm_dma_bd8_4", aie2::mm_dma_bd8_4},
+  {"mm_dma_bd8_5", aie2::mm_dma_bd8_5},
+  {"mm_dma_bd9_0", aie2::mm_dma_bd9_0},
+  {"mm_dma_bd9_1", aie2::mm_dma_bd9_1},
+  {"mm_dma_bd9_2", aie2::mm_dma_bd9_2},
+  {"mm_dma_bd9_3", aie2::mm_dma_bd9_3},
+  {"mm_dma_bd9_4", aie2::mm_dma_bd9_4},
+  {"mm_dma_bd9_5", aie2::mm_dma_bd9_5},
+  {"mm_dma_mm2s_0_ctrl", aie2::mm_dma_mm2s_0_ctrl},
+  {"mm_dma_mm2s_0_start_queue", aie2::mm_dma_mm2s_0_start_queue},
+  {"mm_dma_mm2s_1_ctrl", aie2::mm_dma_mm2s_1_ctrl},
+  {"mm_dma_mm2s_1_start_queue", aie2::mm_dma_mm2s_1_start_queue},
+  {"mm_dma_mm2s_status_0", aie2::mm_dma_mm2s_status_0},
+  {"mm_dma_mm2s_status_1", aie2::mm_dma_mm2s_status_1},
+  {"mm_dma_s2mm_0_ctrl", aie2::mm_dma_s2mm_0_ctrl},
+  {"mm_dma_s2mm_0_start_queue", aie2::mm_dma_s2mm_0_start_queue},
+  {"mm_dma_s2mm_1_ctrl", aie2::mm_dma_s2mm_1_ctrl},
+  {"mm_dma_s2mm_1_start_queue", aie2::mm_dma_s2mm_1_start_queue},
+  {"mm_dma_s2mm_current_write_count_0", aie2::mm_dma_s2mm_current_write_count_0},
+  {"mm_dma_s2mm_current_write_count_1", aie2::mm_dma_s2mm_current_write_count_1},
+  {"mm_dma_s2mm_fot_count_fifo_pop_0", aie2::mm_dma_s2mm_fot_count_fifo_pop_0},
+  {"mm_dma_s2mm_fot_count_fifo_pop_1", aie2::mm_dma_s2mm_fot_count_fifo_pop_1},
+  {"mm_dma_s2mm_status_0", aie2::mm_dma_s2mm_status_0},
+  {"mm_dma_s2mm_status_1", aie2::mm_dma_s2mm_status_1},
+  {"mm_ecc_failing_address", aie2::mm_ecc_failing_address},
+  {"mm_ecc_scrubbing_event", aie2::mm_ecc_scrubbing_event},
+  {"mm_edge_detection_event_control", aie2::mm_edge_detection_event_control},
+  {"mm_event_broadcast0", aie2::mm_event_broadcast0},
+  {"mm_event_broadcast1", aie2::mm_event_broadcast1},
+  {"mm_event_broadcast10", aie2::mm_event_broadcast10},
+  {"mm_event_broadcast11", aie2::mm_event_broadcast11},
+  {"mm_event_broadcast12", aie2::mm_event_broadcast12},
+  {"mm_event_broadcast13", aie2::mm_event_broadcast13},
+  {"mm_event_broadcast14", aie2::mm_event_broadcast14},
+  {"mm_event_broadcast15", aie2::mm_event_broadcast15},
+  {"mm_event_broadcast2", aie2::mm_event_broadcast2},
+  {"mm_event_broadcast3", aie2::mm_event_broadcast3},
+  {"mm_event_broadcast4", aie2::mm_event_broadcast4},
+  {"mm_event_broadcast5", aie2::mm_event_broadcast5},
+  {"mm_event_broadcast6", aie2::mm_event_broadcast6},
+  {"mm_event_broadcast7", aie2::mm_event_broadcast7},
+  {"mm_event_broadcast8", aie2::mm_event_broadcast8},
+  {"mm_event_broadcast9", aie2::mm_event_broadcast9},
+  {"mm_event_broadcast_block_east_clr", aie2::mm_event_broadcast_block_east_clr},
+  {"mm_event_broadcast_block_east_set", aie2::mm_event_broadcast_block_east_set},
+  {"mm_event_broadcast_block_east_value", aie2::mm_event_broadcast_block_east_value},
+  {"mm_event_broadcast_block_north_clr", aie2::mm_event_broadcast_block_north_clr},
+  {"mm_event_broadcast_block_north_set", aie2::mm_event_broadcast_block_north_set},
+  {"mm_event_broadcast_block_north_value", aie2::mm_event_broadcast_block_north_value},
+  {"mm_event_broadcast_block_south_clr", aie2::mm_event_broadcast_block_south_clr},
+  {"mm_event_broadcast_block_south_set", aie2::mm_event_broadcast_block_south_set},
+  {"mm_event_broadcast_block_south_value", aie2::mm_event_broadcast_block_south_value},
+  {"mm_event_broadcast_block_west_clr", aie2::mm_event_broadcast_block_west_clr},
+  {"mm_event_broadcast_block_west_set", aie2::mm_event_broadcast_block_west_set},
+  {"mm_event_broadcast_block_west_value", aie2::mm_event_broadcast_block_west_value},
+  {"mm_event_generate", aie2::mm_event_generate},
+  {"mm_event_group_0_enable", aie2::mm_event_group_0_enable},
+  {"mm_event_group_broadcast_enable", aie2::mm_event_group_broadcast_enable},
+  {"mm_event_group_dma_enable", aie2::mm_event_group_dma_enable},
+  {"mm_event_group_error_enable", aie2::mm_event_group_error_enable},
+  {"mm_event_group_lock_enable", aie2::mm_event_group_lock_enable},
+  {"mm_event_group_memory_conflict_enable", aie2::mm_event_group_memory_conflict_enable},
+  {"mm_event_group_user_event_enable", aie2::mm_event_group_user_event_enable},
+  {"mm_event_group_watchpoint_enable", aie2::mm_event_group_watchpoint_enable},
+  {"mm_event_status0", aie2::mm_event_status0},
+  {"mm_event_status1", aie2::mm_event_status1},
+  {"mm_event_status2", aie2::mm_event_status2},
+  {"mm_event_status3", aie2::mm_event_status3},
+  {"mm_lock0_value", aie2::mm_lock0_value},
+  {"mm_lock10_value", aie2::mm_lock10_value},
+  {"mm_lock11_value", aie2::mm_lock11_value},
+  {"mm_lock12_value", aie2::mm_lock12_value},
+  {"mm_lock13_value", aie2::mm_lock13_value},
+  {"mm_lock14_value", aie2::mm_lock14_value},
+  {"mm_lock15_value", aie2::mm_lock15_value},
+  {"mm_lock1_value", aie2::mm_lock1_value},
+  {"mm_lock2_value", aie2::mm_lock2_value},
+  {"mm_lock3_value", aie2::mm_lock3_value},
+  {"mm_lock4_value", aie2::mm_lock4_value},
+  {"mm_lock5_value", aie2::mm_lock5_value},
+  {"mm_lock6_value", aie2::mm_lock6_value},
+  {"mm_lock7_value", aie2::mm_lock7_value},
+  {"mm_lock8_value", aie2::mm_lock8_value},
+  {"mm_lock9_value", aie2::mm_lock9_value},
+  {"mm_lock_request", aie2::mm_lock_request},
+  {"mm_locks_event_selection_0", aie2::mm_locks_event_selection_0},
+  {"mm_locks_event_selection_1", aie2::mm_locks_event_selection_1},
+  {"mm_locks_event_selection_2", aie2::mm_locks_event_selection_2},
+  {"mm_locks_event_selection_3", aie2::mm_locks_event_selection_3},
+  {"mm_locks_event_selection_4", aie2::mm_locks_event_selection_4},
+  {"mm_locks_event_selection_5", aie2::mm_locks_event_selection_5},
+  {"mm_locks_event_selection_6", aie2::mm_locks_event_selection_6},
+  {"mm_locks_event_selection_7", aie2::mm_locks_event_selection_7},
+  {"mm_locks_overflow", aie2::mm_locks_overflow},
+  {"mm_locks_underflow", aie2::mm_locks_underflow},
+  {"mm_memory_control", aie2::mm_memory_control},
+  {"mm_parity_failing_address", aie2::mm_parity_failing_address},
+  {"mm_performance_control0", aie2::mm_performance_control0},
+  {"mm_performance_control1", aie2::mm_performance_control1},
+  {"mm_performance_counter0", aie2::mm_performance_counter0},
+  {"mm_performance_counter0_event_value", aie2::mm_performance_counter0_event_value},
+  {"mm_performance_counter1", aie2::mm_performance_counter1},
+  {"mm_performance_counter1_event_value", aie2::mm_performance_counter1_event_value},
+  {"mm_reserved0", aie2::mm_reserved0},
+  {"mm_reserved1", aie2::mm_reserved1},
+  {"mm_reserved2", aie2::mm_reserved2},
+  {"mm_reserved3", aie2::mm_reserved3},
+  {"mm_spare_reg", aie2::mm_spare_reg},
+  {"mm_timer_control", aie2::mm_timer_control},
+  {"mm_timer_high", aie2::mm_timer_high},
+  {"mm_timer_low", aie2::mm_timer_low},
+  {"mm_timer_trig_event_high_value", aie2::mm_timer_trig_event_high_value},
+  {"mm_timer_trig_event_low_value", aie2::mm_timer_trig_event_low_value},
+  {"mm_trace_control0", aie2::mm_trace_control0},
+  {"mm_trace_control1", aie2::mm_trace_control1},
+  {"mm_trace_event0", aie2::mm_trace_event0},
+  {"mm_trace_event1", aie2::mm_trace_event1},
+  {"mm_trace_status", aie2::mm_trace_status},
+  {"mm_watchpoint0", aie2::mm_watchpoint0},
+  {"mm_watchpoint1", aie2::mm_watchpoint1},
+  {"shim_dma_bd0_0", aie2::shim_dma_bd0_0},
+  {"shim_dma_bd0_1", aie2::shim_dma_bd0_1},
+  {"shim_dma_bd0_2", aie2::shim_dma_bd0_2},
+  {"shim_dma_bd0_3", aie2::shim_dma_bd0_3},
+  {"shim_dma_bd0_4", aie2::shim_dma_bd0_4},
+  {"shim_dma_bd0_5", aie2::shim_dma_bd0_5},
+  {"shim_dma_bd0_6", aie2::shim_dma_bd0_6},
+  {"shim_dma_bd0_7", aie2::shim_dma_bd0_7},
+  {"shim_dma_bd10_0", aie2::shim_dma_bd10_0},
+  {"shim_dma_bd10_1", aie2::shim_dma_bd10_1},
+  {"shim_dma_bd10_2", aie2::shim_dma_bd10_2},
+  {"shim_dma_bd10_3", aie2::shim_dma_bd10_3},
+  {"shim_dma_bd10_4", aie2::shim_dma_bd10_4},
+  {"shim_dma_bd10_5", aie2::shim_dma_bd10_5},
+  {"shim_dma_bd10_6", aie2::shim_dma_bd10_6},
+  {"shim_dma_bd10_7", aie2::shim_dma_bd10_7},
+  {"shim_dma_bd11_0", aie2::shim_dma_bd11_0},
+  {"shim_dma_bd11_1", aie2::shim_dma_bd11_1},
+  {"shim_dma_bd11_2", aie2::shim_dma_bd11_2},
+  {"shim_dma_bd11_3", aie2::shim_dma_bd11_3},
+  {"shim_dma_bd11_4", aie2::shim_dma_bd11_4},
+  {"shim_dma_bd11_5", aie2::shim_dma_bd11_5},
+  {"shim_dma_bd11_6", aie2::shim_dma_bd11_6},
+  {"shim_dma_bd11_7", aie2::shim_dma_bd11_7},
+  {"shim_dma_bd12_0", aie2::shim_dma_bd12_0},
+  {"shim_dma_bd12_1", aie2::shim_dma_bd12_1},
+  {"shim_dma_bd12_2", aie2::shim_dma_bd12_2},
+  {"shim_dma_bd12_3", aie2::shim_dma_bd12_3},
+  {"shim_dma_bd12_4", aie2::shim_dma_bd12_4},
+  {"shim_dma_bd12_5", aie2::shim_dma_bd12_5},
+  {"shim_dma_bd12_6", aie2::shim_dma_bd12_6},
+  {"shim_dma_bd12_7", aie2::shim_dma_bd12_7},
+  {"shim_dma_bd13_0", aie2::shim_dma_bd13_0},
+  {"shim_dma_bd13_1", aie2::shim_dma_bd13_1},
+  {"shim_dma_bd13_2", aie2::shim_dma_bd13_2},
+  {"shim_dma_bd13_3", aie2::shim_dma_bd13_3},
+  {"shim_dma_bd13_4", aie2::shim_dma_bd13_4},
+  {"shim_dma_bd13_5", aie2::shim_dma_bd13_5},
+  {"shim_dma_bd13_6", aie2::shim_dma_bd13_6},
+  {"shim_dma_bd13_7", aie2::shim_dma_bd13_7},
+  {"shim_dma_bd14_0", aie2::shim_dma_bd14_0},
+  {"shim_dma_bd14_1", aie2::shim_dma_bd14_1},
+  {"shim_dma_bd14_2", aie2::shim_dma_bd14_2},
+  {"shim_dma_bd14_3", aie2::shim_dma_bd14_3},
+  {"shim_dma_bd14_4", aie2::shim_dma_bd14_4},
+  {"shim_dma_bd14_5", aie2::shim_dma_bd14_5},
+  {"shim_dma_bd14_6", aie2::shim_dma_bd14_6},
+  {"shim_dma_bd14_7", aie2::shim_dma_bd14_7},
+  {"shim_dma_bd15_0", aie2::shim_dma_bd15_0},
+  {"shim_dma_bd15_1", aie2::shim_dma_bd15_1},
+  {"shim_dma_bd15_2", aie2::shim_dma_bd15_2},
+  {"shim_dma_bd15_3", aie2::shim_dma_bd15_3},
+  {"shim_dma_bd15_4", aie2::shim_dma_bd15_4},
+  {"shim_dma_bd15_5", aie2::shim_dma_bd15_5},
+  {"shim_dma_bd15_6", aie2::shim_dma_bd15_6},
+  {"shim_dma_bd15_7", aie2::shim_dma_bd15_7},
+  {"shim_dma_bd1_0", aie2::shim_dma_bd1_0},
+  {"shim_dma_bd1_1", aie2::shim_dma_bd1_1},
+  {"shim_dma_bd1_2", aie2::shim_dma_bd1_2},
+  {"shim_dma_bd1_3", aie2::shim_dma_bd1_3},
+  {"shim_dma_bd1_4", aie2::shim_dma_bd1_4},
+  {"shim_dma_bd1_5", aie2::shim_dma_bd1_5},
+  {"shim_dma_bd1_6", aie2::shim_dma_bd1_6},
+  {"shim_dma_bd1_7", aie2::shim_dma_bd1_7},
+  {"shim_dma_bd2_0", aie2::shim_dma_bd2_0},
+  {"shim_dma_bd2_1", aie2::shim_dma_bd2_1},
+  {"shim_dma_bd2_2", aie2::shim_dma_bd2_2},
+  {"shim_dma_bd2_3", aie2::shim_dma_bd2_3},
+  {"shim_dma_bd2_4", aie2::shim_dma_bd2_4},
+  {"shim_dma_bd2_5", aie2::shim_dma_bd2_5},
+  {"shim_dma_bd2_6", aie2::shim_dma_bd2_6},
+  {"shim_dma_bd2_7", aie2::shim_dma_bd2_7},
+  {"shim_dma_bd3_0", aie2::shim_dma_bd3_0},
+  {"shim_dma_bd3_1", aie2::shim_dma_bd3_1},
+  {"shim_dma_bd3_2", aie2::shim_dma_bd3_2},
+  {"shim_dma_bd3_3", aie2::shim_dma_bd3_3},
+  {"shim_dma_bd3_4", aie2::shim_dma_bd3_4},
+  {"shim_dma_bd3_5", aie2::shim_dma_bd3_5},
+  {"shim_dma_bd3_6", aie2::shim_dma_bd3_6},
+  {"shim_dma_bd3_7", aie2::shim_dma_bd3_7},
+  {"shim_dma_bd4_0", aie2::shim_dma_bd4_0},
+  {"shim_dma_bd4_1", aie2::shim_dma_bd4_1},
+  {"shim_dma_bd4_2", aie2::shim_dma_bd4_2},
+  {"shim_dma_bd4_3", aie2::shim_dma_bd4_3},
+  {"shim_dma_bd4_4", aie2::shim_dma_bd4_4},
+  {"shim_dma_bd4_5", aie2::shim_dma_bd4_5},
+  {"shim_dma_bd4_6", aie2::shim_dma_bd4_6},
+  {"shim_dma_bd4_7", aie2::shim_dma_bd4_7},
+  {"shim_dma_bd5_0", aie2::shim_dma_bd5_0},
+  {"shim_dma_bd5_1", aie2::shim_dma_bd5_1},
+  {"shim_dma_bd5_2", aie2::shim_dma_bd5_2},
+  {"shim_dma_bd5_3", aie2::shim_dma_bd5_3},
+  {"shim_dma_bd5_4", aie2::shim_dma_bd5_4},
+  {"shim_dma_bd5_5", aie2::shim_dma_bd5_5},
+  {"shim_dma_bd5_6", aie2::shim_dma_bd5_6},
+  {"shim_dma_bd5_7", aie2::shim_dma_bd5_7},
+  {"shim_dma_bd6_0", aie2::shim_dma_bd6_0},
+  {"shim_dma_bd6_1", aie2::shim_dma_bd6_1},
+  {"shim_dma_bd6_2", aie2::shim_dma_bd6_2},
+  {"shim_dma_bd6_3", aie2::shim_dma_bd6_3},
+  {"shim_dma_bd6_4", aie2::shim_dma_bd6_4},
+  {"shim_dma_bd6_5", aie2::shim_dma_bd6_5},
+  {"shim_dma_bd6_6", aie2::shim_dma_bd6_6},
+  {"shim_dma_bd6_7", aie2::shim_dma_bd6_7},
+  {"shim_dma_bd7_0", aie2::shim_dma_bd7_0},
+  {"shim_dma_bd7_1", aie2::shim_dma_bd7_1},
+  {"shim_dma_bd7_2", aie2::shim_dma_bd7_2},
+  {"shim_dma_bd7_3", aie2::shim_dma_bd7_3},
+  {"shim_dma_bd7_4", aie2::shim_dma_bd7_4},
+  {"shim_dma_bd7_5", aie2::shim_dma_bd7_5},
+  {"shim_dma_bd7_6", aie2::shim_dma_bd7_6},
+  {"shim_dma_bd7_7", aie2::shim_dma_bd7_7},
+  {"shim_dma_bd8_0", aie2::shim_dma_bd8_0},
+  {"shim_dma_bd8_1", aie2::shim_dma_bd8_1},
+  {"shim_dma_bd8_2", aie2::shim_dma_bd8_2},
+  {"shim_dma_bd8_3", aie2::shim_dma_bd8_3},
+  {"shim_dma_bd8_4", aie2::shim_dma_bd8_4},
+  {"shim_dma_bd8_5", aie2::shim_dma_bd8_5},
+  {"shim_dma_bd8_6", aie2::shim_dma_bd8_6},
+  {"shim_dma_bd8_7", aie2::shim_dma_bd8_7},
+  {"shim_dma_bd9_0", aie2::shim_dma_bd9_0},
+  {"shim_dma_bd9_1", aie2::shim_dma_bd9_1},
+  {"shim_dma_bd9_2", aie2::shim_dma_bd9_2},
+  {"shim_dma_bd9_3", aie2::shim_dma_bd9_3},
+  {"shim_dma_bd9_4", aie2::shim_dma_bd9_4},
+  {"shim_dma_bd9_5", aie2::shim_dma_bd9_5},
+  {"shim_dma_bd9_6", aie2::shim_dma_bd9_6},
+  {"shim_dma_bd9_7", aie2::shim_dma_bd9_7},
+  {"shim_dma_bd_step_size", aie2::shim_dma_bd_step_size},
+  {"shim_dma_mm2s_status_0", aie2::shim_dma_mm2s_status_0},
+  {"shim_dma_mm2s_status_1", aie2::shim_dma_mm2s_status_1},
+  {"shim_dma_s2mm_0_ctrl", aie2::shim_dma_s2mm_0_ctrl},
+  {"shim_dma_s2mm_0_task_queue", aie2::shim_dma_s2mm_0_task_queue},
+  {"shim_dma_s2mm_status_0", aie2::shim_dma_s2mm_status_0},
+  {"shim_dma_s2mm_status_1", aie2::shim_dma_s2mm_status_1},
+  {"shim_dma_s2mm_step_size", aie2::shim_dma_s2mm_step_size},
+  {"shim_event_broadcast_a_0", aie2::shim_event_broadcast_a_0},
+  {"shim_event_broadcast_a_1", aie2::shim_event_broadcast_a_1},
+  {"shim_event_broadcast_a_10", aie2::shim_event_broadcast_a_10},
+  {"shim_event_broadcast_a_11", aie2::shim_event_broadcast_a_11},
+  {"shim_event_broadcast_a_12", aie2::shim_event_broadcast_a_12},
+  {"shim_event_broadcast_a_13", aie2::shim_event_broadcast_a_13},
+  {"shim_event_broadcast_a_14", aie2::shim_event_broadcast_a_14},
+  {"shim_event_broadcast_a_15", aie2::shim_event_broadcast_a_15},
+  {"shim_event_broadcast_a_2", aie2::shim_event_broadcast_a_2},
+  {"shim_event_broadcast_a_3", aie2::shim_event_broadcast_a_3},
+  {"shim_event_broadcast_a_4", aie2::shim_event_broadcast_a_4},
+  {"shim_event_broadcast_a_5", aie2::shim_event_broadcast_a_5},
+  {"shim_event_broadcast_a_6", aie2::shim_event_broadcast_a_6},
+  {"shim_event_broadcast_a_7", aie2::shim_event_broadcast_a_7},
+  {"shim_event_broadcast_a_8", aie2::shim_event_broadcast_a_8},
+  {"shim_event_broadcast_a_9", aie2::shim_event_broadcast_a_9},
+  {"shim_event_broadcast_a_block_east_clr", aie2::shim_event_broadcast_a_block_east_clr},
+  {"shim_event_broadcast_a_block_east_set", aie2::shim_event_broadcast_a_block_east_set},
+  {"shim_event_broadcast_a_block_east_value", aie2::shim_event_broadcast_a_block_east_value},
+  {"shim_event_broadcast_a_block_north_clr", aie2::shim_event_broadcast_a_block_north_clr},
+  {"shim_event_broadcast_a_block_north_set", aie2::shim_event_broadcast_a_block_north_set},
+  {"shim_event_broadcast_a_block_north_value", aie2::shim_event_broadcast_a_block_north_value},
+  {"shim_event_broadcast_a_block_south_clr", aie2::shim_event_broadcast_a_block_south_clr},
+  {"shim_event_broadcast_a_block_south_set", aie2::shim_event_broadcast_a_block_south_set},
+  {"shim_event_broadcast_a_block_south_value", aie2::shim_event_broadcast_a_block_south_value},
+  {"shim_event_broadcast_a_block_west_clr", aie2::shim_event_broadcast_a_block_west_clr},
+  {"shim_event_broadcast_a_block_west_set", aie2::shim_event_broadcast_a_block_west_set},
+  {"shim_event_broadcast_a_block_west_value", aie2::shim_event_broadcast_a_block_west_value},
+  {"shim_event_generate", aie2::shim_event_generate},
+  {"shim_event_group_dma_enable", aie2::shim_event_group_dma_enable},
+  {"shim_event_status0", aie2::shim_event_status0},
+  {"shim_event_status1", aie2::shim_event_status1},
+  {"shim_event_status2", aie2::shim_event_status2},
+  {"shim_event_status3", aie2::shim_event_status3},
+  {"shim_lock0_value", aie2::shim_lock0_value},
+  {"shim_lock10_value", aie2::shim_lock10_value},
+  {"shim_lock11_value", aie2::shim_lock11_value},
+  {"shim_lock12_value", aie2::shim_lock12_value},
+  {"shim_lock13_value", aie2::shim_lock13_value},
+  {"shim_lock14_value", aie2::shim_lock14_value},
+  {"shim_lock15_value", aie2::shim_lock15_value},
+  {"shim_lock1_value", aie2::shim_lock1_value},
+  {"shim_lock2_value", aie2::shim_lock2_value},
+  {"shim_lock3_value", aie2::shim_lock3_value},
+  {"shim_lock4_value", aie2::shim_lock4_value},
+  {"shim_lock5_value", aie2::shim_lock5_value},
+  {"shim_lock6_value", aie2::shim_lock6_value},
+  {"shim_lock7_value", aie2::shim_lock7_value},
+  {"shim_lock8_value", aie2::shim_lock8_value},
+  {"shim_lock9_value", aie2::shim_lock9_value},
+  {"shim_lock_step_size", aie2::shim_lock_step_size},
+  {"shim_performance_control0", aie2::shim_performance_control0},
+  {"shim_performance_control1", aie2::shim_performance_control1},
+  {"shim_performance_counter0", aie2::shim_performance_counter0},
+  {"shim_performance_counter0_event_value", aie2::shim_performance_counter0_event_value},
+  {"shim_performance_counter1", aie2::shim_performance_counter1},
+  {"shim_performance_counter1_event_value", aie2::shim_performance_counter1_event_value},
+  {"shim_stream_switch_event_port_selection_0", aie2::shim_stream_switch_event_port_selection_0},
+  {"shim_stream_switch_event_port_selection_1", aie2::shim_stream_switch_event_port_selection_1},
+  {"shim_timer_high", aie2::shim_timer_high},
+  {"shim_timer_low", aie2::shim_timer_low},
+  {"shim_timer_trig_event_high_value", aie2::shim_timer_trig_event_high_value},
+  {"shim_timer_trig_event_low_value", aie2::shim_timer_trig_event_low_value},
+  {"shim_trace_control0", aie2::shim_trace_control0},
+  {"shim_trace_control1", aie2::shim_trace_control1},
+  {"shim_trace_event0", aie2::shim_trace_event0},
+  {"shim_trace_event1", aie2::shim_trace_event1},
+  {"shim_trace_status", aie2::shim_trace_status},
+};
+
+// Ids of registers in order of address
+constexpr uint16_t byAddress[] = {
+  1322, 1373, 1315, 1164, 1165, 1166, 1168, 1167, 1169, 976, 1092, 1091,
+  1163, 1357, 1122, 1094, 1095, 1102, 1103, 1365, 1105, 1106, 1107, 1366,
+  1109, 1096, 1097, 1367, 1099, 1100, 1101, 1368, 1116, 1118, 1120, 1119,
+  1121, 1114, 1113, 1115, 1111, 1110, 1112, 1372, 1358, 1359, 1360, 1180,
+  1181, 1184, 1362, 1183, 1179, 1178, 1177, 1176, 1185, 1186, 1131, 1132,
+  1133, 1134, 1170, 1171, 1172, 1173, 978, 977, 1093, 1123, 1130, 1125,
+  1127, 1128, 1126, 1124, 1129, 1174, 1162, 1187, 1188, 1189, 1190, 1191,
+  1192, 1193, 1194, 1021, 1022, 1023, 1024, 1025, 1026, 1249, 1250, 1027,
+  1252, 1029, 1030, 1031, 1032, 1257, 1258, 1259, 1034, 1035, 1036, 1037,
+  1038, 1265, 1266, 1039, 1040, 1041, 1042, 1043, 1044, 1273, 1274, 1045,
+  1046, 1047, 1048, 1049, 1050, 1281, 1282, 1051, 1284, 1053, 1054, 1287,
+  1288, 1289, 1290, 1057, 1058, 1059, 1060, 1061, 1062, 1297, 1298, 1063,
+  1064, 1065, 1066, 1067, 1068, 1305, 1306, 1069, 1070, 1071, 1072, 1073,
+  1074, 1313, 1314, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 991,
+  992, 993, 994, 995, 996, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+  1216, 1217, 1218, 1003, 1004, 1005, 1006, 1007, 1008, 1225, 1226, 1009,
+  1228, 1011, 1012, 1013, 1014, 1233, 1234, 1015, 1016, 1017, 1018, 1019,
+  1020, 1241, 1242, 1318, 1319, 1320, 1321, 1316, 1317, 1081, 1082, 1083,
+  1084, 1075, 1076, 1077, 1078, 1089, 1090, 1079, 1080, 1085, 1086, 1087,
+  1088, 1135, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1136,
+  1137, 1138, 1139, 1140, 1141, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
+  1159, 1160, 1161, 1374, 1375, 1376, 1378, 1377, 1379, 75, 64, 65,
+  66, 67, 69, 71, 73, 68, 70, 72, 74, 3, 5, 12,
+  76, 6, 7, 8, 9, 60, 61, 62, 63, 13, 14, 4,
+  10, 239, 1351, 15, 16, 23, 24, 1333, 26, 1335, 1336, 29,
+  30, 1325, 1326, 1327, 20, 1329, 1330, 38, 1345, 39, 1349, 40,
+  1350, 1343, 34, 1344, 32, 1339, 33, 1386, 1387, 1390, 1388, 1389,
+  243, 1384, 1383, 240, 1353, 1354, 1355, 1356, 2, 1, 11, 44,
+  50, 47, 46, 48, 49, 51, 45, 52, 237, 0, 57, 87,
+  88, 89, 105, 94, 101, 102, 103, 104, 106, 107, 108, 109,
+  95, 96, 97, 98, 99, 100, 90, 91, 92, 93, 120, 122,
+  123, 140, 128, 134, 135, 136, 137, 138, 139, 141, 142, 143,
+  144, 130, 131, 132, 133, 124, 125, 126, 127, 121, 129, 112,
+  113, 114, 115, 145, 146, 147, 148, 149, 150, 151, 152, 217,
+  218, 219, 220, 169, 170, 171, 172, 193, 194, 195, 196, 197,
+  198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209,
+  210, 211, 212, 213, 214, 215, 216, 221, 222, 223, 224, 225,
+  226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 177,
+  178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+  190, 191, 192, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+  162, 163, 164, 165, 166, 167, 168, 116, 117, 118, 119, 173,
+  174, 175, 176, 80, 81, 79, 83, 84, 82, 85, 86, 111,
+  110, 238, 78, 77, 1151, 58, 59, 825, 826, 827, 828, 830,
+  832, 834, 829, 831, 833, 835, 249, 687, 686, 962, 729, 689,
+  690, 697, 698, 699, 700, 701, 702, 703, 704, 691, 692, 693,
+  694, 695, 696, 712, 711, 713, 715, 714, 716, 709, 708, 710,
+  706, 705, 707, 724, 723, 725, 727, 726, 728, 721, 720, 722,
+  718, 717, 719, 967, 968, 971, 969, 970, 966, 965, 964, 963,
+  972, 973, 974, 975, 739, 740, 741, 742, 743, 744, 836, 837,
+  838, 839, 251, 250, 688, 730, 738, 732, 734, 736, 735, 733,
+  731, 737, 840, 960, 252, 822, 253, 254, 255, 256, 257, 258,
+  259, 260, 341, 342, 343, 344, 345, 346, 347, 348, 429, 430,
+  431, 432, 433, 434, 435, 436, 517, 518, 519, 520, 521, 522,
+  523, 524, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598,
+  599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610,
+  611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622,
+  623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634,
+  635, 636, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+  271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282,
+  283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294,
+  295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+  307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+  319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+  331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 349, 350,
+  351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362,
+  363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+  375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386,
+  387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+  399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410,
+  411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+  423, 424, 425, 426, 427, 428, 437, 438, 439, 440, 441, 442,
+  443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454,
+  455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466,
+  467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+  479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+  491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502,
+  503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514,
+  515, 516, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+  535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
+  547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558,
+  559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570,
+  571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582,
+  583, 584, 585, 586, 587, 588, 656, 657, 658, 659, 660, 661,
+  662, 663, 664, 665, 666, 667, 638, 639, 640, 641, 642, 643,
+  644, 645, 646, 647, 648, 649, 680, 681, 682, 683, 684, 685,
+  650, 651, 652, 653, 654, 655, 637, 668, 669, 670, 671, 672,
+  673, 674, 675, 676, 677, 678, 679, 851, 852, 853, 854, 855,
+  856, 867, 863, 864, 865, 866, 857, 858, 859, 860, 861, 862,
+  870, 871, 872, 873, 874, 875, 886, 880, 881, 882, 883, 884,
+  885, 876, 877, 878, 879, 887, 888, 889, 890, 891, 892, 893,
+  894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905,
+  906, 907, 908, 909, 910, 911, 952, 953, 954, 955, 928, 929,
+  930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941,
+  942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 912, 913,
+  914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925,
+  926, 927, 956, 957, 958, 959, 844, 845, 843, 847, 848, 846,
+  849, 850, 869, 868, 961, 842, 841, 745, 756, 767, 778, 789,
+  800, 805, 806, 807, 808, 746, 747, 748, 749, 750, 751, 752,
+  753, 754, 755, 757, 758, 759, 760, 761, 762, 763, 764, 765,
+  766, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 779,
+  780, 781, 782, 783, 784, 785, 786, 787, 788, 790, 791, 792,
+  793, 794, 795, 796, 797, 798, 799, 801, 802, 803, 804, 810,
+  811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 809,
+  823, 824,
+};
+
+static_assert(isSortedByName(registers, std::size(registers)),
+              "AIE2 registers must be sorted by name");
+static_assert(isSortedByAddress(registers, byAddress, std::size(byAddress)),
+              "AIE2 register ids must be sorted by address");
+
+} // end anonymous namespace
+
+RegisterNameTable getAIE2RegisterNames()
+{
+  return RegisterNameTable(registers, static_cast<uint16_t>(std::size(registers)),
+                           byAddress, static_cast<uint16_t>(std::size(byAddress)));
+}
+
+} // end namespace xdp
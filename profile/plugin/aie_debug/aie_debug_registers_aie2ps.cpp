@@ -0,0 +1,1983 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved
+
+#define XDP_PLUGIN_SOURCE
+
+#include <iterator>
+
+#include "xdp/profile/plugin/aie_base/generations/aie2ps_registers.h"
+#include "xdp/profile/plugin/aie_debug/aie_debug_registers.h"
+
+namespace xdp {
+
+/*************************************************************************************
+ AIE2PS Registers
+ *************************************************************************************/
+namespace {
+
+constexpr RegisterName registers[] = {
+  {"cm_accumulator_control", aie2ps::cm_accumulator_control},
+  {"cm_combo_event_control", aie2ps::cm_combo_event_control},
+  {"cm_combo_event_inputs", aie2ps::cm_combo_event_inputs},
+  {"cm_core_bmhh0_part1", aie2ps::cm_core_bmhh0_part1},
+  {"cm_core_bmhh0_part2", aie2ps::cm_core_bmhh0_part2},
+  {"cm_core_bmhh0_part3", aie2ps::cm_core_bmhh0_part3},
+  {"cm_core_bmhh0_part4", aie2ps::cm_core_bmhh0_part4},
+  {"cm_core_bmhh1_part1", aie2ps::cm_core_bmhh1_part1},
+  {"cm_core_bmhh1_part2", aie2ps::cm_core_bmhh1_part2},
+  {"cm_core_bmhh1_part3", aie2ps::cm_core_bmhh1_part3},
+  {"cm_core_bmhh1_part4", aie2ps::cm_core_bmhh1_part4},
+  {"cm_core_bmhh2_part1", aie2ps::cm_core_bmhh2_part1},
+  {"cm_core_bmhh2_part2", aie2ps::cm_core_bmhh2_part2},
+  {"cm_core_bmhh2_part3", aie2ps::cm_core_bmhh2_part3},
+  {"cm_core_bmhh2_part4", aie2ps::cm_core_bmhh2_part4},
+  {"cm_core_bmhh3_part1", aie2ps::cm_core_bmhh3_part1},
+  {"cm_core_bmhh3_part2", aie2ps::cm_core_bmhh3_part2},
+  {"cm_core_bmhh3_part3", aie2ps::cm_core_bmhh3_part3},
+  {"cm_core_bmhh3_part4", aie2ps::cm_core_bmhh3_part4},
+  {"cm_core_bmhh4_part1", aie2ps::cm_core_bmhh4_part1},
+  {"cm_core_bmhh4_part2", aie2ps::cm_core_bmhh4_part2},
+  {"cm_core_bmhh4_part3", aie2ps::cm_core_bmhh4_part3},
+  {"cm_core_bmhh4_part4", aie2ps::cm_core_bmhh4_part4},
+  {"cm_core_bmhh5_part1", aie2ps::cm_core_bmhh5_part1},
+  {"cm_core_bmhh5_part2", aie2ps::cm_core_bmhh5_part2},
+  {"cm_core_bmhh5_part3", aie2ps::cm_core_bmhh5_part3},
+  {"cm_core_bmhh5_part4", aie2ps::cm_core_bmhh5_part4},
+  {"cm_core_bmhh6_part1", aie2ps::cm_core_bmhh6_part1},
+  {"cm_core_bmhh6_part2", aie2ps::cm_core_bmhh6_part2},
+  {"cm_core_bmhh6_part3", aie2ps::cm_core_bmhh6_part3},
+  {"cm_core_bmhh6_part4", aie2ps::cm_core_bmhh6_part4},
+  {"cm_core_bmhh7_part1", aie2ps::cm_core_bmhh7_part1},
+  {"cm_core_bmhh7_part2", aie2ps::cm_core_bmhh7_part2},
+  {"cm_core_bmhh7_part3", aie2ps::cm_core_bmhh7_part3},
+  {"cm_core_bmhh7_part4", aie2ps::cm_core_bmhh7_part4},
+  {"cm_core_bmhl0_part1", aie2ps::cm_core_bmhl0_part1},
+  {"cm_core_bmhl0_part2", aie2ps::cm_core_bmhl0_part2},
+  {"cm_core_bmhl0_part3", aie2ps::cm_core_bmhl0_part3},
+  {"cm_core_bmhl0_part4", aie2ps::cm_core_bmhl0_part4},
+  {"cm_core_bmhl1_part1", aie2ps::cm_core_bmhl1_part1},
+  {"cm_core_bmhl1_part2", aie2ps::cm_core_bmhl1_part2},
+  {"cm_core_bmhl1_part3", aie2ps::cm_core_bmhl1_part3},
+  {"cm_core_bmhl1_part4", aie2ps::cm_core_bmhl1_part4},
+  {"cm_core_bmhl2_part1", aie2ps::cm_core_bmhl2_part1},
+  {"cm_core_bmhl2_part2", aie2ps::cm_core_bmhl2_part2},
+  {"cm_core_bmhl2_part3", aie2ps::cm_core_bmhl2_part3},
+  {"cm_core_bmhl2_part4", aie2ps::cm_core_bmhl2_part4},
+  {"cm_core_bmhl3_part1", aie2ps::cm_core_bmhl3_part1},
+  {"cm_core_bmhl3_part2", aie2ps::cm_core_bmhl3_part2},
+  {"cm_core_bmhl3_part3", aie2ps::cm_core_bmhl3_part3},
+  {"cm_core_bmhl3_part4", aie2ps::cm_core_bmhl3_part4},
+  {"cm_core_bmhl4_part1", aie2ps::cm_core_bmhl4_part1},
+  {"cm_core_bmhl4_part2", aie2ps::cm_core_bmhl4_part2},
+  {"cm_core_bmhl4_part3", aie2ps::cm_core_bmhl4_part3},
+  {"cm_core_bmhl4_part4", aie2ps::cm_core_bmhl4_part4},
+  {"cm_core_bmhl5_part1", aie2ps::cm_core_bmhl5_part1},
+  {"cm_core_bmhl5_part2", aie2ps::cm_core_bmhl5_part2},
+  {"cm_core_bmhl5_part3", aie2ps::cm_core_bmhl5_part3},
+  {"cm_core_bmhl5_part4", aie2ps::cm_core_bmhl5_part4},
+  {"cm_core_bmhl6_part1", aie2ps::cm_core_bmhl6_part1},
+  {"cm_core_bmhl6_part2", aie2ps::cm_core_bmhl6_part2},
+  {"cm_core_bmhl6_part3", aie2ps::cm_core_bmhl6_part3},
+  {"cm_core_bmhl6_part4", aie2ps::cm_core_bmhl6_part4},
+  {"cm_core_bmhl7_part1", aie2ps::cm_core_bmhl7_part1},
+  {"cm_core_bmhl7_part2", aie2ps::cm_core_bmhl7_part2},
+  {"cm_core_bmhl7_part3", aie2ps::cm_core_bmhl7_part3},
+  {"cm_core_bmhl7_part4", aie2ps::cm_core_bmhl7_part4},
+  {"cm_core_bmlh0_part1", aie2ps::cm_core_bmlh0_part1},
+  {"cm_core_bmlh0_part2", aie2ps::cm_core_bmlh0_part2},
+  {"cm_core_bmlh0_part3", aie2ps::cm_core_bmlh0_part3},
+  {"cm_core_bmlh0_part4", aie2ps::cm_core_bmlh0_part4},
+  {"cm_core_bmlh1_part1", aie2ps::cm_core_bmlh1_part1},
+  {"cm_core_bmlh1_part2", aie2ps::cm_core_bmlh1_part2},
+  {"cm_core_bmlh1_part3", aie2ps::cm_core_bmlh1_part3},
+  {"cm_core_bmlh1_part4", aie2ps::cm_core_bmlh1_part4},
+  {"cm_core_bmlh2_part1", aie2ps::cm_core_bmlh2_part1},
+  {"cm_core_bmlh2_part2", aie2ps::cm_core_bmlh2_part2},
+  {"cm_core_bmlh2_part3", aie2ps::cm_core_bmlh2_part3},
+  {"cm_core_bmlh2_part4", aie2ps::cm_core_bmlh2_part4},
+  {"cm_core_bmlh3_part1", aie2ps::cm_core_bmlh3_part1},
+  {"cm_core_bmlh3_part2", aie2ps::cm_core_bmlh3_part2},
+  {"cm_core_bmlh3_part3", aie2ps::cm_core_bmlh3_part3},
+  {"cm_core_bmlh3_part4", aie2ps::cm_core_bmlh3_part4},
+  {"cm_core_bmlh4_part1", aie2ps::cm_core_bmlh4_part1},
+  {"cm_core_bmlh4_part2", aie2ps::cm_core_bmlh4_part2},
+  {"cm_core_bmlh4_part3", aie2ps::cm_core_bmlh4_part3},
+  {"cm_core_bmlh4_part4", aie2ps::cm_core_bmlh4_part4},
+  {"cm_core_bmlh5_part1", aie2ps::cm_core_bmlh5_part1},
+  {"cm_core_bmlh5_part2", aie2ps::cm_core_bmlh5_part2},
+  {"cm_core_bmlh5_part3", aie2ps::cm_core_bmlh5_part3},
+  {"cm_core_bmlh5_part4", aie2ps::cm_core_bmlh5_part4},
+  {"cm_core_bmlh6_part1", aie2ps::cm_core_bmlh6_part1},
+  {"cm_core_bmlh6_part2", aie2ps::cm_core_bmlh6_part2},
+  {"cm_core_bmlh6_part3", aie2ps::cm_core_bmlh6_part3},
+  {"cm_core_bmlh6_part4", aie2ps::cm_core_bmlh6_part4},
+  {"cm_core_bmlh7_part1", aie2ps::cm_core_bmlh7_part1},
+  {"cm_core_bmlh7_part2", aie2ps::cm_core_bmlh7_part2},
+  {"cm_core_bmlh7_part3", aie2ps::cm_core_bmlh7_part3},
+  {"cm_core_bmlh7_part4", aie2ps::cm_core_bmlh7_part4},
+  {"cm_core_bmll0_part1", aie2ps::cm_core_bmll0_part1},
+  {"cm_core_bmll0_part2", aie2ps::cm_core_bmll0_part2},
+  {"cm_core_bmll0_part3", aie2ps::cm_core_bmll0_part3},
+  {"cm_core_bmll0_part4", aie2ps::cm_core_bmll0_part4},
+  {"cm_core_bmll1_part1", aie2ps::cm_core_bmll1_part1},
+  {"cm_core_bmll1_part2", aie2ps::cm_core_bmll1_part2},
+  {"cm_core_bmll1_part3", aie2ps::cm_core_bmll1_part3},
+  {"cm_core_bmll1_part4", aie2ps::cm_core_bmll1_part4},
+  {"cm_core_bmll2_part1", aie2ps::cm_core_bmll2_part1},
+  {"cm_core_bmll2_part2", aie2ps::cm_core_bmll2_part2},
+  {"cm_core_bmll2_part3", aie2ps::cm_core_bmll2_part3},
+  {"cm_core_bmll2_part4", aie2ps::cm_core_bmll2_part4},
+  {"cm_core_bmll3_part1", aie2ps::cm_core_bmll3_part1},
+  {"cm_core_bmll3_part2", aie2ps::cm_core_bmll3_part2},
+  {"cm_core_bmll3_part3", aie2ps::cm_core_bmll3_part3},
+  {"cm_core_bmll3_part4", aie2ps::cm_core_bmll3_part4},
+  {"cm_core_bmll4_part1", aie2ps::cm_core_bmll4_part1},
+  {"cm_core_bmll4_part2", aie2ps::cm_core_bmll4_part2},
+  {"cm_core_bmll4_part3", aie2ps::cm_core_bmll4_part3},
+  {"cm_core_bmll4_part4", aie2ps::cm_core_bmll4_part4},
+  {"cm_core_bmll5_part1", aie2ps::cm_core_bmll5_part1},
+  {"cm_core_bmll5_part2", aie2ps::cm_core_bmll5_part2},
+  {"cm_core_bmll5_part3", aie2ps::cm_core_bmll5_part3},
+  {"cm_core_bmll5_part4", aie2ps::cm_core_bmll5_part4},
+  {"cm_core_bmll6_part1", aie2ps::cm_core_bmll6_part1},
+  {"cm_core_bmll6_part2", aie2ps::cm_core_bmll6_part2},
+  {"cm_core_bmll6_part3", aie2ps::cm_core_bmll6_part3},
+  {"cm_core_bmll6_part4", aie2ps::cm_core_bmll6_part4},
+  {"cm_core_bmll7_part1", aie2ps::cm_core_bmll7_part1},
+  {"cm_core_bmll7_part2", aie2ps::cm_core_bmll7_part2},
+  {"cm_core_bmll7_part3", aie2ps::cm_core_bmll7_part3},
+  {"cm_core_bmll7_part4", aie2ps::cm_core_bmll7_part4},
+  {"cm_core_control", aie2ps::cm_core_control},
+  {"cm_core_cr1", aie2ps::cm_core_cr1},
+  {"cm_core_cr2", aie2ps::cm_core_cr2},
+  {"cm_core_cr3", aie2ps::cm_core_cr3},
+  {"cm_core_dc0", aie2ps::cm_core_dc0},
+  {"cm_core_dc1", aie2ps::cm_core_dc1},
+  {"cm_core_dc2", aie2ps::cm_core_dc2},
+  {"cm_core_dc3", aie2ps::cm_core_dc3},
+  {"cm_core_dc4", aie2ps::cm_core_dc4},
+  {"cm_core_dc5", aie2ps::cm_core_dc5},
+  {"cm_core_dc6", aie2ps::cm_core_dc6},
+  {"cm_core_dc7", aie2ps::cm_core_dc7},
+  {"cm_core_dj0", aie2ps::cm_core_dj0},
+  {"cm_core_dj1", aie2ps::cm_core_dj1},
+  {"cm_core_dj2", aie2ps::cm_core_dj2},
+  {"cm_core_dj3", aie2ps::cm_core_dj3},
+  {"cm_core_dj4", aie2ps::cm_core_dj4},
+  {"cm_core_dj5", aie2ps::cm_core_dj5},
+  {"cm_core_dj6", aie2ps::cm_core_dj6},
+  {"cm_core_dj7", aie2ps::cm_core_dj7},
+  {"cm_core_dn0", aie2ps::cm_core_dn0},
+  {"cm_core_dn1", aie2ps::cm_core_dn1},
+  {"cm_core_dn2", aie2ps::cm_core_dn2},
+  {"cm_core_dn3", aie2ps::cm_core_dn3},
+  {"cm_core_dn4", aie2ps::cm_core_dn4},
+  {"cm_core_dn5", aie2ps::cm_core_dn5},
+  {"cm_core_dn6", aie2ps::cm_core_dn6},
+  {"cm_core_dn7", aie2ps::cm_core_dn7},
+  {"cm_core_eg0", aie2ps::cm_core_eg0},
+  {"cm_core_eg1", aie2ps::cm_core_eg1},
+  {"cm_core_eg10", aie2ps::cm_core_eg10},
+  {"cm_core_eg11", aie2ps::cm_core_eg11},
+  {"cm_core_eg2", aie2ps::cm_core_eg2},
+  {"cm_core_eg3", aie2ps::cm_core_eg3},
+  {"cm_core_eg4", aie2ps::cm_core_eg4},
+  {"cm_core_eg5", aie2ps::cm_core_eg5},
+  {"cm_core_eg6", aie2ps::cm_core_eg6},
+  {"cm_core_eg7", aie2ps::cm_core_eg7},
+  {"cm_core_eg8", aie2ps::cm_core_eg8},
+  {"cm_core_eg9", aie2ps::cm_core_eg9},
+  {"cm_core_f0", aie2ps::cm_core_f0},
+  {"cm_core_f1", aie2ps::cm_core_f1},
+  {"cm_core_f10", aie2ps::cm_core_f10},
+  {"cm_core_f11", aie2ps::cm_core_f11},
+  {"cm_core_f2", aie2ps::cm_core_f2},
+  {"cm_core_f3", aie2ps::cm_core_f3},
+  {"cm_core_f4", aie2ps::cm_core_f4},
+  {"cm_core_f5", aie2ps::cm_core_f5},
+  {"cm_core_f6", aie2ps::cm_core_f6},
+  {"cm_core_f7", aie2ps::cm_core_f7},
+  {"cm_core_f8", aie2ps::cm_core_f8},
+  {"cm_core_f9", aie2ps::cm_core_f9},
+  {"cm_core_fc", aie2ps::cm_core_fc},
+  {"cm_core_fifoxtra_part1", aie2ps::cm_core_fifoxtra_part1},
+  {"cm_core_fifoxtra_part2", aie2ps::cm_core_fifoxtra_part2},
+  {"cm_core_fifoxtra_part3", aie2ps::cm_core_fifoxtra_part3},
+  {"cm_core_fifoxtra_part4", aie2ps::cm_core_fifoxtra_part4},
+  {"cm_core_lc", aie2ps::cm_core_lc},
+  {"cm_core_lci", aie2ps::cm_core_lci},
+  {"cm_core_ldfifoh0_part1", aie2ps::cm_core_ldfifoh0_part1},
+  {"cm_core_ldfifoh0_part2", aie2ps::cm_core_ldfifoh0_part2},
+  {"cm_core_ldfifoh0_part3", aie2ps::cm_core_ldfifoh0_part3},
+  {"cm_core_ldfifoh0_part4", aie2ps::cm_core_ldfifoh0_part4},
+  {"cm_core_ldfifoh1_part1", aie2ps::cm_core_ldfifoh1_part1},
+  {"cm_core_ldfifoh1_part2", aie2ps::cm_core_ldfifoh1_part2},
+  {"cm_core_ldfifoh1_part3", aie2ps::cm_core_ldfifoh1_part3},
+  {"cm_core_ldfifoh1_part4", aie2ps::cm_core_ldfifoh1_part4},
+  {"cm_core_ldfifol0_part1", aie2ps::cm_core_ldfifol0_part1},
+  {"cm_core_ldfifol0_part2", aie2ps::cm_core_ldfifol0_part2},
+  {"cm_core_ldfifol0_part3", aie2ps::cm_core_ldfifol0_part3},
+  {"cm_core_ldfifol0_part4", aie2ps::cm_core_ldfifol0_part4},
+  {"cm_core_ldfifol1_part1", aie2ps::cm_core_ldfifol1_part1},
+  {"cm_core_ldfifol1_part2", aie2ps::cm_core_ldfifol1_part2},
+  {"cm_core_ldfifol1_part3", aie2ps::cm_core_ldfifol1_part3},
+  {"cm_core_ldfifol1_part4", aie2ps::cm_core_ldfifol1_part4},
+  {"cm_core_le", aie2ps::cm_core_le},
+  {"cm_core_lr", aie2ps::cm_core_lr},
+  {"cm_core_ls", aie2ps::cm_core_ls},
+  {"cm_core_m0", aie2ps::cm_core_m0},
+  {"cm_core_m1", aie2ps::cm_core_m1},
+  {"cm_core_m2", aie2ps::cm_core_m2},
+  {"cm_core_m3", aie2ps::cm_core_m3},
+  {"cm_core_m4", aie2ps::cm_core_m4},
+  {"cm_core_m5", aie2ps::cm_core_m5},
+  {"cm_core_m6", aie2ps::cm_core_m6},
+  {"cm_core_m7", aie2ps::cm_core_m7},
+  {"cm_core_p0", aie2ps::cm_core_p0},
+  {"cm_core_p1", aie2ps::cm_core_p1},
+  {"cm_core_p2", aie2ps::cm_core_p2},
+  {"cm_core_p3", aie2ps::cm_core_p3},
+  {"cm_core_p4", aie2ps::cm_core_p4},
+  {"cm_core_p5", aie2ps::cm_core_p5},
+  {"cm_core_p6", aie2ps::cm_core_p6},
+  {"cm_core_p7", aie2ps::cm_core_p7},
+  {"cm_core_pc", aie2ps::cm_core_pc},
+  {"cm_core_processor_bus", aie2ps::cm_core_processor_bus},
+  {"cm_core_r0", aie2ps::cm_core_r0},
+  {"cm_core_r1", aie2ps::cm_core_r1},
+  {"cm_core_r10", aie2ps::cm_core_r10},
+  {"cm_core_r11", aie2ps::cm_core_r11},
+  {"cm_core_r12", aie2ps::cm_core_r12},
+  {"cm_core_r13", aie2ps::cm_core_r13},
+  {"cm_core_r14", aie2ps::cm_core_r14},
+  {"cm_core_r15", aie2ps::cm_core_r15},
+  {"cm_core_r16", aie2ps::cm_core_r16},
+  {"cm_core_r17", aie2ps::cm_core_r17},
+  {"cm_core_r18", aie2ps::cm_core_r18},
+  {"cm_core_r19", aie2ps::cm_core_r19},
+  {"cm_core_r2", aie2ps::cm_core_r2},
+  {"cm_core_r20", aie2ps::cm_core_r20},
+  {"cm_core_r21", aie2ps::cm_core_r21},
+  {"cm_core_r22", aie2ps::cm_core_r22},
+  {"cm_core_r23", aie2ps::cm_core_r23},
+  {"cm_core_r24", aie2ps::cm_core_r24},
+  {"cm_core_r25", aie2ps::cm_core_r25},
+  {"cm_core_r26", aie2ps::cm_core_r26},
+  {"cm_core_r27", aie2ps::cm_core_r27},
+  {"cm_core_r28", aie2ps::cm_core_r28},
+  {"cm_core_r29", aie2ps::cm_core_r29},
+  {"cm_core_r3", aie2ps::cm_core_r3},
+  {"cm_core_r30", aie2ps::cm_core_r30},
+  {"cm_core_r31", aie2ps::cm_core_r31},
+  {"cm_core_r4", aie2ps::cm_core_r4},
+  {"cm_core_r5", aie2ps::cm_core_r5},
+  {"cm_core_r6", aie2ps::cm_core_r6},
+  {"cm_core_r7", aie2ps::cm_core_r7},
+  {"cm_core_r8", aie2ps::cm_core_r8},
+  {"cm_core_r9", aie2ps::cm_core_r9},
+  {"cm_core_s0", aie2ps::cm_core_s0},
+  {"cm_core_s1", aie2ps::cm_core_s1},
+  {"cm_core_s2", aie2ps::cm_core_s2},
+  {"cm_core_s3", aie2ps::cm_core_s3},
+  {"cm_core_sp", aie2ps::cm_core_sp},
+  {"cm_core_sr1", aie2ps::cm_core_sr1},
+  {"cm_core_sr2", aie2ps::cm_core_sr2},
+  {"cm_core_status", aie2ps::cm_core_status},
+  {"cm_core_stfifoh_part1", aie2ps::cm_core_stfifoh_part1},
+  {"cm_core_stfifoh_part2", aie2ps::cm_core_stfifoh_part2},
+  {"cm_core_stfifoh_part3", aie2ps::cm_core_stfifoh_part3},
+  {"cm_core_stfifoh_part4", aie2ps::cm_core_stfifoh_part4},
+  {"cm_core_stfifol_part1", aie2ps::cm_core_stfifol_part1},
+  {"cm_core_stfifol_part2", aie2ps::cm_core_stfifol_part2},
+  {"cm_core_stfifol_part3", aie2ps::cm_core_stfifol_part3},
+  {"cm_core_stfifol_part4", aie2ps::cm_core_stfifol_part4},
+  {"cm_core_x0_part1", aie2ps::cm_core_x0_part1},
+  {"cm_core_x0_part2", aie2ps::cm_core_x0_part2},
+  {"cm_core_x0_part3", aie2ps::cm_core_x0_part3},
+  {"cm_core_x0_part4", aie2ps::cm_core_x0_part4},
+  {"cm_core_x10_part1", aie2ps::cm_core_x10_part1},
+  {"cm_core_x10_part2", aie2ps::cm_core_x10_part2},
+  {"cm_core_x10_part3", aie2ps::cm_core_x10_part3},
+  {"cm_core_x10_part4", aie2ps::cm_core_x10_part4},
+  {"cm_core_x11_part1", aie2ps::cm_core_x11_part1},
+  {"cm_core_x11_part2", aie2ps::cm_core_x11_part2},
+  {"cm_core_x11_part3", aie2ps::cm_core_x11_part3},
+  {"cm_core_x11_part4", aie2ps::cm_core_x11_part4},
+  {"cm_core_x1_part1", aie2ps::cm_core_x1_part1},
+  {"cm_core_x1_part2", aie2ps::cm_core_x1_part2},
+  {"cm_core_x1_part3", aie2ps::cm_core_x1_part3},
+  {"cm_core_x1_part4", aie2ps::cm_core_x1_part4},
+  {"cm_core_x2_part1", aie2ps::cm_core_x2_part1},
+  {"cm_core_x2_part2", aie2ps::cm_core_x2_part2},
+  {"cm_core_x2_part3", aie2ps::cm_core_x2_part3},
+  {"cm_core_x2_part4", aie2ps::cm_core_x2_part4},
+  {"cm_core_x3_part1", aie2ps::cm_core_x3_part1},
+  {"cm_core_x3_part2", aie2ps::cm_core_x3_part2},
+  {"cm_core_x3_part3", aie2ps::cm_core_x3_part3},
+  {"cm_core_x3_part4", aie2ps::cm_core_x3_part4},
+  {"cm_core_x4_part1", aie2ps::cm_core_x4_part1},
+  {"cm_core_x4_part2", aie2ps::cm_core_x4_part2},
+  {"cm_core_x4_part3", aie2ps::cm_core_x4_part3},
+  {"cm_core_x4_part4", aie2ps::cm_core_x4_part4},
+  {"cm_core_x5_part1", aie2ps::cm_core_x5_part1},
+  {"cm_core_x5_part2", aie2ps::cm_core_x5_part2},
+  {"cm_core_x5_part3", aie2ps::cm_core_x5_part3},
+  {"cm_core_x5_part4", aie2ps::cm_core_x5_part4},
+  {"cm_core_x6_part1", aie2ps::cm_core_x6_part1},
+  {"cm_core_x6_part2", aie2ps::cm_core_x6_part2},
+  {"cm_core_x6_part3", aie2ps::cm_core_x6_part3},
+  {"cm_core_x6_part4", aie2ps::cm_core_x6_part4},
+  {"cm_core_x7_part1", aie2ps::cm_core_x7_part1},
+  {"cm_core_x7_part2", aie2ps::cm_core_x7_part2},
+  {"cm_core_x7_part3", aie2ps::cm_core_x7_part3},
+  {"cm_core_x7_part4", aie2ps::cm_core_x7_part4},
+  {"cm_core_x8_part1", aie2ps::cm_core_x8_part1},
+  {"cm_core_x8_part2", aie2ps::cm_core_x8_part2},
+  {"cm_core_x8_part3", aie2ps::cm_core_x8_part3},
+  {"cm_core_x8_part4", aie2ps::cm_core_x8_part4},
+  {"cm_core_x9_part1", aie2ps::cm_core_x9_part1},
+  {"cm_core_x9_part2", aie2ps::cm_core_x9_part2},
+  {"cm_core_x9_part3", aie2ps::cm_core_x9_part3},
+  {"cm_core_x9_part4", aie2ps::cm_core_x9_part4},
+  {"cm_debug_control0", aie2ps::cm_debug_control0},
+  {"cm_debug_control1", aie2ps::cm_debug_control1},
+  {"cm_debug_control2", aie2ps::cm_debug_control2},
+  {"cm_debug_status", aie2ps::cm_debug_status},
+  {"cm_ecc_scrubbing_event", aie2ps::cm_ecc_scrubbing_event},
+  {"cm_edge_detection_event_control", aie2ps::cm_edge_detection_event_control},
+  {"cm_enable_events", aie2ps::cm_enable_events},
+  {"cm_error_halt_control", aie2ps::cm_error_halt_control},
+  {"cm_error_halt_event", aie2ps::cm_error_halt_event},
+  {"cm_event_broadcast0", aie2ps::cm_event_broadcast0},
+  {"cm_event_broadcast1", aie2ps::cm_event_broadcast1},
+  {"cm_event_broadcast10", aie2ps::cm_event_broadcast10},
+  {"cm_event_broadcast11", aie2ps::cm_event_broadcast11},
+  {"cm_event_broadcast12", aie2ps::cm_event_broadcast12},
+  {"cm_event_broadcast13", aie2ps::cm_event_broadcast13},
+  {"cm_event_broadcast14", aie2ps::cm_event_broadcast14},
+  {"cm_event_broadcast15", aie2ps::cm_event_broadcast15},
+  {"cm_event_broadcast2", aie2ps::cm_event_broadcast2},
+  {"cm_event_broadcast3", aie2ps::cm_event_broadcast3},
+  {"cm_event_broadcast4", aie2ps::cm_event_broadcast4},
+  {"cm_event_broadcast5", aie2ps::cm_event_broadcast5},
+  {"cm_event_broadcast6", aie2ps::cm_event_broadcast6},
+  {"cm_event_broadcast7", aie2ps::cm_event_broadcast7},
+  {"cm_event_broadcast8", aie2ps::cm_event_broadcast8},
+  {"cm_event_broadcast9", aie2ps::cm_event_broadcast9},
+  {"cm_event_broadcast_block_east_clr", aie2ps::cm_event_broadcast_block_east_clr},
+  {"cm_event_broadcast_block_east_set", aie2ps::cm_event_broadcast_block_east_set},
+  {"cm_event_broadcast_block_east_value", aie2ps::cm_event_broadcast_block_east_value},
+  {"cm_event_broadcast_block_north_clr", aie2ps::cm_event_broadcast_block_north_clr},
+  {"cm_event_broadcast_block_north_set", aie2ps::cm_event_broadcast_block_north_set},
+  {"cm_event_broadcast_block_north_value", aie2ps::cm_event_broadcast_block_north_value},
+  {"cm_event_broadcast_block_south_clr", aie2ps::cm_event_broadcast_block_south_clr},
+  {"cm_event_broadcast_block_south_set", aie2ps::cm_event_broadcast_block_south_set},
+  {"cm_event_broadcast_block_south_value", aie2ps::cm_event_broadcast_block_south_value},
+  {"cm_event_broadcast_block_west_clr", aie2ps::cm_event_broadcast_block_west_clr},
+  {"cm_event_broadcast_block_west_set", aie2ps::cm_event_broadcast_block_west_set},
+  {"cm_event_broadcast_block_west_value", aie2ps::cm_event_broadcast_block_west_value},
+  {"cm_event_generate", aie2ps::cm_event_generate},
+  {"cm_event_group_0_enable", aie2ps::cm_event_group_0_enable},
+  {"cm_event_group_broadcast_enable", aie2ps::cm_event_group_broadcast_enable},
+  {"cm_event_group_core_program_flow_enable", aie2ps::cm_event_group_core_program_flow_enable},
+  {"cm_event_group_core_stall_enable", aie2ps::cm_event_group_core_stall_enable},
+  {"cm_event_group_errors0_enable", aie2ps::cm_event_group_errors0_enable},
+  {"cm_event_group_errors1_enable", aie2ps::cm_event_group_errors1_enable},
+  {"cm_event_group_pc_enable", aie2ps::cm_event_group_pc_enable},
+  {"cm_event_group_stream_switch_enable", aie2ps::cm_event_group_stream_switch_enable},
+  {"cm_event_group_user_event_enable", aie2ps::cm_event_group_user_event_enable},
+  {"cm_event_status0", aie2ps::cm_event_status0},
+  {"cm_event_status1", aie2ps::cm_event_status1},
+  {"cm_event_status2", aie2ps::cm_event_status2},
+  {"cm_event_status3", aie2ps::cm_event_status3},
+  {"cm_memory_control", aie2ps::cm_memory_control},
+  {"cm_module_clock_control", aie2ps::cm_module_clock_control},
+  {"cm_pc_event0", aie2ps::cm_pc_event0},
+  {"cm_pc_event1", aie2ps::cm_pc_event1},
+  {"cm_pc_event2", aie2ps::cm_pc_event2},
+  {"cm_pc_event3", aie2ps::cm_pc_event3},
+  {"cm_performance_control0", aie2ps::cm_performance_control0},
+  {"cm_performance_control1", aie2ps::cm_performance_control1},
+  {"cm_performance_control2", aie2ps::cm_performance_control2},
+  {"cm_performance_counter0", aie2ps::cm_performance_counter0},
+  {"cm_performance_counter0_event_value", aie2ps::cm_performance_counter0_event_value},
+  {"cm_performance_counter1", aie2ps::cm_performance_counter1},
+  {"cm_performance_counter1_event_value", aie2ps::cm_performance_counter1_event_value},
+  {"cm_performance_counter2", aie2ps::cm_performance_counter2},
+  {"cm_performance_counter2_event_value", aie2ps::cm_performance_counter2_event_value},
+  {"cm_performance_counter3", aie2ps::cm_performance_counter3},
+  {"cm_performance_counter3_event_value", aie2ps::cm_performance_counter3_event_value},
+  {"cm_program_counter", aie2ps::cm_program_counter},
+  {"cm_reset_event", aie2ps::cm_reset_event},
+  {"cm_stream_switch_adaptive_clock_gate_abort_period", aie2ps::cm_stream_switch_adaptive_clock_gate_abort_period},
+  {"cm_stream_switch_adaptive_clock_gate_status", aie2ps::cm_stream_switch_adaptive_clock_gate_status},
+  {"cm_stream_switch_deterministic_merge_arb0_ctrl", aie2ps::cm_stream_switch_deterministic_merge_arb0_ctrl},
+  {"cm_stream_switch_deterministic_merge_arb0_slave0_1", aie2ps::cm_stream_switch_deterministic_merge_arb0_slave0_1},
+  {"cm_stream_switch_deterministic_merge_arb0_slave2_3", aie2ps::cm_stream_switch_deterministic_merge_arb0_slave2_3},
+  {"cm_stream_switch_deterministic_merge_arb1_ctrl", aie2ps::cm_stream_switch_deterministic_merge_arb1_ctrl},
+  {"cm_stream_switch_deterministic_merge_arb1_slave0_1", aie2ps::cm_stream_switch_deterministic_merge_arb1_slave0_1},
+  {"cm_stream_switch_deterministic_merge_arb1_slave2_3", aie2ps::cm_stream_switch_deterministic_merge_arb1_slave2_3},
+  {"cm_stream_switch_event_port_selection_0", aie2ps::cm_stream_switch_event_port_selection_0},
+  {"cm_stream_switch_event_port_selection_1", aie2ps::cm_stream_switch_event_port_selection_1},
+  {"cm_stream_switch_master_config_aie_core0", aie2ps::cm_stream_switch_master_config_aie_core0},
+  {"cm_stream_switch_master_config_dma0", aie2ps::cm_stream_switch_master_config_dma0},
+  {"cm_stream_switch_master_config_dma1", aie2ps::cm_stream_switch_master_config_dma1},
+  {"cm_stream_switch_master_config_east0", aie2ps::cm_stream_switch_master_config_east0},
+  {"cm_stream_switch_master_config_east1", aie2ps::cm_stream_switch_master_config_east1},
+  {"cm_stream_switch_master_config_east2", aie2ps::cm_stream_switch_master_config_east2},
+  {"cm_stream_switch_master_config_east3", aie2ps::cm_stream_switch_master_config_east3},
+  {"cm_stream_switch_master_config_fifo0", aie2ps::cm_stream_switch_master_config_fifo0},
+  {"cm_stream_switch_master_config_north0", aie2ps::cm_stream_switch_master_config_north0},
+  {"cm_stream_switch_master_config_north1", aie2ps::cm_stream_switch_master_config_north1},
+  {"cm_stream_switch_master_config_north2", aie2ps::cm_stream_switch_master_config_north2},
+  {"cm_stream_switch_master_config_north3", aie2ps::cm_stream_switch_master_config_north3},
+  {"cm_stream_switch_master_config_north4", aie2ps::cm_stream_switch_master_config_north4},
+  {"cm_stream_switch_master_config_north5", aie2ps::cm_stream_switch_master_config_north5},
+  {"cm_stream_switch_master_config_south0", aie2ps::cm_stream_switch_master_config_south0},
+  {"cm_stream_switch_master_config_south1", aie2ps::cm_stream_switch_master_config_south1},
+  {"cm_stream_switch_master_config_south2", aie2ps::cm_stream_switch_master_config_south2},
+  {"cm_stream_switch_master_config_south3", aie2ps::cm_stream_switch_master_config_south3},
+  {"cm_stream_switch_master_config_tile_ctrl", aie2ps::cm_stream_switch_master_config_tile_ctrl},
+  {"cm_stream_switch_master_config_west0", aie2ps::cm_stream_switch_master_config_west0},
+  {"cm_stream_switch_master_config_west1", aie2ps::cm_stream_switch_master_config_west1},
+  {"cm_stream_switch_master_config_west2", aie2ps::cm_stream_switch_master_config_west2},
+  {"cm_stream_switch_master_config_west3", aie2ps::cm_stream_switch_master_config_west3},
+  {"cm_stream_switch_parity_injection", aie2ps::cm_stream_switch_parity_injection},
+  {"cm_stream_switch_parity_status", aie2ps::cm_stream_switch_parity_status},
+  {"cm_stream_switch_slave_aie_core0_slot0", aie2ps::cm_stream_switch_slave_aie_core0_slot0},
+  {"cm_stream_switch_slave_aie_core0_slot1", aie2ps::cm_stream_switch_slave_aie_core0_slot1},
+  {"cm_stream_switch_slave_aie_core0_slot2", aie2ps::cm_stream_switch_slave_aie_core0_slot2},
+  {"cm_stream_switch_slave_aie_core0_slot3", aie2ps::cm_stream_switch_slave_aie_core0_slot3},
+  {"cm_stream_switch_slave_aie_trace_slot0", aie2ps::cm_stream_switch_slave_aie_trace_slot0},
+  {"cm_stream_switch_slave_aie_trace_slot1", aie2ps::cm_stream_switch_slave_aie_trace_slot1},
+  {"cm_stream_switch_slave_aie_trace_slot2", aie2ps::cm_stream_switch_slave_aie_trace_slot2},
+  {"cm_stream_switch_slave_aie_trace_slot3", aie2ps::cm_stream_switch_slave_aie_trace_slot3},
+  {"cm_stream_switch_slave_config_aie_core0", aie2ps::cm_stream_switch_slave_config_aie_core0},
+  {"cm_stream_switch_slave_config_aie_trace", aie2ps::cm_stream_switch_slave_config_aie_trace},
+  {"cm_stream_switch_slave_config_dma_0", aie2ps::cm_stream_switch_slave_config_dma_0},
+  {"cm_stream_switch_slave_config_dma_1", aie2ps::cm_stream_switch_slave_config_dma_1},
+  {"cm_stream_switch_slave_config_east_0", aie2ps::cm_stream_switch_slave_config_east_0},
+  {"cm_stream_switch_slave_config_east_1", aie2ps::cm_stream_switch_slave_config_east_1},
+  {"cm_stream_switch_slave_config_east_2", aie2ps::cm_stream_switch_slave_config_east_2},
+  {"cm_stream_switch_slave_config_east_3", aie2ps::cm_stream_switch_slave_config_east_3},
+  {"cm_stream_switch_slave_config_fifo_0", aie2ps::cm_stream_switch_slave_config_fifo_0},
+  {"cm_stream_switch_slave_config_mem_trace", aie2ps::cm_stream_switch_slave_config_mem_trace},
+  {"cm_stream_switch_slave_config_north_0", aie2ps::cm_stream_switch_slave_config_north_0},
+  {"cm_stream_switch_slave_config_north_1", aie2ps::cm_stream_switch_slave_config_north_1},
+  {"cm_stream_switch_slave_config_north_2", aie2ps::cm_stream_switch_slave_config_north_2},
+  {"cm_stream_switch_slave_config_north_3", aie2ps::cm_stream_switch_slave_config_north_3},
+  {"cm_stream_switch_slave_config_south_0", aie2ps::cm_stream_switch_slave_config_south_0},
+  {"cm_stream_switch_slave_config_south_1", aie2ps::cm_stream_switch_slave_config_south_1},
+  {"cm_stream_switch_slave_config_south_2", aie2ps::cm_stream_switch_slave_config_south_2},
+  {"cm_stream_switch_slave_config_south_3", aie2ps::cm_stream_switch_slave_config_south_3},
+  {"cm_stream_switch_slave_config_south_4", aie2ps::cm_stream_switch_slave_config_south_4},
+  {"cm_stream_switch_slave_config_south_5", aie2ps::cm_stream_switch_slave_config_south_5},
+  {"cm_stream_switch_slave_config_tile_ctrl", aie2ps::cm_stream_switch_slave_config_tile_ctrl},
+  {"cm_stream_switch_slave_config_west_0", aie2ps::cm_stream_switch_slave_config_west_0},
+  {"cm_stream_switch_slave_config_west_1", aie2ps::cm_stream_switch_slave_config_west_1},
+  {"cm_stream_switch_slave_config_west_2", aie2ps::cm_stream_switch_slave_config_west_2},
+  {"cm_stream_switch_slave_config_west_3", aie2ps::cm_stream_switch_slave_config_west_3},
+  {"cm_stream_switch_slave_dma_0_slot0", aie2ps::cm_stream_switch_slave_dma_0_slot0},
+  {"cm_stream_switch_slave_dma_0_slot1", aie2ps::cm_stream_switch_slave_dma_0_slot1},
+  {"cm_stream_switch_slave_dma_0_slot2", aie2ps::cm_stream_switch_slave_dma_0_slot2},
+  {"cm_stream_switch_slave_dma_0_slot3", aie2ps::cm_stream_switch_slave_dma_0_slot3},
+  {"cm_stream_switch_slave_dma_1_slot0", aie2ps::cm_stream_switch_slave_dma_1_slot0},
+  {"cm_stream_switch_slave_dma_1_slot1", aie2ps::cm_stream_switch_slave_dma_1_slot1},
+  {"cm_stream_switch_slave_dma_1_slot2", aie2ps::cm_stream_switch_slave_dma_1_slot2},
+  {"cm_stream_switch_slave_dma_1_slot3", aie2ps::cm_stream_switch_slave_dma_1_slot3},
+  {"cm_stream_switch_slave_east_0_slot0", aie2ps::cm_stream_switch_slave_east_0_slot0},
+  {"cm_stream_switch_slave_east_0_slot1", aie2ps::cm_stream_switch_slave_east_0_slot1},
+  {"cm_stream_switch_slave_east_0_slot2", aie2ps::cm_stream_switch_slave_east_0_slot2},
+  {"cm_stream_switch_slave_east_0_slot3", aie2ps::cm_stream_switch_slave_east_0_slot3},
+  {"cm_stream_switch_slave_east_1_slot0", aie2ps::cm_stream_switch_slave_east_1_slot0},
+  {"cm_stream_switch_slave_east_1_slot1", aie2ps::cm_stream_switch_slave_east_1_slot1},
+  {"cm_stream_switch_slave_east_1_slot2", aie2ps::cm_stream_switch_slave_east_1_slot2},
+  {"cm_stream_switch_slave_east_1_slot3", aie2ps::cm_stream_switch_slave_east_1_slot3},
+  {"cm_stream_switch_slave_east_2_slot0", aie2ps::cm_stream_switch_slave_east_2_slot0},
+  {"cm_stream_switch_slave_east_2_slot1", aie2ps::cm_stream_switch_slave_east_2_slot1},
+  {"cm_stream_switch_slave_east_2_slot2", aie2ps::cm_stream_switch_slave_east_2_slot2},
+  {"cm_stream_switch_slave_east_2_slot3", aie2ps::cm_stream_switch_slave_east_2_slot3},
+  {"cm_stream_switch_slave_east_3_slot0", aie2ps::cm_stream_switch_slave_east_3_slot0},
+  {"cm_stream_switch_slave_east_3_slot1", aie2ps::cm_stream_switch_slave_east_3_slot1},
+  {"cm_stream_switch_slave_east_3_slot2", aie2ps::cm_stream_switch_slave_east_3_slot2},
+  {"cm_stream_switch_slave_east_3_slot3", aie2ps::cm_stream_switch_slave_east_3_slot3},
+  {"cm_stream_switch_slave_fifo_0_slot0", aie2ps::cm_stream_switch_slave_fifo_0_slot0},
+  {"cm_stream_switch_slave_fifo_0_slot1", aie2ps::cm_stream_switch_slave_fifo_0_slot1},
+  {"cm_stream_switch_slave_fifo_0_slot2", aie2ps::cm_stream_switch_slave_fifo_0_slot2},
+  {"cm_stream_switch_slave_fifo_0_slot3", aie2ps::cm_stream_switch_slave_fifo_0_slot3},
+  {"cm_stream_switch_slave_mem_trace_slot0", aie2ps::cm_stream_switch_slave_mem_trace_slot0},
+  {"cm_stream_switch_slave_mem_trace_slot1", aie2ps::cm_stream_switch_slave_mem_trace_slot1},
+  {"cm_stream_switch_slave_mem_trace_slot2", aie2ps::cm_stream_switch_slave_mem_trace_slot2},
+  {"cm_stream_switch_slave_mem_trace_slot3", aie2ps::cm_stream_switch_slave_mem_trace_slot3},
+  {"cm_stream_switch_slave_north_0_slot0", aie2ps::cm_stream_switch_slave_north_0_slot0},
+  {"cm_stream_switch_slave_north_0_slot1", aie2ps::cm_stream_switch_slave_north_0_slot1},
+  {"cm_stream_switch_slave_north_0_slot2", aie2ps::cm_stream_switch_slave_north_0_slot2},
+  {"cm_stream_switch_slave_north_0_slot3", aie2ps::cm_stream_switch_slave_north_0_slot3},
+  {"cm_stream_switch_slave_north_1_slot0", aie2ps::cm_stream_switch_slave_north_1_slot0},
+  {"cm_stream_switch_slave_north_1_slot1", aie2ps::cm_stream_switch_slave_north_1_slot1},
+  {"cm_stream_switch_slave_north_1_slot2", aie2ps::cm_stream_switch_slave_north_1_slot2},
+  {"cm_stream_switch_slave_north_1_slot3", aie2ps::cm_stream_switch_slave_north_1_slot3},
+  {"cm_stream_switch_slave_north_2_slot0", aie2ps::cm_stream_switch_slave_north_2_slot0},
+  {"cm_stream_switch_slave_north_2_slot1", aie2ps::cm_stream_switch_slave_north_2_slot1},
+  {"cm_stream_switch_slave_north_2_slot2", aie2ps::cm_stream_switch_slave_north_2_slot2},
+  {"cm_stream_switch_slave_north_2_slot3", aie2ps::cm_stream_switch_slave_north_2_slot3},
+  {"cm_stream_switch_slave_north_3_slot0", aie2ps::cm_stream_switch_slave_north_3_slot0},
+  {"cm_stream_switch_slave_north_3_slot1", aie2ps::cm_stream_switch_slave_north_3_slot1},
+  {"cm_stream_switch_slave_north_3_slot2", aie2ps::cm_stream_switch_slave_north_3_slot2},
+  {"cm_stream_switch_slave_north_3_slot3", aie2ps::cm_stream_switch_slave_north_3_slot3},
+  {"cm_stream_switch_slave_south_0_slot0", aie2ps::cm_stream_switch_slave_south_0_slot0},
+  {"cm_stream_switch_slave_south_0_slot1", aie2ps::cm_stream_switch_slave_south_0_slot1},
+  {"cm_stream_switch_slave_south_0_slot2", aie2ps::cm_stream_switch_slave_south_0_slot2},
+  {"cm_stream_switch_slave_south_0_slot3", aie2ps::cm_stream_switch_slave_south_0_slot3},
+  {"cm_stream_switch_slave_south_1_slot0", aie2ps::cm_stream_switch_slave_south_1_slot0},
+  {"cm_stream_switch_slave_south_1_slot1", aie2ps::cm_stream_switch_slave_south_1_slot1},
+  {"cm_stream_switch_slave_south_1_slot2", aie2ps::cm_stream_switch_slave_south_1_slot2},
+  {"cm_stream_switch_slave_south_1_slot3", aie2ps::cm_stream_switch_slave_south_1_slot3},
+  {"cm_stream_switch_slave_south_2_slot0", aie2ps::cm_stream_switch_slave_south_2_slot0},
+  {"cm_stream_switch_slave_south_2_slot1", aie2ps::cm_stream_switch_slave_south_2_slot1},
+  {"cm_stream_switch_slave_south_2_slot2", aie2ps::cm_stream_switch_slave_south_2_slot2},
+  {"cm_stream_switch_slave_south_2_slot3", aie2ps::cm_stream_switch_slave_south_2_slot3},
+  {"cm_stream_switch_slave_south_3_slot0", aie2ps::cm_stream_switch_slave_south_3_slot0},
+  {"cm_stream_switch_slave_south_3_slot1", aie2ps::cm_stream_switch_slave_south_3_slot1},
+  {"cm_stream_switch_slave_south_3_slot2", aie2ps::cm_stream_switch_slave_south_3_slot2},
+  {"cm_stream_switch_slave_south_3_slot3", aie2ps::cm_stream_switch_slave_south_3_slot3},
+  {"cm_stream_switch_slave_south_4_slot0", aie2ps::cm_stream_switch_slave_south_4_slot0},
+  {"cm_stream_switch_slave_south_4_slot1", aie2ps::cm_stream_switch_slave_south_4_slot1},
+  {"cm_stream_switch_slave_south_4_slot2", aie2ps::cm_stream_switch_slave_south_4_slot2},
+  {"cm_stream_switch_slave_south_4_slot3", aie2ps::cm_stream_switch_slave_south_4_slot3},
+  {"cm_stream_switch_slave_south_5_slot0", aie2ps::cm_stream_switch_slave_south_5_slot0},
+  {"cm_stream_switch_slave_south_5_slot1", aie2ps::cm_stream_switch_slave_south_5_slot1},
+  {"cm_stream_switch_slave_south_5_slot2", aie2ps::cm_stream_switch_slave_south_5_slot2},
+  {"cm_stream_switch_slave_south_5_slot3", aie2ps::cm_stream_switch_slave_south_5_slot3},
+  {"cm_stream_switch_slave_tile_ctrl_slot0", aie2ps::cm_stream_switch_slave_tile_ctrl_slot0},
+  {"cm_stream_switch_slave_tile_ctrl_slot1", aie2ps::cm_stream_switch_slave_tile_ctrl_slot1},
+  {"cm_stream_switch_slave_tile_ctrl_slot2", aie2ps::cm_stream_switch_slave_tile_ctrl_slot2},
+  {"cm_stream_switch_slave_tile_ctrl_slot3", aie2ps::cm_stream_switch_slave_tile_ctrl_slot3},
+  {"cm_stream_switch_slave_west_0_slot0", aie2ps::cm_stream_switch_slave_west_0_slot0},
+  {"cm_stream_switch_slave_west_0_slot1", aie2ps::cm_stream_switch_slave_west_0_slot1},
+  {"cm_stream_switch_slave_west_0_slot2", aie2ps::cm_stream_switch_slave_west_0_slot2},
+  {"cm_stream_switch_slave_west_0_slot3", aie2ps::cm_stream_switch_slave_west_0_slot3},
+  {"cm_stream_switch_slave_west_1_slot0", aie2ps::cm_stream_switch_slave_west_1_slot0},
+  {"cm_stream_switch_slave_west_1_slot1", aie2ps::cm_stream_switch_slave_west_1_slot1},
+  {"cm_stream_switch_slave_west_1_slot2", aie2ps::cm_stream_switch_slave_west_1_slot2},
+  {"cm_stream_switch_slave_west_1_slot3", aie2ps::cm_stream_switch_slave_west_1_slot3},
+  {"cm_stream_switch_slave_west_2_slot0", aie2ps::cm_stream_switch_slave_west_2_slot0},
+  {"cm_stream_switch_slave_west_2_slot1", aie2ps::cm_stream_switch_slave_west_2_slot1},
+  {"cm_stream_switch_slave_west_2_slot2", aie2ps::cm_stream_switch_slave_west_2_slot2},
+  {"cm_stream_switch_slave_west_2_slot3", aie2ps::cm_stream_switch_slave_west_2_slot3},
+  {"cm_stream_switch_slave_west_3_slot0", aie2ps::cm_stream_switch_slave_west_3_slot0},
+  {"cm_stream_switch_slave_west_3_slot1", aie2ps::cm_stream_switch_slave_west_3_slot1},
+  {"cm_stream_switch_slave_west_3_slot2", aie2ps::cm_stream_switch_slave_west_3_slot2},
+  {"cm_stream_switch_slave_west_3_slot3", aie2ps::cm_stream_switch_slave_west_3_slot3},
+  {"cm_tile_control", aie2ps::cm_tile_control},
+  {"cm_tile_control_packet_handler_status", aie2ps::cm_tile_control_packet_handler_status},
+  {"cm_timer_control", aie2ps::cm_timer_control},
+  {"cm_timer_high", aie2ps::cm_timer_high},
+  {"cm_timer_low", aie2ps::cm_timer_low},
+  {"cm_timer_trig_event_high_value", aie2ps::cm_timer_trig_event_high_value},
+  {"cm_timer_trig_event_low_value", aie2ps::cm_timer_trig_event_low_value},
+  {"cm_trace_control0", aie2ps::cm_trace_control0},
+  {"cm_trace_control1", aie2ps::cm_trace_control1},
+  {"cm_trace_event0", aie2ps::cm_trace_event0},
+  {"cm_trace_event1", aie2ps::cm_trace_event1},
+  {"cm_trace_status", aie2ps::cm_trace_status},
+  {"mem_combo_event_control", aie2ps::mem_combo_event_control},
+  {"mem_combo_event_inputs", aie2ps::mem_combo_event_inputs},
+  {"mem_dma_bd0_0", aie2ps::mem_dma_bd0_0},
+  {"mem_dma_bd0_1", aie2ps::mem_dma_bd0_1},
+  {"mem_dma_bd0_2", aie2ps::mem_dma_bd0_2},
+  {"mem_dma_bd0_3", aie2ps::mem_dma_bd0_3},
+  {"mem_dma_bd0_4", aie2ps::mem_dma_bd0_4},
+  {"mem_dma_bd0_5", aie2ps::mem_dma_bd0_5},
+  {"mem_dma_bd0_6", aie2ps::mem_dma_bd0_6},
+  {"mem_dma_bd0_7", aie2ps::mem_dma_bd0_7},
+  {"mem_dma_bd10_0", aie2ps::mem_dma_bd10_0},
+  {"mem_dma_bd10_1", aie2ps::mem_dma_bd10_1},
+  {"mem_dma_bd10_2", aie2ps::mem_dma_bd10_2},
+  {"mem_dma_bd10_3", aie2ps::mem_dma_bd10_3},
+  {"mem_dma_bd10_4", aie2ps::mem_dma_bd10_4},
+  {"mem_dma_bd10_5", aie2ps::mem_dma_bd10_5},
+  {"mem_dma_bd10_6", aie2ps::mem_dma_bd10_6},
+  {"mem_dma_bd10_7", aie2ps::mem_dma_bd10_7},
+  {"mem_dma_bd11_0", aie2ps::mem_dma_bd11_0},
+  {"mem_dma_bd11_1", aie2ps::mem_dma_bd11_1},
+  {"mem_dma_bd11_2", aie2ps::mem_dma_bd11_2},
+  {"mem_dma_bd11_3", aie2ps::mem_dma_bd11_3},
+  {"mem_dma_bd11_4", aie2ps::mem_dma_bd11_4},
+  {"mem_dma_bd11_5", aie2ps::mem_dma_bd11_5},
+  {"mem_dma_bd11_6", aie2ps::mem_dma_bd11_6},
+  {"mem_dma_bd11_7", aie2ps::mem_dma_bd11_7},
+  {"mem_dma_bd12_0", aie2ps::mem_dma_bd12_0},
+  {"mem_dma_bd12_1", aie2ps::mem_dma_bd12_1},
+  {"mem_dma_bd12_2", aie2ps::mem_dma_bd12_2},
+  {"mem_dma_bd12_3", aie2ps::mem_dma_bd12_3},
+  {"mem_dma_bd12_4", aie2ps::mem_dma_bd12_4},
+  {"mem_dma_bd12_5", aie2ps::mem_dma_bd12_5},
+  {"mem_dma_bd12_6", aie2ps::mem_dma_bd12_6},
+  {"mem_dma_bd12_7", aie2ps::mem_dma_bd12_7},
+  {"mem_dma_bd13_0", aie2ps::mem_dma_bd13_0},
+  {"mem_dma_bd13_1", aie2ps::mem_dma_bd13_1},
+  {"mem_dma_bd13_2", aie2ps::mem_dma_bd13_2},
+  {"mem_dma_bd13_3", aie2ps::mem_dma_bd13_3},
+  {"mem_dma_bd13_4", aie2ps::mem_dma_bd13_4},
+  {"mem_dma_bd13_5", aie2ps::mem_dma_bd13_5},
+  {"mem_dma_bd13_6", aie2ps::mem_dma_bd13_6},
+  {"mem_dma_bd13_7", aie2ps::mem_dma_bd13_7},
+  {"mem_dma_bd14_0", aie2ps::mem_dma_bd14_0},
+  {"mem_dma_bd14_1", aie2ps::mem_dma_bd14_1},
+  {"mem_dma_bd14_2", aie2ps::mem_dma_bd14_2},
+  {"mem_dma_bd14_3", aie2ps::mem_dma_bd14_3},
+  {"mem_dma_bd14_4", aie2ps::mem_dma_bd14_4},
+  {"mem_dma_bd14_5", aie2ps::mem_dma_bd14_5},
+  {"mem_dma_bd14_6", aie2ps::mem_dma_bd14_6},
+  {"mem_dma_bd14_7", aie2ps::mem_dma_bd14_7},
+  {"mem_dma_bd15_0", aie2ps::mem_dma_bd15_0},
+  {"mem_dma_bd15_1", aie2ps::mem_dma_bd15_1},
+  {"mem_dma_bd15_2", aie2ps::mem_dma_bd15_2},
+  {"mem_dma_bd15_3", aie2ps::mem_dma_bd15_3},
+  {"mem_dma_bd15_4", aie2ps::mem_dma_bd15_4},
+  {"mem_dma_bd15_5", aie2ps::mem_dma_bd15_5},
+  {"mem_dma_bd15_6", aie2ps::mem_dma_bd15_6},
+  {"mem_dma_bd15_7", aie2ps::mem_dma_bd15_7},
+  {"mem_dma_bd16_0", aie2ps::mem_dma_bd16_0},
+  {"mem_dma_bd16_1", aie2ps::mem_dma_bd16_1},
+  {"mem_dma_bd16_2", aie2ps::mem_dma_bd16_2},
+  {"mem_dma_bd16_3", aie2ps::mem_dma_bd16_3},
+  {"mem_dma_bd16_4", aie2ps::mem_dma_bd16_4},
+  {"mem_dma_bd16_5", aie2ps::mem_dma_bd16_5},
+  {"mem_dma_bd16_6", aie2ps::mem_dma_bd16_6},
+  {"mem_dma_bd16_7", aie2ps::mem_dma_bd16_7},
+  {"mem_dma_bd17_0", aie2ps::mem_dma_bd17_0},
+  {"mem_dma_bd17_1", aie2ps::mem_dma_bd17_1},
+  {"mem_dma_bd17_2", aie2ps::mem_dma_bd17_2},
+  {"mem_dma_bd17_3", aie2ps::mem_dma_bd17_3},
+  {"mem_dma_bd17_4", aie2ps::mem_dma_bd17_4},
+  {"mem_dma_bd17_5", aie2ps::mem_dma_bd17_5},
+  {"mem_dma_bd17_6", aie2ps::mem_dma_bd17_6},
+  {"mem_dma_bd17_7", aie2ps::mem_dma_bd17_7},
+  {"mem_dma_bd18_0", aie2ps::mem_dma_bd18_0},
+  {"mem_dma_bd18_1", aie2ps::mem_dma_bd18_1},
+  {"mem_dma_bd18_2", aie2ps::mem_dma_bd18_2},
+  {"mem_dma_bd18_3", aie2ps::mem_dma_bd18_3},
+  {"mem_dma_bd18_4", aie2ps::mem_dma_bd18_4},
+  {"mem_dma_bd18_5", aie2ps::mem_dma_bd18_5},
+  {"mem_dma_bd18_6", aie2ps::mem_dma_bd18_6},
+  {"mem_dma_bd18_7", aie2ps::mem_dma_bd18_7},
+  {"mem_dma_bd19_0", aie2ps::mem_dma_bd19_0},
+  {"mem_dma_bd19_1", aie2ps::mem_dma_bd19_1},
+  {"mem_dma_bd19_2", aie2ps::mem_dma_bd19_2},
+  {"mem_dma_bd19_3", aie2ps::mem_dma_bd19_3},
+  {"mem_dma_bd19_4", aie2ps::mem_dma_bd19_4},
+  {"mem_dma_bd19_5", aie2ps::mem_dma_bd19_5},
+  {"mem_dma_bd19_6", aie2ps::mem_dma_bd19_6},
+  {"mem_dma_bd19_7", aie2ps::mem_dma_bd19_7},
+  {"mem_dma_bd1_0", aie2ps::mem_dma_bd1_0},
+  {"mem_dma_bd1_1", aie2ps::mem_dma_bd1_1},
+  {"mem_dma_bd1_2", aie2ps::mem_dma_bd1_2},
+  {"mem_dma_bd1_3", aie2ps::mem_dma_bd1_3},
+  {"mem_dma_bd1_4", aie2ps::mem_dma_bd1_4},
+  {"mem_dma_bd1_5", aie2ps::mem_dma_bd1_5},
+  {"mem_dma_bd1_6", aie2ps::mem_dma_bd1_6},
+  {"mem_dma_bd1_7", aie2ps::mem_dma_bd1_7},
+  {"mem_dma_bd20_0", aie2ps::mem_dma_bd20_0},
+  {"mem_dma_bd20_1", aie2ps::mem_dma_bd20_1},
+  {"mem_dma_bd20_2", aie2ps::mem_dma_bd20_2},
+  {"mem_dma_bd20_3", aie2ps::mem_dma_bd20_3},
+  {"mem_dma_bd20_4", aie2ps::mem_dma_bd20_4},
+  {"mem_dma_bd20_5", aie2ps::mem_dma_bd20_5},
+  {"mem_dma_bd20_6", aie2ps::mem_dma_bd20_6},
+  {"mem_dma_bd20_7", aie2ps::mem_dma_bd20_7},
+  {"mem_dma_bd21_0", aie2ps::mem_dma_bd21_0},
+  {"mem_dma_bd21_1", aie2ps::mem_dma_bd21_1},
+  {"mem_dma_bd21_2", aie2ps::mem_dma_bd21_2},
+  {"mem_dma_bd21_3", aie2ps::mem_dma_bd21_3},
+  {"mem_dma_bd21_4", aie2ps::mem_dma_bd21_4},
+  {"mem_dma_bd21_5", aie2ps::mem_dma_bd21_5},
+  {"mem_dma_bd21_6", aie2ps::mem_dma_bd21_6},
+  {"mem_dma_bd21_7", aie2ps::mem_dma_bd21_7},
+  {"mem_dma_bd22_0", aie2ps::mem_dma_bd22_0},
+  {"mem_dma_bd22_1", aie2ps::mem_dma_bd22_1},
+  {"mem_dma_bd22_2", aie2ps::mem_dma_bd22_2},
+  {"mem_dma_bd22_3", aie2ps::mem_dma_bd22_3},
+  {"mem_dma_bd22_4", aie2ps::mem_dma_bd22_4},
+  {"mem_dma_bd22_5", aie2ps::mem_dma_bd22_5},
+  {"mem_dma_bd22_6", aie2ps::mem_dma_bd22_6},
+  {"mem_dma_bd22_7", aie2ps::mem_dma_bd22_7},
+  {"mem_dma_bd23_0", aie2ps::mem_dma_bd23_0},
+  {"mem_dma_bd23_1", aie2ps::mem_dma_bd23_1},
+  {"mem_dma_bd23_2", aie2ps::mem_dma_bd23_2},
+  {"mem_dma_bd23_3", aie2ps::mem_dma_bd23_3},
+  {"mem_dma_bd23_4", aie2ps::mem_dma_bd23_4},
+  {"mem_dma_bd23_5", aie2ps::mem_dma_bd23_5},
+  {"mem_dma_bd23_6", aie2ps::mem_dma_bd23_6},
+  {"mem_dma_bd23_7", aie2ps::mem_dma_bd23_7},
+  {"mem_dma_bd24_0", aie2ps::mem_dma_bd24_0},
+  {"mem_dma_bd24_1", aie2ps::mem_dma_bd24_1},
+  {"mem_dma_bd24_2", aie2ps::mem_dma_bd24_2},
+  {"mem_dma_bd24_3", aie2ps::mem_dma_bd24_3},
+  {"mem_dma_bd24_4", aie2ps::mem_dma_bd24_4},
+  {"mem_dma_bd24_5", aie2ps::mem_dma_bd24_5},
+  {"mem_dma_bd24_6", aie2ps::mem_dma_bd24_6},
+  {"mem_dma_bd24_7", aie2ps::mem_dma_bd24_7},
+  {"mem_dma_bd25_0", aie2ps::mem_dma_bd25_0},
+  {"mem_dma_bd25_1", aie2ps::mem_dma_bd25_1},
+  {"mem_dma_bd25_2", aie2ps::mem_dma_bd25_2},
+  {"mem_dma_bd25_3", aie2ps::mem_dma_bd25_3},
+  {"mem_dma_bd25_4", aie2ps::mem_dma_bd25_4},
+  {"mem_dma_bd25_5", aie2ps::mem_dma_bd25_5},
+  {"mem_dma_bd25_6", aie2ps::mem_dma_bd25_6},
+  {"mem_dma_bd25_7", aie2ps::mem_dma_bd25_7},
+  {"mem_dma_bd26_0", aie2ps::mem_dma_bd26_0},
+  {"mem_dma_bd26_1", aie2ps::mem_dma_bd26_1},
+  {"mem_dma_bd26_2", aie2ps::mem_dma_bd26_2},
+  {"mem_dma_bd26_3", aie2ps::mem_dma_bd26_3},
+  {"mem_dma_bd26_4", aie2ps::mem_dma_bd26_4},
+  {"mem_dma_bd26_5", aie2ps::mem_dma_bd26_5},
+  {"mem_dma_bd26_6", aie2ps::mem_dma_bd26_6},
+  {"mem_dma_bd26_7", aie2ps::mem_dma_bd26_7},
+  {"mem_dma_bd27_0", aie2ps::mem_dma_bd27_0},
+  {"mem_dma_bd27_1", aie2ps::mem_dma_bd27_1},
+  {"mem_dma_bd27_2", aie2ps::mem_dma_bd27_2},
+  {"mem_dma_bd27_3", aie2ps::mem_dma_bd27_3},
+  {"mem_dma_bd27_4", aie2ps::mem_dma_bd27_4},
+  {"mem_dma_bd27_5", aie2ps::mem_dma_bd27_5},
+  {"mem_dma_bd27_6", aie2ps::mem_dma_bd27_6},
+  {"mem_dma_bd27_7", aie2ps::mem_dma_bd27_7},
+  {"mem_dma_bd28_0", aie2ps::mem_dma_bd28_0},
+  {"mem_dma_bd28_1", aie2ps::mem_dma_bd28_1},
+  {"mem_dma_bd28_2", aie2ps::mem_dma_bd28_2},
+  {"mem_dma_bd28_3", aie2ps::mem_dma_bd28_3},
+  {"mem_dma_bd28_4", aie2ps::mem_dma_bd28_4},
+  {"mem_dma_bd28_5", aie2ps::mem_dma_bd28_5},
+  {"mem_dma_bd28_6", aie2ps::mem_dma_bd28_6},
+  {"mem_dma_bd28_7", aie2ps::mem_dma_bd28_7},
+  {"mem_dma_bd29_0", aie2ps::mem_dma_bd29_0},
+  {"mem_dma_bd29_1", aie2ps::mem_dma_bd29_1},
+  {"mem_dma_bd29_2", aie2ps::mem_dma_bd29_2},
+  {"mem_dma_bd29_3", aie2ps::mem_dma_bd29_3},
+  {"mem_dma_bd29_4", aie2ps::mem_dma_bd29_4},
+  {"mem_dma_bd29_5", aie2ps::mem_dma_bd29_5},
+  {"mem_dma_bd29_6", aie2ps::mem_dma_bd29_6},
+  {"mem_dma_bd29_7", aie2ps::mem_dma_bd29_7},
+  {"mem_dma_bd2_0", aie2ps::mem_dma_bd2_0},
+  {"mem_dma_bd2_1", aie2ps::mem_dma_bd2_1},
+  {"mem_dma_bd2_2", aie2ps::mem_dma_bd2_2},
+  {"mem_dma_bd2_3", aie2ps::mem_dma_bd2_3},
+  {"mem_dma_bd2_4", aie2ps::mem_dma_bd2_4},
+  {"mem_dma_bd2_5", aie2ps::mem_dma_bd2_5},
+  {"mem_dma_bd2_6", aie2ps::mem_dma_bd2_6},
+  {"mem_dma_bd2_7", aie2ps::mem_dma_bd2_7},
+  {"mem_dma_bd30_0", aie2ps::mem_dma_bd30_0},
+  {"mem_dma_bd30_1", aie2ps::mem_dma_bd30_1},
+  {"mem_dma_bd30_2", aie2ps::mem_dma_bd30_2},
+  {"mem_dma_bd30_3", aie2ps::mem_dma_bd30_3},
+  {"mem_dma_bd30_4", aie2ps::mem_dma_bd30_4},
+  {"mem_dma_bd30_5", aie2ps::mem_dma_bd30_5},
+  {"mem_dma_bd30_6", aie2ps::mem_dma_bd30_6},
+  {"mem_dma_bd30_7", aie2ps::mem_dma_bd30_7},
+  {"mem_dma_bd31_0", aie2ps::mem_dma_bd31_0},
+  {"mem_dma_bd31_1", aie2ps::mem_dma_bd31_1},
+  {"mem_dma_bd31_2", aie2ps::mem_dma_bd31_2},
+  {"mem_dma_bd31_3", aie2ps::mem_dma_bd31_3},
+  {"mem_dma_bd31_4", aie2ps::mem_dma_bd31_4},
+  {"mem_dma_bd31_5", aie2ps::mem_dma_bd31_5},
+  {"mem_dma_bd31_6", aie2ps::mem_dma_bd31_6},
+  {"mem_dma_bd31_7", aie2ps::mem_dma_bd31_7},
+  {"mem_dma_bd32_0", aie2ps::mem_dma_bd32_0},
+  {"mem_dma_bd32_1", aie2ps::mem_dma_bd32_1},
+  {"mem_dma_bd32_2", aie2ps::mem_dma_bd32_2},
+  {"mem_dma_bd32_3", aie2ps::mem_dma_bd32_3},
+  {"mem_dma_bd32_4", aie2ps::mem_dma_bd32_4},
+  {"mem_dma_bd32_5", aie2ps::mem_dma_bd32_5},
+  {"mem_dma_bd32_6", aie2ps::mem_dma_bd32_6},
+  {"mem_dma_bd32_7", aie2ps::mem_dma_bd32_7},
+  {"mem_dma_bd33_0", aie2ps::mem_dma_bd33_0},
+  {"mem_dma_bd33_1", aie2ps::mem_dma_bd33_1},
+  {"mem_dma_bd33_2", aie2ps::mem_dma_bd33_2},
+  {"mem_dma_bd33_3", aie2ps::mem_dma_bd33_3},
+  {"mem_dma_bd33_4", aie2ps::mem_dma_bd33_4},
+  {"mem_dma_bd33_5", aie2ps::mem_dma_bd33_5},
+  {"mem_dma_bd33_6", aie2ps::mem_dma_bd33_6},
+  {"mem_dma_bd33_7", aie2ps::mem_dma_bd33_7},
+  {"mem_dma_bd34_0", aie2ps::mem_dma_bd34_0},
+  {"mem_dma_bd34_1", aie2ps::mem_dma_bd34_1},
+  {"mem_dma_bd34_2", aie2ps::mem_dma_bd34_2},
+  {"mem_dma_bd34_3", aie2ps::mem_dma_bd34_3},
+  {"mem_dma_bd34_4", aie2ps::mem_dma_bd34_4},
+  {"mem_dma_bd34_5", aie2ps::mem_dma_bd34_5},
+  {"mem_dma_bd34_6", aie2ps::mem_dma_bd34_6},
+  {"mem_dma_bd34_7", aie2ps::mem_dma_bd34_7},
+  {"mem_dma_bd35_0", aie2ps::mem_dma_bd35_0},
+  {"mem_dma_bd35_1", aie2ps::mem_dma_bd35_1},
+  {"mem_dma_bd35_2", aie2ps::mem_dma_bd35_2},
+  {"mem_dma_bd35_3", aie2ps::mem_dma_bd35_3},
+  {"mem_dma_bd35_4", aie2ps::mem_dma_bd35_4},
+  {"mem_dma_bd35_5", aie2ps::mem_dma_bd35_5},
+  {"mem_dma_bd35_6", aie2ps::mem_dma_bd35_6},
+  {"mem_dma_bd35_7", aie2ps::mem_dma_bd35_7},
+  {"mem_dma_bd36_0", aie2ps::mem_dma_bd36_0},
+  {"mem_dma_bd36_1", aie2ps::mem_dma_bd36_1},
+  {"mem_dma_bd36_2", aie2ps::mem_dma_bd36_2},
+  {"mem_dma_bd36_3", aie2ps::mem_dma_bd36_3},
+  {"mem_dma_bd36_4", aie2ps::mem_dma_bd36_4},
+  {"mem_dma_bd36_5", aie2ps::mem_dma_bd36_5},
+  {"mem_dma_bd36_6", aie2ps::mem_dma_bd36_6},
+  {"mem_dma_bd36_7", aie2ps::mem_dma_bd36_7},
+  {"mem_dma_bd37_0", aie2ps::mem_dma_bd37_0},
+  {"mem_dma_bd37_1", aie2ps::mem_dma_bd37_1},
+  {"mem_dma_bd37_2", aie2ps::mem_dma_bd37_2},
+  {"mem_dma_bd37_3", aie2ps::mem_dma_bd37_3},
+  {"mem_dma_bd37_4", aie2ps::mem_dma_bd37_4},
+  {"mem_dma_bd37_5", aie2ps::mem_dma_bd37_5},
+  {"mem_dma_bd37_6", aie2ps::mem_dma_bd37_6},
+  {"mem_dma_bd37_7", aie2ps::mem_dma_bd37_7},
+  {"mem_dma_bd38_0", aie2ps::mem_dma_bd38_0},
+  {"mem_dma_bd38_1", aie2ps::mem_dma_bd38_1},
+  {"mem_dma_bd38_2", aie2ps::mem_dma_bd38_2},
+  {"mem_dma_bd38_3", aie2ps::mem_dma_bd38_3},
+  {"mem_dma_bd38_4", aie2ps::mem_dma_bd38_4},
+  {"mem_dma_bd38_5", aie2ps::mem_dma_bd38_5},
+  {"mem_dma_bd38_6", aie2ps::mem_dma_bd38_6},
+  {"mem_dma_bd38_7", aie2ps::mem_dma_bd38_7},
+  {"mem_dma_bd39_0", aie2ps::mem_dma_bd39_0},
+  {"mem_dma_bd39_1", aie2ps::mem_dma_bd39_1},
+  {"mem_dma_bd39_2", aie2ps::mem_dma_bd39_2},
+  {"mem_dma_bd39_3", aie2ps::mem_dma_bd39_3},
+  {"mem_dma_bd39_4", aie2ps::mem_dma_bd39_4},
+  {"mem_dma_bd39_5", aie2ps::mem_dma_bd39_5},
+  {"mem_dma_bd39_6", aie2ps::mem_dma_bd39_6},
+  {"mem_dma_bd39_7", aie2ps::mem_dma_bd39_7},
+  {"mem_dma_bd3_0", aie2ps::mem_dma_bd3_0},
+  {"mem_dma_bd3_1", aie2ps::mem_dma_bd3_1},
+  {"mem_dma_bd3_2", aie2ps::mem_dma_bd3_2},
+  {"mem_dma_bd3_3", aie2ps::mem_dma_bd3_3},
+  {"mem_dma_bd3_4", aie2ps::mem_dma_bd3_4},
+  {"mem_dma_bd3_5", aie2ps::mem_dma_bd3_5},
+  {"mem_dma_bd3_6", aie2ps::mem_dma_bd3_6},
+  {"mem_dma_bd3_7", aie2ps::mem_dma_bd3_7},
+  {"mem_dma_bd40_0", aie2ps::mem_dma_bd40_0},
+  {"mem_dma_bd40_1", aie2ps::mem_dma_bd40_1},
+  {"mem_dma_bd40_2", aie2ps::mem_dma_bd40_2},
+  {"mem_dma_bd40_3", aie2ps::mem_dma_bd40_3},
+  {"mem_dma_bd40_4", aie2ps::mem_dma_bd40_4},
+  {"mem_dma_bd40_5", aie2ps::mem_dma_bd40_5},
+  {"mem_dma_bd40_6", aie2ps::mem_dma_bd40_6},
+  {"mem_dma_bd40_7", aie2ps::mem_dma_bd40_7},
+  {"mem_dma_bd41_0", aie2ps::mem_dma_bd41_0},
+  {"mem_dma_bd41_1", aie2ps::mem_dma_bd41_1},
+  {"mem_dma_bd41_2", aie2ps::mem_dma_bd41_2},
+  {"mem_dma_bd41_3", aie2ps::mem_dma_bd41_3},
+  {"mem_dma_bd41_4", aie2ps::mem_dma_bd41_4},
+  {"mem_dma_bd41_5", aie2ps::mem_dma_bd41_5},
+  {"mem_dma_bd41_6", aie2ps::mem_dma_bd41_6},
+  {"mem_dma_bd41_7", aie2ps::mem_dma_bd41_7},
+  {"mem_dma_bd42_0", aie2ps::mem_dma_bd42_0},
+  {"mem_dma_bd42_1", aie2ps::mem_dma_bd42_1},
+  {"mem_dma_bd42_2", aie2ps::mem_dma_bd42_2},
+  {"mem_dma_bd42_3", aie2ps::mem_dma_bd42_3},
+  {"mem_dma_bd42_4", aie2ps::mem_dma_bd42_4},
+  {"mem_dma_bd42_5", aie2ps::mem_dma_bd42_5},
+  {"mem_dma_bd42_6", aie2ps::mem_dma_bd42_6},
+  {"mem_dma_bd42_7", aie2ps::mem_dma_bd42_7},
+  {"mem_dma_bd43_0", aie2ps::mem_dma_bd43_0},
+  {"mem_dma_bd43_1", aie2ps::mem_dma_bd43_1},
+  {"mem_dma_bd43_2", aie2ps::mem_dma_bd43_2},
+  {"mem_dma_bd43_3", aie2ps::mem_dma_bd43_3},
+  {"mem_dma_bd43_4", aie2ps::mem_dma_bd43_4},
+  {"mem_dma_bd43_5", aie2ps::mem_dma_bd43_5},
+  {"mem_dma_bd43_6", aie2ps::mem_dma_bd43_6},
+  {"mem_dma_bd43_7", aie2ps::mem_dma_bd43_7},
+  {"mem_dma_bd44_0", aie2ps::mem_dma_bd44_0},
+  {"mem_dma_bd44_1", aie2ps::mem_dma_bd44_1},
+  {"mem_dma_bd44_2", aie2ps::mem_dma_bd44_2},
+  {"mem_dma_bd44_3", aie2ps::mem_dma_bd44_3},
+  {"mem_dma_bd44_4", aie2ps::mem_dma_bd44_4},
+  {"mem_dma_bd44_5", aie2ps::mem_dma_bd44_5},
+  {"mem_dma_bd44_6", aie2ps::mem_dma_bd44_6},
+  {"mem_dma_bd44_7", aie2ps::mem_dma_bd44_7},
+  {"mem_dma_bd45_0", aie2ps::mem_dma_bd45_0},
+  {"mem_dma_bd45_1", aie2ps::mem_dma_bd45_1},
+  {"mem_dma_bd45_2", aie2ps::mem_dma_bd45_2},
+  {"mem_dma_bd45_3", aie2ps::mem_dma_bd45_3},
+  {"mem_dma_bd45_4", aie2ps::mem_dma_bd45_4},
+  {"mem_dma_bd45_5", aie2ps::mem_dma_bd45_5},
+  {"mem_dma_bd45_6", aie2ps::mem_dma_bd45_6},
+  {"mem_dma_bd45_7", aie2ps::mem_dma_bd45_7},
+  {"mem_dma_bd46_0", aie2ps::mem_dma_bd46_0},
+  {"mem_dma_bd46_1", aie2ps::mem_dma_bd46_1},
+  {"mem_dma_bd46_2", aie2ps::mem_dma_bd46_2},
+  {"mem_dma_bd46_3", aie2ps::mem_dma_bd46_3},
+  {"mem_dma_bd46_4", aie2ps::mem_dma_bd46_4},
+  {"mem_dma_bd46_5", aie2ps::mem_dma_bd46_5},
+  {"mem_dma_bd46_6", aie2ps::mem_dma_bd46_6},
+  {"mem_dma_bd46_7", aie2ps::mem_dma_bd46_7},
+  {"mem_dma_bd47_0", aie2ps::mem_dma_bd47_0},
+  {"mem_dma_bd47_1", aie2ps::mem_dma_bd47_1},
+  {"mem_dma_bd47_2", aie2ps::mem_dma_bd47_2},
+  {"mem_dma_bd47_3", aie2ps::mem_dma_bd47_3},
+  {"mem_dma_bd47_4", aie2ps::mem_dma_bd47_4},
+  {"mem_dma_bd47_5", aie2ps::mem_dma_bd47_5},
+  {"mem_dma_bd47_6", aie2ps::mem_dma_bd47_6},
+  {"mem_dma_bd47_7", aie2ps::mem_dma_bd47_7},
+  {"mem_dma_bd4_0", aie2ps::mem_dma_bd4_0},
+  {"mem_dma_bd4_1", aie2ps::mem_dma_bd4_1},
+  {"mem_dma_bd4_2", aie2ps::mem_dma_bd4_2},
+  {"mem_dma_bd4_3", aie2ps::mem_dma_bd4_3},
+  {"mem_dma_bd4_4", aie2ps::mem_dma_bd4_4},
+  {"mem_dma_bd4_5", aie2ps::mem_dma_bd4_5},
+  {"mem_dma_bd4_6", aie2ps::mem_dma_bd4_6},
+  {"mem_dma_bd4_7", aie2ps::mem_dma_bd4_7},
+  {"mem_dma_bd5_0", aie2ps::mem_dma_bd5_0},
+  {"mem_dma_bd5_1", aie2ps::mem_dma_bd5_1},
+  {"mem_dma_bd5_2", aie2ps::mem_dma_bd5_2},
+  {"mem_dma_bd5_3", aie2ps::mem_dma_bd5_3},
+  {"mem_dma_bd5_4", aie2ps::mem_dma_bd5_4},
+  {"mem_dma_bd5_5", aie2ps::mem_dma_bd5_5},
+  {"mem_dma_bd5_6", aie2ps::mem_dma_bd5_6},
+  {"mem_dma_bd5_7", aie2ps::mem_dma_bd5_7},
+  {"mem_dma_bd6_0", aie2ps::mem_dma_bd6_0},
+  {"mem_dma_bd6_1", aie2ps::mem_dma_bd6_1},
+  {"mem_dma_bd6_2", aie2ps::mem_dma_bd6_2},
+  {"mem_dma_bd6_3", aie2ps::mem_dma_bd6_3},
+  {"mem_dma_bd6_4", aie2ps::mem_dma_bd6_4},
+  {"mem_dma_bd6_5", aie2ps::mem_dma_bd6_5},
+  {"mem_dma_bd6_6", aie2ps::mem_dma_bd6_6},
+  {"mem_dma_bd6_7", aie2ps::mem_dma_bd6_7},
+  {"mem_dma_bd7_0", aie2ps::mem_dma_bd7_0},
+  {"mem_dma_bd7_1", aie2ps::mem_dma_bd7_1},
+  {"mem_dma_bd7_2", aie2ps::mem_dma_bd7_2},
+  {"mem_dma_bd7_3", aie2ps::mem_dma_bd7_3},
+  {"mem_dma_bd7_4", aie2ps::mem_dma_bd7_4},
+  {"mem_dma_bd7_5", aie2ps::mem_dma_bd7_5},
+  {"mem_dma_bd7_6", aie2ps::mem_dma_bd7_6},
+  {"mem_dma_bd7_7", aie2ps::mem_dma_bd7_7},
+  {"mem_dma_bd8_0", aie2ps::mem_dma_bd8_0},
+  {"mem_dma_bd8_1", aie2ps::mem_dma_bd8_1},
+  {"mem_dma_bd8_2", aie2ps::mem_dma_bd8_2},
+  {"mem_dma_bd8_3", aie2ps::mem_dma_bd8_3},
+  {"mem_dma_bd8_4", aie2ps::mem_dma_bd8_4},
+  {"mem_dma_bd8_5", aie2ps::mem_dma_bd8_5},
+  {"mem_dma_bd8_6", aie2ps::mem_dma_bd8_6},
+  {"mem_dma_bd8_7", aie2ps::mem_dma_bd8_7},
+  {"mem_dma_bd9_0", aie2ps::mem_dma_bd9_0},
+  {"mem_dma_bd9_1", aie2ps::mem_dma_bd9_1},
+  {"mem_dma_bd9_2", aie2ps::mem_dma_bd9_2},
+  {"mem_dma_bd9_3", aie2ps::mem_dma_bd9_3},
+  {"mem_dma_bd9_4", aie2ps::mem_dma_bd9_4},
+  {"mem_dma_bd9_5", aie2ps::mem_dma_bd9_5},
+  {"mem_dma_bd9_6", aie2ps::mem_dma_bd9_6},
+  {"mem_dma_bd9_7", aie2ps::mem_dma_bd9_7},
+  {"mem_dma_event_channel_selection", aie2ps::mem_dma_event_channel_selection},
+  {"mem_dma_mm2s_0_constant_pad_value", aie2ps::mem_dma_mm2s_0_constant_pad_value},
+  {"mem_dma_mm2s_0_ctrl", aie2ps::mem_dma_mm2s_0_ctrl},
+  {"mem_dma_mm2s_0_start_queue", aie2ps::mem_dma_mm2s_0_start_queue},
+  {"mem_dma_mm2s_1_constant_pad_value", aie2ps::mem_dma_mm2s_1_constant_pad_value},
+  {"mem_dma_mm2s_1_ctrl", aie2ps::mem_dma_mm2s_1_ctrl},
+  {"mem_dma_mm2s_1_start_queue", aie2ps::mem_dma_mm2s_1_start_queue},
+  {"mem_dma_mm2s_2_constant_pad_value", aie2ps::mem_dma_mm2s_2_constant_pad_value},
+  {"mem_dma_mm2s_2_ctrl", aie2ps::mem_dma_mm2s_2_ctrl},
+  {"mem_dma_mm2s_2_start_queue", aie2ps::mem_dma_mm2s_2_start_queue},
+  {"mem_dma_mm2s_3_constant_pad_value", aie2ps::mem_dma_mm2s_3_constant_pad_value},
+  {"mem_dma_mm2s_3_ctrl", aie2ps::mem_dma_mm2s_3_ctrl},
+  {"mem_dma_mm2s_3_start_queue", aie2ps::mem_dma_mm2s_3_start_queue},
+  {"mem_dma_mm2s_4_constant_pad_value", aie2ps::mem_dma_mm2s_4_constant_pad_value},
+  {"mem_dma_mm2s_4_ctrl", aie2ps::mem_dma_mm2s_4_ctrl},
+  {"mem_dma_mm2s_4_start_queue", aie2ps::mem_dma_mm2s_4_start_queue},
+  {"mem_dma_mm2s_5_constant_pad_value", aie2ps::mem_dma_mm2s_5_constant_pad_value},
+  {"mem_dma_mm2s_5_ctrl", aie2ps::mem_dma_mm2s_5_ctrl},
+  {"mem_dma_mm2s_5_start_queue", aie2ps::mem_dma_mm2s_5_start_queue},
+  {"mem_dma_mm2s_status_0", aie2ps::mem_dma_mm2s_status_0},
+  {"mem_dma_mm2s_status_1", aie2ps::mem_dma_mm2s_status_1},
+  {"mem_dma_mm2s_status_2", aie2ps::mem_dma_mm2s_status_2},
+  {"mem_dma_mm2s_status_3", aie2ps::mem_dma_mm2s_status_3},
+  {"mem_dma_mm2s_status_4", aie2ps::mem_dma_mm2s_status_4},
+  {"mem_dma_mm2s_status_5", aie2ps::mem_dma_mm2s_status_5},
+  {"mem_dma_s2mm_0_ctrl", aie2ps::mem_dma_s2mm_0_ctrl},
+  {"mem_dma_s2mm_0_start_queue", aie2ps::mem_dma_s2mm_0_start_queue},
+  {"mem_dma_s2mm_1_ctrl", aie2ps::mem_dma_s2mm_1_ctrl},
+  {"mem_dma_s2mm_1_start_queue", aie2ps::mem_dma_s2mm_1_start_queue},
+  {"mem_dma_s2mm_2_ctrl", aie2ps::mem_dma_s2mm_2_ctrl},
+  {"mem_dma_s2mm_2_start_queue", aie2ps::mem_dma_s2mm_2_start_queue},
+  {"mem_dma_s2mm_3_ctrl", aie2ps::mem_dma_s2mm_3_ctrl},
+  {"mem_dma_s2mm_3_start_queue", aie2ps::mem_dma_s2mm_3_start_queue},
+  {"mem_dma_s2mm_4_ctrl", aie2ps::mem_dma_s2mm_4_ctrl},
+  {"mem_dma_s2mm_4_start_queue", aie2ps::mem_dma_s2mm_4_start_queue},
+  {"mem_dma_s2mm_5_ctrl", aie2ps::mem_dma_s2mm_5_ctrl},
+  {"mem_dma_s2mm_5_start_queue", aie2ps::mem_dma_s2mm_5_start_queue},
+  {"mem_dma_s2mm_current_write_count_0", aie2ps::mem_dma_s2mm_current_write_count_0},
+  {"mem_dma_s2mm_current_write_count_1", aie2ps::mem_dma_s2mm_current_write_count_1},
+  {"mem_dma_s2mm_current_write_count_2", aie2ps::mem_dma_s2mm_current_write_count_2},
+  {"mem_dma_s2mm_current_write_count_3", aie2ps::mem_dma_s2mm_current_write_count_3},
+  {"mem_dma_s2mm_current_write_count_4", aie2ps::mem_dma_s2mm_current_write_count_4},
+  {"mem_dma_s2mm_current_write_count_5", aie2ps::mem_dma_s2mm_current_write_count_5},
+  {"mem_dma_s2mm_fot_count_fifo_pop_0", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_0},
+  {"mem_dma_s2mm_fot_count_fifo_pop_1", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_1},
+  {"mem_dma_s2mm_fot_count_fifo_pop_2", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_2},
+  {"mem_dma_s2mm_fot_count_fifo_pop_3", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_3},
+  {"mem_dma_s2mm_fot_count_fifo_pop_4", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_4},
+  {"mem_dma_s2mm_fot_count_fifo_pop_5", aie2ps::mem_dma_s2mm_fot_count_fifo_pop_5},
+  {"mem_dma_s2mm_status_0", aie2ps::mem_dma_s2mm_status_0},
+  {"mem_dma_s2mm_status_1", aie2ps::mem_dma_s2mm_status_1},
+  {"mem_dma_s2mm_status_2", aie2ps::mem_dma_s2mm_status_2},
+  {"mem_dma_s2mm_status_3", aie2ps::mem_dma_s2mm_status_3},
+  {"mem_dma_s2mm_status_4", aie2ps::mem_dma_s2mm_status_4},
+  {"mem_dma_s2mm_status_5", aie2ps::mem_dma_s2mm_status_5},
+  {"mem_edge_detection_event_control", aie2ps::mem_edge_detection_event_control},
+  {"mem_event_broadcast0", aie2ps::mem_event_broadcast0},
+  {"mem_event_broadcast1", aie2ps::mem_event_broadcast1},
+  {"mem_event_broadcast10", aie2ps::mem_event_broadcast10},
+  {"mem_event_broadcast11", aie2ps::mem_event_broadcast11},
+  {"mem_event_broadcast12", aie2ps::mem_event_broadcast12},
+  {"mem_event_broadcast13", aie2ps::mem_event_broadcast13},
+  {"mem_event_broadcast14", aie2ps::mem_event_broadcast14},
+  {"mem_event_broadcast15", aie2ps::mem_event_broadcast15},
+  {"mem_event_broadcast2", aie2ps::mem_event_broadcast2},
+  {"mem_event_broadcast3", aie2ps::mem_event_broadcast3},
+  {"mem_event_broadcast4", aie2ps::mem_event_broadcast4},
+  {"mem_event_broadcast5", aie2ps::mem_event_broadcast5},
+  {"mem_event_broadcast6", aie2ps::mem_event_broadcast6},
+  {"mem_event_broadcast7", aie2ps::mem_event_broadcast7},
+  {"mem_event_broadcast8", aie2ps::mem_event_broadcast8},
+  {"mem_event_broadcast9", aie2ps::mem_event_broadcast9},
+  {"mem_event_broadcast_a_block_east_clr", aie2ps::mem_event_broadcast_a_block_east_clr},
+  {"mem_event_broadcast_a_block_east_set", aie2ps::mem_event_broadcast_a_block_east_set},
+  {"mem_event_broadcast_a_block_east_value", aie2ps::mem_event_broadcast_a_block_east_value},
+  {"mem_event_broadcast_a_block_north_clr", aie2ps::mem_event_broadcast_a_block_north_clr},
+  {"mem_event_broadcast_a_block_north_set", aie2ps::mem_event_broadcast_a_block_north_set},
+  {"mem_event_broadcast_a_block_north_value", aie2ps::mem_event_broadcast_a_block_north_value},
+  {"mem_event_broadcast_a_block_south_clr", aie2ps::mem_event_broadcast_a_block_south_clr},
+  {"mem_event_broadcast_a_block_south_set", aie2ps::mem_event_broadcast_a_block_south_set},
+  {"mem_event_broadcast_a_block_south_value", aie2ps::mem_event_broadcast_a_block_south_value},
+  {"mem_event_broadcast_a_block_west_clr", aie2ps::mem_event_broadcast_a_block_west_clr},
+  {"mem_event_broadcast_a_block_west_set", aie2ps::mem_event_broadcast_a_block_west_set},
+  {"mem_event_broadcast_a_block_west_value", aie2ps::mem_event_broadcast_a_block_west_value},
+  {"mem_event_broadcast_b_block_east_clr", aie2ps::mem_event_broadcast_b_block_east_clr},
+  {"mem_event_broadcast_b_block_east_set", aie2ps::mem_event_broadcast_b_block_east_set},
+  {"mem_event_broadcast_b_block_east_value", aie2ps::mem_event_broadcast_b_block_east_value},
+  {"mem_event_broadcast_b_block_north_clr", aie2ps::mem_event_broadcast_b_block_north_clr},
+  {"mem_event_broadcast_b_block_north_set", aie2ps::mem_event_broadcast_b_block_north_set},
+  {"mem_event_broadcast_b_block_north_value", aie2ps::mem_event_broadcast_b_block_north_value},
+  {"mem_event_broadcast_b_block_south_clr", aie2ps::mem_event_broadcast_b_block_south_clr},
+  {"mem_event_broadcast_b_block_south_set", aie2ps::mem_event_broadcast_b_block_south_set},
+  {"mem_event_broadcast_b_block_south_value", aie2ps::mem_event_broadcast_b_block_south_value},
+  {"mem_event_broadcast_b_block_west_clr", aie2ps::mem_event_broadcast_b_block_west_clr},
+  {"mem_event_broadcast_b_block_west_set", aie2ps::mem_event_broadcast_b_block_west_set},
+  {"mem_event_broadcast_b_block_west_value", aie2ps::mem_event_broadcast_b_block_west_value},
+  {"mem_event_generate", aie2ps::mem_event_generate},
+  {"mem_event_group_0_enable", aie2ps::mem_event_group_0_enable},
+  {"mem_event_group_broadcast_enable", aie2ps::mem_event_group_broadcast_enable},
+  {"mem_event_group_dma_enable", aie2ps::mem_event_group_dma_enable},
+  {"mem_event_group_error_enable", aie2ps::mem_event_group_error_enable},
+  {"mem_event_group_lock_enable", aie2ps::mem_event_group_lock_enable},
+  {"mem_event_group_memory_conflict_enable", aie2ps::mem_event_group_memory_conflict_enable},
+  {"mem_event_group_stream_switch_enable", aie2ps::mem_event_group_stream_switch_enable},
+  {"mem_event_group_user_event_enable", aie2ps::mem_event_group_user_event_enable},
+  {"mem_event_group_watchpoint_enable", aie2ps::mem_event_group_watchpoint_enable},
+  {"mem_event_status0", aie2ps::mem_event_status0},
+  {"mem_event_status1", aie2ps::mem_event_status1},
+  {"mem_event_status2", aie2ps::mem_event_status2},
+  {"mem_event_status3", aie2ps::mem_event_status3},
+  {"mem_event_status4", aie2ps::mem_event_status4},
+  {"mem_event_status5", aie2ps::mem_event_status5},
+  {"mem_lock0_value", aie2ps::mem_lock0_value},
+  {"mem_lock10_value", aie2ps::mem_lock10_value},
+  {"mem_lock11_value", aie2ps::mem_lock11_value},
+  {"mem_lock12_value", aie2ps::mem_lock12_value},
+  {"mem_lock13_value", aie2ps::mem_lock13_value},
+  {"mem_lock14_value", aie2ps::mem_lock14_value},
+  {"mem_lock15_value", aie2ps::mem_lock15_value},
+  {"mem_lock16_value", aie2ps::mem_lock16_value},
+  {"mem_lock17_value", aie2ps::mem_lock17_value},
+  {"mem_lock18_value", aie2ps::mem_lock18_value},
+  {"mem_lock19_value", aie2ps::mem_lock19_value},
+  {"mem_lock1_value", aie2ps::mem_lock1_value},
+  {"mem_lock20_value", aie2ps::mem_lock20_value},
+  {"mem_lock21_value", aie2ps::mem_lock21_value},
+  {"mem_lock22_value", aie2ps::mem_lock22_value},
+  {"mem_lock23_value", aie2ps::mem_lock23_value},
+  {"mem_lock24_value", aie2ps::mem_lock24_value},
+  {"mem_lock25_value", aie2ps::mem_lock25_value},
+  {"mem_lock26_value", aie2ps::mem_lock26_value},
+  {"mem_lock27_value", aie2ps::mem_lock27_value},
+  {"mem_lock28_value", aie2ps::mem_lock28_value},
+  {"mem_lock29_value", aie2ps::mem_lock29_value},
+  {"mem_lock2_value", aie2ps::mem_lock2_value},
+  {"mem_lock30_value", aie2ps::mem_lock30_value},
+  {"mem_lock31_value", aie2ps::mem_lock31_value},
+  {"mem_lock32_value", aie2ps::mem_lock32_value},
+  {"mem_lock33_value", aie2ps::mem_lock33_value},
+  {"mem_lock34_value", aie2ps::mem_lock34_value},
+  {"mem_lock35_value", aie2ps::mem_lock35_value},
+  {"mem_lock36_value", aie2ps::mem_lock36_value},
+  {"mem_lock37_value", aie2ps::mem_lock37_value},
+  {"mem_lock38_value", aie2ps::mem_lock38_value},
+  {"mem_lock39_value", aie2ps::mem_lock39_value},
+  {"mem_lock3_value", aie2ps::mem_lock3_value},
+  {"mem_lock40_value", aie2ps::mem_lock40_value},
+  {"mem_lock41_value", aie2ps::mem_lock41_value},
+  {"mem_lock42_value", aie2ps::mem_lock42_value},
+  {"mem_lock43_value", aie2ps::mem_lock43_value},
+  {"mem_lock44_value", aie2ps::mem_lock44_value},
+  {"mem_lock45_value", aie2ps::mem_lock45_value},
+  {"mem_lock46_value", aie2ps::mem_lock46_value},
+  {"mem_lock47_value", aie2ps::mem_lock47_value},
+  {"mem_lock48_value", aie2ps::mem_lock48_value},
+  {"mem_lock49_value", aie2ps::mem_lock49_value},
+  {"mem_lock4_value", aie2ps::mem_lock4_value},
+  {"mem_lock50_value", aie2ps::mem_lock50_value},
+  {"mem_lock51_value", aie2ps::mem_lock51_value},
+  {"mem_lock52_value", aie2ps::mem_lock52_value},
+  {"mem_lock53_value", aie2ps::mem_lock53_value},
+  {"mem_lock54_value", aie2ps::mem_lock54_value},
+  {"mem_lock55_value", aie2ps::mem_lock55_value},
+  {"mem_lock56_value", aie2ps::mem_lock56_value},
+  {"mem_lock57_value", aie2ps::mem_lock57_value},
+  {"mem_lock58_value", aie2ps::mem_lock58_value},
+  {"mem_lock59_value", aie2ps::mem_lock59_value},
+  {"mem_lock5_value", aie2ps::mem_lock5_value},
+  {"mem_lock60_value", aie2ps::mem_lock60_value},
+  {"mem_lock61_value", aie2ps::mem_lock61_value},
+  {"mem_lock62_value", aie2ps::mem_lock62_value},
+  {"mem_lock63_value", aie2ps::mem_lock63_value},
+  {"mem_lock6_value", aie2ps::mem_lock6_value},
+  {"mem_lock7_value", aie2ps::mem_lock7_value},
+  {"mem_lock8_value", aie2ps::mem_lock8_value},
+  {"mem_lock9_value", aie2ps::mem_lock9_value},
+  {"mem_lock_request", aie2ps::mem_lock_request},
+  {"mem_locks_event_selection_0", aie2ps::mem_locks_event_selection_0},
+  {"mem_locks_event_selection_1", aie2ps::mem_locks_event_selection_1},
+  {"mem_locks_event_selection_2", aie2ps::mem_locks_event_selection_2},
+  {"mem_locks_event_selection_3", aie2ps::mem_locks_event_selection_3},
+  {"mem_locks_event_selection_4", aie2ps::mem_locks_event_selection_4},
+  {"mem_locks_event_selection_5", aie2ps::mem_locks_event_selection_5},
+  {"mem_locks_event_selection_6", aie2ps::mem_locks_event_selection_6},
+  {"mem_locks_event_selection_7", aie2ps::mem_locks_event_selection_7},
+  {"mem_locks_overflow_0", aie2ps::mem_locks_overflow_0},
+  {"mem_locks_overflow_1", aie2ps::mem_locks_overflow_1},
+  {"mem_locks_underflow_0", aie2ps::mem_locks_underflow_0},
+  {"mem_locks_underflow_1", aie2ps::mem_locks_underflow_1},
+  {"mem_memory_control", aie2ps::mem_memory_control},
+  {"mem_module_clock_control", aie2ps::mem_module_clock_control},
+  {"mem_performance_control0", aie2ps::mem_performance_control0},
+  {"mem_performance_control1", aie2ps::mem_performance_control1},
+  {"mem_performance_control2", aie2ps::mem_performance_control2},
+  {"mem_performance_control3", aie2ps::mem_performance_control3},
+  {"mem_performance_control4", aie2ps::mem_performance_control4},
+  {"mem_performance_counter0", aie2ps::mem_performance_counter0},
+  {"mem_performance_counter0_event_value", aie2ps::mem_performance_counter0_event_value},
+  {"mem_performance_counter1", aie2ps::mem_performance_counter1},
+  {"mem_performance_counter1_event_value", aie2ps::mem_performance_counter1_event_value},
+  {"mem_performance_counter2", aie2ps::mem_performance_counter2},
+  {"mem_performance_counter2_event_value", aie2ps::mem_performance_counter2_event_value},
+  {"mem_performance_counter3", aie2ps::mem_performance_counter3},
+  {"mem_performance_counter3_event_value", aie2ps::mem_performance_counter3_event_value},
+  {"mem_performance_counter4", aie2ps::mem_performance_counter4},
+  {"mem_performance_counter5", aie2ps::mem_performance_counter5},
+  {"mem_stream_switch_adaptive_clock_gate_abort_period", aie2ps::mem_stream_switch_adaptive_clock_gate_abort_period},
+  {"mem_stream_switch_adaptive_clock_gate_status", aie2ps::mem_stream_switch_adaptive_clock_gate_status},
+  {"mem_stream_switch_deterministic_merge_arb0_ctrl", aie2ps::mem_stream_switch_deterministic_merge_arb0_ctrl},
+  {"mem_stream_switch_deterministic_merge_arb0_slave0_1", aie2ps::mem_stream_switch_deterministic_merge_arb0_slave0_1},
+  {"mem_stream_switch_deterministic_merge_arb0_slave2_3", aie2ps::mem_stream_switch_deterministic_merge_arb0_slave2_3},
+  {"mem_stream_switch_deterministic_merge_arb1_ctrl", aie2ps::mem_stream_switch_deterministic_merge_arb1_ctrl},
+  {"mem_stream_switch_deterministic_merge_arb1_slave0_1", aie2ps::mem_stream_switch_deterministic_merge_arb1_slave0_1},
+  {"mem_stream_switch_deterministic_merge_arb1_slave2_3", aie2ps::mem_stream_switch_deterministic_merge_arb1_slave2_3},
+  {"mem_stream_switch_event_port_selection_0", aie2ps::mem_stream_switch_event_port_selection_0},
+  {"mem_stream_switch_event_port_selection_1", aie2ps::mem_stream_switch_event_port_selection_1},
+  {"mem_stream_switch_master_config_dma0", aie2ps::mem_stream_switch_master_config_dma0},
+  {"mem_stream_switch_master_config_dma1", aie2ps::mem_stream_switch_master_config_dma1},
+  {"mem_stream_switch_master_config_dma2", aie2ps::mem_stream_switch_master_config_dma2},
+  {"mem_stream_switch_master_config_dma3", aie2ps::mem_stream_switch_master_config_dma3},
+  {"mem_stream_switch_master_config_dma4", aie2ps::mem_stream_switch_master_config_dma4},
+  {"mem_stream_switch_master_config_dma5", aie2ps::mem_stream_switch_master_config_dma5},
+  {"mem_stream_switch_master_config_north0", aie2ps::mem_stream_switch_master_config_north0},
+  {"mem_stream_switch_master_config_north1", aie2ps::mem_stream_switch_master_config_north1},
+  {"mem_stream_switch_master_config_north2", aie2ps::mem_stream_switch_master_config_north2},
+  {"mem_stream_switch_master_config_north3", aie2ps::mem_stream_switch_master_config_north3},
+  {"mem_stream_switch_master_config_north4", aie2ps::mem_stream_switch_master_config_north4},
+  {"mem_stream_switch_master_config_north5", aie2ps::mem_stream_switch_master_config_north5},
+  {"mem_stream_switch_master_config_south0", aie2ps::mem_stream_switch_master_config_south0},
+  {"mem_stream_switch_master_config_south1", aie2ps::mem_stream_switch_master_config_south1},
+  {"mem_stream_switch_master_config_south2", aie2ps::mem_stream_switch_master_config_south2},
+  {"mem_stream_switch_master_config_south3", aie2ps::mem_stream_switch_master_config_south3},
+  {"mem_stream_switch_master_config_tile_ctrl", aie2ps::mem_stream_switch_master_config_tile_ctrl},
+  {"mem_stream_switch_parity_injection", aie2ps::mem_stream_switch_parity_injection},
+  {"mem_stream_switch_parity_status", aie2ps::mem_stream_switch_parity_status},
+  {"mem_stream_switch_slave_config_dma_0", aie2ps::mem_stream_switch_slave_config_dma_0},
+  {"mem_stream_switch_slave_config_dma_1", aie2ps::mem_stream_switch_slave_config_dma_1},
+  {"mem_stream_switch_slave_config_dma_2", aie2ps::mem_stream_switch_slave_config_dma_2},
+  {"mem_stream_switch_slave_config_dma_3", aie2ps::mem_stream_switch_slave_config_dma_3},
+  {"mem_stream_switch_slave_config_dma_4", aie2ps::mem_stream_switch_slave_config_dma_4},
+  {"mem_stream_switch_slave_config_dma_5", aie2ps::mem_stream_switch_slave_config_dma_5},
+  {"mem_stream_switch_slave_config_north_0", aie2ps::mem_stream_switch_slave_config_north_0},
+  {"mem_stream_switch_slave_config_north_1", aie2ps::mem_stream_switch_slave_config_north_1},
+  {"mem_stream_switch_slave_config_north_2", aie2ps::mem_stream_switch_slave_config_north_2},
+  {"mem_stream_switch_slave_config_north_3", aie2ps::mem_stream_switch_slave_config_north_3},
+  {"mem_stream_switch_slave_config_south_0", aie2ps::mem_stream_switch_slave_config_south_0},
+  {"mem_stream_switch_slave_config_south_1", aie2ps::mem_stream_switch_slave_config_south_1},
+  {"mem_stream_switch_slave_config_south_2", aie2ps::mem_stream_switch_slave_config_south_2},
+  {"mem_stream_switch_slave_config_south_3", aie2ps::mem_stream_switch_slave_config_south_3},
+  {"mem_stream_switch_slave_config_south_4", aie2ps::mem_stream_switch_slave_config_south_4},
+  {"mem_stream_switch_slave_config_south_5", aie2ps::mem_stream_switch_slave_config_south_5},
+  {"mem_stream_switch_slave_config_tile_ctrl", aie2ps::mem_stream_switch_slave_config_tile_ctrl},
+  {"mem_stream_switch_slave_config_trace", aie2ps::mem_stream_switch_slave_config_trace},
+  {"mem_stream_switch_slave_dma_0_slot0", aie2ps::mem_stream_switch_slave_dma_0_slot0},
+  {"mem_stream_switch_slave_dma_0_slot1", aie2ps::mem_stream_switch_slave_dma_0_slot1},
+  {"mem_stream_switch_slave_dma_0_slot2", aie2ps::mem_stream_switch_slave_dma_0_slot2},
+  {"mem_stream_switch_slave_dma_0_slot3", aie2ps::mem_stream_switch_slave_dma_0_slot3},
+  {"mem_stream_switch_slave_dma_1_slot0", aie2ps::mem_stream_switch_slave_dma_1_slot0},
+  {"mem_stream_switch_slave_dma_1_slot1", aie2ps::mem_stream_switch_slave_dma_1_slot1},
+  {"mem_stream_switch_slave_dma_1_slot2", aie2ps::mem_stream_switch_slave_dma_1_slot2},
+  {"mem_stream_switch_slave_dma_1_slot3", aie2ps::mem_stream_switch_slave_dma_1_slot3},
+  {"mem_stream_switch_slave_dma_2_slot0", aie2ps::mem_stream_switch_slave_dma_2_slot0},
+  {"mem_stream_switch_slave_dma_2_slot1", aie2ps::mem_stream_switch_slave_dma_2_slot1},
+  {"mem_stream_switch_slave_dma_2_slot2", aie2ps::mem_stream_switch_slave_dma_2_slot2},
+  {"mem_stream_switch_slave_dma_2_slot3", aie2ps::mem_stream_switch_slave_dma_2_slot3},
+  {"mem_stream_switch_slave_dma_3_slot0", aie2ps::mem_stream_switch_slave_dma_3_slot0},
+  {"mem_stream_switch_slave_dma_3_slot1", aie2ps::mem_stream_switch_slave_dma_3_slot1},
+  {"mem_stream_switch_slave_dma_3_slot2", aie2ps::mem_stream_switch_slave_dma_3_slot2},
+  {"mem_stream_switch_slave_dma_3_slot3", aie2ps::mem_stream_switch_slave_dma_3_slot3},
+  {"mem_stream_switch_slave_dma_4_slot0", aie2ps::mem_stream_switch_slave_dma_4_slot0},
+  {"mem_stream_switch_slave_dma_4_slot1", aie2ps::mem_stream_switch_slave_dma_4_slot1},
+  {"mem_stream_switch_slave_dma_4_slot2", aie2ps::mem_stream_switch_slave_dma_4_slot2},
+  {"mem_stream_switch_slave_dma_4_slot3", aie2ps::mem_stream_switch_slave_dma_4_slot3},
+  {"mem_stream_switch_slave_dma_5_slot0", aie2ps::mem_stream_switch_slave_dma_5_slot0},
+  {"mem_stream_switch_slave_dma_5_slot1", aie2ps::mem_stream_switch_slave_dma_5_slot1},
+  {"mem_stream_switch_slave_dma_5_slot2", aie2ps::mem_stream_switch_slave_dma_5_slot2},
+  {"mem_stream_switch_slave_dma_5_slot3", aie2ps::mem_stream_switch_slave_dma_5_slot3},
+  {"mem_stream_switch_slave_north_0_slot0", aie2ps::mem_stream_switch_slave_north_0_slot0},
+  {"mem_stream_switch_slave_north_0_slot1", aie2ps::mem_stream_switch_slave_north_0_slot1},
+  {"mem_stream_switch_slave_north_0_slot2", aie2ps::mem_stream_switch_slave_north_0_slot2},
+  {"mem_stream_switch_slave_north_0_slot3", aie2ps::mem_stream_switch_slave_north_0_slot3},
+  {"mem_stream_switch_slave_north_1_slot0", aie2ps::mem_stream_switch_slave_north_1_slot0},
+  {"mem_stream_switch_slave_north_1_slot1", aie2ps::mem_stream_switch_slave_north_1_slot1},
+  {"mem_stream_switch_slave_north_1_slot2", aie2ps::mem_stream_switch_slave_north_1_slot2},
+  {"mem_stream_switch_slave_north_1_slot3", aie2ps::mem_stream_switch_slave_north_1_slot3},
+  {"mem_stream_switch_slave_north_2_slot0", aie2ps::mem_stream_switch_slave_north_2_slot0},
+  {"mem_stream_switch_slave_north_2_slot1", aie2ps::mem_stream_switch_slave_north_2_slot1},
+  {"mem_stream_switch_slave_north_2_slot2", aie2ps::mem_stream_switch_slave_north_2_slot2},
+  {"mem_stream_switch_slave_north_2_slot3", aie2ps::mem_stream_switch_slave_north_2_slot3},
+  {"mem_stream_switch_slave_north_3_slot0", aie2ps::mem_stream_switch_slave_north_3_slot0},
+  {"mem_stream_switch_slave_north_3_slot1", aie2ps::mem_stream_switch_slave_north_3_slot1},
+  {"mem_stream_switch_slave_north_3_slot2", aie2ps::mem_stream_switch_slave_north_3_slot2},
+  {"mem_stream_switch_slave_north_3_slot3", aie2ps::mem_stream_switch_slave_north_3_slot3},
+  {"mem_stream_switch_slave_south_0_slot0", aie2ps::mem_stream_switch_slave_south_0_slot0},
+  {"mem_stream_switch_slave_south_0_slot1", aie2ps::mem_stream_switch_slave_south_0_slot1},
+  {"mem_stream_switch_slave_south_0_slot2", aie2ps::mem_stream_switch_slave_south_0_slot2},
+  {"mem_stream_switch_slave_south_0_slot3", aie2ps::mem_stream_switch_slave_south_0_slot3},
+  {"mem_stream_switch_slave_south_1_slot0", aie2ps::mem_stream_switch_slave_south_1_slot0},
+  {"mem_stream_switch_slave_south_1_slot1", aie2ps::mem_stream_switch_slave_south_1_slot1},
+  {"mem_stream_switch_slave_south_1_slot2", aie2ps::mem_stream_switch_slave_south_1_slot2},
+  {"mem_stream_switch_slave_south_1_slot3", aie2ps::mem_stream_switch_slave_south_1_slot3},
+  {"mem_stream_switch_slave_south_2_slot0", aie2ps::mem_stream_switch_slave_south_2_slot0},
+  {"mem_stream_switch_slave_south_2_slot1", aie2ps::mem_stream_switch_slave_south_2_slot1},
+  {"mem_stream_switch_slave_south_2_slot2", aie2ps::mem_stream_switch_slave_south_2_slot2},
+  {"mem_stream_switch_slave_south_2_slot3", aie2ps::mem_stream_switch_slave_south_2_slot3},
+  {"mem_stream_switch_slave_south_3_slot0", aie2ps::mem_stream_switch_slave_south_3_slot0},
+  {"mem_stream_switch_slave_south_3_slot1", aie2ps::mem_stream_switch_slave_south_3_slot1},
+  {"mem_stream_switch_slave_south_3_slot2", aie2ps::mem_stream_switch_slave_south_3_slot2},
+  {"mem_stream_switch_slave_south_3_slot3", aie2ps::mem_stream_switch_slave_south_3_slot3},
+  {"mem_stream_switch_slave_south_4_slot0", aie2ps::mem_stream_switch_slave_south_4_slot0},
+  {"mem_stream_switch_slave_south_4_slot1", aie2ps::mem_stream_switch_slave_south_4_slot1},
+  {"mem_stream_switch_slave_south_4_slot2", aie2ps::mem_stream_switch_slave_south_4_slot2},
+  {"mem_stream_switch_slave_south_4_slot3", aie2ps::mem_stream_switch_slave_south_4_slot3},
+  {"mem_stream_switch_slave_south_5_slot0", aie2ps::mem_stream_switch_slave_south_5_slot0},
+  {"mem_stream_switch_slave_south_5_slot1", aie2ps::mem_stream_switch_slave_south_5_slot1},
+  {"mem_stream_switch_slave_south_5_slot2", aie2ps::mem_stream_switch_slave_south_5_slot2},
+  {"mem_stream_switch_slave_south_5_slot3", aie2ps::mem_stream_switch_slave_south_5_slot3},
+  {"mem_stream_switch_slave_tile_ctrl_slot0", aie2ps::mem_stream_switch_slave_tile_ctrl_slot0},
+  {"mem_stream_switch_slave_tile_ctrl_slot1", aie2ps::mem_stream_switch_slave_tile_ctrl_slot1},
+  {"mem_stream_switch_slave_tile_ctrl_slot2", aie2ps::mem_stream_switch_slave_tile_ctrl_slot2},
+  {"mem_stream_switch_slave_tile_ctrl_slot3", aie2ps::mem_stream_switch_slave_tile_ctrl_slot3},
+  {"mem_stream_switch_slave_trace_slot0", aie2ps::mem_stream_switch_slave_trace_slot0},
+  {"mem_stream_switch_slave_trace_slot1", aie2ps::mem_stream_switch_slave_trace_slot1},
+  {"mem_stream_switch_slave_trace_slot2", aie2ps::mem_stream_switch_slave_trace_slot2},
+  {"mem_stream_switch_slave_trace_slot3", aie2ps::mem_stream_switch_slave_trace_slot3},
+  {"mem_tile_control", aie2ps::mem_tile_control},
+  {"mem_tile_control_packet_handler_status", aie2ps::mem_tile_control_packet_handler_status},
+  {"mem_timer_control", aie2ps::mem_timer_control},
+  {"mem_timer_high", aie2ps::mem_timer_high},
+  {"mem_timer_low", aie2ps::mem_timer_low},
+  {"mem_timer_trig_event_high_value", aie2ps::mem_timer_trig_event_high_value},
+  {"mem_timer_trig_event_low_value", aie2ps::mem_timer_trig_event_low_value},
+  {"mem_trace_control0", aie2ps::mem_trace_control0},
+  {"mem_trace_control1", aie2ps::mem_trace_control1},
+  {"mem_trace_event0", aie2ps::mem_trace_event0},
+  {"mem_trace_event1", aie2ps::mem_trace_event1},
+  {"mem_trace_status", aie2ps::mem_trace_status},
+  {"mem_watchpoint0", aie2ps::mem_watchpoint0},
+  {"mem_watchpoint1", aie2ps::mem_watchpoint1},
+  {"mem_watchpoint2", aie2ps::mem_watchpoint2},
+  {"mem_watchpoint3", aie2ps::mem_watchpoint3},
+  {"mm_combo_event_control", aie2ps::mm_combo_event_control},
+  {"mm_combo_event_inputs", aie2ps::mm_combo_event_inputs},
+  {"mm_dma_bd0_0", aie2ps::mm_dma_bd0_0},
+  {"mm_dma_bd0_1", aie2ps::mm_dma_bd0_1},
+  {"mm_dma_bd0_2", aie2ps::mm_dma_bd0_2},
+  {"mm_dma_bd0_3", aie2ps::mm_dma_bd0_3},
+  {"mm_dma_bd0_4", aie2ps::mm_dma_bd0_4},
+  {"mm_dma_bd0_5", aie2ps::mm_dma_bd0_5},
+  {"mm_dma_bd10_0", aie2ps::mm_dma_bd10_0},
+  {"mm_dma_bd10_1", aie2ps::mm_dma_bd10_1},
+  {"mm_dma_bd10_2", aie2ps::mm_dma_bd10_2},
+  {"mm_dma_bd10_3", aie2ps::mm_dma_bd10_3},
+  {"mm_dma_bd10_4", aie2ps::mm_dma_bd10_4},
+  {"mm_dma_bd10_5", aie2ps::mm_dma_bd10_5},
+  {"mm_dma_bd11_0", aie2ps::mm_dma_bd11_0},
+  {"mm_dma_bd11_1", aie2ps::mm_dma_bd11_1},
+  {"mm_dma_bd11_2", aie2ps::mm_dma_bd11_2},
+  {"mm_dma_bd11_3", aie2ps::mm_dma_bd11_3},
+  {"mm_dma_bd11_4", aie2ps::mm_dma_bd11_4},
+  {"mm_dma_bd11_5", aie2ps::mm_dma_bd11_5},
+  {"mm_dma_bd12_0", aie2ps::mm_dma_bd12_0},
+  {"mm_dma_bd12_1", aie2ps::mm_dma_bd12_1},
+  {"mm_dma_bd12_2", aie2ps::mm_dma_bd12_2},
+  {"mm_dma_bd12_3", aie2ps::mm_dma_bd12_3},
+  {"mm_dma_bd12_4", aie2ps::mm_dma_bd12_4},
+  {"mm_dma_bd12_5", aie2ps::mm_dma_bd12_5},
+  {"mm_dma_bd13_0", aie2ps::mm_dma_bd13_0},
+  {"mm_dma_bd13_1", aie2ps::mm_dma_bd13_1},
+  {"mm_dma_bd13_2", aie2ps::mm_dma_bd13_2},
+  {"mm_dma_bd13_3", aie2ps::mm_dma_bd13_3},
+  {"mm_dma_bd13_4", aie2ps::mm_dma_bd13_4},
+  {"mm_dma_bd13_5", aie2ps::mm_dma_bd13_5},
+  {"mm_dma_bd14_0", aie2ps::mm_dma_bd14_0},
+  {"mm_dma_bd14_1", aie2ps::mm_dma_bd14_1},
+  {"mm_dma_bd14_2", aie2ps::mm_dma_bd14_2},
+  {"mm_dma_bd14_3", aie2ps::mm_dma_bd14_3},
+  {"mm_dma_bd14_4", aie2ps::mm_dma_bd14_4},
+  {"mm_dma_bd14_5", aie2ps::mm_dma_bd14_5},
+  {"mm_dma_bd15_0", aie2ps::mm_dma_bd15_0},
+  {"mm_dma_bd15_1", aie2ps::mm_dma_bd15_1},
+  {"mm_dma_bd15_2", aie2ps::mm_dma_bd15_2},
+  {"mm_dma_bd15_3", aie2ps::mm_dma_bd15_3},
+  {"mm_dma_bd15_4", aie2ps::mm_dma_bd15_4},
+  {"mm_dma_bd15_5", aie2ps::mm_dma_bd15_5},
+  {"mm_dma_bd1_0", aie2ps::mm_dma_bd1_0},
+  {"mm_dma_bd1_1", aie2ps::mm_dma_bd1_1},
+  {"mm_dma_bd1_2", aie2ps::mm_dma_bd1_2},
+  {"mm_dma_bd1_3", aie2ps::mm_dma_bd1_3},
+  {"mm_dma_bd1_4", aie2ps::mm_dma_bd1_4},
+  {"mm_dma_bd1_5", aie2ps::mm_dma_bd1_5},
+  {"mm_dma_bd2_0", aie2ps::mm_dma_bd2_0},
+  {"mm_dma_bd2_1", aie2ps::mm_dma_bd2_1},
+  {"mm_dma_bd2_2", aie2ps::mm_dma_bd2_2},
+  {"mm_dma_bd2_3", aie2ps::mm_dma_bd2_3},
+  {"mm_dma_bd2_4", aie2ps::mm_dma_bd2_4},
+  {"mm_dma_bd2_5", aie2ps::mm_dma_bd2_5},
+  {"mm_dma_bd3_0", aie2ps::mm_dma_bd3_0},
+  {"mm_dma_bd3_1", aie2ps::mm_dma_bd3_1},
+  {"mm_dma_bd3_2", aie2ps::mm_dma_bd3_2},
+  {"mm_dma_bd3_3", aie2ps::mm_dma_bd3_3},
+  {"mm_dma_bd3_4", aie2ps::mm_dma_bd3_4},
+  {"mm_dma_bd3_5", aie2ps::mm_dma_bd3_5},
+  {"mm_dma_bd4_0", aie2ps::mm_dma_bd4_0},
+  {"mm_dma_bd4_1", aie2ps::mm_dma_bd4_1},
+  {"mm_dma_bd4_2", aie2ps::mm_dma_bd4_2},
+  {"mm_dma_bd4_3", aie2ps::mm_dma_bd4_3},
+  {"mm_dma_bd4_4", aie2ps::mm_dma_bd4_4},
+  {"mm_dma_bd4_5", aie2ps::mm_dma_bd4_5},
+  {"mm_dma_bd5_0", aie2ps::mm_dma_bd5_0},
+  {"mm_dma_bd5_1", aie2ps::mm_dma_bd5_1},
+  {"mm_dma_bd5_2", aie2ps::mm_dma_bd5_2},
+  {"mm_dma_bd5_3", aie2ps::mm_dma_bd5_3},
+  {"mm_dma_bd5_4", aie2ps::mm_dma_bd5_4},
+  {"mm_dma_bd5_5", aie2ps::mm_dma_bd5_5},
+  {"mm_dma_bd6_0", aie2ps::mm_dma_bd6_0},
+  {"mm_dma_bd6_1", aie2ps::mm_dma_bd6_1},
+  {"mm_dma_bd6_2", aie2ps::mm_dma_bd6_2},
+  {"mm_dma_bd6_3", aie2ps::mm_dma_bd6_3},
+  {"mm_dma_bd6_4", aie2ps::mm_dma_bd6_4},
+  {"mm_dma_bd6_5", aie2ps::mm_dma_bd6_5},
+  {"mm_dma_bd7_0", aie2ps::mm_dma_bd7_0},
+  {"mm_dma_bd7_1", aie2ps::mm_dma_bd7_1},
+  {"mm_dma_bd7_2", aie2ps::mm_dma_bd7_2},
+  {"mm_dma_bd7_3", aie2ps::mm_dma_bd7_3},
+  {"mm_dma_bd7_4", aie2ps::mm_dma_bd7_4},
+  {"mm_dma_bd7_5", aie2ps::mm_dma_bd7_5},
+  {"mm_dma_bd8_0", aie2ps::mm_dma_bd8_0},
+  {"mm_dma_bd8_1", aie2ps::mm_dma_bd8_1},
+  {"mm_dma_bd8_2", aie2ps::mm_dma_bd8_2},
+  {"mm_dma_bd8_3", aie2ps::mm_dma_bd8_3},
+  {"mm_dma_bd8_4", aie2ps::mm_dma_bd8_4},
+  {"mm_dma_bd8_5", aie2ps::mm_dma_bd8_5},
+  {"mm_dma_bd9_0", aie2ps::mm_dma_bd9_0},
+  {"mm_dma_bd9_1", aie2ps::mm_dma_bd9_1},
+  {"mm_dma_bd9_2", aie2ps::mm_dma_bd9_2},
+  {"mm_dma_bd9_3", aie2ps::mm_dma_bd9_3},
+  {"mm_dma_bd9_4", aie2ps::mm_dma_bd9_4},
+  {"mm_dma_bd9_5", aie2ps::mm_dma_bd9_5},
+  {"mm_dma_mm2s_0_ctrl", aie2ps::mm_dma_mm2s_0_ctrl},
+  {"mm_dma_mm2s_0_start_queue", aie2ps::mm_dma_mm2s_0_start_queue},
+  {"mm_dma_mm2s_1_ctrl", aie2ps::mm_dma_mm2s_1_ctrl},
+  {"mm_dma_mm2s_1_start_queue", aie2ps::mm_dma_mm2s_1_start_queue},
+  {"mm_dma_mm2s_status_0", aie2ps::mm_dma_mm2s_status_0},
+  {"mm_dma_mm2s_status_1", aie2ps::mm_dma_mm2s_status_1},
+  {"mm_dma_s2mm_0_ctrl", aie2ps::mm_dma_s2mm_0_ctrl},
+  {"mm_dma_s2mm_0_start_queue", aie2ps::mm_dma_s2mm_0_start_queue},
+  {"mm_dma_s2mm_1_ctrl", aie2ps::mm_dma_s2mm_1_ctrl},
+  {"mm_dma_s2mm_1_start_queue", aie2ps::mm_dma_s2mm_1_start_queue},
+  {"mm_dma_s2mm_current_write_count_0", aie2ps::mm_dma_s2mm_current_write_count_0},
+  {"mm_dma_s2mm_current_write_count_1", aie2ps::mm_dma_s2mm_current_write_count_1},
+  {"mm_dma_s2mm_fot_count_fifo_pop_0", aie2ps::mm_dma_s2mm_fot_count_fifo_pop_0},
+  {"mm_dma_s2mm_fot_count_fifo_pop_1", aie2ps::mm_dma_s2mm_fot_count_fifo_pop_1},
+  {"mm_dma_s2mm_status_0", aie2ps::mm_dma_s2mm_status_0},
+  {"mm_dma_s2mm_status_1", aie2ps::mm_dma_s2mm_status_1},
+  {"mm_edge_detection_event_control", aie2ps::mm_edge_detection_event_control},
+  {"mm_event_broadcast0", aie2ps::mm_event_broadcast0},
+  {"mm_event_broadcast1", aie2ps::mm_event_broadcast1},
+  {"mm_event_broadcast10", aie2ps::mm_event_broadcast10},
+  {"mm_event_broadcast11", aie2ps::mm_event_broadcast11},
+  {"mm_event_broadcast12", aie2ps::mm_event_broadcast12},
+  {"mm_event_broadcast13", aie2ps::mm_event_broadcast13},
+  {"mm_event_broadcast14", aie2ps::mm_event_broadcast14},
+  {"mm_event_broadcast15", aie2ps::mm_event_broadcast15},
+  {"mm_event_broadcast2", aie2ps::mm_event_broadcast2},
+  {"mm_event_broadcast3", aie2ps::mm_event_broadcast3},
+  {"mm_event_broadcast4", aie2ps::mm_event_broadcast4},
+  {"mm_event_broadcast5", aie2ps::mm_event_broadcast5},
+  {"mm_event_broadcast6", aie2ps::mm_event_broadcast6},
+  {"mm_event_broadcast7", aie2ps::mm_event_broadcast7},
+  {"mm_event_broadcast8", aie2ps::mm_event_broadcast8},
+  {"mm_event_broadcast9", aie2ps::mm_event_broadcast9},
+  {"mm_event_broadcast_block_east_clr", aie2ps::mm_event_broadcast_block_east_clr},
+  {"mm_event_broadcast_block_east_set", aie2ps::mm_event_broadcast_block_east_set},
+  {"mm_event_broadcast_block_east_value", aie2ps::mm_event_broadcast_block_east_value},
+  {"mm_event_broadcast_block_north_clr", aie2ps::mm_event_broadcast_block_north_clr},
+  {"mm_event_broadcast_block_north_set", aie2ps::mm_event_broadcast_block_north_set},
+  {"mm_event_broadcast_block_north_value", aie2ps::mm_event_broadcast_block_north_value},
+  {"mm_event_broadcast_block_south_clr", aie2ps::mm_event_broadcast_block_south_clr},
+  {"mm_event_broadcast_block_south_set", aie2ps::mm_event_broadcast_block_south_set},
+  {"mm_event_broadcast_block_south_value", aie2ps::mm_event_broadcast_block_south_value},
+  {"mm_event_broadcast_block_west_clr", aie2ps::mm_event_broadcast_block_west_clr},
+  {"mm_event_broadcast_block_west_set", aie2ps::mm_event_broadcast_block_west_set},
+  {"mm_event_broadcast_block_west_value", aie2ps::mm_event_broadcast_block_west_value},
+  {"mm_event_generate", aie2ps::mm_event_generate},
+  {"mm_event_group_0_enable", aie2ps::mm_event_group_0_enable},
+  {"mm_event_group_broadcast_enable", aie2ps::mm_event_group_broadcast_enable},
+  {"mm_event_group_dma_enable", aie2ps::mm_event_group_dma_enable},
+  {"mm_event_group_error_enable", aie2ps::mm_event_group_error_enable},
+  {"mm_event_group_lock_enable", aie2ps::mm_event_group_lock_enable},
+  {"mm_event_group_memory_conflict_enable", aie2ps::mm_event_group_memory_conflict_enable},
+  {"mm_event_group_user_event_enable", aie2ps::mm_event_group_user_event_enable},
+  {"mm_event_group_watchpoint_enable", aie2ps::mm_event_group_watchpoint_enable},
+  {"mm_event_status0", aie2ps::mm_event_status0},
+  {"mm_event_status1", aie2ps::mm_event_status1},
+  {"mm_event_status2", aie2ps::mm_event_status2},
+  {"mm_event_status3", aie2ps::mm_event_status3},
+  {"mm_lock0_value", aie2ps::mm_lock0_value},
+  {"mm_lock10_value", aie2ps::mm_lock10_value},
+  {"mm_lock11_value", aie2ps::mm_lock11_value},
+  {"mm_lock12_value", aie2ps::mm_lock12_value},
+  {"mm_lock13_value", aie2ps::mm_lock13_value},
+  {"mm_lock14_value", aie2ps::mm_lock14_value},
+  {"mm_lock15_value", aie2ps::mm_lock15_value},
+  {"mm_lock1_value", aie2ps::mm_lock1_value},
+  {"mm_lock2_value", aie2ps::mm_lock2_value},
+  {"mm_lock3_value", aie2ps::mm_lock3_value},
+  {"mm_lock4_value", aie2ps::mm_lock4_value},
+  {"mm_lock5_value", aie2ps::mm_lock5_value},
+  {"mm_lock6_value", aie2ps::mm_lock6_value},
+  {"mm_lock7_value", aie2ps::mm_lock7_value},
+  {"mm_lock8_value", aie2ps::mm_lock8_value},
+  {"mm_lock9_value", aie2ps::mm_lock9_value},
+  {"mm_lock_request", aie2ps::mm_lock_request},
+  {"mm_locks_event_selection_0", aie2ps::mm_locks_event_selection_0},
+  {"mm_locks_event_selection_1", aie2ps::mm_locks_event_selection_1},
+  {"mm_locks_event_selection_2", aie2ps::mm_locks_event_selection_2},
+  {"mm_locks_event_selection_3", aie2ps::mm_locks_event_selection_3},
+  {"mm_locks_event_selection_4", aie2ps::mm_locks_event_selection_4},
+  {"mm_locks_event_selection_5", aie2ps::mm_locks_event_selection_5},
+  {"mm_locks_event_selection_6", aie2ps::mm_locks_event_selection_6},
+  {"mm_locks_event_selection_7", aie2ps::mm_locks_event_selection_7},
+  {"mm_locks_overflow", aie2ps::mm_locks_overflow},
+  {"mm_locks_underflow", aie2ps::mm_locks_underflow},
+  {"mm_memory_control", aie2ps::mm_memory_control},
+  {"mm_performance_control0", aie2ps::mm_performance_control0},
+  {"mm_performance_control1", aie2ps::mm_performance_control1},
+  {"mm_performance_control2", aie2ps::mm_performance_control2},
+  {"mm_performance_control3", aie2ps::mm_performance_control3},
+  {"mm_performance_counter0", aie2ps::mm_performance_counter0},
+  {"mm_performance_counter0_event_value", aie2ps::mm_performance_counter0_event_value},
+  {"mm_performance_counter1", aie2ps::mm_performance_counter1},
+  {"mm_performance_counter1_event_value", aie2ps::mm_performance_counter1_event_value},
+  {"mm_performance_counter2", aie2ps::mm_performance_counter2},
+  {"mm_performance_counter3", aie2ps::mm_performance_counter3},
+  {"mm_timer_control", aie2ps::mm_timer_control},
+  {"mm_timer_high", aie2ps::mm_timer_high},
+  {"mm_timer_low", aie2ps::mm_timer_low},
+  {"mm_timer_trig_event_high_value", aie2ps::mm_timer_trig_event_high_value},
+  {"mm_timer_trig_event_low_value", aie2ps::mm_timer_trig_event_low_value},
+  {"mm_trace_control0", aie2ps::mm_trace_control0},
+  {"mm_trace_control1", aie2ps::mm_trace_control1},
+  {"mm_trace_event0", aie2ps::mm_trace_event0},
+  {"mm_trace_event1", aie2ps::mm_trace_event1},
+  {"mm_trace_status", aie2ps::mm_trace_status},
+  {"mm_watchpoint0", aie2ps::mm_watchpoint0},
+  {"mm_watchpoint1", aie2ps::mm_watchpoint1},
+  {"npi_me_idr0", aie2ps::npi_me_idr0},
+  {"npi_me_idr1", aie2ps::npi_me_idr1},
+  {"npi_me_idr2", aie2ps::npi_me_idr2},
+  {"npi_me_idr3", aie2ps::npi_me_idr3},
+  {"npi_me_ier0", aie2ps::npi_me_ier0},
+  {"npi_me_ier1", aie2ps::npi_me_ier1},
+  {"npi_me_ier2", aie2ps::npi_me_ier2},
+  {"npi_me_ier3", aie2ps::npi_me_ier3},
+  {"npi_me_imr0", aie2ps::npi_me_imr0},
+  {"npi_me_imr1", aie2ps::npi_me_imr1},
+  {"npi_me_imr2", aie2ps::npi_me_imr2},
+  {"npi_me_imr3", aie2ps::npi_me_imr3},
+  {"npi_me_ior", aie2ps::npi_me_ior},
+  {"npi_me_isr", aie2ps::npi_me_isr},
+  {"npi_me_itr", aie2ps::npi_me_itr},
+  {"npi_me_pll_status", aie2ps::npi_me_pll_status},
+  {"npi_me_secure_reg", aie2ps::npi_me_secure_reg},
+  {"shim_axi_mm_outstanding_transactions", aie2ps::shim_axi_mm_outstanding_transactions},
+  {"shim_demux_config", aie2ps::shim_demux_config},
+  {"shim_dma_bd0_0", aie2ps::shim_dma_bd0_0},
+  {"shim_dma_bd0_1", aie2ps::shim_dma_bd0_1},
+  {"shim_dma_bd0_2", aie2ps::shim_dma_bd0_2},
+  {"shim_dma_bd0_3", aie2ps::shim_dma_bd0_3},
+  {"shim_dma_bd0_4", aie2ps::shim_dma_bd0_4},
+  {"shim_dma_bd0_5", aie2ps::shim_dma_bd0_5},
+  {"shim_dma_bd0_6", aie2ps::shim_dma_bd0_6},
+  {"shim_dma_bd0_7", aie2ps::shim_dma_bd0_7},
+  {"shim_dma_bd0_8", aie2ps::shim_dma_bd0_8},
+  {"shim_dma_bd10_0", aie2ps::shim_dma_bd10_0},
+  {"shim_dma_bd10_1", aie2ps::shim_dma_bd10_1},
+  {"shim_dma_bd10_2", aie2ps::shim_dma_bd10_2},
+  {"shim_dma_bd10_3", aie2ps::shim_dma_bd10_3},
+  {"shim_dma_bd10_4", aie2ps::shim_dma_bd10_4},
+  {"shim_dma_bd10_5", aie2ps::shim_dma_bd10_5},
+  {"shim_dma_bd10_6", aie2ps::shim_dma_bd10_6},
+  {"shim_dma_bd10_7", aie2ps::shim_dma_bd10_7},
+  {"shim_dma_bd10_8", aie2ps::shim_dma_bd10_8},
+  {"shim_dma_bd11_0", aie2ps::shim_dma_bd11_0},
+  {"shim_dma_bd11_1", aie2ps::shim_dma_bd11_1},
+  {"shim_dma_bd11_2", aie2ps::shim_dma_bd11_2},
+  {"shim_dma_bd11_3", aie2ps::shim_dma_bd11_3},
+  {"shim_dma_bd11_4", aie2ps::shim_dma_bd11_4},
+  {"shim_dma_bd11_5", aie2ps::shim_dma_bd11_5},
+  {"shim_dma_bd11_6", aie2ps::shim_dma_bd11_6},
+  {"shim_dma_bd11_7", aie2ps::shim_dma_bd11_7},
+  {"shim_dma_bd11_8", aie2ps::shim_dma_bd11_8},
+  {"shim_dma_bd12_0", aie2ps::shim_dma_bd12_0},
+  {"shim_dma_bd12_1", aie2ps::shim_dma_bd12_1},
+  {"shim_dma_bd12_2", aie2ps::shim_dma_bd12_2},
+  {"shim_dma_bd12_3", aie2ps::shim_dma_bd12_3},
+  {"shim_dma_bd12_4", aie2ps::shim_dma_bd12_4},
+  {"shim_dma_bd12_5", aie2ps::shim_dma_bd12_5},
+  {"shim_dma_bd12_6", aie2ps::shim_dma_bd12_6},
+  {"shim_dma_bd12_7", aie2ps::shim_dma_bd12_7},
+  {"shim_dma_bd12_8", aie2ps::shim_dma_bd12_8},
+  {"shim_dma_bd13_0", aie2ps::shim_dma_bd13_0},
+  {"shim_dma_bd13_1", aie2ps::shim_dma_bd13_1},
+  {"shim_dma_bd13_2", aie2ps::shim_dma_bd13_2},
+  {"shim_dma_bd13_3", aie2ps::shim_dma_bd13_3},
+  {"shim_dma_bd13_4", aie2ps::shim_dma_bd13_4},
+  {"shim_dma_bd13_5", aie2ps::shim_dma_bd13_5},
+  {"shim_dma_bd13_6", aie2ps::shim_dma_bd13_6},
+  {"shim_dma_bd13_7", aie2ps::shim_dma_bd13_7},
+  {"shim_dma_bd13_8", aie2ps::shim_dma_bd13_8},
+  {"shim_dma_bd14_0", aie2ps::shim_dma_bd14_0},
+  {"shim_dma_bd14_1", aie2ps::shim_dma_bd14_1},
+  {"shim_dma_bd14_2", aie2ps::shim_dma_bd14_2},
+  {"shim_dma_bd14_3", aie2ps::shim_dma_bd14_3},
+  {"shim_dma_bd14_4", aie2ps::shim_dma_bd14_4},
+  {"shim_dma_bd14_5", aie2ps::shim_dma_bd14_5},
+  {"shim_dma_bd14_6", aie2ps::shim_dma_bd14_6},
+  {"shim_dma_bd14_7", aie2ps::shim_dma_bd14_7},
+  {"shim_dma_bd14_8", aie2ps::shim_dma_bd14_8},
+  {"shim_dma_bd15_0", aie2ps::shim_dma_bd15_0},
+  {"shim_dma_bd15_1", aie2ps::shim_dma_bd15_1},
+  {"shim_dma_bd15_2", aie2ps::shim_dma_bd15_2},
+  {"shim_dma_bd15_3", aie2ps::shim_dma_bd15_3},
+  {"shim_dma_bd15_4", aie2ps::shim_dma_bd15_4},
+  {"shim_dma_bd15_5", aie2ps::shim_dma_bd15_5},
+  {"shim_dma_bd15_6", aie2ps::shim_dma_bd15_6},
+  {"shim_dma_bd15_7", aie2ps::shim_dma_bd15_7},
+  {"shim_dma_bd15_8", aie2ps::shim_dma_bd15_8},
+  {"shim_dma_bd1_0", aie2ps::shim_dma_bd1_0},
+  {"shim_dma_bd1_1", aie2ps::shim_dma_bd1_1},
+  {"shim_dma_bd1_2", aie2ps::shim_dma_bd1_2},
+  {"shim_dma_bd1_3", aie2ps::shim_dma_bd1_3},
+  {"shim_dma_bd1_4", aie2ps::shim_dma_bd1_4},
+  {"shim_dma_bd1_5", aie2ps::shim_dma_bd1_5},
+  {"shim_dma_bd1_6", aie2ps::shim_dma_bd1_6},
+  {"shim_dma_bd1_7", aie2ps::shim_dma_bd1_7},
+  {"shim_dma_bd1_8", aie2ps::shim_dma_bd1_8},
+  {"shim_dma_bd2_0", aie2ps::shim_dma_bd2_0},
+  {"shim_dma_bd2_1", aie2ps::shim_dma_bd2_1},
+  {"shim_dma_bd2_2", aie2ps::shim_dma_bd2_2},
+  {"shim_dma_bd2_3", aie2ps::shim_dma_bd2_3},
+  {"shim_dma_bd2_4", aie2ps::shim_dma_bd2_4},
+  {"shim_dma_bd2_5", aie2ps::shim_dma_bd2_5},
+  {"shim_dma_bd2_6", aie2ps::shim_dma_bd2_6},
+  {"shim_dma_bd2_7", aie2ps::shim_dma_bd2_7},
+  {"shim_dma_bd2_8", aie2ps::shim_dma_bd2_8},
+  {"shim_dma_bd3_0", aie2ps::shim_dma_bd3_0},
+  {"shim_dma_bd3_1", aie2ps::shim_dma_bd3_1},
+  {"shim_dma_bd3_2", aie2ps::shim_dma_bd3_2},
+  {"shim_dma_bd3_3", aie2ps::shim_dma_bd3_3},
+  {"shim_dma_bd3_4", aie2ps::shim_dma_bd3_4},
+  {"shim_dma_bd3_5", aie2ps::shim_dma_bd3_5},
+  {"shim_dma_bd3_6", aie2ps::shim_dma_bd3_6},
+  {"shim_dma_bd3_7", aie2ps::shim_dma_bd3_7},
+  {"shim_dma_bd3_8", aie2ps::shim_dma_bd3_8},
+  {"shim_dma_bd4_0", aie2ps::shim_dma_bd4_0},
+  {"shim_dma_bd4_1", aie2ps::shim_dma_bd4_1},
+  {"shim_dma_bd4_2", aie2ps::shim_dma_bd4_2},
+  {"shim_dma_bd4_3", aie2ps::shim_dma_bd4_3},
+  {"shim_dma_bd4_4", aie2ps::shim_dma_bd4_4},
+  {"shim_dma_bd4_5", aie2ps::shim_dma_bd4_5},
+  {"shim_dma_bd4_6", aie2ps::shim_dma_bd4_6},
+  {"shim_dma_bd4_7", aie2ps::shim_dma_bd4_7},
+  {"shim_dma_bd4_8", aie2ps::shim_dma_bd4_8},
+  {"shim_dma_bd5_0", aie2ps::shim_dma_bd5_0},
+  {"shim_dma_bd5_1", aie2ps::shim_dma_bd5_1},
+  {"shim_dma_bd5_2", aie2ps::shim_dma_bd5_2},
+  {"shim_dma_bd5_3", aie2ps::shim_dma_bd5_3},
+  {"shim_dma_bd5_4", aie2ps::shim_dma_bd5_4},
+  {"shim_dma_bd5_5", aie2ps::shim_dma_bd5_5},
+  {"shim_dma_bd5_6", aie2ps::shim_dma_bd5_6},
+  {"shim_dma_bd5_7", aie2ps::shim_dma_bd5_7},
+  {"shim_dma_bd5_8", aie2ps::shim_dma_bd5_8},
+  {"shim_dma_bd6_0", aie2ps::shim_dma_bd6_0},
+  {"shim_dma_bd6_1", aie2ps::shim_dma_bd6_1},
+  {"shim_dma_bd6_2", aie2ps::shim_dma_bd6_2},
+  {"shim_dma_bd6_3", aie2ps::shim_dma_bd6_3},
+  {"shim_dma_bd6_4", aie2ps::shim_dma_bd6_4},
+  {"shim_dma_bd6_5", aie2ps::shim_dma_bd6_5},
+  {"shim_dma_bd6_6", aie2ps::shim_dma_bd6_6},
+  {"shim_dma_bd6_7", aie2ps::shim_dma_bd6_7},
+  {"shim_dma_bd6_8", aie2ps::shim_dma_bd6_8},
+  {"shim_dma_bd7_0", aie2ps::shim_dma_bd7_0},
+  {"shim_dma_bd7_1", aie2ps::shim_dma_bd7_1},
+  {"shim_dma_bd7_2", aie2ps::shim_dma_bd7_2},
+  {"shim_dma_bd7_3", aie2ps::shim_dma_bd7_3},
+  {"shim_dma_bd7_4", aie2ps::shim_dma_bd7_4},
+  {"shim_dma_bd7_5", aie2ps::shim_dma_bd7_5},
+  {"shim_dma_bd7_6", aie2ps::shim_dma_bd7_6},
+  {"shim_dma_bd7_7", aie2ps::shim_dma_bd7_7},
+  {"shim_dma_bd7_8", aie2ps::shim_dma_bd7_8},
+  {"shim_dma_bd8_0", aie2ps::shim_dma_bd8_0},
+  {"shim_dma_bd8_1", aie2ps::shim_dma_bd8_1},
+  {"shim_dma_bd8_2", aie2ps::shim_dma_bd8_2},
+  {"shim_dma_bd8_3", aie2ps::shim_dma_bd8_3},
+  {"shim_dma_bd8_4", aie2ps::shim_dma_bd8_4},
+  {"shim_dma_bd8_5", aie2ps::shim_dma_bd8_5},
+  {"shim_dma_bd8_6", aie2ps::shim_dma_bd8_6},
+  {"shim_dma_bd8_7", aie2ps::shim_dma_bd8_7},
+  {"shim_dma_bd8_8", aie2ps::shim_dma_bd8_8},
+  {"shim_dma_bd9_0", aie2ps::shim_dma_bd9_0},
+  {"shim_dma_bd9_1", aie2ps::shim_dma_bd9_1},
+  {"shim_dma_bd9_2", aie2ps::shim_dma_bd9_2},
+  {"shim_dma_bd9_3", aie2ps::shim_dma_bd9_3},
+  {"shim_dma_bd9_4", aie2ps::shim_dma_bd9_4},
+  {"shim_dma_bd9_5", aie2ps::shim_dma_bd9_5},
+  {"shim_dma_bd9_6", aie2ps::shim_dma_bd9_6},
+  {"shim_dma_bd9_7", aie2ps::shim_dma_bd9_7},
+  {"shim_dma_bd9_8", aie2ps::shim_dma_bd9_8},
+  {"shim_dma_bd_step_size", aie2ps::shim_dma_bd_step_size},
+  {"shim_dma_mm2s_0_ctrl", aie2ps::shim_dma_mm2s_0_ctrl},
+  {"shim_dma_mm2s_0_response_fifo_parity_error_injection", aie2ps::shim_dma_mm2s_0_response_fifo_parity_error_injection},
+  {"shim_dma_mm2s_0_task_queue", aie2ps::shim_dma_mm2s_0_task_queue},
+  {"shim_dma_mm2s_1_ctrl", aie2ps::shim_dma_mm2s_1_ctrl},
+  {"shim_dma_mm2s_1_response_fifo_parity_error_injection", aie2ps::shim_dma_mm2s_1_response_fifo_parity_error_injection},
+  {"shim_dma_mm2s_1_task_queue", aie2ps::shim_dma_mm2s_1_task_queue},
+  {"shim_dma_mm2s_status_0", aie2ps::shim_dma_mm2s_status_0},
+  {"shim_dma_mm2s_status_1", aie2ps::shim_dma_mm2s_status_1},
+  {"shim_dma_pause", aie2ps::shim_dma_pause},
+  {"shim_dma_s2mm_0_ctrl", aie2ps::shim_dma_s2mm_0_ctrl},
+  {"shim_dma_s2mm_0_task_queue", aie2ps::shim_dma_s2mm_0_task_queue},
+  {"shim_dma_s2mm_1_ctrl", aie2ps::shim_dma_s2mm_1_ctrl},
+  {"shim_dma_s2mm_1_task_queue", aie2ps::shim_dma_s2mm_1_task_queue},
+  {"shim_dma_s2mm_current_write_count_0", aie2ps::shim_dma_s2mm_current_write_count_0},
+  {"shim_dma_s2mm_current_write_count_1", aie2ps::shim_dma_s2mm_current_write_count_1},
+  {"shim_dma_s2mm_fot_count_fifo_pop_0", aie2ps::shim_dma_s2mm_fot_count_fifo_pop_0},
+  {"shim_dma_s2mm_fot_count_fifo_pop_1", aie2ps::shim_dma_s2mm_fot_count_fifo_pop_1},
+  {"shim_dma_s2mm_status_0", aie2ps::shim_dma_s2mm_status_0},
+  {"shim_dma_s2mm_status_1", aie2ps::shim_dma_s2mm_status_1},
+  {"shim_dma_s2mm_step_size", aie2ps::shim_dma_s2mm_step_size},
+  {"shim_event_broadcast_a_0", aie2ps::shim_event_broadcast_a_0},
+  {"shim_event_broadcast_a_1", aie2ps::shim_event_broadcast_a_1},
+  {"shim_event_broadcast_a_10", aie2ps::shim_event_broadcast_a_10},
+  {"shim_event_broadcast_a_11", aie2ps::shim_event_broadcast_a_11},
+  {"shim_event_broadcast_a_12", aie2ps::shim_event_broadcast_a_12},
+  {"shim_event_broadcast_a_13", aie2ps::shim_event_broadcast_a_13},
+  {"shim_event_broadcast_a_14", aie2ps::shim_event_broadcast_a_14},
+  {"shim_event_broadcast_a_15", aie2ps::shim_event_broadcast_a_15},
+  {"shim_event_broadcast_a_2", aie2ps::shim_event_broadcast_a_2},
+  {"shim_event_broadcast_a_3", aie2ps::shim_event_broadcast_a_3},
+  {"shim_event_broadcast_a_4", aie2ps::shim_event_broadcast_a_4},
+  {"shim_event_broadcast_a_5", aie2ps::shim_event_broadcast_a_5},
+  {"shim_event_broadcast_a_6", aie2ps::shim_event_broadcast_a_6},
+  {"shim_event_broadcast_a_7", aie2ps::shim_event_broadcast_a_7},
+  {"shim_event_broadcast_a_8", aie2ps::shim_event_broadcast_a_8},
+  {"shim_event_broadcast_a_9", aie2ps::shim_event_broadcast_a_9},
+  {"shim_event_broadcast_a_block_east_clr", aie2ps::shim_event_broadcast_a_block_east_clr},
+  {"shim_event_broadcast_a_block_east_set", aie2ps::shim_event_broadcast_a_block_east_set},
+  {"shim_event_broadcast_a_block_east_value", aie2ps::shim_event_broadcast_a_block_east_value},
+  {"shim_event_broadcast_a_block_north_clr", aie2ps::shim_event_broadcast_a_block_north_clr},
+  {"shim_event_broadcast_a_block_north_set", aie2ps::shim_event_broadcast_a_block_north_set},
+  {"shim_event_broadcast_a_block_north_value", aie2ps::shim_event_broadcast_a_block_north_value},
+  {"shim_event_broadcast_a_block_south_clr", aie2ps::shim_event_broadcast_a_block_south_clr},
+  {"shim_event_broadcast_a_block_south_set", aie2ps::shim_event_broadcast_a_block_south_set},
+  {"shim_event_broadcast_a_block_south_value", aie2ps::shim_event_broadcast_a_block_south_value},
+  {"shim_event_broadcast_a_block_west_clr", aie2ps::shim_event_broadcast_a_block_west_clr},
+  {"shim_event_broadcast_a_block_west_set", aie2ps::shim_event_broadcast_a_block_west_set},
+  {"shim_event_broadcast_a_block_west_value", aie2ps::shim_event_broadcast_a_block_west_value},
+  {"shim_event_generate", aie2ps::shim_event_generate},
+  {"shim_event_group_dma_enable", aie2ps::shim_event_group_dma_enable},
+  {"shim_event_status0", aie2ps::shim_event_status0},
+  {"shim_event_status1", aie2ps::shim_event_status1},
+  {"shim_event_status2", aie2ps::shim_event_status2},
+  {"shim_event_status3", aie2ps::shim_event_status3},
+  {"shim_interrupt_controller_2nd_level_disable", aie2ps::shim_interrupt_controller_2nd_level_disable},
+  {"shim_interrupt_controller_2nd_level_enable", aie2ps::shim_interrupt_controller_2nd_level_enable},
+  {"shim_interrupt_controller_2nd_level_interrupt", aie2ps::shim_interrupt_controller_2nd_level_interrupt},
+  {"shim_interrupt_controller_2nd_level_mask", aie2ps::shim_interrupt_controller_2nd_level_mask},
+  {"shim_interrupt_controller_2nd_level_status", aie2ps::shim_interrupt_controller_2nd_level_status},
+  {"shim_lock0_value", aie2ps::shim_lock0_value},
+  {"shim_lock10_value", aie2ps::shim_lock10_value},
+  {"shim_lock11_value", aie2ps::shim_lock11_value},
+  {"shim_lock12_value", aie2ps::shim_lock12_value},
+  {"shim_lock13_value", aie2ps::shim_lock13_value},
+  {"shim_lock14_value", aie2ps::shim_lock14_value},
+  {"shim_lock15_value", aie2ps::shim_lock15_value},
+  {"shim_lock1_value", aie2ps::shim_lock1_value},
+  {"shim_lock2_value", aie2ps::shim_lock2_value},
+  {"shim_lock3_value", aie2ps::shim_lock3_value},
+  {"shim_lock4_value", aie2ps::shim_lock4_value},
+  {"shim_lock5_value", aie2ps::shim_lock5_value},
+  {"shim_lock6_value", aie2ps::shim_lock6_value},
+  {"shim_lock7_value", aie2ps::shim_lock7_value},
+  {"shim_lock8_value", aie2ps::shim_lock8_value},
+  {"shim_lock9_value", aie2ps::shim_lock9_value},
+  {"shim_lock_request", aie2ps::shim_lock_request},
+  {"shim_lock_step_size", aie2ps::shim_lock_step_size},
+  {"shim_locks_event_selection_0", aie2ps::shim_locks_event_selection_0},
+  {"shim_locks_event_selection_1", aie2ps::shim_locks_event_selection_1},
+  {"shim_locks_event_selection_2", aie2ps::shim_locks_event_selection_2},
+  {"shim_locks_event_selection_3", aie2ps::shim_locks_event_selection_3},
+  {"shim_locks_event_selection_4", aie2ps::shim_locks_event_selection_4},
+  {"shim_locks_event_selection_5", aie2ps::shim_locks_event_selection_5},
+  {"shim_locks_overflow", aie2ps::shim_locks_overflow},
+  {"shim_locks_underflow", aie2ps::shim_locks_underflow},
+  {"shim_me_aximm_config", aie2ps::shim_me_aximm_config},
+  {"shim_mux_config", aie2ps::shim_mux_config},
+  {"shim_performance_control0", aie2ps::shim_performance_control0},
+  {"shim_performance_control1", aie2ps::shim_performance_control1},
+  {"shim_performance_control2", aie2ps::shim_performance_control2},
+  {"shim_performance_control3", aie2ps::shim_performance_control3},
+  {"shim_performance_control4", aie2ps::shim_performance_control4},
+  {"shim_performance_control5", aie2ps::shim_performance_control5},
+  {"shim_performance_counter0", aie2ps::shim_performance_counter0},
+  {"shim_performance_counter0_event_value", aie2ps::shim_performance_counter0_event_value},
+  {"shim_performance_counter1", aie2ps::shim_performance_counter1},
+  {"shim_performance_counter1_event_value", aie2ps::shim_performance_counter1_event_value},
+  {"shim_performance_counter2", aie2ps::shim_performance_counter2},
+  {"shim_performance_counter3", aie2ps::shim_performance_counter3},
+  {"shim_performance_counter4", aie2ps::shim_performance_counter4},
+  {"shim_performance_counter5", aie2ps::shim_performance_counter5},
+  {"shim_smid", aie2ps::shim_smid},
+  {"shim_stream_switch_event_port_selection_0", aie2ps::shim_stream_switch_event_port_selection_0},
+  {"shim_stream_switch_event_port_selection_1", aie2ps::shim_stream_switch_event_port_selection_1},
+  {"shim_timer_high", aie2ps::shim_timer_high},
+  {"shim_timer_low", aie2ps::shim_timer_low},
+  {"shim_timer_trig_event_high_value", aie2ps::shim_timer_trig_event_high_value},
+  {"shim_timer_trig_event_low_value", aie2ps::shim_timer_trig_event_low_value},
+  {"shim_trace_control0", aie2ps::shim_trace_control0},
+  {"shim_trace_control1", aie2ps::shim_trace_control1},
+  {"shim_trace_event0", aie2ps::shim_trace_event0},
+  {"shim_trace_event1", aie2ps::shim_trace_event1},
+  {"shim_trace_status", aie2ps::shim_trace_status},
+  {"uc_base_address", aie2ps::uc_base_address},
+  {"uc_core_control", aie2ps::uc_core_control},
+  {"uc_core_interrupt_status", aie2ps::uc_core_interrupt_status},
+  {"uc_core_status", aie2ps::uc_core_status},
+  {"uc_dma_dm2mm_axi_control", aie2ps::uc_dma_dm2mm_axi_control},
+  {"uc_dma_dm2mm_control", aie2ps::uc_dma_dm2mm_control},
+  {"uc_dma_dm2mm_status", aie2ps::uc_dma_dm2mm_status},
+  {"uc_dma_mm2dm_axi_control", aie2ps::uc_dma_mm2dm_axi_control},
+  {"uc_dma_mm2dm_control", aie2ps::uc_dma_mm2dm_control},
+  {"uc_dma_mm2dm_status", aie2ps::uc_dma_mm2dm_status},
+  {"uc_dma_pause", aie2ps::uc_dma_pause},
+  {"uc_mdm_dbg_ctrl_status", aie2ps::uc_mdm_dbg_ctrl_status},
+  {"uc_mdm_dbg_data", aie2ps::uc_mdm_dbg_data},
+  {"uc_mdm_dbg_lock", aie2ps::uc_mdm_dbg_lock},
+  {"uc_mdm_pccmdr", aie2ps::uc_mdm_pccmdr},
+  {"uc_mdm_pcctrlr", aie2ps::uc_mdm_pcctrlr},
+  {"uc_mdm_pcdrr", aie2ps::uc_mdm_pcdrr},
+  {"uc_mdm_pcsr", aie2ps::uc_mdm_pcsr},
+  {"uc_mdm_pcwr", aie2ps::uc_mdm_pcwr},
+  {"uc_memory_dm_ecc_error_generation", aie2ps::uc_memory_dm_ecc_error_generation},
+  {"uc_memory_dm_ecc_scrubbing_period", aie2ps::uc_memory_dm_ecc_scrubbing_period},
+  {"uc_memory_privileged", aie2ps::uc_memory_privileged},
+  {"uc_memory_zeroization", aie2ps::uc_memory_zeroization},
+  {"uc_module_axi_mm_outstanding_transactions", aie2ps::uc_module_axi_mm_outstanding_transactions},
+  {"uc_module_aximm_offset", aie2ps::uc_module_aximm_offset},
+};
+
+// Ids of registers in order of address
+constexpr uint16_t byAddress[] = {
+  1721, 1681, 1728, 1661, 1511, 1512, 1506, 1502, 1731, 1507, 1503, 1499,
+  1732, 1504, 1500, 1509, 1505, 1501, 1510, 1734, 1735, 1736, 1722, 1723,
+  1724, 1725, 1726, 1727, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746,
+  1514, 1719, 1717, 1716, 1720, 1718, 1747, 1748, 1516, 1515, 1763, 1517,
+  1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1580, 1581, 1582, 1583,
+  1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
+  1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+  1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,
+  1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+  1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+  1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
+  1656, 1657, 1658, 1659, 1660, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+  1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+  1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
+  1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568,
+  1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1671,
+  1672, 1673, 1674, 1662, 1664, 1665, 1667, 1679, 1680, 1668, 1669, 1675,
+  1676, 1677, 1678, 1663, 1666, 1670, 1737, 1476, 1477, 1478, 1479, 1480,
+  1482, 1484, 1485, 1481, 1483, 1486, 1435, 1407, 1408, 1415, 1416, 1417,
+  1418, 1419, 1420, 1421, 1422, 1409, 1410, 1411, 1412, 1413, 1414, 1430,
+  1429, 1431, 1433, 1432, 1434, 1427, 1426, 1428, 1424, 1423, 1425, 1491,
+  1492, 1495, 1493, 1494, 1490, 1489, 1488, 1487, 1496, 1497, 1444, 1445,
+  1446, 1447, 1293, 1292, 1406, 1436, 1443, 1438, 1440, 1441, 1439, 1437,
+  1442, 1475, 1294, 1295, 1296, 1297, 1298, 1299, 1336, 1337, 1338, 1339,
+  1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
+  1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+  1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+  1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+  1388, 1389, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+  1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321,
+  1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+  1334, 1335, 1396, 1397, 1398, 1399, 1390, 1391, 1392, 1393, 1404, 1405,
+  1394, 1395, 1400, 1401, 1402, 1403, 1448, 1455, 1456, 1457, 1458, 1459,
+  1460, 1461, 1462, 1463, 1449, 1450, 1451, 1452, 1453, 1454, 1465, 1466,
+  1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 99, 100, 101, 102,
+  67, 68, 69, 70, 35, 36, 37, 38, 3, 4, 5, 6,
+  103, 104, 105, 106, 71, 72, 73, 74, 39, 40, 41, 42,
+  7, 8, 9, 10, 107, 108, 109, 110, 75, 76, 77, 78,
+  43, 44, 45, 46, 11, 12, 13, 14, 111, 112, 113, 114,
+  79, 80, 81, 82, 47, 48, 49, 50, 15, 16, 17, 18,
+  115, 116, 117, 118, 83, 84, 85, 86, 51, 52, 53, 54,
+  19, 20, 21, 22, 119, 120, 121, 122, 87, 88, 89, 90,
+  55, 56, 57, 58, 23, 24, 25, 26, 123, 124, 125, 126,
+  91, 92, 93, 94, 59, 60, 61, 62, 27, 28, 29, 30,
+  127, 128, 129, 130, 95, 96, 97, 98, 63, 64, 65, 66,
+  31, 32, 33, 34, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1757,
+  1759, 1760, 1761, 1762, 1756, 1758, 275, 276, 277, 278, 287, 288,
+  289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+  301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312,
+  313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 279, 280,
+  281, 282, 283, 284, 285, 286, 198, 199, 200, 201, 190, 191,
+  192, 193, 202, 203, 204, 205, 194, 195, 196, 197, 271, 272,
+  273, 274, 267, 268, 269, 270, 184, 185, 186, 187, 159, 160,
+  163, 164, 165, 166, 167, 168, 169, 170, 161, 162, 171, 172,
+  175, 176, 177, 178, 179, 180, 181, 182, 173, 174, 227, 228,
+  239, 250, 253, 254, 255, 256, 257, 258, 229, 230, 231, 232,
+  233, 234, 235, 236, 237, 238, 240, 241, 242, 243, 244, 245,
+  246, 247, 248, 249, 251, 252, 209, 210, 211, 212, 213, 214,
+  215, 216, 151, 152, 153, 154, 155, 156, 157, 158, 143, 144,
+  145, 146, 147, 148, 149, 150, 135, 136, 137, 138, 139, 140,
+  141, 142, 217, 218, 219, 220, 221, 222, 223, 224, 259, 260,
+  261, 262, 225, 183, 263, 207, 208, 206, 188, 189, 132, 133,
+  134, 264, 265, 555, 1710, 332, 333, 340, 341, 1692, 1693, 1694,
+  1695, 346, 347, 1684, 1685, 1686, 1687, 1688, 1689, 1705, 1704, 356,
+  1708, 357, 1709, 1702, 351, 1703, 349, 1698, 350, 1770, 1771, 1774,
+  1772, 1773, 559, 1768, 1767, 556, 1712, 1713, 1714, 1715, 2, 1,
+  328, 361, 367, 364, 363, 365, 366, 368, 362, 369, 0, 374,
+  380, 381, 382, 383, 385, 387, 389, 384, 386, 388, 390, 131,
+  266, 329, 392, 323, 324, 325, 326, 376, 377, 378, 379, 330,
+  331, 226, 327, 403, 404, 405, 421, 410, 417, 418, 419, 420,
+  422, 423, 424, 425, 411, 412, 413, 414, 415, 416, 406, 407,
+  408, 409, 436, 438, 439, 456, 444, 450, 451, 452, 453, 454,
+  455, 457, 458, 459, 460, 446, 447, 448, 449, 440, 441, 442,
+  443, 437, 445, 428, 429, 430, 431, 461, 462, 463, 464, 465,
+  466, 467, 468, 533, 534, 535, 536, 485, 486, 487, 488, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521,
+  522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 537,
+  538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+  550, 551, 552, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+  502, 503, 504, 505, 506, 507, 508, 469, 470, 471, 472, 473,
+  474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 432,
+  433, 434, 435, 489, 490, 491, 492, 396, 397, 395, 399, 400,
+  398, 401, 402, 427, 426, 554, 394, 393, 1464, 375, 553, 1142,
+  1143, 1144, 1145, 1146, 1147, 1149, 1151, 1153, 1155, 1156, 1148, 1150,
+  1152, 1154, 1278, 1047, 1007, 1008, 1015, 1016, 1017, 1018, 1019, 1020,
+  1021, 1022, 1009, 1010, 1011, 1012, 1013, 1014, 1030, 1029, 1031, 1033,
+  1032, 1034, 1027, 1026, 1028, 1024, 1023, 1025, 1042, 1041, 1043, 1045,
+  1044, 1046, 1039, 1038, 1040, 1036, 1035, 1037, 1283, 1284, 1287, 1285,
+  1286, 1282, 1281, 1280, 1279, 1288, 1289, 1290, 1291, 1057, 1058, 1059,
+  1060, 1061, 1062, 566, 565, 1006, 1048, 1056, 1050, 1052, 1054, 1053,
+  1051, 1049, 1055, 1140, 567, 568, 569, 570, 571, 572, 573, 574,
+  655, 656, 657, 658, 659, 660, 661, 662, 743, 744, 745, 746,
+  747, 748, 749, 750, 831, 832, 833, 834, 835, 836, 837, 838,
+  903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914,
+  915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926,
+  927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938,
+  939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950,
+  575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+  587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598,
+  599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610,
+  611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622,
+  623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634,
+  635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646,
+  647, 648, 649, 650, 651, 652, 653, 654, 663, 664, 665, 666,
+  667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678,
+  679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690,
+  691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702,
+  703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714,
+  715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726,
+  727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738,
+  739, 740, 741, 742, 751, 752, 753, 754, 755, 756, 757, 758,
+  759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770,
+  771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782,
+  783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
+  795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806,
+  807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818,
+  819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830,
+  839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850,
+  851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862,
+  863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+  875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886,
+  887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898,
+  899, 900, 901, 902, 976, 977, 978, 979, 980, 981, 982, 983,
+  984, 985, 986, 987, 953, 954, 956, 957, 959, 960, 962, 963,
+  965, 966, 968, 969, 1000, 1001, 1002, 1003, 1004, 1005, 970, 971,
+  972, 973, 974, 975, 951, 988, 989, 990, 991, 992, 993, 994,
+  995, 996, 997, 998, 999, 952, 955, 958, 961, 964, 967, 1167,
+  1168, 1169, 1170, 1171, 1172, 1183, 1179, 1180, 1181, 1182, 1173, 1174,
+  1175, 1176, 1177, 1178, 1186, 1187, 1188, 1189, 1190, 1191, 1202, 1196,
+  1197, 1198, 1199, 1200, 1201, 1192, 1193, 1194, 1195, 1203, 1204, 1205,
+  1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
+  1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1268, 1269,
+  1270, 1271, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
+  1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265,
+  1266, 1267, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237,
+  1238, 1239, 1240, 1241, 1242, 1243, 1272, 1273, 1274, 1275, 1160, 1161,
+  1159, 1163, 1164, 1162, 1165, 1166, 1185, 1184, 1277, 1158, 1157, 1790,
+  1789, 1792, 1791, 1793, 1063, 1776, 1777, 1074, 1085, 1798, 1096, 1796,
+  1795, 1794, 1107, 1118, 1123, 1124, 1125, 1126, 1064, 1065, 1066, 1067,
+  1068, 1069, 1781, 1780, 1779, 1784, 1783, 1782, 1785, 1073, 1075, 1076,
+  1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1086, 1087, 1088, 1089,
+  1090, 1091, 1092, 1093, 1094, 1095, 1097, 1098, 1099, 1100, 1101, 1102,
+  1103, 1104, 1105, 1106, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+  1116, 1117, 1119, 1120, 1121, 1122, 1128, 1129, 1130, 1131, 1132, 1133,
+  1134, 1135, 1136, 1137, 1138, 1139, 1127, 1141, 1276,
+};
+
+static_assert(isSortedByName(registers, std::size(registers)),
+              "AIE2PS registers must be sorted by name");
+static_assert(isSortedByAddress(registers, byAddress, std::size(byAddress)),
+              "AIE2PS register ids must be sorted by address");
+
+} // end anonymous namespace
+
+RegisterNameTable getAIE2psRegisterNames()
+{
+  return RegisterNameTable(registers, static_cast<uint16_t>(std::size(registers)),
+                           byAddress, static_cast<uint16_t>(std::size(byAddress)));
+}
+
+} // end namespace xdp
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #define XDP_PLUGIN_SOURCE
 
@@ -75,6 +75,10 @@ namespace xdp {
 
     resultBO.sync(XCL_BO_SYNC_BO_FROM_DEVICE);
 
+    // Registers are added again below, along with this pass's values
+    for (auto& tileAddr : debugTileMap)
+      tileAddr.second->clearRegisters();
+
     for (uint32_t i = 0; i < op->count; i++) {
       uint8_t col  = (op->data[i].address >> 25) & 0x1F;
       uint8_t row  = (op->data[i].address >> 20) & 0x1F;
@@ -94,8 +98,8 @@ namespace xdp {
       if (debugTileMap.find(tile) == debugTileMap.end())
         debugTileMap[tile] = std::make_unique<ClientReadableTile>(col, row, reg);
         
-      auto regName = metadata->lookupRegisterName(reg);
-      debugTileMap[tile]->addOffsetName(reg, regName);
+      auto regId = metadata->lookupRegisterId(reg);
+      debugTileMap[tile]->addRegister(reg, regId);
       debugTileMap[tile]->addValue(output[i]);
     }
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2023-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2023-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #define XDP_PLUGIN_SOURCE
 
@@ -158,8 +158,8 @@ namespace xdp {
           if (debugTileMap.find(tile) == debugTileMap.end())
             debugTileMap[tile] = std::make_unique<EdgeReadableTile>(tile.col, tile.row, tileOffset);
         
-          auto regName = metadata->lookupRegisterName(regAddr);
-          debugTileMap[tile]->addOffsetName(regAddr, regName);
+          auto regId = metadata->lookupRegisterId(regAddr);
+          debugTileMap[tile]->addRegister(regAddr, regId);
         }
       }
     }
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #define XDP_PLUGIN_SOURCE
 
@@ -202,11 +202,14 @@ namespace xdp {
           // 25 is column offset and 20 is row offset for IPU
           op_profile_data.emplace_back(register_data_t{Regs[i] + (col << 25) + (row << 20)});
 
-          std::vector<uint64_t> values;
-          uint8_t absCol = col + startCol;
-          values.insert(values.end(), {absCol, row, phyStartEvent, phyEndEvent, 
-                        resetEvent, 0, 0, payload});
-          outputValues.push_back(values);
+          counters::AIESample sample = {};
+          sample.column     = static_cast<uint8_t>(col + startCol);
+          sample.row        = static_cast<uint8_t>(row);
+          sample.startEvent = phyStartEvent;
+          sample.endEvent   = phyEndEvent;
+          sample.resetEvent = resetEvent;
+          sample.payload    = payload;
+          outputValues.push_back(sample);
 
           counterId++;
           numCounters++;
@@ -341,9 +344,10 @@ namespace xdp {
       std::stringstream msg;
       msg << "Counter address/values: 0x" << std::hex << op->data[i].address << ": " << std::dec << output[i];
       xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT", msg.str());
-      std::vector<uint64_t> values = outputValues[i];
-      values[5] = static_cast<uint64_t>(output[i]); //write pc value
-      db->getDynamicInfo().addAIESample(id, timestamp, values);
+      counters::AIESample sample = outputValues[i];
+      sample.timestamp = timestamp;
+      sample.value = static_cast<uint64_t>(output[i]); //write pc value
+      db->getDynamicInfo().addAIESample(id, sample);
     }
 
     finishedPoll=true;
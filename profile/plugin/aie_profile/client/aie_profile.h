@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef AIE_PROFILE_H
 #define AIE_PROFILE_H
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "xdp/profile/database/dynamic_info/types.h"
 #include "xdp/profile/database/static_info/aie_constructs.h"
 #include "xdp/profile/plugin/aie_profile/aie_profile_defs.h"
 #include "xdp/profile/plugin/aie_profile/aie_profile_impl.h"
@@ -66,7 +67,7 @@ namespace xdp {
       read_register_op_t* op;
       std::size_t op_size;
       XAie_DevInst aieDevInst = {0};
-      std::vector<std::vector<uint64_t>> outputValues;
+      std::vector<counters::AIESample> outputValues;
       bool finishedPoll = false;
 
   };
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #define XDP_PLUGIN_SOURCE 
 
@@ -500,25 +500,38 @@ namespace xdp {
     poll(id);
   }
 
-  void AieProfile_EdgeImpl::poll(const uint64_t id)
+  void AieProfile_EdgeImpl::buildReadPlan()
   {
-    // Wait until xclbin has been loaded and device has been updated in database
-    if (!(db->getStaticInfo().isDeviceReady(id)))
+    // Resolve the perf counters, ADF API results and tile information of
+    // every counter up front so polling never builds keys, searches maps
+    // or handles exceptions.  Counters that cannot be resolved are left
+    // out of the plan, just as they were skipped when polled.
+    readPlan.clear();
+    if (!counterSnapshot)
       return;
+    readPlan.reserve(counterSnapshot->counters.size());
+
+    auto findResult = [this](aie::profile::adfAPI api, const std::string& key)
+                      -> aie::profile::adfAPIResourceInfo* {
+      auto apiIter = adfAPIResourceInfoMap.find(api);
+      if (apiIter == adfAPIResourceInfoMap.end())
+        return nullptr;
+      auto keyIter = apiIter->second.find(key);
+      if (keyIter == apiIter->second.end())
+        return nullptr;
+      if ((keyIter->second.srcPcIdx >= perfCounters.size()) ||
+          ((api == aie::profile::adfAPI::INTF_TILE_LATENCY) &&
+           (keyIter->second.destPcIdx >= perfCounters.size())))
+        return nullptr;
+      return &(keyIter->second);
+    };
 
-    if (!aieDevInst)
-      return;
+    bool firstTile = true;
+    uint8_t prevColumn = 0;
+    uint8_t prevRow = 0;
 
-    uint32_t prevColumn = 0;
-    uint32_t prevRow = 0;
-    uint64_t timerValue = 0;
-
-    // Iterate over all AIE Counters & Timers
-    auto numCounters = db->getStaticInfo().getNumAIECounter(id);
-    for (uint64_t c=0; c < numCounters; c++) {
-      auto aie = db->getStaticInfo().getAIECounter(id, c);
-      if (!aie)
-        continue;
+    for (uint64_t c = 0; c < counterSnapshot->counters.size(); c++) {
+      const AIECounter* aie = &(counterSnapshot->counters[c]);
 
       auto absCol = (db->getStaticInfo().getAppStyle() == xdp::AppStyle::LOAD_XCLBIN_STYLE)
                     ? aie->column 
@@ -527,80 +540,119 @@ namespace xdp {
                     ? aie->column - metadata->getPartitionOverlayStartCols().front()
                     : aie->column ;
 
-      std::vector<uint64_t> values;
-      values.push_back(absCol);
-      values.push_back(aie::getRelativeRow(aie->row, metadata->getAIETileRowOffset()));
-      values.push_back(aie->startEvent);
-      values.push_back(aie->endEvent);
-      values.push_back(aie->resetEvent);
+      CounterReadStep step;
+      step.location      = XAie_TileLoc(getXAIECol(relCol), aie->row);
+      step.counterNumber = aie->counterNumber;
 
-      // Read counter value from device
-      uint32_t counterValue;
       if (perfCounters.empty()) {
         // Compiler-defined counters
-        XAie_LocType tileLocation = XAie_TileLoc(getXAIECol(relCol), aie->row);
-        XAie_PerfCounterGet(aieDevInst, tileLocation, XAIE_CORE_MOD, aie->counterNumber, &counterValue);
+        step.kind = CounterRead::compiler;
       }
-      else {
-        // Runtime-defined counters
-        if (aie::profile::adfAPILatencyConfigEvent(aie->startEvent))
-        {
-          uint32_t srcCounterValue = 0;
-          uint32_t destCounterValue = 0;
-          try {
-            std::string srcDestPairKey = metadata->getSrcDestPairKey(aie->column, aie->row, aie->streamId);
-            uint64_t srcPcIdx = adfAPIResourceInfoMap.at(aie::profile::adfAPI::INTF_TILE_LATENCY).at(srcDestPairKey).srcPcIdx;
-            uint64_t destPcIdx = adfAPIResourceInfoMap.at(aie::profile::adfAPI::INTF_TILE_LATENCY).at(srcDestPairKey).destPcIdx;
-            auto srcPerfCount = perfCounters.at(srcPcIdx);
-            auto destPerfCount = perfCounters.at(destPcIdx);
-            srcPerfCount->readResult(srcCounterValue);
-            destPerfCount->readResult(destCounterValue);
-            counterValue = (destCounterValue > srcCounterValue) ? (destCounterValue-srcCounterValue) : (srcCounterValue-destCounterValue);
-            uint64_t storedValue = adfAPIResourceInfoMap[aie::profile::adfAPI::INTF_TILE_LATENCY][srcDestPairKey].profileResult;
-            if (counterValue != storedValue)
-              adfAPIResourceInfoMap[aie::profile::adfAPI::INTF_TILE_LATENCY][srcDestPairKey].profileResult = counterValue;
-          } catch(...) {
-            continue;
-          }
-        }
-        else if (aie::profile::adfAPIStartToTransferredConfigEvent(aie->startEvent))
-        {
-          try {
-            std::string srcKey = "(" + aie::uint8ToStr(aie->column) + "," + aie::uint8ToStr(aie->row) + ")";
-            uint64_t srcPcIdx = adfAPIResourceInfoMap.at(aie::profile::adfAPI::START_TO_BYTES_TRANSFERRED).at(srcKey).srcPcIdx;
-            auto perfCounter = perfCounters.at(srcPcIdx);
-            perfCounter->readResult(counterValue);
-            uint64_t storedValue = adfAPIResourceInfoMap[aie::profile::adfAPI::START_TO_BYTES_TRANSFERRED][srcKey].profileResult;
-            if (counterValue != storedValue)
-              adfAPIResourceInfoMap[aie::profile::adfAPI::START_TO_BYTES_TRANSFERRED][srcKey].profileResult = counterValue;
-          } catch(...) {
-            continue;
-          }
-        } 
-        else {
-          auto perfCounter = perfCounters.at(c);
-          perfCounter->readResult(counterValue);
+      else if (aie::profile::adfAPILatencyConfigEvent(aie->startEvent)) {
+        aie::profile::adfAPIResourceInfo* info = nullptr;
+        try {
+          std::string srcDestPairKey = metadata->getSrcDestPairKey(aie->column, aie->row, aie->streamId);
+          info = findResult(aie::profile::adfAPI::INTF_TILE_LATENCY, srcDestPairKey);
+        } catch(...) {
         }
+        if (!info)
+          continue;
+        step.kind        = CounterRead::latency;
+        step.source      = perfCounters[info->srcPcIdx].get();
+        step.destination = perfCounters[info->destPcIdx].get();
+        step.result      = &(info->profileResult);
+      }
+      else if (aie::profile::adfAPIStartToTransferredConfigEvent(aie->startEvent)) {
+        std::string srcKey = "(" + aie::uint8ToStr(aie->column) + "," + aie::uint8ToStr(aie->row) + ")";
+        auto info = findResult(aie::profile::adfAPI::START_TO_BYTES_TRANSFERRED, srcKey);
+        if (!info)
+          continue;
+        step.kind   = CounterRead::bytesTransferred;
+        step.source = perfCounters[info->srcPcIdx].get();
+        step.result = &(info->profileResult);
+      }
+      else {
+        if (c >= perfCounters.size())
+          continue;
+        step.kind   = CounterRead::single;
+        step.source = perfCounters[c].get();
       }
-      values.push_back(counterValue);
 
-      // Read tile timer (once per tile to minimize overhead)
-      if ((aie->column != prevColumn) || (aie->row != prevRow)) {
+      if (firstTile || (aie->column != prevColumn) || (aie->row != prevRow)) {
+        firstTile  = false;
         prevColumn = aie->column;
-        prevRow = aie->row;
+        prevRow    = aie->row;
         auto moduleType = aie::getModuleType(aie->row, metadata->getAIETileRowOffset());
-        auto falModuleType =  (moduleType == module_type::core) ? XAIE_CORE_MOD 
-                            : ((moduleType == module_type::shim) ? XAIE_PL_MOD 
-                            : XAIE_MEM_MOD);
-        XAie_LocType tileLocation = XAie_TileLoc(getXAIECol(relCol), aie->row);
-        XAie_ReadTimer(aieDevInst, tileLocation, falModuleType, &timerValue);
+        step.readTimer   = true;
+        step.timerModule = (moduleType == module_type::core) ? XAIE_CORE_MOD 
+                         : ((moduleType == module_type::shim) ? XAIE_PL_MOD 
+                         : XAIE_MEM_MOD);
+      }
+
+      step.sample.column     = static_cast<uint8_t>(absCol);
+      step.sample.row        = static_cast<uint8_t>(aie::getRelativeRow(aie->row, metadata->getAIETileRowOffset()));
+      step.sample.startEvent = aie->startEvent;
+      step.sample.endEvent   = aie->endEvent;
+      step.sample.resetEvent = aie->resetEvent;
+      step.sample.payload    = aie->payload;
+      readPlan.push_back(step);
+    }
+  }
+
+  void AieProfile_EdgeImpl::poll(const uint64_t id)
+  {
+    // Wait until xclbin has been loaded and device has been updated in database
+    if (!(db->getStaticInfo().isDeviceReady(id)))
+      return;
+
+    if (!aieDevInst)
+      return;
+
+    // Rebuild the read plan only when the counters being polled change
+    auto snapshot = db->getStaticInfo().getAIECounterSnapshot(id, counterSnapshot);
+    if (snapshot != counterSnapshot) {
+      counterSnapshot = snapshot;
+      buildReadPlan();
+    }
+
+    // Iterate over all AIE Counters & Timers
+    uint64_t timerValue = 0;
+    for (auto& step : readPlan) {
+      // Read counter value from device
+      uint32_t counterValue = 0;
+      switch (step.kind) {
+      case CounterRead::compiler:
+        XAie_PerfCounterGet(aieDevInst, step.location, XAIE_CORE_MOD, step.counterNumber, &counterValue);
+        break;
+      case CounterRead::single:
+        step.source->readResult(counterValue);
+        break;
+      case CounterRead::latency: {
+        uint32_t srcCounterValue = 0;
+        uint32_t destCounterValue = 0;
+        step.source->readResult(srcCounterValue);
+        step.destination->readResult(destCounterValue);
+        counterValue = (destCounterValue > srcCounterValue) ? (destCounterValue-srcCounterValue) : (srcCounterValue-destCounterValue);
+        *step.result = counterValue;
+        break;
+      }
+      case CounterRead::bytesTransferred:
+        step.source->readResult(counterValue);
+        *step.result = counterValue;
+        break;
       }
-      values.push_back(timerValue);
-      values.push_back(aie->payload);
+
+      // Read tile timer (once per tile to minimize overhead)
+      if (step.readTimer)
+        XAie_ReadTimer(aieDevInst, step.location, step.timerModule, &timerValue);
+
+      counters::AIESample sample = step.sample;
+      sample.value = counterValue;
+      sample.timer = timerValue;
 
       // Get timestamp in milliseconds
-      double timestamp = xrt_core::time_ns() / 1.0e6;
-      db->getDynamicInfo().addAIESample(id, timestamp, values);
+      sample.timestamp = xrt_core::time_ns() / 1.0e6;
+      db->getDynamicInfo().addAIESample(id, sample);
     }
   }
 
@@ -1,12 +1,14 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef AIE_PROFILE_H
 #define AIE_PROFILE_H
 
 #include <cstdint>
+#include <vector>
 
 #include "core/edge/common/aie_parser.h"
+#include "xdp/profile/database/dynamic_info/types.h"
 #include "xdp/profile/plugin/aie_profile/aie_profile_impl.h"
 #include "xdp/profile/plugin/aie_profile/util/aie_profile_util.h"
 #include "xaiefal/xaiefal.hpp"
@@ -57,6 +59,30 @@ namespace xdp {
       XAie_DevInst*     aieDevInst = nullptr;
       xaiefal::XAieDev* aieDevice  = nullptr;    
 
+      // Everything needed to read one counter, resolved once when the
+      // counters being polled change so polling is a tight loop
+      enum class CounterRead : uint8_t {
+        compiler,        // Compiler-defined counter read through the driver
+        single,          // Runtime-defined counter
+        latency,         // ADF API latency between two counters
+        bytesTransferred // ADF API start to bytes transferred
+      };
+      struct CounterReadStep
+      {
+        CounterRead kind;
+        xaiefal::XAiePerfCounter* source = nullptr;
+        xaiefal::XAiePerfCounter* destination = nullptr;
+        uint64_t* result = nullptr; // ADF API result kept up to date
+        XAie_LocType location;
+        uint8_t counterNumber = 0;
+        bool readTimer = false;     // First counter of its tile
+        XAie_ModuleType timerModule = XAIE_CORE_MOD;
+        counters::AIESample sample = {}; // Fields that never change
+      };
+      std::vector<CounterReadStep> readPlan;
+
+      void buildReadPlan();
+
       std::map<std::string, std::vector<XAie_Events>> coreStartEvents;
       std::map<std::string, std::vector<XAie_Events>> coreEndEvents;
       std::map<std::string, std::vector<XAie_Events>> memoryStartEvents;
@@ -66,6 +92,8 @@ namespace xdp {
       std::map<std::string, std::vector<XAie_Events>> memTileStartEvents;
       std::map<std::string, std::vector<XAie_Events>> memTileEndEvents; 
       std::vector<std::shared_ptr<xaiefal::XAiePerfCounter>> perfCounters;
+      // Counters being polled, refreshed once per sweep if they changed
+      std::shared_ptr<const AIECounterSnapshot> counterSnapshot;
       std::vector<std::shared_ptr<xaiefal::XAieStreamPortSelect>> streamPorts;
 
       bool graphItrBroadcastConfigDone = false;
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #ifndef AIE_PROFILE_H
 #define AIE_PROFILE_H
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "core/edge/common/aie_parser.h"
+#include "xdp/profile/database/dynamic_info/types.h"
 #include "xdp/profile/plugin/aie_profile/aie_profile_impl.h"
 #include "xdp/profile/plugin/aie_profile/util/aie_profile_util.h"
 #include "xdp/profile/plugin/aie_base/generations/aie2ps_registers.h"
@@ -99,6 +100,30 @@ namespace xdp {
     #ifdef XDP_VE2_ZOCL_BUILD
       XAie_DevInst*     aieDevInst = nullptr;
       xaiefal::XAieDev* aieDevice  = nullptr;    
+
+      // Everything needed to read one counter, resolved once when the
+      // counters being polled change so polling is a tight loop
+      enum class CounterRead : uint8_t {
+        compiler,        // Compiler-defined counter read through the driver
+        single,          // Runtime-defined counter
+        latency,         // ADF API latency between two counters
+        bytesTransferred // ADF API start to bytes transferred
+      };
+      struct CounterReadStep
+      {
+        CounterRead kind;
+        xaiefal::XAiePerfCounter* source = nullptr;
+        xaiefal::XAiePerfCounter* destination = nullptr;
+        uint64_t* result = nullptr; // ADF API result kept up to date
+        XAie_LocType location;
+        uint8_t counterNumber = 0;
+        bool readTimer = false;     // First counter of its tile
+        XAie_ModuleType timerModule = XAIE_CORE_MOD;
+        counters::AIESample sample = {}; // Fields that never change
+      };
+      std::vector<CounterReadStep> readPlan;
+
+      void buildReadPlan();
     #else
       void configEventSelections(const XAie_LocType loc, const module_type type, const std::string metricSet, std::vector<uint8_t>& channels);
       void configStreamSwitchPorts(const tile_type& tile, const XAie_LocType& loc, const module_type& type, const std::string& metricSet, const uint8_t channel, const XAie_Events startEvent);
@@ -109,7 +134,7 @@ namespace xdp {
       XAie_DevInst aieDevInst = {0};
       bool finishedPoll = false;
       std::vector<u32> op_profile_data;
-      std::vector<std::vector<uint64_t>> outputValues;
+      std::vector<counters::AIESample> outputValues;
       
       // Register offsets per tile type for VE2 (AIE2PS) — used to build the poll ELF.
       const std::map<module_type, std::vector<uint64_t>> regValues {
@@ -135,6 +160,8 @@ namespace xdp {
       std::map<std::string, std::vector<uint32_t>> microcontrollerEvents;
       std::map<tile_type, std::vector<uint32_t>> microcontrollerTileEvents;
       std::vector<std::shared_ptr<xaiefal::XAiePerfCounter>> perfCounters;
+      // Counters being polled, refreshed once per sweep if they changed
+      std::shared_ptr<const AIECounterSnapshot> counterSnapshot;
       std::vector<std::shared_ptr<xaiefal::XAieStreamPortSelect>> streamPorts;
 
       bool graphItrBroadcastConfigDone = false;
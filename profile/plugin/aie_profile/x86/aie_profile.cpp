@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -215,18 +215,18 @@ namespace xdp {
       ProfileOutputConfiguration* cfg = reinterpret_cast<ProfileOutputConfiguration*>(outbo_map);
 
       for (uint32_t i = 0; i < numCountersConfigured; i++) {
-        std::vector<uint64_t> values;
         auto& counter = cfg->counters[i];
-        values.push_back(counter.col);
-        values.push_back(counter.row);
-        values.push_back(counter.startEvent);
-        values.push_back(counter.endEvent);
-        values.push_back(counter.resetEvent);
-        values.push_back(counter.counterValue);
-        values.push_back(counter.timerValue);
-        values.push_back(counter.payload);
-        double timestamp = xrt_core::time_ns() / 1.0e6;
-        db->getDynamicInfo().addAIESample(id, timestamp, values);
+        counters::AIESample sample = {};
+        sample.column     = static_cast<uint8_t>(counter.col);
+        sample.row        = static_cast<uint8_t>(counter.row);
+        sample.startEvent = static_cast<uint16_t>(counter.startEvent);
+        sample.endEvent   = static_cast<uint16_t>(counter.endEvent);
+        sample.resetEvent = static_cast<uint16_t>(counter.resetEvent);
+        sample.value      = counter.counterValue;
+        sample.timer      = counter.timerValue;
+        sample.payload    = counter.payload;
+        sample.timestamp  = xrt_core::time_ns() / 1.0e6;
+        db->getDynamicInfo().addAIESample(id, sample);
       }
     }
     catch (...) {
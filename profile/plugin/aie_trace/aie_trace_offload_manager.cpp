@@ -1,15 +1,28 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved
 #define XDP_PLUGIN_SOURCE
 #include "xdp/profile/plugin/aie_trace/aie_trace_offload_manager.h"
+#include "core/common/config_reader.h"
 
 namespace xdp {
   using severity_level = xrt_core::message::severity_level;
 
+  // Write trace to the files as it is offloaded instead of keeping all of
+  //  it in the database until the writers run
+  void AIETraceOffloadManager::attachStreamSink(AIETraceOffloadData& data,
+                                                AIETraceDataLogger* logger) {
+    if (data.writers.empty() ||
+        !xrt_core::config::detail::get_bool_value("Debug.aie_trace_streaming_flush", false))
+      return;
+    data.sink = std::make_unique<AIETraceStreamSink>(data.writers);
+    logger->setSink(data.sink.get());
+  }
+
   void AIETraceOffloadManager::startPLIOOffload(bool continuousTrace, uint64_t offloadIntervalUs) {
     if (plio.offloader && continuousTrace) {
       plio.offloader->setContinuousTrace();
       plio.offloader->setOffloadIntervalUs(offloadIntervalUs);
+      plio.offloader->enableAdaptiveInterval();
     }
     if (plio.offloader)
       plio.offloader->startOffload();
@@ -19,6 +32,7 @@ namespace xdp {
     if (gmio.offloader && continuousTrace) {
       gmio.offloader->setContinuousTrace(); // GMIO trace offload does not support continuous trace
       gmio.offloader->setOffloadIntervalUs(offloadIntervalUs);
+      gmio.offloader->enableAdaptiveInterval();
     }
     if (gmio.offloader)
       gmio.offloader->startOffload();
@@ -58,6 +72,7 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
       return;
 
     plio.logger = std::make_unique<AIETraceDataLogger>(deviceID, io_type::PLIO);
+    attachStreamSink(plio, static_cast<AIETraceDataLogger*>(plio.logger.get()));
 #ifndef XDP_CLIENT_BUILD
     plio.offloader = std::make_unique<AIETraceOffload>(handle, deviceID, deviceIntf, plio.logger.get(), true, bufSize, numStreams, devInst);
 #else
@@ -87,6 +102,7 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
       return;
 
     gmio.logger = std::make_unique<AIETraceDataLogger>(deviceID, io_type::GMIO);
+    attachStreamSink(gmio, static_cast<AIETraceDataLogger*>(gmio.logger.get()));
     // Use the client-specific AIETraceOffload constructor
     gmio.offloader = std::make_unique<AIETraceOffload>(
         handle, deviceID, deviceIntf, gmio.logger.get(), false, // isPLIO = false
@@ -107,6 +123,7 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
     }
 
     gmio.logger = std::make_unique<AIETraceDataLogger>(deviceID, io_type::GMIO);
+    attachStreamSink(gmio, static_cast<AIETraceDataLogger*>(gmio.logger.get()));
     gmio.offloader = std::make_unique<AIETraceOffload>(handle, deviceID, deviceIntf, gmio.logger.get(), false, bufSize, numStreams, devInst);
     gmio.valid = true;
     std::stringstream msg;
@@ -147,6 +164,11 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
     if (offloadEnabledGMIO && gmio.offloader)
       flushOffloader(gmio.offloader, warn);
 
+    // Everything offloaded has to be in the files before they are closed
+    if (plio.sink)
+      plio.sink->flush();
+    if (gmio.sink)
+      gmio.sink->flush();
   }
 
   void AIETraceOffloadManager::flushOffloader(const std::unique_ptr<AIETraceOffload>& offloader, bool warn) {
@@ -163,11 +185,25 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
   }
 
   void AIETraceOffloadManager::createTraceWriters(uint64_t numStreamsPLIO, uint64_t numStreamsGMIO, std::vector<VPWriter*>& writers) {
+    // Raw binary trace is much smaller and faster to write than one hex
+    //  string per word, but only tools that understand it can read it
+    bool binary =
+      xrt_core::config::detail::get_bool_value("Debug.aie_trace_binary_output", false);
+    std::string extension = binary ? ".bin" : ".txt";
+    std::string fileType = binary ? "AIE_EVENT_TRACE_BINARY" : "AIE_EVENT_TRACE";
+    // Decoding as the trace is written gives per tile event streams
+    //  without running the offline parser
+    bool decode =
+      xrt_core::config::detail::get_bool_value("Debug.aie_trace_decode", false);
+    // Size in KB of the file buffer of each writer, 0 for the default
+    uint64_t bufferSize =
+      xrt_core::config::detail::get_uint_value("Debug.aie_trace_file_buffer_kb", 0) * 1024;
+
     if (offloadEnabledPLIO) {
       // Add writer for every PLIO stream
       for (uint64_t n = 0; n < numStreamsPLIO; ++n) {
         std::string fileName = "aie_trace_plio_" + std::to_string(deviceID) + "_" +
-                              std::to_string(n) + ".txt";
+                              std::to_string(n) + extension;
         VPWriter *writer = new AIETraceWriter(
           fileName.c_str(),
           deviceID,
@@ -176,10 +212,15 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
           "", // creation time
           "", // xrt version
           "",  // tool version
-          io_type::PLIO // offload type
+          io_type::PLIO, // offload type
+          binary,
+          bufferSize
         );
+        if (decode)
+          static_cast<AIETraceWriter*>(writer)->enableDecoding();
         writers.push_back(writer);
-        db->addOpenedFile(writer->getcurrentFileName(), "AIE_EVENT_TRACE", deviceID);
+        plio.writers.push_back(static_cast<AIETraceWriter*>(writer));
+        db->addOpenedFile(writer->getcurrentFileName(), fileType, deviceID);
 
         std::stringstream msg;
         msg << "Creating AIE trace file " << fileName << " for device " << deviceID;
@@ -191,7 +232,7 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
       // Add writer for every GMIO stream
       for (uint64_t n = 0; n < numStreamsGMIO; ++n) {
         std::string fileName = "aie_trace_gmio_" + std::to_string(deviceID) + "_" +
-                              std::to_string(n) + ".txt";
+                              std::to_string(n) + extension;
         VPWriter *writer = new AIETraceWriter(
           fileName.c_str(),
           deviceID,
@@ -200,10 +241,15 @@ uint64_t AIETraceOffloadManager::checkAndCapToBankSize(uint8_t memIndex, uint64_
           "", // creation time
           "", // xrt version
           "",  // tool version
-          io_type::GMIO // offload type
+          io_type::GMIO, // offload type
+          binary,
+          bufferSize
         );
+        if (decode)
+          static_cast<AIETraceWriter*>(writer)->enableDecoding();
         writers.push_back(writer);
-        db->addOpenedFile(writer->getcurrentFileName(), "AIE_EVENT_TRACE", deviceID);
+        gmio.writers.push_back(static_cast<AIETraceWriter*>(writer));
+        db->addOpenedFile(writer->getcurrentFileName(), fileType, deviceID);
 
         std::stringstream msg;
         msg << "Creating AIE trace file " << fileName << " for device " << deviceID;
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2025-2026 Advanced Micro Devices, Inc. All rights reserved
 #ifndef AIE_TRACE_OFFLOAD_MANAGER_H
 #define AIE_TRACE_OFFLOAD_MANAGER_H
 #include <iostream>
@@ -10,6 +10,7 @@
 #include <memory>
 #include "core/common/message.h"
 #include "xdp/profile/database/events/creator/aie_trace_data_logger.h"
+#include "xdp/profile/writer/aie_trace/aie_trace_stream_sink.h"
 #include "xdp/profile/writer/aie_trace/aie_trace_writer.h"
 #include "xdp/profile/plugin/aie_trace/aie_trace_impl.h"
 #include "xdp/profile/device/pl_device_intf.h"
@@ -39,6 +40,10 @@ namespace xdp {
 
   struct AIETraceOffloadData {
     bool valid = false;
+    // One per stream, owned by the plugin
+    std::vector<AIETraceWriter*> writers;
+    // Declared before the logger and offloader so it outlives them
+    std::unique_ptr<AIETraceStreamSink> sink;
     std::unique_ptr<AIETraceLogger> logger;
     std::unique_ptr<AIETraceOffload> offloader;
   };
@@ -47,6 +52,7 @@ class AIETraceOffloadManager {
   private:
     void startPLIOOffload(bool continuousTrace, uint64_t offloadIntervalUs);
     void startGMIOOffload(bool continuousTrace, uint64_t offloadIntervalUs);
+    void attachStreamSink(AIETraceOffloadData& data, AIETraceDataLogger* logger);
     uint64_t checkAndCapToBankSize(uint8_t memIndex, uint64_t desired);
 
     uint64_t deviceID;
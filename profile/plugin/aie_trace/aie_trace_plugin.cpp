@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright (C) 2022-2025 Advanced Micro Devices, Inc. All rights reserved
+// Copyright (C) 2022-2026 Advanced Micro Devices, Inc. All rights reserved
 
 #define XDP_PLUGIN_SOURCE
 
@@ -7,9 +7,11 @@
 
 #include "core/common/api/device_int.h"
 #include "core/common/api/hw_context_int.h"
+#include "core/common/config_reader.h"
 #include "core/common/message.h"
 
 #include "xdp/profile/database/database.h"
+#include "xdp/profile/database/dynamic_info/aie_trace_buffer_pool.h"
 #include "xdp/profile/database/events/creator/aie_trace_data_logger.h"
 #include "xdp/profile/database/static_info/pl_constructs.h"
 #include "xdp/profile/device/pl_device_intf.h"
@@ -52,6 +54,12 @@ AieTracePluginUnified::AieTracePluginUnified() : XDPPlugin() {
   db->registerPlugin(this);
   db->registerInfo(info::aie_trace);
   db->getStaticInfo().setAieApplication();
+
+  // Every AIE trace stream has a writer with its own file, so they can
+  //  all be written at once instead of one after the other
+  auto writerThreads =
+    xrt_core::config::detail::get_uint_value("Debug.aie_trace_writer_threads", 0);
+  setWriterThreads(static_cast<unsigned int>(writerThreads));
 }
 
 AieTracePluginUnified::~AieTracePluginUnified() {
@@ -70,6 +78,9 @@ AieTracePluginUnified::~AieTracePluginUnified() {
     db->unregisterPlugin(this);
   }
 
+  // All trace has been written, so cached copies will not be reused
+  AIETraceBufferPool::trim();
+
   // If the database is dead, then we must have already forced a
   // write at the database destructor so we can just move on
   AieTracePluginUnified::live = false;
@@ -452,6 +463,7 @@ void AieTracePluginUnified::finishFlushAIEDevice(void *handle) {
     AIEData.offloadManager->flushAll(true);
 
   XDPPlugin::endWrite();
+  AIETraceBufferPool::trim();
 
   handleToAIEData.erase(itr);
 }
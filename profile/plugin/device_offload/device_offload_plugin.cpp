@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2022 Xilinx, Inc
- * Copyright (C) 2022-2025 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -136,6 +136,11 @@ namespace xdp {
         xrt_core::config::get_trace_buffer_offload_interval_ms();
 
       m_enable_circular_buffer = continuous_trace;
+
+      // Decode continuously offloaded trace in place instead of copying
+      //  it out of the trace buffer
+      m_zero_copy_offload = continuous_trace &&
+        xrt_core::config::detail::get_bool_value("Debug.device_trace_zero_copy", false);
     }
     else {
       if (xrt_core::config::get_continuous_trace()) {
@@ -267,6 +272,11 @@ namespace xdp {
       new PLDeviceTraceOffload(devInterface, logger,
                                trace_buffer_offload_interval_ms, // offload_sleep_ms
                                trace_buffer_size);           // trace buffer size
+    offloader->set_zero_copy(m_zero_copy_offload);
+    // Shorten the offload interval under bursts of trace and stretch it
+    //  when the device is idle
+    if (continuous_trace)
+      offloader->enable_adaptive_interval();
 
     // If trace is enabled, set up trace.  Otherwise just keep the offloader
     //  for reading the counters.
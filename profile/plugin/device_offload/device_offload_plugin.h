@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -50,6 +50,7 @@ namespace xdp {
     bool continuous_trace ;
     unsigned int trace_buffer_offload_interval_ms ;
     bool m_enable_circular_buffer = false;
+    bool m_zero_copy_offload = false;
 
   protected:
     // Each device offload plugin is responsible for offloading
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2023-2025 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2023-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,6 +17,7 @@
 
 #define XDP_CORE_SOURCE
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 
@@ -25,6 +26,7 @@
 #include "xdp/profile/writer/vp_base/vp_run_summary.h"
 #include "xdp/profile/database/database.h"
 #include "xdp/profile/device/tracedefs.h"
+#include "xdp/profile/device/trace_worker_pool.h"
 #include "core/common/config_reader.h"
 #include "core/common/message.h"
 #include "core/common/time.h"
@@ -139,8 +141,7 @@ namespace xdp {
 
     // Do a final write
     mtx_writer_list.lock();
-    for (auto w : writers)
-      w->write(false);
+    writeWriters(false, type);
     mtx_writer_list.unlock();
   }
 
@@ -174,15 +175,47 @@ namespace xdp {
 
     // If a writer is already writing, then don't do anything
     if (mtx_writer_list.try_lock()) {
-      for (auto w : writers) {
-        bool success = w->write(openNewFiles);
-        if (openNewFiles && success)
-          db->addOpenedFile(w->getcurrentFileName().c_str(), type);
-      }
+      writeWriters(openNewFiles, type);
       mtx_writer_list.unlock();
     }
   }
 
+  void XDPPlugin::setWriterThreads(unsigned int numThreads)
+  {
+    constexpr unsigned int maxWriterThreads = 8;
+    if (numThreads == 0)
+      numThreads = std::min(std::max(1u, std::thread::hardware_concurrency()),
+                            maxWriterThreads);
+    writer_threads = numThreads;
+  }
+
+  void XDPPlugin::writeWriters(bool openNewFiles, const std::string& type)
+  {
+    std::vector<char> succeeded(writers.size(), 0);
+    auto writeOne = [&](std::size_t i) {
+      succeeded[i] = writers[i]->write(openNewFiles);
+    };
+
+    auto numThreads = std::min<std::size_t>(writer_threads, writers.size());
+    if (numThreads > 1) {
+      // The pool only lives for this write so no threads are left
+      //  running when plugins are destroyed at exit
+      TraceWorkerPool pool(static_cast<unsigned int>(numThreads));
+      pool.run(writers.size(), writeOne);
+    }
+    else {
+      for (std::size_t i = 0; i < writers.size(); ++i)
+        writeOne(i);
+    }
+
+    if (!openNewFiles)
+      return;
+    for (std::size_t i = 0; i < writers.size(); ++i) {
+      if (succeeded[i])
+        db->addOpenedFile(writers[i]->getcurrentFileName().c_str(), type);
+    }
+  }
+
   void XDPPlugin::runConstructorHook(void* run_impl_ptr, void* hwctx,
                                      uint32_t run_uid,
                                      const std::string& kernel_name,
@@ -59,6 +59,12 @@ namespace xdp {
     // Mutex to access writer list
     std::mutex mtx_writer_list;
 
+    // Number of threads that call write on the writers at the same time.
+    //  Only plugins whose writers are independent of each other raise it.
+    unsigned int writer_threads = 1;
+    // Must be called with mtx_writer_list held
+    void writeWriters(bool openNewFiles, const std::string& type);
+
   protected:
     // A link to the single instance of the database that all plugins
     //  refer to.
@@ -74,6 +80,9 @@ namespace xdp {
     XDP_CORE_EXPORT void startWriteThread(unsigned int interval, std::string type, bool openNewFiles = true);
     XDP_CORE_EXPORT void endWrite();
     XDP_CORE_EXPORT void trySafeWrite(const std::string& type, bool openNewFiles);
+    // Write up to numThreads writers in parallel.  Zero picks a count
+    //  based on the number of processors.
+    XDP_CORE_EXPORT void setWriterThreads(unsigned int numThreads);
 
     // Run-lifecycle hook implementations. Plugins that want to react to
     // xrt::run construction / start / wait override one or more of these.
@@ -0,0 +1,280 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Measures the tile queries the AIE profile and trace plugins make while
+//  configuring, once per graph, port, kernel, and metric set, against an
+//  aie_control_config.json.  Uses the given file if there is one,
+//  otherwise a generated design that fills a large array.  A checksum of
+//  every result is printed so runs of different versions of the metadata
+//  reader can be compared.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include "xdp/profile/database/static_info/filetypes/aie_control_config_filetype.h"
+
+namespace {
+
+  constexpr int ITERATIONS = 5;
+
+  constexpr unsigned int NUM_COLUMNS = 38;
+  constexpr unsigned int NUM_AIE_ROWS = 8;
+  constexpr unsigned int NUM_GRAPHS = 64;
+  constexpr unsigned int KERNELS_PER_GRAPH = 4;
+
+  const std::vector<std::string> METRIC_SETS = {
+    "input_throughputs", "output_throughputs", "s2mm_throughputs",
+    "mm2s_throughputs", "input_stalls", "output_stalls", "packets",
+    "read_bandwidth", "write_bandwidth", "ddr_bandwidth",
+    "interface_tile_latency"
+  };
+
+  template <typename T>
+  std::string list(const std::vector<T>& values)
+  {
+    std::ostringstream out;
+    out << "[";
+    for (size_t i = 0; i < values.size(); ++i)
+      out << (i ? "," : "") << "\"" << values[i] << "\"";
+    out << "]";
+    return out.str();
+  }
+
+  // A design of NUM_GRAPHS graphs spread over the whole array, each with
+  //  its own kernels, shared buffers, PLIOs, and GMIOs
+  std::string generateMetadata()
+  {
+    std::ostringstream graphs, eventGraphs, kernels, buffers, plios, gmios;
+    unsigned int tileNum = 0;
+    unsigned int ioNum = 0;
+
+    for (unsigned int g = 0; g < NUM_GRAPHS; ++g) {
+      std::string graph = "graph" + std::to_string(g);
+      std::vector<unsigned int> cols, rows, zeros, addrs;
+      std::vector<std::string> triggers;
+      for (unsigned int t = 0; t < 16; ++t, ++tileNum) {
+        cols.push_back((tileNum / NUM_AIE_ROWS) % NUM_COLUMNS);
+        rows.push_back(tileNum % NUM_AIE_ROWS);
+        zeros.push_back(0);
+        addrs.push_back(0x4000 + t);
+        triggers.push_back((t % 2) ? "true" : "false");
+      }
+
+      graphs << (g ? "," : "") << "{\"name\":\"" << graph << "\""
+             << ",\"core_columns\":" << list(cols)
+             << ",\"core_rows\":" << list(rows)
+             << ",\"iteration_memory_columns\":" << list(cols)
+             << ",\"iteration_memory_rows\":" << list(zeros)
+             << ",\"iteration_memory_addresses\":" << list(addrs)
+             << ",\"multirate_triggers\":" << list(triggers) << "}";
+
+      // DMAs are used in the graph's tiles and one row above them
+      std::vector<unsigned int> dmaRows;
+      for (auto row : rows)
+        dmaRows.push_back((row + 1) % NUM_AIE_ROWS);
+      eventGraphs << (g ? "," : "") << "{\"name\":\"" << graph << "\""
+                  << ",\"core_columns\":" << list(cols)
+                  << ",\"core_rows\":" << list(rows)
+                  << ",\"dma_columns\":" << list(cols)
+                  << ",\"dma_rows\":" << list(dmaRows) << "}";
+
+      for (unsigned int t = 0; t < cols.size(); ++t) {
+        kernels << ((g || t) ? "," : "") << "{\"graph\":\"" << graph << "\""
+                << ",\"function\":\"" << graph << ".k" << (t % KERNELS_PER_GRAPH) << "\""
+                << ",\"column\":\"" << cols[t] << "\",\"row\":\"" << rows[t] << "\"}";
+      }
+
+      for (unsigned int b = 0; b < 8; ++b) {
+        buffers << ((g || b) ? "," : "") << "{\"graph\":\"" << graph << "\""
+                << ",\"bufferName\":\"" << graph << ".buf" << b << "\""
+                << ",\"column\":\"" << ((g + b) % NUM_COLUMNS) << "\",\"row\":\"" << (b % 2) << "\""
+                << ",\"dmaChannels\":[{\"channel\":\"0\",\"direction\":\"s2mm\",\"name\":\"in" << b << "\"}"
+                << ",{\"channel\":\"1\",\"direction\":\"mm2s\",\"name\":\"out" << b << "\"}]}";
+      }
+
+      for (unsigned int p = 0; p < 16; ++p, ++ioNum) {
+        plios << (ioNum ? "," : "") << "{\"id\":\"" << ioNum << "\""
+              << ",\"name\":\"" << graph << ".plio" << p << "\""
+              << ",\"logical_name\":\"plio_" << ioNum << "\""
+              << ",\"shim_column\":\"" << (ioNum % NUM_COLUMNS) << "\""
+              << ",\"stream_id\":\"" << (ioNum / NUM_COLUMNS) % 8 << "\""
+              << ",\"slaveOrMaster\":\"" << (p % 2 ? "true" : "false") << "\"}";
+      }
+
+      for (unsigned int m = 0; m < 4; ++m) {
+        gmios << ((g || m) ? "," : "") << "{\"id\":\"" << (ioNum + m) << "\""
+              << ",\"name\":\"" << graph << ".gmio" << m << "\""
+              << ",\"logical_name\":\"gmio_" << g << "_" << m << "\""
+              << ",\"type\":\"" << (m % 2) << "\""
+              << ",\"shim_column\":\"" << ((g + m) % NUM_COLUMNS) << "\""
+              << ",\"channel_number\":\"" << (m % 2 ? m / 2 : 2 + m / 2) << "\""
+              << ",\"stream_id\":\"" << m << "\",\"burst_length_in_16byte\":\"4\"}";
+      }
+    }
+
+    std::ostringstream json;
+    json << "{\"aie_metadata\":{"
+         << "\"driver_config\":{\"hw_gen\":\"2\",\"aie_tile_row_start\":\"3\",\"num_rows\":\"11\"},"
+         << "\"graphs\":[" << graphs.str() << "],"
+         << "\"EventGraphs\":[" << eventGraphs.str() << "],"
+         << "\"TileMapping\":{\"AIEKernelToTileMapping\":[" << kernels.str() << "],"
+         << "\"SharedBufferToTileMapping\":[" << buffers.str() << "]},"
+         << "\"PLIOs\":[" << plios.str() << "],"
+         << "\"GMIOs\":[" << gmios.str() << "]}}";
+    return json.str();
+  }
+
+  void hashValue(uint64_t& hash, uint64_t value)
+  {
+    // FNV-1a
+    hash = (hash ^ value) * 0x100000001b3ULL;
+  }
+
+  void hashTiles(uint64_t& hash, const std::vector<xdp::tile_type>& tiles)
+  {
+    hashValue(hash, tiles.size());
+    for (auto& tile : tiles) {
+      hashValue(hash, (tile.col << 8) | tile.row);
+      hashValue(hash, tile.itr_mem_addr);
+      hashValue(hash, (tile.active_core << 2) | (tile.active_memory << 1) | tile.is_trigger);
+      hashValue(hash, tile.subtype);
+      for (auto id : tile.stream_ids)
+        hashValue(hash, id);
+      for (auto master : tile.is_master_vec)
+        hashValue(hash, master);
+      for (auto* names : {&tile.port_names, &tile.s2mm_names, &tile.mm2s_names})
+        for (auto& name : *names)
+          hashValue(hash, std::hash<std::string>()(name));
+    }
+  }
+
+  // One pass over everything the plugins ask for while configuring.
+  //  Returns the number of queries.
+  uint64_t configure(const xdp::aie::AIEControlConfigFiletype& metadata,
+                     const std::vector<std::string>& graphs,
+                     const std::vector<std::string>& ports,
+                     const std::vector<std::string>& kernels,
+                     uint64_t& hash)
+  {
+    uint64_t queries = 0;
+
+    for (auto& graph : graphs) {
+      hashTiles(hash, metadata.getAIETiles(graph));
+      hashTiles(hash, metadata.getEventTiles(graph, xdp::module_type::core));
+      hashTiles(hash, metadata.getAllAIETiles(graph));
+      hashTiles(hash, metadata.getMemoryTiles(graph, "all"));
+      queries += 4;
+
+      for (auto& kernel : kernels) {
+        hashTiles(hash, metadata.getTiles(graph, xdp::module_type::core, kernel));
+        ++queries;
+      }
+      for (auto& metric : METRIC_SETS) {
+        hashTiles(hash, metadata.getInterfaceTiles(graph, "all", metric));
+        ++queries;
+      }
+    }
+
+    for (auto& port : ports) {
+      for (auto& metric : METRIC_SETS) {
+        hashTiles(hash, metadata.getInterfaceTiles("all", port, metric));
+        ++queries;
+      }
+    }
+
+    for (auto& metric : METRIC_SETS) {
+      for (uint8_t col = 0; col < NUM_COLUMNS; col += 4) {
+        hashTiles(hash, metadata.getInterfaceTiles("all", "all", metric, -1, true,
+                                                   col, col + 3));
+        ++queries;
+      }
+    }
+
+    hashValue(hash, metadata.getPLIOs().size());
+    hashValue(hash, metadata.getGMIOs().size());
+    return queries + 2;
+  }
+
+  double seconds(std::chrono::steady_clock::time_point start)
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+} // end anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  boost::property_tree::ptree aieMeta;
+  auto start = std::chrono::steady_clock::now();
+  try {
+    if (argc > 1) {
+      boost::property_tree::read_json(argv[1], aieMeta);
+    }
+    else {
+      std::stringstream json(generateMetadata());
+      boost::property_tree::read_json(json, aieMeta);
+    }
+  }
+  catch (const std::exception& e) {
+    std::cerr << "Cannot read AIE metadata: " << e.what() << std::endl;
+    return 1;
+  }
+  double parseTime = seconds(start);
+
+  xdp::aie::AIEControlConfigFiletype metadata(aieMeta);
+
+  // Ask for every graph, port, and kernel in the design plus "all"
+  std::vector<std::string> graphs = metadata.getValidGraphs();
+  graphs.push_back("all");
+  std::vector<std::string> ports = metadata.getValidPorts();
+  auto validKernels = metadata.getValidKernels();
+  std::set<std::string> uniqueKernels(validKernels.begin(), validKernels.end());
+  std::vector<std::string> kernels(uniqueKernels.begin(), uniqueKernels.end());
+
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  // The first pass includes whatever is done once per file
+  start = std::chrono::steady_clock::now();
+  uint64_t queries = configure(metadata, graphs, ports, kernels, hash);
+  double firstTime = seconds(start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < ITERATIONS; ++i) {
+    uint64_t passHash = 0xcbf29ce484222325ULL;
+    configure(metadata, graphs, ports, kernels, passHash);
+  }
+  double repeatTime = seconds(start) / ITERATIONS;
+
+  std::cout << "Graphs:          " << graphs.size() - 1 << "\n"
+            << "Ports:           " << ports.size() << "\n"
+            << "Kernels:         " << kernels.size() << "\n"
+            << "Queries/pass:    " << queries << "\n"
+            << "JSON parse:      " << parseTime * 1e3 << " ms\n"
+            << "First pass:      " << firstTime * 1e3 << " ms\n"
+            << "Later passes:    " << repeatTime * 1e3 << " ms\n"
+            << "Per query:       " << (repeatTime / queries) * 1e6 << " us\n"
+            << "Result checksum: " << std::hex << hash << std::dec << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+// Measures the PL trace pre-pass (classification and host timestamp
+//  conversion) with and without SIMD and checks that both give the
+//  same results.  Runs on a raw trace file if one is given, otherwise on
+//  a generated trace with a mix of AM, AIM, ASM, and clock training
+//  packets.
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "xdp/profile/device/pl_trace_classifier.h"
+
+namespace {
+
+  constexpr uint64_t BLOCK_PACKETS = 65536;
+  constexpr int ITERATIONS = 20;
+
+  std::vector<uint64_t> generateTrace(uint64_t numPackets)
+  {
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> trace(numPackets);
+    uint64_t timestamp = 1000;
+    for (auto& packet : trace) {
+      timestamp += rng() % 16;
+      auto choice = rng() % 100;
+      uint64_t traceId = 0;
+      if (choice < 2) {
+        packet = (1ULL << 63) | ((rng() & 0xFFFF) << 45) | timestamp;
+        continue;
+      }
+      else if (choice < 40)
+        traceId = 64 + (rng() % 481);  // AM
+      else if (choice < 90)
+        traceId = rng() % 62;          // AIM
+      else
+        traceId = 576 + (rng() % 31);  // ASM
+      packet = (traceId << 49) | ((rng() & 0xF) << 45) | timestamp;
+    }
+    return trace;
+  }
+
+  std::vector<uint64_t> readTrace(const std::string& fileName)
+  {
+    std::vector<uint64_t> trace;
+    std::ifstream fin(fileName, std::ios::binary|std::ios::in);
+    uint64_t packet = 0;
+    while (fin.read(reinterpret_cast<char*>(&packet), 8))
+      trace.push_back(packet);
+    return trace;
+  }
+
+  // Classify and convert the whole trace block by block, keeping
+  //  everything so the two runs can be compared.
+  double run(xdp::PLTraceClassifier& classifier,
+             const std::vector<uint64_t>& trace,
+             std::vector<double>& host,
+             std::vector<uint32_t>& indices)
+  {
+    host.assign(trace.size(), 0.0);
+    indices.clear();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t begin = 0; begin < trace.size(); begin += BLOCK_PACKETS) {
+      auto count = std::min(BLOCK_PACKETS, trace.size() - begin);
+      classifier.classify(trace.data() + begin, count, trace[0] & 0x1FFFFFFFFFFF);
+      classifier.convertToHostTimestamps(classifier.getDeviceTimestamps(),
+                                         host.data() + begin, count,
+                                         1.0 / 300.0, 1.0e9);
+      for (int type = 0; type < xdp::PLTraceClassifier::NUM_CLASSES; ++type) {
+        auto klass = static_cast<xdp::PLTraceClassifier::PacketClass>(type);
+        auto list = classifier.getIndices(klass);
+        indices.insert(indices.end(), list, list + classifier.getCount(klass));
+      }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+  }
+
+} // end anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  std::vector<uint64_t> trace;
+  if (argc > 1) {
+    trace = readTrace(argv[1]);
+    if (trace.empty()) {
+      std::cerr << "Cannot read raw trace file " << argv[1] << std::endl;
+      return 1;
+    }
+  }
+  else
+    trace = generateTrace(16 * 1024 * 1024);
+
+  xdp::PLTraceClassifier scalar(false);
+  xdp::PLTraceClassifier simd(true);
+
+  std::vector<double> scalarHost, simdHost;
+  std::vector<uint32_t> scalarIndices, simdIndices;
+
+  double scalarTime = 0.0;
+  double simdTime = 0.0;
+  for (int i = 0; i < ITERATIONS; ++i) {
+    scalarTime += run(scalar, trace, scalarHost, scalarIndices);
+    simdTime += run(simd, trace, simdHost, simdIndices);
+  }
+
+  bool same = scalarIndices == simdIndices &&
+    std::memcmp(scalarHost.data(), simdHost.data(),
+                scalarHost.size() * sizeof(double)) == 0;
+
+  auto rate = [&](double seconds) {
+    return (static_cast<double>(trace.size()) * ITERATIONS) / seconds / 1e6;
+  };
+
+  std::cout << "Packets:        " << trace.size() << "\n"
+            << "SIMD available: " << (simd.usingSIMD() ? "yes" : "no") << "\n"
+            << "Scalar:         " << rate(scalarTime) << " M packets/s\n"
+            << "SIMD:           " << rate(simdTime) << " M packets/s\n"
+            << "Speedup:        " << (scalarTime / simdTime) << "x\n"
+            << "Results match:  " << (same ? "yes" : "no") << std::endl;
+
+  return same ? 0 : 1;
+}
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -68,41 +68,43 @@ namespace xdp {
     }
 
     // Getting all samples from database
-    std::vector<xdp::aie::AIEDebugDataType> samples =
-      db->getDynamicInfo().moveAIEDebugSamples(mDeviceIndex);
+    std::vector<xdp::aie::AIEDebugBlock> blocks =
+      db->getDynamicInfo().moveAIEDebugBlocks(mDeviceIndex);
     
     // Create register interpreter for current AIE generation
     auto aieGeneration = (db->getStaticInfo()).getAIEGeneration(mDeviceIndex);
-    std::unique_ptr<RegisterInterpreter> regInterp = 
-      std::make_unique<RegisterInterpreter>(mDeviceIndex, aieGeneration);
+    RegisterInterpreter regInterp(mDeviceIndex, aieGeneration);
     
+    std::size_t numSamples = 0;
+    for (auto& block : blocks)
+      numSamples += block.values.size();
     xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT", 
-      "Writing " + std::to_string(samples.size()) + " samples to AIE Debug file.");
+      "Writing " + std::to_string(numSamples) + " samples to AIE Debug file.");
 
-    for (auto& sample : samples) {
-      // Print out full 32-bit values (for debug purposes)
-      fout << +sample.col << ","
-           << +sample.row << ","
-           << sample.name << ","
-           << "31:0" << ","
-           << "full" << ","
-           << "0x" << std::hex << sample.value
-           << std::dec << "\n";
-      
-      // Parse all fields from register value
-      auto regInfoVec = regInterp->registerInfo(sample.name, sample.offset, sample.value);
+    for (auto& block : blocks) {
+      for (std::size_t i = 0; i < block.values.size(); ++i) {
+        auto id = block.registerIds[i];
+        auto value = block.values[i];
+        const char* name = regInterp.registerName(id);
+
+        // Print out full 32-bit values (for debug purposes)
+        fout << +block.col << ","
+             << +block.row << ","
+             << name << ","
+             << "31:0" << ","
+             << "full" << ","
+             << "0x" << std::hex << value
+             << std::dec << "\n";
       
-      // Report all fields
-      for (auto& rInfo : regInfoVec) {
-        if (rInfo.field_name == "")
-          continue;
-        
-        fout << +sample.col << ","
-             << +sample.row << ","
-             << sample.name << ","
-             << rInfo.bit_range << ","
-             << rInfo.field_name << ","
-             << rInfo.subval << "\n";
+        // Report all fields parsed from register value
+        for (auto& field : regInterp.registerFields(id)) {
+          fout << +block.col << ","
+               << +block.row << ","
+               << name << ","
+               << field.bit_range << ","
+               << field.field_name << ","
+               << field.extract(value) << "\n";
+        }
       }
     }
 
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,89 +17,51 @@
 #ifndef AIE_DEBUG_WRITER_METADATA_H
 #define AIE_DEBUG_WRITER_METADATA_H
 
-#include <map>
-#include <vector>
-#include <string>
+#include <cstddef>
 #include <cstdint>
 
+#include "xdp/profile/plugin/aie_debug/aie_debug_registers.h"
+
 namespace xdp {
 
 /*************************************************************************************
-The class WriterUsedRegisters is what gives us AIE hw generation specific data. The base class
-has virtual functions which populate the correct registers according to the AIE hw generation 
-in the derived classes. Thus we can dynamically populate the correct registers at runtime.
+The register field tables give us AIE hw generation specific data. Every generation
+has one table with an entry for each field of each register the debug writer knows
+about. Tables are built at compile time and sorted by register name (fields of a
+register keep their order), so decoding a register is a binary search followed by a
+shift and mask per field without building or allocating anything.
 **************************************************************************************/
-class WriterUsedRegisters {
-  public:
-    struct RegData {
-      std::string field_name;
-      std::string bit_range;
-      int shift;
-      uint32_t mask;
-
-      RegData(std::string n, std::string b, int s, uint32_t m)
-        : field_name(n), bit_range(b), shift(s), mask(m) {}
-    };
-
-  protected:
-    std::map<std::string, std::vector<RegData>> regDataMap;
-
-  public:
-    WriterUsedRegisters() { }
-
-    virtual ~WriterUsedRegisters() {
-      regDataMap.clear();
-    }
-
-    std::map<std::string, std::vector<RegData>>& getRegDataMap() {
-      return regDataMap;
-    }    
-
-    virtual void populateRegDataMap() {};
-
-};
-
-/*************************************************************************************
- AIE1 Registers
- *************************************************************************************/
-class AIE1WriterUsedRegisters : public WriterUsedRegisters {
-public:
-  AIE1WriterUsedRegisters() {
-    populateRegDataMap();
+struct RegisterField {
+  const char* register_name;
+  const char* field_name;
+  const char* bit_range;
+  int shift;
+  uint32_t mask;
+
+  constexpr uint32_t extract(uint32_t regVal) const {
+    return (regVal >> shift) & mask;
   }
-  ~AIE1WriterUsedRegisters() = default;
-
-  void populateRegDataMap();
+};
 
+struct RegisterFieldTable {
+  const RegisterField* fields;
+  std::size_t size;
 };
 
-/*************************************************************************************
- AIE2 Registers
- *************************************************************************************/
-class AIE2WriterUsedRegisters : public WriterUsedRegisters {
-public:
-  AIE2WriterUsedRegisters() {
-    populateRegDataMap();
+constexpr bool isSortedByRegister(const RegisterField* fields, std::size_t size) {
+  for (std::size_t i = 1; i < size; ++i) {
+    if (compareRegisterNames(fields[i - 1].register_name, fields[i].register_name) > 0)
+      return false;
   }
-  ~AIE2WriterUsedRegisters() = default;
-
-  void populateRegDataMap();
-
-};
+  return true;
+}
 
 /*************************************************************************************
- AIE2PS Registers
+ AIE1, AIE2, and AIE2PS Registers
  *************************************************************************************/
-class AIE2PSWriterUsedRegisters : public WriterUsedRegisters {
-public:
-  AIE2PSWriterUsedRegisters() {
-    populateRegDataMap();
-  }
-  ~AIE2PSWriterUsedRegisters() = default;
-
-  void populateRegDataMap();
-
-};
+RegisterFieldTable getAIE1RegisterFields();
+RegisterFieldTable getAIE2RegisterFields();
+RegisterFieldTable getAIE2PSRegisterFields();
 
 } // end namesapce xdp
 
@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -15,46 +15,64 @@
  */
 #include "xdp/profile/writer/aie_debug/register_interpreter.h"
 #include "xdp/profile/writer/aie_debug/aie_debug_writer_metadata.h"
-#include <fstream>
-#include <iostream>
-#include <sstream>
-#include <vector>
+#include <algorithm>
 
 namespace xdp {
     RegisterInterpreter::RegisterInterpreter() { }
     RegisterInterpreter::RegisterInterpreter(uint64_t deviceIndex, int aieGeneration)
-      : mDeviceIndex(deviceIndex), mAieGeneration(aieGeneration) { }
-
-    std::vector<RegisterInterpreter::RegInfo>
-    RegisterInterpreter::registerInfo(const std::string& regName, const uint64_t& /*regAddr*/, const uint32_t& regVal) 
+      : mAieGeneration(aieGeneration), mDeviceIndex(deviceIndex)
     {
-        if (mAieGeneration == 1)
-          writerUsedRegisters = std::make_unique<AIE1WriterUsedRegisters>();
-        else if (mAieGeneration == 5)
-          writerUsedRegisters = std::make_unique<AIE2PSWriterUsedRegisters>();
-        else if ((mAieGeneration > 1) && (mAieGeneration <= 9))
-          writerUsedRegisters = std::make_unique<AIE2WriterUsedRegisters>();
-
-        std::map<std::string, std::vector<WriterUsedRegisters::RegData>>& writerUsedRegistersMap = 
-          writerUsedRegisters->getRegDataMap();
-
-        std::vector<RegInfo> regInfoVec;
-        auto it = writerUsedRegistersMap.find(regName);
-        if (it != writerUsedRegistersMap.end()) {
-            for (auto regSpecificDataMap : it->second) {
-                uint32_t subval = (regVal >> regSpecificDataMap.shift) & regSpecificDataMap.mask;
-                regInfoVec.push_back(RegInfo(regSpecificDataMap.field_name, regSpecificDataMap.bit_range, subval));
-            }
-        } else {
-            return { RegInfo("", "", 0) };
+        if (mAieGeneration == 1) {
+          table = getAIE1RegisterFields();
+          names = getAIE1RegisterNames();
+        }
+        else if (mAieGeneration == 5) {
+          table = getAIE2PSRegisterFields();
+          names = getAIE2psRegisterNames();
+        }
+        else if ((mAieGeneration > 1) && (mAieGeneration <= 9)) {
+          table = getAIE2RegisterFields();
+          names = getAIE2RegisterNames();
         }
 
-        return regInfoVec;
+        fieldsById.reserve(names.size());
+        for (uint16_t id = 0; id < names.size(); ++id)
+          fieldsById.push_back(registerFields(std::string(names.getName(id))));
     }
 
-} // end namespace xdp
-
+    RegisterInterpreter::FieldRange
+    RegisterInterpreter::registerFields(uint16_t id) const
+    {
+        if (id >= fieldsById.size())
+          return { nullptr, nullptr };
+        return fieldsById[id];
+    }
 
+    const char* RegisterInterpreter::registerName(uint16_t id) const
+    {
+        if (id >= names.size())
+          return "";
+        return names.getName(id);
+    }
 
+    RegisterInterpreter::FieldRange
+    RegisterInterpreter::registerFields(const std::string& regName) const
+    {
+        const RegisterField* first = table.fields;
+        const RegisterField* last = table.fields + table.size;
+        if (first == nullptr)
+          return { nullptr, nullptr };
 
+        const char* name = regName.c_str();
+        auto begin = std::lower_bound(first, last, name,
+          [](const RegisterField& field, const char* n) {
+            return compareRegisterNames(field.register_name, n) < 0;
+          });
+        auto end = std::upper_bound(begin, last, name,
+          [](const char* n, const RegisterField& field) {
+            return compareRegisterNames(n, field.register_name) < 0;
+          });
+        return { begin, end };
+    }
 
+} // end namespace xdp
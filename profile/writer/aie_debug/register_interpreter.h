@@ -1,5 +1,5 @@
 /**
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -20,6 +20,7 @@
 #include "xdp/profile/writer/aie_debug/aie_debug_writer_metadata.h"
 #include <string>
 #include <cstdint>
+#include <vector>
 
 namespace xdp {
 class RegisterInterpreter {
@@ -29,19 +30,30 @@ class RegisterInterpreter {
     
     ~RegisterInterpreter()=default;
 
-    struct RegInfo {
-      std::string field_name;
-      std::string bit_range;
-      uint32_t subval;
+    // The fields of one register, in the static table of the generation
+    struct FieldRange {
+      const RegisterField* first;
+      const RegisterField* last;
 
-      RegInfo(std::string f, std::string b, uint32_t s)
-        : field_name(f), bit_range(b), subval(s) {}
+      const RegisterField* begin() const { return first; }
+      const RegisterField* end() const { return last; }
+      bool empty() const { return first == last; }
     };
 
-    std::vector<RegInfo> registerInfo(const std::string &regName, const uint64_t &regAddr, const uint32_t &regVal);
+    // Empty if the register is not known for this generation.  The value
+    //  of each field is RegisterField::extract of the register value.
+    FieldRange registerFields(const std::string& regName) const;
+
+    // Same as above for a register id from the AIE debug plugin's register
+    //  table.  These are looked up once when the interpreter is created.
+    FieldRange registerFields(uint16_t id) const;
+    // Empty if the id is not in the register table
+    const char* registerName(uint16_t id) const;
 
   private:
-    std::unique_ptr<WriterUsedRegisters> writerUsedRegisters;
+    RegisterFieldTable table = { nullptr, 0 };
+    RegisterNameTable names;
+    std::vector<FieldRange> fieldsById;
     int mAieGeneration;
     uint64_t mDeviceIndex;
   };
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2020-2021 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -136,17 +136,22 @@ namespace xdp {
       this->mHeaderWritten = true;
     }
 
-    // Write all data elements
-    std::vector<counters::Sample> samples =
-      db->getDynamicInfo().moveAIESamples(mDeviceID);
-
-    for (auto& sample : samples) {
-      fout << sample.timestamp << ",";
-      for (auto value : sample.values) {
-        fout << value << ",";
-      }
-      fout << "\n";
-    }
+    // Write all data elements straight out of the database
+    db->getDynamicInfo().consumeAIESamples(mDeviceID,
+      [this](const counters::AIESample* samples, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+          auto& sample = samples[i];
+          fout << sample.timestamp   << ","
+               << +sample.column     << ","
+               << +sample.row        << ","
+               << sample.startEvent  << ","
+               << sample.endEvent    << ","
+               << sample.resetEvent  << ","
+               << sample.value       << ","
+               << sample.timer       << ","
+               << sample.payload     << ",\n";
+        }
+      });
     fout.flush();
     return true;
   }
@@ -0,0 +1,123 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#define XDP_PLUGIN_SOURCE
+
+#include <algorithm>
+#include <cstring>
+
+#include "xdp/profile/writer/aie_trace/aie_trace_stream_sink.h"
+#include "xdp/profile/writer/aie_trace/aie_trace_writer.h"
+
+namespace xdp {
+
+  AIETraceStreamSink::AIETraceStreamSink(const std::vector<AIETraceWriter*>& streamWriters,
+                                         std::size_t numBlocks,
+                                         uint64_t blockBytes)
+    : writers(streamWriters),
+      // Blocks hold whole 32-bit trace words
+      blockSize(std::max<uint64_t>(blockBytes & ~static_cast<uint64_t>(3), 4))
+  {
+    if (numBlocks == 0)
+      numBlocks = 1;
+
+    // The memory for a block is only allocated once it is needed
+    blocks.resize(numBlocks);
+    for (std::size_t i = numBlocks; i > 0; --i)
+      freeBlocks.push_back(i - 1);
+
+    writerThread = std::thread(&AIETraceStreamSink::writeBlocks, this);
+  }
+
+  AIETraceStreamSink::~AIETraceStreamSink()
+  {
+    flush();
+    {
+      std::lock_guard<std::mutex> lock(sinkLock);
+      stopping = true;
+    }
+    blockFilled.notify_all();
+    if (writerThread.joinable())
+      writerThread.join();
+  }
+
+  void AIETraceStreamSink::append(uint64_t strmIndex, const void* buffer,
+                                  uint64_t bufferSz)
+  {
+    auto data = static_cast<const unsigned char*>(buffer);
+    while (bufferSz > 0) {
+      std::size_t index = 0;
+      {
+        std::unique_lock<std::mutex> lock(sinkLock);
+        blockFree.wait(lock, [this]() { return !freeBlocks.empty(); });
+        index = freeBlocks.back();
+        freeBlocks.pop_back();
+      }
+
+      // Only this thread touches the block until it is queued
+      auto& block = blocks[index];
+      if (!block.data)
+        block.data = std::make_unique<unsigned char[]>(blockSize);
+      auto size = std::min(bufferSz, blockSize);
+      std::memcpy(block.data.get(), data, size);
+      block.stream = strmIndex;
+      block.size = size;
+
+      {
+        std::lock_guard<std::mutex> lock(sinkLock);
+        filledBlocks.push_back(index);
+      }
+      blockFilled.notify_one();
+
+      data += size;
+      bufferSz -= size;
+    }
+  }
+
+  void AIETraceStreamSink::flush()
+  {
+    std::unique_lock<std::mutex> lock(sinkLock);
+    drained.wait(lock, [this]() { return filledBlocks.empty() && numWriting == 0; });
+  }
+
+  void AIETraceStreamSink::writeBlocks()
+  {
+    std::unique_lock<std::mutex> lock(sinkLock);
+    while (true) {
+      blockFilled.wait(lock, [this]() { return stopping || !filledBlocks.empty(); });
+      if (filledBlocks.empty())
+        return;
+
+      auto index = filledBlocks.front();
+      filledBlocks.pop_front();
+      ++numWriting;
+      lock.unlock();
+
+      auto& block = blocks[index];
+      if (block.stream < writers.size() && writers[block.stream])
+        writers[block.stream]->writeChunk(block.data.get(), block.size);
+
+      lock.lock();
+      --numWriting;
+      freeBlocks.push_back(index);
+      blockFree.notify_one();
+      if (filledBlocks.empty() && numWriting == 0)
+        drained.notify_all();
+    }
+  }
+
+} // end namespace xdp
@@ -0,0 +1,91 @@
+/**
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"). You may
+ * not use this file except in compliance with the License. A copy of the
+ * License is located at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ */
+
+
+#ifndef AIE_TRACE_STREAM_SINK_DOT_H
+#define AIE_TRACE_STREAM_SINK_DOT_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "xdp/profile/database/events/creator/aie_trace_data_logger.h"
+
+namespace xdp {
+
+  class AIETraceWriter;
+
+  // Writes AIE trace to the per-stream trace files as it is offloaded, so
+  //  it doesn't build up in memory until the writers run.  Offloaded data
+  //  is copied into one of a fixed set of reusable blocks and a
+  //  background thread writes the blocks out in order.  When every block
+  //  is waiting to be written, offload waits for one to free up, so
+  //  memory stays bounded however long the run is.
+  class AIETraceStreamSink : public AIETraceSink
+  {
+  public:
+    static constexpr std::size_t DEFAULT_NUM_BLOCKS = 8;
+    static constexpr uint64_t DEFAULT_BLOCK_SIZE = 0x400000; // 4 MB
+
+  private:
+    struct Block
+    {
+      uint64_t stream = 0;
+      uint64_t size = 0;
+      std::unique_ptr<unsigned char[]> data;
+    };
+
+    // Index is the stream
+    std::vector<AIETraceWriter*> writers;
+    uint64_t blockSize;
+
+    std::mutex sinkLock;  // Protects everything below
+    std::condition_variable blockFree;
+    std::condition_variable blockFilled;
+    std::condition_variable drained;
+    std::vector<Block> blocks;
+    std::vector<std::size_t> freeBlocks;
+    std::deque<std::size_t> filledBlocks;
+    std::size_t numWriting = 0;
+    bool stopping = false;
+
+    std::thread writerThread;
+
+    void writeBlocks();
+
+  public:
+    AIETraceStreamSink(const std::vector<AIETraceWriter*>& streamWriters,
+                       std::size_t numBlocks = DEFAULT_NUM_BLOCKS,
+                       uint64_t blockBytes = DEFAULT_BLOCK_SIZE);
+    ~AIETraceStreamSink();
+
+    AIETraceStreamSink(const AIETraceStreamSink&) = delete;
+    AIETraceStreamSink& operator=(const AIETraceStreamSink&) = delete;
+
+    virtual void append(uint64_t strmIndex, const void* buffer, uint64_t bufferSz);
+
+    // Wait until everything appended so far is in the files
+    void flush();
+  };
+
+} // end namespace xdp
+
+#endif
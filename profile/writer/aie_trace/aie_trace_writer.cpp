@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
- * Copyright (C) 2022-2023 Advanced Micro Devices, Inc. - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -15,32 +15,55 @@
  * under the License.
  */
 
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
 #include "core/common/error.h"
 #include "core/common/message.h"
 
+#include "xdp/profile/database/dynamic_info/aie_trace_buffer_pool.h"
 #include "xdp/profile/writer/aie_trace/aie_trace_writer.h"
 
 namespace xdp {
 
   // 10 Megabytes or 2.5M words
   constexpr uint64_t LARGE_DATA_WARN_THRESHOLD = 0xA00000;
-  bool AIETraceWriter::largeDataWarning = false;
+  std::atomic<bool> AIETraceWriter::largeDataWarning{false};
 
   AIETraceWriter::AIETraceWriter(const char* filename, uint64_t devId, uint64_t trStrmId,
                                  const std::string& version, 
                                  const std::string& creationTime, 
                                  const std::string& /*xrtV*/, 
                                  const std::string& /*toolV*/,
-                                 io_type oType)
+                                 io_type oType,
+                                 bool binary,
+                                 uint64_t bufferSize)
     : VPTraceWriter(filename, version, creationTime, 6 /* us */),
       deviceId(devId),
       traceStreamId(trStrmId),
-      offloadType(oType)
+      offloadType(oType),
+      binaryFormat(binary)
 #if 0
       xrtVersion(xrtV),
       toolVersion(toolV)
 #endif
   {
+    // The base class opens the file for text with the default buffer.
+    //  A larger buffer turns the many small writes of text output into
+    //  fewer, bigger ones, but it has to be set before the file is opened.
+    if ((binaryFormat || bufferSize > 0) && fout.is_open()) {
+      fout.close();
+      fout.clear();
+      if (bufferSize > 0) {
+        fileBuffer.resize(bufferSize);
+        fout.rdbuf()->pubsetbuf(fileBuffer.data(), static_cast<std::streamsize>(bufferSize));
+      }
+      auto mode = std::ios::out | std::ios::trunc;
+      if (binaryFormat)
+        mode |= std::ios::binary;
+      fout.open(getcurrentFileName(), mode);
+    }
   }
 
   AIETraceWriter::~AIETraceWriter()
@@ -52,7 +75,26 @@ namespace xdp {
               + ", stream #" + std::to_string(traceStreamId) + ") trace data was not captured.";
           xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", msg);
         }
-        fout << std::endl;
+        if (!binaryFormat)
+          fout << std::endl;
+        // The stream buffer is owned here and goes away before the base
+        //  class closes the file
+        if (!fileBuffer.empty())
+          fout.close();
+      }
+
+      if (decoder) {
+        std::stringstream msg;
+        msg << "AIE trace stream " << traceStreamId << " of device " << deviceId
+            << ": decoded " << decoder->getNumEvents() << " events in "
+            << decoder->getNumPackets() << " packets from "
+            << decoder->getTiles().size() << " modules ("
+            << decoder->getNumInvalidWords() << " words skipped, "
+            << decoder->getNumUnknownFrames() << " unknown frames)";
+        xrt_core::message::send(xrt_core::message::severity_level::debug, "XRT", msg.str());
+
+        std::ofstream summary(summaryFileName);
+        decodedSummary.write(summary);
       }
     } catch (...){
       std::string msg = "Trace File: " + getcurrentFileName() + " not found.";
@@ -86,14 +128,14 @@ namespace xdp {
       return;
     }
 
-    if (!largeDataWarning) {
+    // Only formatting every word as text is slow enough to warn about
+    if (!binaryFormat && !largeDataWarning.load()) {
       uint64_t traceBytes = 0;
       for (size_t j = 0; j < num; j++)
         traceBytes += traceData->bufferSz[j];
-      if (traceBytes > LARGE_DATA_WARN_THRESHOLD) {
+      if (traceBytes > LARGE_DATA_WARN_THRESHOLD && !largeDataWarning.exchange(true)) {
         std::string msg = "Writing large amount of AIE trace. This could take a while.";
         xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", msg);
-        largeDataWarning = true;
       }
     }
 
@@ -102,27 +144,84 @@ namespace xdp {
       if (nullptr == buf)
         continue;
 
-      // We write 4 bytes at a time
-      // Max chunk size should be multiple of 4
-      // If last chunk is not multiple of 4 then in worst case, 
-      // 3 bytes of data will not be written. But this is not possible, as we always write full packet.
-      uint64_t bufferSz = (traceData->bufferSz[j] / 4);
-
-      uint32_t* dataBuffer = static_cast<uint32_t*>(buf);
-      for (uint64_t i = 0; i < bufferSz; i++)
-      {
-        fout << "0x" << std::hex << dataBuffer[i] << '\n';
-      }
-      fout.flush();
-
+      writeChunk(buf, traceData->bufferSz[j]);
 
-      // Free the memory immediately if we own it
+      // Recycle the memory immediately if we own it
       if (traceData->owner)
-        delete[] (traceData->buffer[j]);
+        AIETraceBufferPool::release(traceData->buffer[j], traceData->bufferSz[j]);
     }
     delete traceData;
   }
 
+  void AIETraceWriter::writeChunk(const void* buf, uint64_t bytes)
+  {
+    // We write 4 bytes at a time
+    // Max chunk size should be multiple of 4
+    // If last chunk is not multiple of 4 then in worst case, 
+    // 3 bytes of data will not be written. But this is not possible, as we always write full packet.
+    uint64_t numWords = bytes / 4;
+
+    if (binaryFormat)
+      writeBinaryChunk(buf, numWords * 4);
+    else
+      writeTextChunk(static_cast<const uint32_t*>(buf), numWords);
+
+    if (decoder) {
+      decoder->decode(static_cast<const uint32_t*>(buf), numWords);
+      decodedSummary.add(decoder->takeEvents());
+    }
+  }
+
+  void AIETraceWriter::enableDecoding()
+  {
+    auto hwGen = (db->getStaticInfo()).getAIEGeneration(deviceId);
+    if (!AIETraceDecoder::isSupported(hwGen)) {
+      std::string msg = "AIE trace decoding is not supported on AIE hardware generation "
+                        + std::to_string(hwGen) + ". Trace is written without decoding.";
+      xrt_core::message::send(xrt_core::message::severity_level::warning, "XRT", msg);
+      return;
+    }
+
+    decoder = std::make_unique<AIETraceDecoder>(hwGen);
+    auto cfgTiles = (db->getStaticInfo()).getAIECfgTiles(deviceId);
+    if (cfgTiles != nullptr)
+      decoder->configure(*cfgTiles);
+
+    auto traceFileName = getcurrentFileName();
+    summaryFileName = traceFileName.substr(0, traceFileName.rfind('.')) + "_decoded.csv";
+    db->addOpenedFile(summaryFileName, "AIE_EVENT_TRACE_DECODED_SUMMARY", deviceId);
+  }
+
+  void AIETraceWriter::writeBinaryChunk(const void* buf, uint64_t bytes)
+  {
+    if (bytes == 0)
+      return;
+
+    if (!binaryHeaderWritten) {
+      char header[sizeof(BINARY_MAGIC) + 2 * sizeof(uint32_t)];
+      uint32_t wordSize = sizeof(uint32_t);
+      std::memcpy(header, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+      std::memcpy(header + sizeof(BINARY_MAGIC), &BINARY_VERSION, sizeof(uint32_t));
+      std::memcpy(header + sizeof(BINARY_MAGIC) + sizeof(uint32_t), &wordSize, sizeof(uint32_t));
+      fout.write(header, sizeof(header));
+      binaryHeaderWritten = true;
+    }
+
+    // The whole buffer goes out in one write instead of word by word
+    fout.write(reinterpret_cast<const char*>(&bytes), sizeof(bytes));
+    fout.write(static_cast<const char*>(buf), static_cast<std::streamsize>(bytes));
+    fout.flush();
+  }
+
+  void AIETraceWriter::writeTextChunk(const uint32_t* words, uint64_t numWords)
+  {
+    for (uint64_t i = 0; i < numWords; i++)
+    {
+      fout << "0x" << std::hex << words[i] << '\n';
+    }
+    fout.flush();
+  }
+
   void AIETraceWriter::writeDependencies()
   {
   }
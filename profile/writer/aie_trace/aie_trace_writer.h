@@ -1,5 +1,6 @@
 /**
  * Copyright (C) 2016-2020 Xilinx, Inc
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -17,20 +18,37 @@
 #ifndef AIE_TRACE_WRITER_H
 #define AIE_TRACE_WRITER_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "xdp/profile/device/aie_trace_decoder.h"
 #include "xdp/profile/writer/vp_base/vp_trace_writer.h"
 #include "xdp/profile/database/database.h"
 
 namespace xdp {
 
-  // This is for AIE Trace 
+  // This is for AIE Trace.  By default every 32-bit trace word is written
+  //  as a hex string on its own line.  In binary format the file starts
+  //  with BINARY_MAGIC and two 32-bit values, the format version and the
+  //  word size in bytes.  Every offloaded buffer follows as a 64-bit byte
+  //  count and the raw trace words.  All values are in host byte order.
   class AIETraceWriter : public VPTraceWriter
   {
+  public:
+    static constexpr char BINARY_MAGIC[8] = {'A','I','E','T','R','A','C','E'};
+    static constexpr uint32_t BINARY_VERSION = 1;
+
   private:
     AIETraceWriter() = delete ;
 
-    static bool largeDataWarning;
+    // Writers of different streams may run at the same time
+    static std::atomic<bool> largeDataWarning;
+
+    void writeBinaryChunk(const void* buf, uint64_t bytes);
+    void writeTextChunk(const uint32_t* words, uint64_t numWords);
 
 #if 0
     // Header information 
@@ -41,6 +59,18 @@ namespace xdp {
    uint64_t deviceId;
    uint64_t traceStreamId;
    io_type  offloadType;
+   bool     binaryFormat;
+   bool     binaryHeaderWritten = false;
+
+   // Replaces the default stream buffer when a buffer size is given
+   std::vector<char> fileBuffer;
+
+   // Only set when trace is also decoded as it is written.  Decoded
+   //  events are folded into the summary after every chunk and the
+   //  summary is written next to the trace file.
+   std::unique_ptr<AIETraceDecoder> decoder;
+   AIETraceEventSummary decodedSummary;
+   std::string summaryFileName;
 
   protected:
     virtual void writeHeader();
@@ -55,10 +85,22 @@ namespace xdp {
 		   const std::string& creationTime, 
 		   const std::string& xrtV,
 		   const std::string& toolV,
-       io_type oType);
+       io_type oType,
+       bool binary = false,
+       uint64_t bufferSize = 0);
     ~AIETraceWriter();
 
     virtual bool write(bool openNewFile);
+
+    // Append one buffer of raw trace to the file in the current format
+    void writeChunk(const void* buf, uint64_t bytes);
+
+    // Also decode every buffer written into per tile events, using the
+    //  trace configuration of the device, and write a summary of them.
+    //  Warns and leaves decoding off if the device's AIE generation is
+    //  not supported.
+    void enableDecoding();
+    inline const AIETraceDecoder* getDecoder() const { return decoder.get(); }
   };
 
 }
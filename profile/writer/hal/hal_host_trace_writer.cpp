@@ -78,13 +78,8 @@ namespace xdp {
   {
     fout << "EVENTS\n";
     std::vector<VTFEvent*> HALAPIEvents = 
-      db->getDynamicInfo().copySortedHostEvents( [](VTFEvent* e)
-                                                 {
-                                                   return e->isHostEvent()  &&
-                                                          !e->isOpenCLAPI() &&
-                                                          !e->isLOPHostEvent();
-                                                 }
-                                               );
+      db->getDynamicInfo().copySortedHostEvents(
+        CategoryFilter{CATEGORY_HOST, CATEGORY_OPENCL_API | CATEGORY_LOP_HOST});
     for (auto e : HALAPIEvents) {
       VTFEventType eventType = e->getEventType();
       e->dump(fout, eventTypeBucketIdMap[eventType]) ;
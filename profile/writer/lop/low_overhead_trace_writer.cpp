@@ -99,12 +99,8 @@ namespace xdp {
   {
     fout << "EVENTS\n";
     auto APIEvents = 
-      (db->getDynamicInfo()).moveSortedHostEvents( [](VTFEvent* e)
-                                                   {
-                                                     return e->isLOPAPI() ||
-                                                            e->isLOPHostEvent();
-                                                   }
-                                                  );
+      (db->getDynamicInfo()).moveSortedHostEvents(
+        CategoryFilter{CATEGORY_LOP_API | CATEGORY_LOP_HOST, 0});
     for (auto& e : APIEvents) {
       int bucket = 0 ;
       if (e->isOpenCLAPI() && (dynamic_cast<OpenCLAPICall*>(e.get()) != nullptr)) {
@@ -132,15 +128,8 @@ namespace xdp {
 
   bool LowOverheadTraceWriter::traceEventsExist()
   {
-    return (
-      db->getDynamicInfo().hostEventsExist (
-        [](VTFEvent* e)
-        {
-          return e->isOpenCLAPI() ||
-                 e->isLOPHostEvent() ;
-        }
-      )
-    );
+    return db->getDynamicInfo().hostEventsExist(
+      CategoryFilter{CATEGORY_OPENCL_API | CATEGORY_LOP_HOST, 0});
   }
 
   bool LowOverheadTraceWriter::write(bool openNewFile)
@@ -62,10 +62,7 @@ namespace xdp {
   {
     std::vector<VTFEvent*> APIEvents =
       (db->getDynamicInfo()).moveUnsortedHostEvents(
-        [](VTFEvent* e)
-        {
-          return e->isNativeHostEvent();
-        } ) ;
+        CategoryFilter{CATEGORY_NATIVE_HOST, 0});
 
     std::sort(APIEvents.begin(), APIEvents.end(),
               [](VTFEvent* x, VTFEvent* y)
@@ -113,11 +113,8 @@ namespace xdp {
   {
     fout << "EVENTS\n";
     auto APIEvents = 
-      (db->getDynamicInfo()).moveSortedHostEvents( [](VTFEvent* e)
-                                                   {
-                                                     return e->isOpenCLHostEvent();
-                                                   }
-                                                 );
+      (db->getDynamicInfo()).moveSortedHostEvents(
+        CategoryFilter{CATEGORY_OPENCL_HOST, 0});
     for (auto& e : APIEvents) {
       int bucket = 0 ;
       if (e->isOpenCLAPI() && (dynamic_cast<OpenCLAPICall*>(e.get()) != nullptr)) {
@@ -203,14 +200,8 @@ namespace xdp {
 
   bool OpenCLTraceWriter::traceEventsExist()
   {
-    return (
-      db->getDynamicInfo().hostEventsExist (
-        [](VTFEvent* e)
-        {
-          return e->isOpenCLHostEvent();
-        }
-      )
-    );
+    return db->getDynamicInfo().hostEventsExist(
+      CategoryFilter{CATEGORY_OPENCL_HOST, 0});
   }
 
   bool OpenCLTraceWriter::write(bool openNewFile)
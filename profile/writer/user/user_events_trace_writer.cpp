@@ -62,11 +62,8 @@ namespace xdp {
   {
     fout << "EVENTS\n";
     std::vector<VTFEvent*> userEvents = 
-      db->getDynamicInfo().copySortedHostEvents( [](VTFEvent* e)
-                                                 {
-                                                   return e->isUserEvent();
-                                                 }
-                                               );
+      db->getDynamicInfo().copySortedHostEvents(
+        CategoryFilter{CATEGORY_USER, 0});
     for (auto e : userEvents)
       e->dump(fout, bucketId) ;
   }
@@ -1,6 +1,6 @@
 /**
  * Copyright (C) 2016-2022 Xilinx, Inc
- * Copyright (C) 2022-2024 Advanced Micro Devices, Inc - All rights reserved
+ * Copyright (C) 2022-2026 Advanced Micro Devices, Inc - All rights reserved
  *
  * Licensed under the Apache License, Version 2.0 (the "License"). You may
  * not use this file except in compliance with the License. A copy of the
@@ -190,21 +190,13 @@ namespace xdp {
   void
   SummaryWriter::writeAPICalls(APIType type)
   {
-    // For each function call, across all of the threads,
-    //  consolidate all the information into what we need
-    std::map<std::string,
-             std::tuple<uint64_t,
-                        double,
-                        double,
-                        double> > rows ;
-
-    std::map<std::pair<std::string, std::thread::id>,
-             std::vector<std::pair<double, double>>> callCount =
-      (db->getStats()).getCallCount() ;
-
-    for (const auto& call : callCount) {
-      auto callAndThread = call.first ;
-      auto APIName = callAndThread.first ;
+    // The statistics of each function call have already been
+    //  consolidated across all of the threads
+    std::map<std::string, APICallStatistics> callStats =
+      (db->getStats()).getCallStatistics() ;
+
+    for (const auto& call : callStats) {
+      auto& APIName = call.first ;
 
       switch (type) {
       case OPENCL:
@@ -221,47 +213,43 @@ namespace xdp {
         break ;
       }
 
-      std::vector<std::pair<double, double>> timesOfCalls = call.second ;
-
-      if (rows.find(APIName) == rows.end()) {
-        std::tuple<uint64_t, double, double, double> blank =
-          std::make_tuple<uint64_t, double, double, double>(0,0,std::numeric_limits<double>::max(),0) ;
-
-        rows[APIName] = blank ;
-      }
-
-      for (const auto& executionTime : timesOfCalls) {
-        auto timeTaken = executionTime.second - executionTime.first ;
-
-        ++(std::get<0>(rows[APIName])) ;
-        std::get<1>(rows[APIName]) += timeTaken ;
-        if (timeTaken < std::get<2>(rows[APIName]))
-          std::get<2>(rows[APIName]) = timeTaken ;
-        if (timeTaken > std::get<3>(rows[APIName]))
-          std::get<3>(rows[APIName]) = timeTaken ;
-      }
-    }
-
-    for (const auto& row : rows) {
+      auto& stats = call.second ;
       auto averageTime =
-        static_cast<double>(std::get<1>(row.second)) / static_cast<double>(std::get<0>(row.second)) ;
+        stats.totalTime / static_cast<double>(stats.count) ;
       if (type != OPENCL) fout << "ENTRY:" ;
-      fout << row.first                      << ","     // API Name
-           << std::get<0>(row.second)        << ","     // Number of calls
-           << (std::get<1>(row.second)/one_million) << ","     // Total time
-           << (std::get<2>(row.second)/one_million) << ","     // Minimum time
-           << (averageTime/one_million)             << ","     // Average time
-           << (std::get<3>(row.second)/one_million) << ",\n" ; // Maximum time
+      fout << APIName                                      << ","     // API Name
+           << stats.count                                  << ","     // Number of calls
+           << (stats.totalTime/one_million)                << ","     // Total time
+           << (stats.minTime/one_million)                  << ","     // Minimum time
+           << (averageTime/one_million)                    << ","     // Average time
+           << (stats.maxTime/one_million)                  << ","     // Maximum time
+           << (stats.percentile(0.5)/one_million)   << ","  // P50 time
+           << (stats.percentile(0.9)/one_million)   << ","  // P90 time
+           << (stats.percentile(0.99)/one_million)  << ","  // P99 time
+           << (stats.percentile(0.999)/one_million) << ",\n" ; // P99.9 time
     }
   }
 
+  void SummaryWriter::writeAPIPercentileColumns()
+  {
+    fout << "COLUMN:<html>P50<br>Time (ms)</html>,float,"
+         << "Median execution time (in ms),\n";
+    fout << "COLUMN:<html>P90<br>Time (ms)</html>,float,"
+         << "90th percentile execution time (in ms),\n";
+    fout << "COLUMN:<html>P99<br>Time (ms)</html>,float,"
+         << "99th percentile execution time (in ms),\n";
+    fout << "COLUMN:<html>P99.9<br>Time (ms)</html>,float,"
+         << "99.9th percentile execution time (in ms),\n";
+  }
+
   void SummaryWriter::writeOpenCLAPICalls()
   {
     // Title
     fout << "OpenCL API Calls\n" ;
     // Columns
     fout << "API Name,Number Of Calls,Total Time (ms),Minimum Time (ms),"
-         << "Average Time (ms),Maximum Time (ms),\n" ;
+         << "Average Time (ms),Maximum Time (ms),P50 Time (ms),"
+         << "P90 Time (ms),P99 Time (ms),P99.9 Time (ms),\n" ;
     writeAPICalls(OPENCL) ;
   }
 
@@ -280,6 +268,7 @@ namespace xdp {
          << "Average execution time (in ms),\n";
     fout << "COLUMN:<html>Maximum<br>Time (ms)</html>,float,"
          << "Maximum execution time (in ms),\n";
+    writeAPIPercentileColumns() ;
     writeAPICalls(NATIVE) ;
   }
 
@@ -298,6 +287,7 @@ namespace xdp {
          << "Average execution time (in ms),\n";
     fout << "COLUMN:<html>Maximum<br>Time (ms)</html>,float,"
          << "Maximum execution time (in ms),\n";
+    writeAPIPercentileColumns() ;
     writeAPICalls(HAL) ;
   }
 